@@ -27,6 +27,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -73,6 +74,11 @@ protected:
         {
             iface_addresses_ = CommonHelpers::splitInterfaceAddresses(iface_addresses_str);
         }
+        // Enables kernel-side TX deadlines (`SO_TXTIME` + ETF qdisc), like "1". Default is disabled.
+        if (const auto* const tx_deadlines_str = std::getenv("CYPHAL__TX_DEADLINES"))
+        {
+            tx_deadlines_ = std::strtol(tx_deadlines_str, nullptr, 10) != 0;
+        }
 
         startup_time_ = executor_.now();
     }
@@ -110,6 +116,7 @@ protected:
     NodeId                            local_node_id_{42};
     Duration                          run_duration_{10s};
     std::vector<std::string>          iface_addresses_{"127.0.0.1"};
+    bool                              tx_deadlines_{false};
     // NOLINTEND
 
 };  // Example_0_Transport_1_Heartbeat_GetInfo_Udp
@@ -123,6 +130,7 @@ TEST_F(Example_0_Transport_1_Heartbeat_GetInfo_Udp, main)
     // Make UDP transport with collection of media.
     //
     state.media_collection_.make(mr_, executor_, iface_addresses_);
+    state.media_collection_.setTxDeadlines(tx_deadlines_);
     CommonHelpers::Udp::makeTransport(state, mr_, executor_, local_node_id_);
 
     // Publish/Subscribe heartbeats.
@@ -143,6 +151,12 @@ TEST_F(Example_0_Transport_1_Heartbeat_GetInfo_Udp, main)
         //
         state.get_info_.receive(now);
     });
+
+    if (tx_deadlines_)
+    {
+        const auto drops = state.media_collection_.getTxTimeDrops();
+        std::cout << "TX deadline drops: missed=" << drops.missed << ", invalid=" << drops.invalid << "\n";
+    }
 }
 
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
@@ -27,6 +27,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <iostream>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -77,6 +78,11 @@ protected:
         {
             iface_addresses_ = CommonHelpers::splitInterfaceAddresses(iface_addresses_str);
         }
+        // Enables kernel-side TX deadlines (`SO_TXTIME` + ETF qdisc), like "1". Default is disabled.
+        if (const auto* const tx_deadlines_str = std::getenv("CYPHAL__TX_DEADLINES"))
+        {
+            tx_deadlines_ = std::strtol(tx_deadlines_str, nullptr, 10) != 0;
+        }
 
         startup_time_ = executor_.now();
     }
@@ -112,6 +118,7 @@ protected:
     NodeId                                                local_node_id_{42};
     Duration                                              run_duration_{10s};
     std::vector<std::string>                              iface_addresses_{"vcan0"};
+    bool                                                  tx_deadlines_{false};
     // NOLINTEND
 
 };  // Example_0_Transport_2_Heartbeat_GetInfo_Can
@@ -128,6 +135,10 @@ TEST_F(Example_0_Transport_2_Heartbeat_GetInfo_Can, main)
     {
         GTEST_SKIP();
     }
+    if (tx_deadlines_ && !state.media_collection_.setTxDeadlines(true))
+    {
+        GTEST_SKIP();
+    }
     CommonHelpers::Can::makeTransport(state, mr_, executor_, local_node_id_);
 
     // Publish/Subscribe heartbeats.
@@ -148,6 +159,12 @@ TEST_F(Example_0_Transport_2_Heartbeat_GetInfo_Can, main)
         //
         state.get_info_.receive(now);
     });
+
+    if (tx_deadlines_)
+    {
+        const auto drops = state.media_collection_.getTxTimeDrops();
+        std::cout << "TX deadline drops: missed=" << drops.missed << ", invalid=" << drops.invalid << "\n";
+    }
 }
 
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
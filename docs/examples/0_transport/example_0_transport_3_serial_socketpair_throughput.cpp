@@ -0,0 +1,206 @@
+/// @file
+/// Example of running libcyphal serial transport over a byte stream (here - a local UNIX socket pair).
+/// This example demonstrates how to publish and subscribe raw messages using transport layer
+/// RX/TX message session classes, and measures throughput of the serial transport
+/// (in megabytes and frames per second) between two local nodes.
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/common_helpers.hpp"
+#include "platform/posix/posix_single_threaded_executor.hpp"
+#include "platform/posix/serial/serial_media.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/serial/serial_transport.hpp>
+#include <libcyphal/transport/serial/serial_transport_impl.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace example::platform;             // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport;          // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport::serial;  // NOLINT This our main concern here in this test.
+
+using Duration           = libcyphal::Duration;
+using TimePoint          = libcyphal::TimePoint;
+using SerialTransportPtr = libcyphal::UniquePtr<ISerialTransport>;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+using testing::Eq;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_0_Transport_3_Serial_SocketPair_Throughput : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        // Duration in seconds for which the test will run. Default is 3 seconds.
+        if (const auto* const run_duration_str = std::getenv("CYPHAL__RUN"))
+        {
+            run_duration_ = std::chrono::duration<std::int64_t>{std::strtoll(run_duration_str, nullptr, 10)};
+        }
+        // Size of the published message payload in bytes. Default is 256 bytes.
+        if (const auto* const payload_size_str = std::getenv("CYPHAL__SERIAL__PAYLOAD"))
+        {
+            payload_size_ = std::min<std::size_t>(std::strtoul(payload_size_str, nullptr, 10), ISerialTransport::Mtu);
+        }
+
+        startup_time_ = executor_.now();
+    }
+
+    void TearDown() override
+    {
+        executor_.releaseTemporaryResources();
+
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    SerialTransportPtr makeTransport(IMedia& media, const NodeId node_id)
+    {
+        auto maybe_transport = serial::makeTransport(mr_, executor_, media, TxCapacity);
+        EXPECT_THAT(maybe_transport, VariantWith<SerialTransportPtr>(NotNull()));
+        auto transport = cetl::get<SerialTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(transport->setLocalNodeId(node_id), Eq(cetl::nullopt));
+        return transport;
+    }
+
+    static constexpr std::size_t TxCapacity = 64;
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource            mr_;
+    posix::PollSingleThreadedExecutor executor_{mr_};
+    TimePoint                         startup_time_{};
+    Duration                          run_duration_{3s};
+    std::size_t                       payload_size_{256};
+    // NOLINTEND
+
+};  // Example_0_Transport_3_Serial_SocketPair_Throughput
+
+// MARK: - Tests:
+
+TEST_F(Example_0_Transport_3_Serial_SocketPair_Throughput, main)
+{
+    constexpr PortId TestSubjectId = 147;
+
+    auto maybe_media_pair = posix::SerialMedia::makeSocketPair(executor_);
+    ASSERT_THAT(maybe_media_pair, (VariantWith<std::pair<posix::SerialMedia, posix::SerialMedia>>(testing::_)));
+    auto media_pair = cetl::get<std::pair<posix::SerialMedia, posix::SerialMedia>>(std::move(maybe_media_pair));
+
+    // Publisher node on one end of the socket pair, and subscriber node on the other.
+    //
+    auto publisher_transport  = makeTransport(media_pair.first, 1);
+    auto subscriber_transport = makeTransport(media_pair.second, 2);
+
+    auto maybe_tx_session = publisher_transport->makeMessageTxSession({TestSubjectId});
+    ASSERT_THAT(maybe_tx_session, VariantWith<libcyphal::UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<libcyphal::UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    auto maybe_rx_session = subscriber_transport->makeMessageRxSession({payload_size_, TestSubjectId});
+    ASSERT_THAT(maybe_rx_session, VariantWith<libcyphal::UniquePtr<IMessageRxSession>>(NotNull()));
+    auto rx_session = cetl::get<libcyphal::UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+    std::size_t rx_transfers    = 0;
+    std::size_t rx_bytes        = 0;
+    TransferId  last_rx_tid     = 0;
+    std::size_t rx_out_of_order = 0;
+    rx_session->setOnReceiveCallback([&](const auto& arg) {
+        //
+        ++rx_transfers;
+        rx_bytes += arg.transfer.payload.size();
+        if ((rx_transfers > 1) && (arg.transfer.metadata.rx_meta.base.transfer_id != last_rx_tid + 1))
+        {
+            ++rx_out_of_order;
+        }
+        last_rx_tid = arg.transfer.metadata.rx_meta.base.transfer_id;
+    });
+
+    std::vector<cetl::byte> payload(payload_size_);
+    for (std::size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<cetl::byte>(i);
+    }
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    // Main loop - publish (up to the TX queue capacity per spin) as fast as the TX queue accepts,
+    // for the whole run duration.
+    //
+    TransferId  tx_transfer_id = 0;
+    std::size_t tx_rejected    = 0;
+    const auto  publish_until  = startup_time_ + run_duration_;
+    CommonHelpers::runMainLoop(executor_, publish_until + 500ms, [&](const auto now) {
+        //
+        for (std::size_t i = 0; (i < TxCapacity) && (now < publish_until); ++i)
+        {
+            const TransferTxMetadata metadata{{tx_transfer_id, Priority::Nominal}, now + 1s};
+            if (const auto failure = tx_session->send(metadata, fragments))
+            {
+                ++tx_rejected;
+                EXPECT_THAT(*failure, VariantWith<CapacityError>(testing::_));
+                break;
+            }
+            ++tx_transfer_id;
+        }
+    });
+
+    const auto   seconds   = std::chrono::duration<double>(run_duration_).count();
+    const double mb_per_s  = static_cast<double>(rx_bytes) / (1024.0 * 1024.0) / seconds;
+    const double frames_ps = static_cast<double>(rx_transfers) / seconds;
+    std::cout << "payload_size=" << payload_size_ << " bytes\n";
+    std::cout << "tx_transfers=" << tx_transfer_id << ", tx_queue_full=" << tx_rejected << "\n";
+    std::cout << "rx_transfers=" << rx_transfers << ", rx_out_of_order=" << rx_out_of_order << "\n";
+    std::cout << "throughput=" << mb_per_s << " MB/s, " << frames_ps << " frames/s\n";
+
+    const auto media_stats = subscriber_transport->getMediaStatistics(0);
+    ASSERT_TRUE(media_stats.has_value());
+    std::cout << "rx_media: received=" << media_stats->num_received << ", errored=" << media_stats->num_errored
+              << "\n";
+
+    // The stream is reliable, so nothing should be lost or corrupted.
+    EXPECT_THAT(rx_transfers, tx_transfer_id);
+    EXPECT_THAT(rx_out_of_order, 0);
+    EXPECT_THAT(media_stats->num_errored, 0);
+
+    rx_session.reset();
+    tx_session.reset();
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,292 @@
+/// @file
+/// Example of running libcyphal shared memory transport between two co-located nodes.
+/// This example measures round-trip latency (ping-pong of raw messages) and throughput of
+/// the shared memory transport, and then does the same over UDP loopback - for comparison.
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/common_helpers.hpp"
+#include "platform/linux/shm/shm_media.hpp"
+#include "platform/posix/posix_single_threaded_executor.hpp"
+#include "platform/posix/udp/udp_media.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/shm/segment.hpp>
+#include <libcyphal/transport/shm/shm_transport.hpp>
+#include <libcyphal/transport/shm/shm_transport_impl.hpp>
+#include <libcyphal/transport/transport.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace example::platform;     // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport;  // NOLINT This our main concern here in this test.
+
+using Duration        = libcyphal::Duration;
+using TimePoint       = libcyphal::TimePoint;
+using ShmTransportPtr = libcyphal::UniquePtr<shm::IShmTransport>;
+using UdpTransportPtr = libcyphal::UniquePtr<udp::IUdpTransport>;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+using testing::Eq;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_0_Transport_4_Linux_Shm_Vs_Udp_Loopback : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        // Duration in seconds for which each phase (latency & throughput) will run. Default is 2 seconds.
+        if (const auto* const run_duration_str = std::getenv("CYPHAL__RUN"))
+        {
+            run_duration_ = std::chrono::duration<std::int64_t>{std::strtoll(run_duration_str, nullptr, 10)};
+        }
+        // Size of the published message payload in bytes. Default is 256 bytes.
+        if (const auto* const payload_size_str = std::getenv("CYPHAL__PAYLOAD"))
+        {
+            payload_size_ = std::min<std::size_t>(std::strtoul(payload_size_str, nullptr, 10), MaxPayloadSize);
+        }
+    }
+
+    void TearDown() override
+    {
+        executor_.releaseTemporaryResources();
+
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    template <typename Session>
+    static libcyphal::UniquePtr<Session> getSession(
+        libcyphal::Expected<libcyphal::UniquePtr<Session>, AnyFailure>&& maybe_session)
+    {
+        EXPECT_THAT(maybe_session, VariantWith<libcyphal::UniquePtr<Session>>(NotNull()));
+        return cetl::get<libcyphal::UniquePtr<Session>>(std::move(maybe_session));
+    }
+
+    /// Ping-pong of messages between two nodes - "ping" node publishes next ping only when
+    /// the previous one has been echoed back by the "pong" node. Prints round-trip latency statistics.
+    ///
+    void runLatency(ITransport& ping_transport, ITransport& pong_transport)
+    {
+        constexpr PortId PingSubjectId = 147;
+        constexpr PortId PongSubjectId = 148;
+
+        auto ping_tx_session = getSession(ping_transport.makeMessageTxSession({PingSubjectId}));
+        auto ping_rx_session = getSession(ping_transport.makeMessageRxSession({payload_size_, PongSubjectId}));
+        auto pong_tx_session = getSession(pong_transport.makeMessageTxSession({PongSubjectId}));
+        auto pong_rx_session = getSession(pong_transport.makeMessageRxSession({payload_size_, PingSubjectId}));
+
+        const std::vector<cetl::byte>                     payload(payload_size_);
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+        // Echo every ping back.
+        pong_rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            const auto&              base = arg.transfer.metadata.rx_meta.base;
+            const TransferTxMetadata metadata{{base.transfer_id, base.priority}, executor_.now() + 1s};
+            EXPECT_THAT(pong_tx_session->send(metadata, fragments), Eq(cetl::nullopt));
+        });
+
+        CommonHelpers::RunningStats rtt_stats;
+        Duration                    worst_rtt{0};
+        TransferId                  ping_transfer_id = 0;
+        TimePoint                   ping_time{};
+        bool                        ping_in_flight = false;
+        std::size_t                 lost_pings     = 0;
+        ping_rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            if (ping_in_flight && (arg.transfer.metadata.rx_meta.base.transfer_id == ping_transfer_id))
+            {
+                const auto rtt = executor_.now() - ping_time;
+                worst_rtt      = std::max(worst_rtt, rtt);
+                rtt_stats.append(std::chrono::duration<double, std::micro>(rtt).count());
+                ping_in_flight = false;
+                ++ping_transfer_id;
+            }
+        });
+
+        const auto deadline = executor_.now() + run_duration_;
+        CommonHelpers::runMainLoop(executor_, deadline, [&](const auto now) {
+            //
+            if (ping_in_flight && (now - ping_time > 100ms))
+            {
+                // Lost ping (or pong) - start over with the next one.
+                ++lost_pings;
+                ++ping_transfer_id;
+                ping_in_flight = false;
+            }
+            if (!ping_in_flight && (now < deadline))
+            {
+                ping_time = executor_.now();
+                EXPECT_THAT(ping_tx_session->send({{ping_transfer_id, Priority::Nominal}, ping_time + 1s}, fragments),
+                            Eq(cetl::nullopt));
+                ping_in_flight = true;
+            }
+        });
+
+        std::cout << "round_trips=" << ping_transfer_id - lost_pings << ", lost=" << lost_pings << "\n";
+        std::cout << "rtt_mean=" << rtt_stats.mean() << "us, rtt_stddev=" << rtt_stats.standardDeviation()
+                  << "us, rtt_worst=" << std::chrono::duration_cast<std::chrono::microseconds>(worst_rtt).count()
+                  << "us\n";
+        EXPECT_THAT(lost_pings, 0);
+    }
+
+    /// Publishes messages (up to `Burst` transfers per spin of the executor) as fast as the transport accepts them,
+    /// and prints throughput as it's seen by the subscriber.
+    ///
+    void runThroughput(ITransport& publisher_transport, ITransport& subscriber_transport)
+    {
+        constexpr PortId TestSubjectId = 149;
+
+        auto tx_session = getSession(publisher_transport.makeMessageTxSession({TestSubjectId}));
+        auto rx_session = getSession(subscriber_transport.makeMessageRxSession({payload_size_, TestSubjectId}));
+
+        std::size_t rx_transfers = 0;
+        std::size_t rx_bytes     = 0;
+        rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            ++rx_transfers;
+            rx_bytes += arg.transfer.payload.size();
+        });
+
+        const std::vector<cetl::byte>                     payload(payload_size_);
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+        TransferId  tx_transfer_id = 0;
+        std::size_t tx_rejected    = 0;
+        const auto  publish_until  = executor_.now() + run_duration_;
+        CommonHelpers::runMainLoop(executor_, publish_until + 200ms, [&](const auto now) {
+            //
+            for (std::size_t i = 0; (i < Burst) && (now < publish_until); ++i)
+            {
+                const TransferTxMetadata metadata{{tx_transfer_id, Priority::Nominal}, now + 1s};
+                if (tx_session->send(metadata, fragments).has_value())
+                {
+                    ++tx_rejected;
+                    break;
+                }
+                ++tx_transfer_id;
+            }
+        });
+
+        const auto seconds = std::chrono::duration<double>(run_duration_).count();
+        std::cout << "tx_transfers=" << tx_transfer_id << ", tx_rejected=" << tx_rejected << "\n";
+        std::cout << "rx_transfers=" << rx_transfers << "\n";
+        std::cout << "throughput=" << static_cast<double>(rx_bytes) / (1024.0 * 1024.0) / seconds << " MB/s, "
+                  << static_cast<double>(rx_transfers) / seconds << " transfers/s\n";
+    }
+
+    static constexpr std::size_t MaxPayloadSize = 1024;
+    static constexpr std::size_t Burst          = 64;
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource            mr_;
+    posix::PollSingleThreadedExecutor executor_{mr_};
+    Duration                          run_duration_{2s};
+    std::size_t                       payload_size_{256};
+    // NOLINTEND
+
+};  // Example_0_Transport_4_Linux_Shm_Vs_Udp_Loopback
+
+// MARK: - Tests:
+
+TEST_F(Example_0_Transport_4_Linux_Shm_Vs_Udp_Loopback, shm)
+{
+    // Both nodes share the same segment. Ring capacity is equal to the publishing burst,
+    // so that the subscriber doesn't lose transfers between spins of the executor.
+    // There are enough slots for all rings to be full, plus one more burst in flight.
+    //
+    constexpr std::uint32_t      RingCount    = 4;
+    const std::string            segment_name = "/libcyphal_example_" + std::to_string(::getpid());
+    const shm::SegmentLayout     layout{(RingCount + 1) * Burst, MaxPayloadSize, RingCount, Burst};
+    std::vector<Linux::ShmMedia> media;
+    media.reserve(2);
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        auto maybe_media = Linux::ShmMedia::make(executor_, segment_name, layout);
+        ASSERT_THAT(maybe_media, VariantWith<Linux::ShmMedia>(testing::_));
+        media.emplace_back(cetl::get<Linux::ShmMedia>(std::move(maybe_media)));
+    }
+    media[0].unlink();
+    EXPECT_THAT(media[0].addPeer(media[1].getNotificationFd()), Eq(cetl::nullopt));
+    EXPECT_THAT(media[1].addPeer(media[0].getNotificationFd()), Eq(cetl::nullopt));
+
+    std::array<ShmTransportPtr, 2> transports;
+    for (std::size_t i = 0; i < transports.size(); ++i)
+    {
+        auto maybe_transport = shm::makeTransport(mr_, executor_, media[i]);
+        ASSERT_THAT(maybe_transport, VariantWith<ShmTransportPtr>(NotNull()));
+        transports[i] = cetl::get<ShmTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(transports[i]->setLocalNodeId(static_cast<NodeId>(i + 1)), Eq(cetl::nullopt));
+    }
+
+    std::cout << "Shared memory, payload_size=" << payload_size_ << " bytes\n";
+    runLatency(*transports[0], *transports[1]);
+    runThroughput(*transports[0], *transports[1]);
+}
+
+TEST_F(Example_0_Transport_4_Linux_Shm_Vs_Udp_Loopback, udp_loopback)
+{
+    std::vector<std::string> iface_addresses{"127.0.0.1"};
+
+    std::array<posix::UdpMedia::Collection, 2> media_collections;
+    std::array<UdpTransportPtr, 2>             transports;
+    for (std::size_t i = 0; i < transports.size(); ++i)
+    {
+        media_collections[i].make(mr_, executor_, iface_addresses);
+        auto maybe_transport = udp::makeTransport({mr_}, executor_, media_collections[i].span(), Burst);
+        ASSERT_THAT(maybe_transport, VariantWith<UdpTransportPtr>(NotNull()));
+        transports[i] = cetl::get<UdpTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(transports[i]->setLocalNodeId(static_cast<NodeId>(i + 1)), Eq(cetl::nullopt));
+        transports[i]->setTransientErrorHandler(CommonHelpers::Udp::transientErrorReporter);
+    }
+
+    std::cout << "UDP loopback, payload_size=" << payload_size_ << " bytes\n";
+    runLatency(*transports[0], *transports[1]);
+    runThroughput(*transports[0], *transports[1]);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,289 @@
+/// @file
+/// Example of running libcyphal CAN transport in Classic CAN and CAN FD modes over SocketCAN (like `vcan0`).
+/// This example demonstrates runtime switching of the media MTU (which is honored by the transport),
+/// and compares Classic CAN against CAN FD by transfer latency (ping-pong of raw messages), and by
+/// transfers and frames per second - for several typical payload sizes.
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/common_helpers.hpp"
+#include "platform/linux/can/can_media.hpp"
+#include "platform/linux/epoll_single_threaded_executor.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace example::platform;          // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport;       // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in this test.
+
+using Duration        = libcyphal::Duration;
+using TimePoint       = libcyphal::TimePoint;
+using CanTransportPtr = libcyphal::UniquePtr<ICanTransport>;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+using testing::Eq;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_0_Transport_5_Linux_Can_Classic_Vs_Fd : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        // Duration in seconds for which each measurement will run. Default is 1 second.
+        if (const auto* const run_duration_str = std::getenv("CYPHAL__RUN"))
+        {
+            run_duration_ = std::chrono::duration<std::int64_t>{std::strtoll(run_duration_str, nullptr, 10)};
+        }
+        // CAN FD capable interface address. Default is "vcan0".
+        if (const auto* const iface_address_str = std::getenv("CYPHAL__CAN__IFACE"))
+        {
+            iface_addresses_ = {iface_address_str};
+        }
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    /// Defines a node - its media collection (of a single interface) and CAN transport.
+    ///
+    struct Node
+    {
+        Linux::CanMedia::Collection media_collection;
+        CanTransportPtr             transport;
+    };
+
+    struct Result
+    {
+        double      rtt_mean_us;
+        double      transfers_per_second;
+        double      frames_per_second;
+        std::size_t lost_transfers;
+    };
+
+    bool makeNode(Node& node, const NodeId node_id)
+    {
+        if (!node.media_collection.make(mr_, executor_, iface_addresses_, mr_, {true, true}))
+        {
+            return false;
+        }
+
+        auto maybe_transport = can::makeTransport({mr_}, executor_, node.media_collection.span(), TxCapacity);
+        EXPECT_THAT(maybe_transport, VariantWith<CanTransportPtr>(NotNull()));
+        node.transport = cetl::get<CanTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(node.transport->setLocalNodeId(node_id), Eq(cetl::nullopt));
+        node.transport->setTransientErrorHandler(CommonHelpers::Can::transientErrorReporter);
+        return true;
+    }
+
+    template <typename Session>
+    static libcyphal::UniquePtr<Session> getSession(
+        libcyphal::Expected<libcyphal::UniquePtr<Session>, AnyFailure>&& maybe_session)
+    {
+        EXPECT_THAT(maybe_session, VariantWith<libcyphal::UniquePtr<Session>>(NotNull()));
+        return cetl::get<libcyphal::UniquePtr<Session>>(std::move(maybe_session));
+    }
+
+    /// Ping-pong of messages - the next ping is published only when the previous one has been echoed back.
+    ///
+    /// @return Mean round-trip time in microseconds.
+    ///
+    double runLatency(Node& ping_node, Node& pong_node, const std::size_t payload_size)
+    {
+        constexpr PortId PingSubjectId = 147;
+        constexpr PortId PongSubjectId = 148;
+
+        auto ping_tx_session = getSession(ping_node.transport->makeMessageTxSession({PingSubjectId}));
+        auto ping_rx_session = getSession(ping_node.transport->makeMessageRxSession({payload_size, PongSubjectId}));
+        auto pong_tx_session = getSession(pong_node.transport->makeMessageTxSession({PongSubjectId}));
+        auto pong_rx_session = getSession(pong_node.transport->makeMessageRxSession({payload_size, PingSubjectId}));
+
+        const std::vector<cetl::byte>                     payload(payload_size);
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+        pong_rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            const auto&              base = arg.transfer.metadata.rx_meta.base;
+            const TransferTxMetadata metadata{{base.transfer_id, base.priority}, executor_.now() + 1s};
+            EXPECT_THAT(pong_tx_session->send(metadata, fragments), Eq(cetl::nullopt));
+        });
+
+        // CAN transfer IDs are of a small modulo, so the echoed transfer ID is compared by modulo.
+        const TransferId            tid_modulo = ping_node.transport->getProtocolParams().transfer_id_modulo;
+        CommonHelpers::RunningStats rtt_stats;
+        TransferId                  ping_transfer_id = 0;
+        TimePoint                   ping_time{};
+        bool                        ping_in_flight = false;
+        ping_rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            if (ping_in_flight && (arg.transfer.metadata.rx_meta.base.transfer_id == ping_transfer_id % tid_modulo))
+            {
+                rtt_stats.append(std::chrono::duration<double, std::micro>(executor_.now() - ping_time).count());
+                ping_in_flight = false;
+                ++ping_transfer_id;
+            }
+        });
+
+        const auto deadline = executor_.now() + run_duration_;
+        CommonHelpers::runMainLoop(executor_, deadline, [&](const auto now) {
+            //
+            if (ping_in_flight && (now - ping_time > 100ms))
+            {
+                // Lost ping (or pong) - start over with the next one.
+                ++ping_transfer_id;
+                ping_in_flight = false;
+            }
+            if (!ping_in_flight && (now < deadline))
+            {
+                ping_time = executor_.now();
+                EXPECT_THAT(ping_tx_session->send({{ping_transfer_id, Priority::Nominal}, ping_time + 1s}, fragments),
+                            Eq(cetl::nullopt));
+                ping_in_flight = true;
+            }
+        });
+
+        return rtt_stats.mean();
+    }
+
+    /// Publishes messages as fast as the TX queue accepts them, and counts transfers & frames received by subscriber.
+    ///
+    void runThroughput(Node& publisher_node, Node& subscriber_node, const std::size_t payload_size, Result& result)
+    {
+        constexpr PortId TestSubjectId = 149;
+
+        auto tx_session = getSession(publisher_node.transport->makeMessageTxSession({TestSubjectId}));
+        auto rx_session = getSession(subscriber_node.transport->makeMessageRxSession({payload_size, TestSubjectId}));
+
+        std::size_t rx_transfers = 0;
+        rx_session->setOnReceiveCallback([&](const auto&) {
+            //
+            ++rx_transfers;
+        });
+
+        const std::vector<cetl::byte>                     payload(payload_size);
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+        const auto rx_frames_before = subscriber_node.transport->getMediaStatistics(0).value_or(IoStatistics{});
+
+        TransferId tx_transfer_id = 0;
+        const auto publish_until  = executor_.now() + run_duration_;
+        CommonHelpers::runMainLoop(executor_, publish_until + 200ms, [&](const auto now) {
+            //
+            while (now < publish_until)
+            {
+                const TransferTxMetadata metadata{{tx_transfer_id, Priority::Nominal}, now + 100ms};
+                if (tx_session->send(metadata, fragments).has_value())
+                {
+                    break;  // TX queue is full - try again on the next spin.
+                }
+                ++tx_transfer_id;
+            }
+        });
+
+        const auto rx_frames_after = subscriber_node.transport->getMediaStatistics(0).value_or(IoStatistics{});
+        const auto seconds         = std::chrono::duration<double>(run_duration_).count();
+
+        result.transfers_per_second = static_cast<double>(rx_transfers) / seconds;
+        result.frames_per_second =
+            static_cast<double>(rx_frames_after.num_received - rx_frames_before.num_received) / seconds;
+        result.lost_transfers = tx_transfer_id - rx_transfers;
+    }
+
+    static constexpr std::size_t TxCapacity = 64;
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource             mr_;
+    Linux::EpollSingleThreadedExecutor executor_;
+    Duration                           run_duration_{1s};
+    std::vector<std::string>           iface_addresses_{"vcan0"};
+    const std::array<std::size_t, 4>   payload_sizes_{{7, 32, 63, 256}};
+    // NOLINTEND
+
+};  // Example_0_Transport_5_Linux_Can_Classic_Vs_Fd
+
+// MARK: - Tests:
+
+TEST_F(Example_0_Transport_5_Linux_Can_Classic_Vs_Fd, main)
+{
+    // Both nodes are on the same (CAN FD capable) interface - each one with its own sockets.
+    //
+    Node node1;
+    Node node2;
+    if (!makeNode(node1, 1) || !makeNode(node2, 2))
+    {
+        GTEST_SKIP() << "CAN FD interface is not available (try `ip link add dev vcan0 type vcan mtu 72`).";
+    }
+
+    std::cout << std::setw(8) << "mode" << std::setw(10) << "payload" << std::setw(12) << "rtt_us" << std::setw(14)
+              << "transfers/s" << std::setw(12) << "frames/s" << std::setw(8) << "lost" << "\n";
+
+    for (const bool is_fd : {false, true})
+    {
+        // Switch the mode at runtime - the transport picks up new MTU with the very next transfer.
+        //
+        ASSERT_TRUE(node1.media_collection.setCanFd({is_fd, true}));
+        ASSERT_TRUE(node2.media_collection.setCanFd({is_fd, true}));
+        EXPECT_THAT(node1.transport->getProtocolParams().mtu_bytes, is_fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC);
+
+        for (const std::size_t payload_size : payload_sizes_)
+        {
+            Result result{};
+            result.rtt_mean_us = runLatency(node1, node2, payload_size);
+            runThroughput(node1, node2, payload_size, result);
+
+            std::cout << std::setw(8) << (is_fd ? "FD" : "Classic") << std::setw(10) << payload_size << std::setw(12)
+                      << std::fixed << std::setprecision(1) << result.rtt_mean_us << std::setw(14)
+                      << result.transfers_per_second << std::setw(12) << result.frames_per_second << std::setw(8)
+                      << result.lost_transfers << "\n";
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
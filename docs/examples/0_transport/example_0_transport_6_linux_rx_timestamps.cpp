@@ -0,0 +1,270 @@
+/// @file
+/// Example of kernel receive timestamps of the Linux UDP and CAN media.
+/// This example demonstrates that RX timestamps of received frames (and so of received transfers) don't depend on
+/// executor load. Frames are sent one by one, and each is read only after a varying "load" delay; the jitter of
+/// the kernel timestamps (relative to the moment of sending) is compared against the jitter of the moment of reading.
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/common_helpers.hpp"
+#include "platform/linux/can/can_media.hpp"
+#include "platform/posix/posix_single_threaded_executor.hpp"
+#include "platform/posix/udp/udp_media.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace
+{
+
+using namespace example::platform;  // NOLINT This our main concern here in this test.
+
+using Duration  = libcyphal::Duration;
+using TimePoint = libcyphal::TimePoint;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+using testing::Gt;
+using testing::IsEmpty;
+using testing::Lt;
+using testing::NotNull;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_0_Transport_6_Linux_Rx_Timestamps : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        // Number of frames to send. Default is 50.
+        if (const auto* const frames_count_str = std::getenv("CYPHAL__FRAMES"))
+        {
+            frames_count_ = static_cast<std::size_t>(std::strtoul(frames_count_str, nullptr, 10));
+        }
+        // Local interface address for UDP. Default is "127.0.0.1".
+        if (const auto* const iface_address_str = std::getenv("CYPHAL__UDP__IFACE"))
+        {
+            udp_iface_address_ = iface_address_str;
+        }
+        // CAN interface address. Default is "vcan0".
+        if (const auto* const iface_address_str = std::getenv("CYPHAL__CAN__IFACE"))
+        {
+            can_iface_address_ = iface_address_str;
+        }
+    }
+
+    void TearDown() override
+    {
+        executor_.releaseTemporaryResources();
+
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    struct Result
+    {
+        CommonHelpers::RunningStats rx_timestamp_latency_us;
+        CommonHelpers::RunningStats read_latency_us;
+    };
+
+    /// Sends frames one by one, and reads each of them after a varying "executor load" delay (0...8ms).
+    ///
+    /// @param send Sends a frame; returns `false` on failure.
+    /// @param receive Tries to read a frame; returns its RX timestamp if there is one.
+    ///
+    template <typename Send, typename Receive>
+    Result measure(const Send& send, const Receive& receive)
+    {
+        Result result;
+        for (std::size_t index = 0; index < frames_count_; ++index)
+        {
+            const TimePoint sent_at = executor_.now();
+            if (!send())
+            {
+                ADD_FAILURE() << "Failed to send frame #" << index;
+                break;
+            }
+
+            // Simulate executor being busy with something else before it gets to the media.
+            std::this_thread::sleep_for(std::chrono::milliseconds{2 * (index % 5)});
+
+            cetl::optional<TimePoint> rx_timestamp;
+            const TimePoint           read_deadline = executor_.now() + 1s;
+            while (!rx_timestamp.has_value() && (executor_.now() < read_deadline))
+            {
+                rx_timestamp = receive();
+            }
+            if (!rx_timestamp.has_value())
+            {
+                ADD_FAILURE() << "Frame #" << index << " has not been received";
+                break;
+            }
+
+            const TimePoint read_at = executor_.now();
+            result.rx_timestamp_latency_us.append(toMicroseconds(*rx_timestamp - sent_at));
+            result.read_latency_us.append(toMicroseconds(read_at - sent_at));
+        }
+        return result;
+    }
+
+    static double toMicroseconds(const Duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    static void print(const char* const media_name, const Result& result)
+    {
+        std::cout << std::fixed << std::setprecision(1) << media_name
+                  << " latency of RX timestamp: mean=" << result.rx_timestamp_latency_us.mean()
+                  << "us, jitter(stdev)=" << result.rx_timestamp_latency_us.standardDeviation() << "us\n"
+                  << media_name << " latency of reading:      mean=" << result.read_latency_us.mean()
+                  << "us, jitter(stdev)=" << result.read_latency_us.standardDeviation() << "us\n";
+    }
+
+    static void expectIndependentOfLoad(const Result& result)
+    {
+        // The load delays (0, 2, 4, 6 & 8ms) have ~2.8ms of standard deviation, and they are all seen by reading.
+        // Kernel timestamps are taken at the moment of arrival, so their jitter is way below the load one.
+        EXPECT_THAT(result.read_latency_us.standardDeviation(), Gt(2000.0));
+        EXPECT_THAT(result.rx_timestamp_latency_us.standardDeviation(), Lt(500.0));
+        EXPECT_THAT(result.rx_timestamp_latency_us.mean(), Lt(1000.0));
+    }
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource            mr_;
+    posix::PollSingleThreadedExecutor executor_{mr_};
+    std::size_t                       frames_count_{50};
+    std::string                       udp_iface_address_{"127.0.0.1"};
+    std::string                       can_iface_address_{"vcan0"};
+    // NOLINTEND
+
+};  // Example_0_Transport_6_Linux_Rx_Timestamps
+
+// MARK: - Tests:
+
+TEST_F(Example_0_Transport_6_Linux_Rx_Timestamps, udp)
+{
+    using libcyphal::transport::udp::IMedia;
+    using libcyphal::transport::udp::IRxSocket;
+    using libcyphal::transport::udp::ITxSocket;
+
+    constexpr libcyphal::transport::udp::IpEndpoint Endpoint{0xEF000076, 9382};
+
+    posix::UdpMedia udp_media{mr_, executor_, udp_iface_address_};
+    IMedia&         media = udp_media;
+
+    auto maybe_tx_socket = media.makeTxSocket();
+    ASSERT_THAT(maybe_tx_socket, VariantWith<libcyphal::UniquePtr<ITxSocket>>(NotNull()));
+    const auto tx_socket = cetl::get<libcyphal::UniquePtr<ITxSocket>>(std::move(maybe_tx_socket));
+
+    auto maybe_rx_socket = media.makeRxSocket(Endpoint);
+    ASSERT_THAT(maybe_rx_socket, VariantWith<libcyphal::UniquePtr<IRxSocket>>(NotNull()));
+    const auto rx_socket = cetl::get<libcyphal::UniquePtr<IRxSocket>>(std::move(maybe_rx_socket));
+
+    const std::array<cetl::byte, 8>                   payload{};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    const auto result = measure(
+        [&] {
+            //
+            const auto send_result = tx_socket->send(executor_.now() + 1s, Endpoint, 0, fragments);
+            const auto* const success = cetl::get_if<ITxSocket::SendResult::Success>(&send_result);
+            return (success != nullptr) && success->is_accepted;
+        },
+        [&]() -> cetl::optional<TimePoint> {
+            //
+            auto        receive_result = rx_socket->receive();
+            auto* const success        = cetl::get_if<IRxSocket::ReceiveResult::Success>(&receive_result);
+            if ((success == nullptr) || !success->has_value())
+            {
+                return cetl::nullopt;
+            }
+            return (*success)->timestamp;
+        });
+
+    print("UDP", result);
+    expectIndependentOfLoad(result);
+}
+
+TEST_F(Example_0_Transport_6_Linux_Rx_Timestamps, can)
+{
+    using libcyphal::transport::MediaPayload;
+    using libcyphal::transport::can::IMedia;
+
+    auto maybe_tx_media = Linux::CanMedia::make(mr_, executor_, can_iface_address_, mr_);
+    auto maybe_rx_media = Linux::CanMedia::make(mr_, executor_, can_iface_address_, mr_);
+    if ((cetl::get_if<Linux::CanMedia>(&maybe_tx_media) == nullptr) ||
+        (cetl::get_if<Linux::CanMedia>(&maybe_rx_media) == nullptr))
+    {
+        GTEST_SKIP() << "CAN interface '" << can_iface_address_ << "' is not available.";
+    }
+    auto    tx_can_media = cetl::get<Linux::CanMedia>(std::move(maybe_tx_media));
+    auto    rx_can_media = cetl::get<Linux::CanMedia>(std::move(maybe_rx_media));
+    IMedia& tx_media     = tx_can_media;
+    IMedia& rx_media     = rx_can_media;
+
+    const auto result = measure(
+        [&] {
+            //
+            auto* const data = static_cast<cetl::byte*>(mr_.allocate(8));
+            std::fill_n(data, 8, cetl::byte{0});
+            MediaPayload payload{8, data, 8, &mr_};
+            const auto   push_result = tx_media.push(executor_.now() + 1s, 0x1234, payload);
+            const auto*  success     = cetl::get_if<IMedia::PushResult::Success>(&push_result);
+            return (success != nullptr) && success->is_accepted;
+        },
+        [&]() -> cetl::optional<TimePoint> {
+            //
+            std::array<cetl::byte, 64> buffer{};
+            const auto                 pop_result = rx_media.pop(buffer);
+            const auto* const          success    = cetl::get_if<IMedia::PopResult::Success>(&pop_result);
+            if ((success == nullptr) || !success->has_value())
+            {
+                return cetl::nullopt;
+            }
+            return (*success)->timestamp;
+        });
+
+    print("CAN", result);
+    expectIndependentOfLoad(result);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,283 @@
+/// @file
+/// Example of forwarding raw messages from a CAN bus to the UDP backbone with the transport level bridge.
+/// A publisher floods an in-process virtual CAN bus with messages, the bridge forwards them (without any DSDL
+/// deserialization & serialization) to UDP loopback, and a UDP subscriber counts them. Everything runs in the very
+/// same thread (so on a single core). Throughput is measured in messages per second - first at full load of
+/// a 1 Mbit/s Classic CAN bus, and then with a virtually unlimited bus bitrate (to find out the bridge capacity).
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/common_helpers.hpp"
+#include "platform/posix/posix_single_threaded_executor.hpp"
+#include "platform/posix/udp/udp_media.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/bridge.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/can/virtual_bus.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/udp_transport.hpp>
+#include <libcyphal/transport/udp/udp_transport_impl.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace example::platform;     // NOLINT This our main concern here in this test.
+using namespace libcyphal::transport;  // NOLINT This our main concern here in this test.
+
+using Callback        = libcyphal::IExecutor::Callback;
+using Duration        = libcyphal::Duration;
+using CanTransportPtr = libcyphal::UniquePtr<can::ICanTransport>;
+using UdpTransportPtr = libcyphal::UniquePtr<udp::IUdpTransport>;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+using testing::Eq;
+using testing::Gt;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_0_Transport_7_Can_Udp_Bridge_Throughput : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        // Duration in seconds for which each phase will run. Default is 2 seconds.
+        if (const auto* const run_duration_str = std::getenv("CYPHAL__RUN"))
+        {
+            run_duration_ = std::chrono::duration<std::int64_t>{std::strtoll(run_duration_str, nullptr, 10)};
+        }
+        // Size of the published message payload in bytes. Default is 7 bytes (single Classic CAN frame).
+        if (const auto* const payload_size_str = std::getenv("CYPHAL__PAYLOAD"))
+        {
+            payload_size_ = std::min<std::size_t>(std::strtoul(payload_size_str, nullptr, 10), MaxPayloadSize);
+        }
+        // Local interface address for UDP. Default is "127.0.0.1".
+        if (const auto* const iface_address_str = std::getenv("CYPHAL__UDP__IFACE"))
+        {
+            udp_iface_address_ = iface_address_str;
+        }
+    }
+
+    void TearDown() override
+    {
+        executor_.releaseTemporaryResources();
+
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    struct Result
+    {
+        std::size_t  published;
+        IoStatistics bridge;
+        std::size_t  received;
+        std::size_t  out_of_order;
+        double       bus_load;
+    };
+
+    template <typename Session>
+    static libcyphal::UniquePtr<Session> getSession(
+        libcyphal::Expected<libcyphal::UniquePtr<Session>, AnyFailure>&& maybe_session)
+    {
+        EXPECT_THAT(maybe_session, VariantWith<libcyphal::UniquePtr<Session>>(NotNull()));
+        return cetl::get<libcyphal::UniquePtr<Session>>(std::move(maybe_session));
+    }
+
+    /// Floods the virtual CAN bus (of the given bitrate) with messages for the run duration,
+    /// and forwards them with the bridge to UDP loopback.
+    ///
+    Result run(const std::uint32_t bitrate)
+    {
+        constexpr PortId TestSubjectId = 150;
+
+        can::VirtualBus        bus{executor_, {bitrate, bitrate, true}};
+        can::VirtualBus::Media publisher_media{bus, mr_, {can::VirtualBus::ClassicPayloadSize, false, 3, 16}};
+        can::VirtualBus::Media bridge_media{bus, mr_, {can::VirtualBus::ClassicPayloadSize, false, 3, 64}};
+
+        std::array<can::IMedia*, 1> publisher_media_array{&publisher_media};
+        std::array<can::IMedia*, 1> bridge_media_array{&bridge_media};
+        auto publisher_can = makeCanTransport(publisher_media_array, 10);
+        auto bridge_can    = makeCanTransport(bridge_media_array, 11);
+
+        std::vector<std::string>    iface_addresses{udp_iface_address_};
+        posix::UdpMedia::Collection bridge_udp_media;
+        posix::UdpMedia::Collection subscriber_udp_media;
+        bridge_udp_media.make(mr_, executor_, iface_addresses);
+        subscriber_udp_media.make(mr_, executor_, iface_addresses);
+        auto bridge_udp     = makeUdpTransport(bridge_udp_media, 11);
+        auto subscriber_udp = makeUdpTransport(subscriber_udp_media, 12);
+
+        Bridge bridge{mr_, *bridge_can, *bridge_udp};
+        EXPECT_THAT(bridge.addSubject(TestSubjectId, payload_size_), Eq(cetl::nullopt));
+
+        Result result{0, {}, 0, 0, 0.0};
+
+        // The bridge numbers forwarded transfers sequentially - so any gap means a lost message.
+        auto       rx_session       = getSession(subscriber_udp->makeMessageRxSession({payload_size_, TestSubjectId}));
+        TransferId next_transfer_id = 1;
+        rx_session->setOnReceiveCallback([&](const auto& arg) {
+            //
+            const auto transfer_id = arg.transfer.metadata.rx_meta.base.transfer_id;
+            if (transfer_id != next_transfer_id)
+            {
+                ++result.out_of_order;
+            }
+            next_transfer_id = transfer_id + 1;
+            ++result.received;
+        });
+
+        auto tx_session = getSession(publisher_can->makeMessageTxSession({TestSubjectId}));
+
+        const std::vector<cetl::byte>                     payload(payload_size_);
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+        // Keep the publisher's TX queue full - so that the bus is never idle.
+        // The queue is topped up by a callback (rather than by the main loop action) - so that the main loop
+        // doesn't sleep (till the next scheduled callback) while there are just published frames to transmit.
+        // It's enough to top up the queue once it's half empty - so the period is derived from the frame duration.
+        const auto top_up_period = std::max(
+            Duration{1},
+            std::chrono::duration_cast<Duration>(
+                can::VirtualBus::getFrameDuration(bus.getConfig(), can::VirtualBus::ClassicPayloadSize, false, false) *
+                (TxCapacity / 2)));
+
+        TransferId tx_transfer_id = 0;
+        const auto publish_until  = executor_.now() + run_duration_;
+        auto       publish_cb     = executor_.registerCallback([&](const auto& arg) {
+            //
+            for (std::size_t i = 0; (i < TxCapacity) && (arg.approx_now < publish_until); ++i)
+            {
+                const TransferTxMetadata metadata{{tx_transfer_id, Priority::Nominal}, arg.approx_now + 1s};
+                if (tx_session->send(metadata, fragments).has_value())
+                {
+                    break;
+                }
+                ++tx_transfer_id;
+            }
+        });
+        publish_cb.schedule(Callback::Schedule::Repeat{executor_.now(), top_up_period});
+
+        CommonHelpers::runMainLoop(executor_, publish_until + 200ms, [](const auto) {});
+        publish_cb.reset();
+
+        result.published = tx_transfer_id;
+        result.bridge    = bridge.getStatistics();
+        result.bus_load  = std::chrono::duration<double>(bus.getStatistics().busy_time).count() /
+                           std::chrono::duration<double>(run_duration_).count();
+        return result;
+    }
+
+    CanTransportPtr makeCanTransport(const cetl::span<can::IMedia*> media, const NodeId node_id)
+    {
+        auto maybe_transport = can::makeTransport(mr_, executor_, media, TxCapacity);
+        EXPECT_THAT(maybe_transport, VariantWith<CanTransportPtr>(NotNull()));
+        auto transport = cetl::get<CanTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(transport->setLocalNodeId(node_id), Eq(cetl::nullopt));
+        transport->setTransientErrorHandler(CommonHelpers::Can::transientErrorReporter);
+        return transport;
+    }
+
+    UdpTransportPtr makeUdpTransport(posix::UdpMedia::Collection& media_collection, const NodeId node_id)
+    {
+        auto maybe_transport = udp::makeTransport({mr_}, executor_, media_collection.span(), UdpTxCapacity);
+        EXPECT_THAT(maybe_transport, VariantWith<UdpTransportPtr>(NotNull()));
+        auto transport = cetl::get<UdpTransportPtr>(std::move(maybe_transport));
+        EXPECT_THAT(transport->setLocalNodeId(node_id), Eq(cetl::nullopt));
+        transport->setTransientErrorHandler(CommonHelpers::Udp::transientErrorReporter);
+        return transport;
+    }
+
+    void print(const Result& result) const
+    {
+        const auto seconds = std::chrono::duration<double>(run_duration_).count();
+        std::cout << "published=" << result.published << ", bus_load=" << result.bus_load * 100.0 << "%\n";
+        std::cout << "bridge: received=" << result.bridge.num_received << ", forwarded=" << result.bridge.num_emitted
+                  << ", errored=" << result.bridge.num_errored << "\n";
+        std::cout << "udp_received=" << result.received << ", out_of_order=" << result.out_of_order << "\n";
+        std::cout << "throughput=" << static_cast<double>(result.bridge.num_emitted) / seconds << " msg/s\n";
+    }
+
+    static constexpr std::size_t MaxPayloadSize = 1024;
+    static constexpr std::size_t TxCapacity     = 16;
+    static constexpr std::size_t UdpTxCapacity  = 256;
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource            mr_;
+    posix::PollSingleThreadedExecutor executor_{mr_};
+    Duration                          run_duration_{2s};
+    std::size_t                       payload_size_{7};
+    std::string                       udp_iface_address_{"127.0.0.1"};
+    // NOLINTEND
+
+};  // Example_0_Transport_7_Can_Udp_Bridge_Throughput
+
+// MARK: - Tests:
+
+TEST_F(Example_0_Transport_7_Can_Udp_Bridge_Throughput, full_bus_load)
+{
+    std::cout << "CAN 1 Mbit/s -> UDP loopback, payload_size=" << payload_size_ << " bytes\n";
+    const auto result = run(1000000);
+    print(result);
+
+    // The bus is (almost) never idle, every message seen on it is forwarded, and nothing is lost on the way.
+    EXPECT_THAT(result.bus_load, Gt(0.9));
+    EXPECT_THAT(result.published, Gt(0));
+    EXPECT_THAT(result.bridge.num_received, result.published);
+    EXPECT_THAT(result.bridge.num_emitted, result.bridge.num_received);
+    EXPECT_THAT(result.received, result.bridge.num_emitted);
+    EXPECT_THAT(result.out_of_order, 0);
+}
+
+TEST_F(Example_0_Transport_7_Can_Udp_Bridge_Throughput, capacity)
+{
+    // The bus is not a bottleneck anymore - throughput is limited by the CPU (publisher, CAN and UDP transports,
+    // and the bridge itself - all in the same thread).
+    std::cout << "CAN (unlimited bitrate) -> UDP loopback, payload_size=" << payload_size_ << " bytes\n";
+    const auto result = run(1000000000);
+    print(result);
+
+    EXPECT_THAT(result.bridge.num_emitted, Gt(0));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,234 @@
+/// @file
+/// Example of persistent storage backends for the registry, and their boot-time load performance.
+/// This example compares the one-file-per-key `KeyValue` backend against the single-file log `LogKeyValue` one
+/// by saving, and then loading back (as it's done at boot) 100, 1k and 10k persistent registers.
+///
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#include "platform/log_storage.hpp"
+#include "platform/storage.hpp"
+#include "platform/tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/platform/storage.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace example::platform;       // NOLINT This our main concern here in this test.
+using namespace libcyphal::application;  // NOLINT This our main concern here in this test.
+
+using testing::Eq;
+using testing::IsEmpty;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class Example_2_Application_1_StorageBootLoad : public testing::Test
+{
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    /// Holds a bunch of persistent `uint32` registers, and their values.
+    ///
+    class Registers final
+    {
+    public:
+        Registers(registry::Registry& rgy, const std::size_t count)
+            : values_(count, 0)
+        {
+            names_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                names_.push_back("example.storage.register_" + std::to_string(i));
+            }
+            registers_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                registers_.emplace_back(rgy.route(names_[i].c_str(), makeGetter(i), makeSetter(i), {true}));
+            }
+        }
+
+        std::vector<std::uint32_t>& values() noexcept
+        {
+            return values_;
+        }
+
+    private:
+        using Getter   = std::function<std::uint32_t()>;
+        using Setter   = std::function<cetl::optional<registry::SetError>(const std::uint32_t&)>;
+        using Register = registry::RegisterImpl<Getter, Setter>;
+
+        Getter makeGetter(const std::size_t index)
+        {
+            return [this, index] { return values_[index]; };
+        }
+
+        Setter makeSetter(const std::size_t index)
+        {
+            return [this, index](const std::uint32_t& value) -> cetl::optional<registry::SetError> {
+                //
+                values_[index] = value;
+                return cetl::nullopt;
+            };
+        }
+
+        // MARK: Data members:
+
+        std::vector<std::uint32_t> values_;
+        std::vector<std::string>   names_;
+        std::vector<Register>      registers_;
+
+    };  // Registers
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocated_bytes, 0);
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    static double toMs(const Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    /// Saves all registers with a fresh backend, and then measures "boot":
+    /// opening of a new backend instance plus `registry::load` of all registers.
+    ///
+    template <typename MakeStorage>
+    void benchmark(const char* const backend_name, const std::size_t count, const MakeStorage& make_storage)
+    {
+        registry::Registry rgy{mr_};
+        Registers          registers{rgy, count};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            registers.values()[i] = static_cast<std::uint32_t>(i * 3);
+        }
+        {
+            auto storage = make_storage();
+            ASSERT_THAT(registry::save(*storage, rgy), Eq(cetl::nullopt));
+        }
+        std::fill(registers.values().begin(), registers.values().end(), 0);
+
+        const auto start_time = Clock::now();
+        auto       storage    = make_storage();
+        const auto open_time  = Clock::now();
+        ASSERT_THAT(registry::load(*storage, rgy), Eq(cetl::nullopt));
+        const auto end_time = Clock::now();
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ASSERT_THAT(registers.values()[i], i * 3);
+        }
+        std::cout << backend_name << " x " << count << " keys: open = " << toMs(open_time - start_time)
+                  << " ms, load = " << toMs(end_time - open_time) << " ms, total = " << toMs(end_time - start_time)
+                  << " ms\n";
+    }
+
+    // MARK: Data members:
+    // NOLINTBEGIN
+
+    TrackingMemoryResource mr_;
+
+    // NOLINTEND
+
+};  // Example_2_Application_1_StorageBootLoad
+
+TEST_F(Example_2_Application_1_StorageBootLoad, main)
+{
+    std::cout << "-----------\n";
+    for (const std::size_t count : {100, 1000, 10000})
+    {
+        const std::string root_path = "/tmp/org.opencyphal.ex_2_app_1_" + std::to_string(count);
+
+        benchmark("file-per-key", count, [&root_path] {
+            //
+            return std::make_unique<storage::KeyValue>(root_path);
+        });
+
+        const std::string log_path = root_path + ".log";
+        (void) std::remove(log_path.c_str());
+        benchmark("log         ", count, [&log_path] {
+            //
+            return std::make_unique<storage::LogKeyValue>(log_path);
+        });
+    }
+    std::cout << "-----------\n";
+}
+
+TEST_F(Example_2_Application_1_StorageBootLoad, log_compaction_and_recovery)
+{
+    const std::string log_path = "/tmp/org.opencyphal.ex_2_app_1_compaction.log";
+    (void) std::remove(log_path.c_str());
+
+    using Error = storage::LogKeyValue::Error;
+
+    const std::array<std::uint8_t, 4> value1{1, 2, 3, 4};
+    const std::array<std::uint8_t, 2> value2{5, 6};
+    std::array<std::uint8_t, 8>       buffer{};
+    {
+        storage::LogKeyValue                     kv{log_path};
+        libcyphal::platform::storage::IKeyValue& kv_if = kv;
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_THAT(kv_if.put("a", value1), Eq(cetl::nullopt));
+        }
+        ASSERT_THAT(kv_if.put("b", value2), Eq(cetl::nullopt));
+        ASSERT_THAT(kv_if.put("c", value2), Eq(cetl::nullopt));
+        ASSERT_THAT(kv_if.drop("c"), Eq(cetl::nullopt));
+        EXPECT_THAT(kv_if.drop("c"), Eq(Error::Existence));
+        EXPECT_THAT(kv.size(), 2);
+
+        EXPECT_THAT(kv.compactIfNeeded(), Eq(cetl::nullopt));
+        EXPECT_THAT(kv.getGarbageSize(), 0);
+        EXPECT_THAT(kv.getFileSize(), 8 + (12 + 1 + 4) + (12 + 1 + 2));
+        EXPECT_THAT(std::fopen((log_path + ".tmp").c_str(), "rb"), testing::IsNull());
+    }
+
+    // Emulate torn write at the end of the log.
+    {
+        std::FILE* const file = std::fopen(log_path.c_str(), "ab");
+        ASSERT_THAT(file, testing::NotNull());
+        (void) std::fputs("torn", file);
+        (void) std::fclose(file);
+    }
+
+    storage::LogKeyValue                     kv{log_path};
+    libcyphal::platform::storage::IKeyValue& kv_if = kv;
+    EXPECT_THAT(kv.size(), 2);
+    EXPECT_THAT(kv.getFileSize(), 8 + (12 + 1 + 4) + (12 + 1 + 2));
+    EXPECT_THAT(kv_if.get("a", buffer), testing::VariantWith<std::size_t>(4));
+    EXPECT_THAT(buffer, testing::ElementsAre(1, 2, 3, 4, 0, 0, 0, 0));
+    EXPECT_THAT(kv_if.get("b", buffer), testing::VariantWith<std::size_t>(2));
+    EXPECT_THAT(kv_if.get("c", buffer), testing::VariantWith<Error>(Error::Existence));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
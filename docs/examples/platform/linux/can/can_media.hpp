@@ -9,6 +9,8 @@
 
 #include "../../posix/posix_executor_extension.hpp"
 #include "../../posix/posix_platform_error.hpp"
+#include "../../posix/posix_rx_time.hpp"
+#include "../../posix/posix_tx_time.hpp"
 #include "socketcan.h"
 
 #include <canard.h>
@@ -25,8 +27,13 @@
 #include <cerrno>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <iostream>
 #include <iterator>
+#include <linux/can.h>
+#include <linux/can/raw.h>
 #include <string>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <utility>
 #include <vector>
@@ -39,9 +46,31 @@ namespace platform
 namespace Linux
 {
 
+/// Implements CAN media on top of Linux SocketCAN.
+///
+/// The media works either in Classic CAN mode (8-byte MTU), or in CAN FD mode (64-byte MTU) - see `setCanFd`.
+/// The transport queries MTU before every transmission, so the mode could be switched at runtime.
+/// Reception always accepts both Classic and FD frames once the FD mode has been enabled.
+///
+/// Received frames are stamped by the kernel (by `CLOCK_REALTIME`) at the moment of their arrival,
+/// and the time stamps are mapped into the executor time domain.
+///
+/// Optionally, transmission deadlines of frames could be enforced by the kernel - see `setTxDeadlines`.
+///
 class CanMedia final : public libcyphal::transport::can::IMedia
 {
 public:
+    /// Defines CAN FD related settings of the media. Default (zero) settings mean Classic CAN.
+    ///
+    struct FdOptions
+    {
+        /// Enables CAN FD frames (up to 64 bytes of payload). Requires FD-capable interface (like `vcan`).
+        bool enabled;
+
+        /// Enables bit rate switch (faster data phase) of CAN FD frames.
+        bool bit_rate_switch;
+    };
+
     struct Collection
     {
         Collection() = default;
@@ -49,13 +78,14 @@ public:
         bool make(cetl::pmr::memory_resource& general_mr,
                   libcyphal::IExecutor&       executor,
                   std::vector<std::string>&   iface_addresses,
-                  cetl::pmr::memory_resource& tx_mr)
+                  cetl::pmr::memory_resource& tx_mr,
+                  const FdOptions             fd_options = {})
         {
             reset();
 
             for (const auto& iface_address : iface_addresses)
             {
-                auto maybe_media = CanMedia::make(general_mr, executor, iface_address, tx_mr);
+                auto maybe_media = CanMedia::make(general_mr, executor, iface_address, tx_mr, fd_options);
                 if (auto* const error = cetl::get_if<libcyphal::transport::PlatformError>(&maybe_media))
                 {
                     std::cerr << "Failed to create CAN media '" << iface_address << "', errno=" << (*error)->code()
@@ -78,6 +108,50 @@ public:
             return {media_ifaces_.data(), media_ifaces_.size()};
         }
 
+        /// Switches kernel-side transmission deadlines of all media of the collection (see `CanMedia::setTxDeadlines`).
+        ///
+        bool setTxDeadlines(const bool enabled)
+        {
+            for (auto& media : media_vector_)
+            {
+                if (const auto error = media.setTxDeadlines(enabled))
+                {
+                    std::cerr << "Failed to switch TX deadlines, errno=" << (*error)->code() << ".";
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Gets total numbers of frames dropped by the kernel (across all media of the collection).
+        ///
+        posix::TxTimeDrops getTxTimeDrops()
+        {
+            posix::TxTimeDrops total{};
+            for (auto& media : media_vector_)
+            {
+                const auto& drops = media.getTxTimeDrops();
+                total.missed += drops.missed;
+                total.invalid += drops.invalid;
+            }
+            return total;
+        }
+
+        /// Switches all media of the collection to the given CAN FD mode (see `CanMedia::setCanFd`).
+        ///
+        bool setCanFd(const FdOptions fd_options)
+        {
+            for (auto& media : media_vector_)
+            {
+                if (const auto error = media.setCanFd(fd_options))
+                {
+                    std::cerr << "Failed to switch CAN FD mode, errno=" << (*error)->code() << ".";
+                    return false;
+                }
+            }
+            return true;
+        }
+
         void reset()
         {
             media_vector_.clear();
@@ -94,9 +168,10 @@ public:
         cetl::pmr::memory_resource& general_mr,
         libcyphal::IExecutor&       executor,
         const std::string&          iface_address,
-        cetl::pmr::memory_resource& tx_mr)
+        cetl::pmr::memory_resource& tx_mr,
+        const FdOptions             fd_options = {})
     {
-        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address.c_str(), false);
+        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address.c_str(), fd_options.enabled);
         if (socket_can_rx_fd < 0)
         {
             return libcyphal::transport::PlatformError{posix::PosixPlatformError{-socket_can_rx_fd}};
@@ -105,7 +180,7 @@ public:
         // We gonna register separate callbacks for rx & tx (aka pop & push),
         // so at executor (especially in case of the "epoll" one) we need separate file descriptors.
         //
-        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address.c_str(), false);
+        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address.c_str(), fd_options.enabled);
         if (socket_can_tx_fd < 0)
         {
             const int error_code = -socket_can_tx_fd;
@@ -113,7 +188,7 @@ public:
             return libcyphal::transport::PlatformError{posix::PosixPlatformError{error_code}};
         }
 
-        return CanMedia{general_mr, executor, socket_can_rx_fd, socket_can_tx_fd, iface_address, tx_mr};
+        return CanMedia{general_mr, executor, socket_can_rx_fd, socket_can_tx_fd, iface_address, tx_mr, fd_options};
     }
 
     ~CanMedia()
@@ -138,10 +213,78 @@ public:
         , socket_can_tx_fd_{std::exchange(other.socket_can_tx_fd_, -1)}
         , iface_address_{other.iface_address_}
         , tx_mr_{other.tx_mr_}
+        , fd_options_{other.fd_options_}
+        , fd_sockets_{other.fd_sockets_}
+        , tx_deadlines_{other.tx_deadlines_}
+        , tx_time_socket_{other.tx_time_socket_}
+        , tx_time_drops_{other.tx_time_drops_}
     {
     }
     CanMedia* operator=(CanMedia&&) noexcept = delete;
 
+    /// Switches the media to the given CAN FD mode at runtime.
+    ///
+    /// Enabling of CAN FD turns on the CAN FD socket option (which stays enabled afterward, so that FD frames
+    /// are still received even if the FD mode is disabled later). New MTU takes effect with the next transfer.
+    ///
+    CETL_NODISCARD cetl::optional<libcyphal::transport::PlatformError> setCanFd(const FdOptions fd_options)
+    {
+        if (fd_options.enabled && !fd_sockets_)
+        {
+            const int enable = 1;
+            for (const SocketCANFD fd : {socket_can_rx_fd_, socket_can_tx_fd_})
+            {
+                if (::setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable, sizeof(enable)) < 0)
+                {
+                    return libcyphal::transport::PlatformError{posix::PosixPlatformError{errno}};
+                }
+            }
+            fd_sockets_ = true;
+        }
+
+        fd_options_ = fd_options;
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD const FdOptions& getFdOptions() const noexcept
+    {
+        return fd_options_;
+    }
+
+    /// Switches kernel-side enforcement of transmission deadlines.
+    ///
+    /// Once enabled, the `SO_TXTIME` socket option is turned on (in the deadline mode), and every pushed frame
+    /// carries its transfer deadline to the kernel. Given that the ETF queuing discipline is configured on the
+    /// interface (f.e. `tc qdisc replace dev can0 root etf clockid CLOCK_TAI delta 200000 deadline_mode`),
+    /// stale frames are dropped in the kernel instead of going out late. Other queuing disciplines ignore deadlines.
+    /// Requires Linux 5.18+ (older kernels don't support `SO_TXTIME` for CAN sockets).
+    ///
+    CETL_NODISCARD cetl::optional<libcyphal::transport::PlatformError> setTxDeadlines(const bool enabled)
+    {
+        if (enabled && !tx_time_socket_)
+        {
+            const std::int16_t result = ::socketcanEnableTxTime(socket_can_tx_fd_, true);
+            if (result < 0)
+            {
+                return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
+            }
+            tx_time_socket_ = true;
+        }
+
+        tx_deadlines_ = enabled;
+        return cetl::nullopt;
+    }
+
+    /// Gets total numbers of frames dropped by the kernel because of their transmission deadlines.
+    ///
+    /// Kernel reports such drops via the socket error queue, which is drained here (as well as on every push).
+    ///
+    CETL_NODISCARD const posix::TxTimeDrops& getTxTimeDrops()
+    {
+        readTxTimeErrors();
+        return tx_time_drops_;
+    }
+
     void tryReopen()
     {
         if (socket_can_rx_fd_ >= 0)
@@ -155,16 +298,21 @@ public:
             socket_can_tx_fd_ = -1;
         }
 
-        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address_.c_str(), false);
+        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address_.c_str(), fd_sockets_);
         if (socket_can_rx_fd >= 0)
         {
             socket_can_rx_fd_ = socket_can_rx_fd;
         }
 
-        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address_.c_str(), false);
+        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address_.c_str(), fd_sockets_);
         if (socket_can_tx_fd >= 0)
         {
             socket_can_tx_fd_ = socket_can_tx_fd;
+            if (tx_time_socket_)
+            {
+                tx_time_socket_ = ::socketcanEnableTxTime(socket_can_tx_fd_, true) >= 0;
+                tx_deadlines_   = tx_deadlines_ && tx_time_socket_;
+            }
         }
     }
 
@@ -177,16 +325,30 @@ private:
              const SocketCANFD           socket_can_rx_fd,
              const SocketCANFD           socket_can_tx_fd,
              std::string                 iface_address,
-             cetl::pmr::memory_resource& tx_mr)
+             cetl::pmr::memory_resource& tx_mr,
+             const FdOptions             fd_options)
         : general_mr_{general_mr}
         , executor_{executor}
         , socket_can_rx_fd_{socket_can_rx_fd}
         , socket_can_tx_fd_{socket_can_tx_fd}
         , iface_address_{std::move(iface_address)}
         , tx_mr_{tx_mr}
+        , fd_options_{fd_options}
+        , fd_sockets_{fd_options.enabled}
+        , tx_deadlines_{false}
+        , tx_time_socket_{false}
+        , tx_time_drops_{}
     {
     }
 
+    void readTxTimeErrors()
+    {
+        if (tx_time_socket_ && (socket_can_tx_fd_ >= 0))
+        {
+            (void) ::socketcanReadTxTimeErrors(socket_can_tx_fd_, &tx_time_drops_.missed, &tx_time_drops_.invalid);
+        }
+    }
+
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerAwaitableCallback(
         libcyphal::IExecutor::Callback::Function&&              function,
         const posix::IPosixExecutorExtension::Trigger::Variant& trigger) const
@@ -204,7 +366,7 @@ private:
 
     std::size_t getMtu() const noexcept override
     {
-        return CANARD_MTU_CAN_CLASSIC;
+        return fd_options_.enabled ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
     }
 
     cetl::optional<libcyphal::transport::MediaFailure> setFilters(const Filters filters) noexcept override
@@ -224,12 +386,23 @@ private:
         return cetl::nullopt;
     }
 
-    PushResult::Type push(const libcyphal::TimePoint /* deadline */,
+    PushResult::Type push(const libcyphal::TimePoint             deadline,
                           const libcyphal::transport::can::CanId can_id,
                           libcyphal::transport::MediaPayload&    payload) noexcept override
     {
+        std::uint64_t txtime_nsec = 0;
+        if (tx_deadlines_)
+        {
+            readTxTimeErrors();
+            txtime_nsec = posix::makeTxTime(deadline, executor_.now());
+        }
+
         const CanardFrame  canard_frame{can_id, {payload.getSpan().size(), payload.getSpan().data()}};
-        const std::int16_t result = ::socketcanPush(socket_can_tx_fd_, &canard_frame, 0);
+        const std::int16_t result = ::socketcanPush(socket_can_tx_fd_,
+                                                    &canard_frame,
+                                                    0,
+                                                    fd_options_.enabled && fd_options_.bit_rate_switch,
+                                                    txtime_nsec);
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{posix::PosixPlatformError{-result}};
@@ -247,12 +420,13 @@ private:
 
     CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
     {
-        CanardFrame canard_frame{};
-        bool        is_loopback{false};
+        CanardFrame   canard_frame{};
+        bool          is_loopback{false};
+        std::uint64_t timestamp_nsec{0};
 
         const std::int16_t result = ::socketcanPop(socket_can_rx_fd_,
                                                    &canard_frame,
-                                                   nullptr,
+                                                   &timestamp_nsec,
                                                    payload_buffer.size(),
                                                    payload_buffer.data(),
                                                    0,
@@ -266,7 +440,9 @@ private:
             return cetl::nullopt;
         }
 
-        return PopResult::Metadata{executor_.now(), canard_frame.extended_can_id, canard_frame.payload.size};
+        return PopResult::Metadata{posix::mapRxTime(timestamp_nsec, executor_.now()),
+                                   canard_frame.extended_can_id,
+                                   canard_frame.payload.size};
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerPushCallback(
@@ -296,6 +472,11 @@ private:
     SocketCANFD                 socket_can_tx_fd_;
     const std::string           iface_address_;
     cetl::pmr::memory_resource& tx_mr_;
+    FdOptions                   fd_options_;
+    bool                        fd_sockets_;
+    bool                        tx_deadlines_;
+    bool                        tx_time_socket_;
+    posix::TxTimeDrops          tx_time_drops_;
 
 };  // CanMedia
 
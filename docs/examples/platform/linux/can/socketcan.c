@@ -13,6 +13,8 @@
 #ifdef __linux__
 #    include <linux/can.h>
 #    include <linux/can/raw.h>
+#    include <linux/errqueue.h>
+#    include <linux/net_tstamp.h>
 #    include <net/if.h>
 #    include <sys/ioctl.h>
 #    include <sys/socket.h>
@@ -30,6 +32,7 @@
 
 #define KILO 1000L
 #define MEGA (KILO * KILO)
+#define GIGA (KILO * MEGA)
 
 static int16_t getNegatedErrno(void)
 {
@@ -114,7 +117,7 @@ SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd)
     if (ok)
     {
         const int en = 1;
-        ok           = 0 == setsockopt(fd, SOL_SOCKET, SO_TIMESTAMP, &en, sizeof(en));
+        ok           = 0 == setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &en, sizeof(en));
     }
 
     // Enable outgoing-frame loop-back.
@@ -133,7 +136,11 @@ SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd)
     return getNegatedErrno();
 }
 
-int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const frame, const CanardMicrosecond timeout_usec)
+int16_t socketcanPush(const SocketCANFD               fd,
+                      const struct CanardFrame* const frame,
+                      const CanardMicrosecond         timeout_usec,
+                      const bool                      bit_rate_switch,
+                      const uint64_t                  txtime_nsec)
 {
     if ((frame == NULL) || (frame->payload.data == NULL) || (frame->payload.size > UINT8_MAX))
     {
@@ -149,15 +156,46 @@ int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const fram
         (void) memset(&cfd, 0, sizeof(cfd));
         cfd.can_id = frame->extended_can_id | CAN_EFF_FLAG;
         cfd.len    = (uint8_t) frame->payload.size;
-        // We set the bit rate switch on the assumption that it will be ignored by non-CAN-FD-capable hardware.
-        cfd.flags = CANFD_BRS;
+        // The bit rate switch is ignored by non-CAN-FD-capable hardware, as well as for Classic CAN frames.
+        cfd.flags = bit_rate_switch ? CANFD_BRS : 0;
         (void) memcpy(cfd.data, frame->payload.data, frame->payload.size);
 
         // If the payload is small, use the smaller MTU for compatibility with non-FD sockets.
         // This way, if the user attempts to transmit a CAN FD frame without having the CAN FD socket option enabled,
         // an error will be triggered here.  This is convenient -- we can handle both FD and Classic CAN uniformly.
         const size_t mtu = (frame->payload.size > CAN_MAX_DLEN) ? CANFD_MTU : CAN_MTU;
-        if (write(fd, &cfd, mtu) < 0)
+        if (txtime_nsec == 0)
+        {
+            if (write(fd, &cfd, mtu) < 0)
+            {
+                return getNegatedErrno();
+            }
+            return poll_result;
+        }
+
+        // The transmission time is passed to the kernel as ancillary data (see SO_TXTIME in socket(7)).
+        // The ancillary data buffer is wrapped in a union to ensure it is suitably aligned.
+        struct iovec iov = {.iov_base = &cfd, .iov_len = mtu};
+        union
+        {
+            uint8_t        buf[CMSG_SPACE(sizeof(uint64_t))];
+            struct cmsghdr align;
+        } control;
+        (void) memset(control.buf, 0, sizeof(control.buf));
+
+        struct msghdr msg  = {0};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control.buf;
+        msg.msg_controllen = sizeof(control.buf);
+
+        struct cmsghdr* const cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level           = SOL_SOCKET;
+        cmsg->cmsg_type            = SCM_TXTIME;
+        cmsg->cmsg_len             = CMSG_LEN(sizeof(uint64_t));
+        (void) memcpy(CMSG_DATA(cmsg), &txtime_nsec, sizeof(txtime_nsec));  // Copy to avoid alignment problems
+
+        if (sendmsg(fd, &msg, 0) < 0)
         {
             return getNegatedErrno();
         }
@@ -167,7 +205,7 @@ int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const fram
 
 int16_t socketcanPop(const SocketCANFD        fd,
                      struct CanardFrame* const       out_frame,
-                     CanardMicrosecond* const out_timestamp_usec,
+                     uint64_t* const          out_timestamp_nsec,
                      const size_t             payload_buffer_size,
                      void* const              payload_buffer,
                      const CanardMicrosecond  timeout_usec,
@@ -193,12 +231,13 @@ int16_t socketcanPop(const SocketCANFD        fd,
         };
 
         // Determine the size of the ancillary data and zero-initialize the buffer for it.
-        // We require space for both the receive message header (implied in CMSG_SPACE) and the time stamp.
+        // We require space for both the receive message header (implied in CMSG_SPACE) and the time stamps -
+        // the software one, and (optionally) the hardware one (which comes as the third of three time stamps).
         // The ancillary data buffer is wrapped in a union to ensure it is suitably aligned.
         // See the cmsg(3) man page (release 5.08 dated 2020-06-09, or later) for details.
         union
         {
-            uint8_t        buf[CMSG_SPACE(sizeof(struct timeval))];
+            uint8_t        buf[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(3 * sizeof(struct timespec))];
             struct cmsghdr align;
         } control;
         (void) memset(control.buf, 0, sizeof(control.buf));
@@ -245,25 +284,35 @@ int16_t socketcanPop(const SocketCANFD        fd,
         }
 
         // Obtain the CAN frame time stamp from the kernel.
-        // This time stamp is from the CLOCK_REALTIME kernel source.
-        if (NULL != out_timestamp_usec)
+        // The software time stamp is from the CLOCK_REALTIME kernel source. The hardware one is reported only if
+        // explicitly enabled (see socketcanEnableHardwareTimestamps()), in which case it is preferred.
+        if (NULL != out_timestamp_nsec)
         {
-            const struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
-            struct timeval        tv   = {0};
-            assert(cmsg != NULL);
-            if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_TIMESTAMP))
+            struct timespec sw_ts = {0};
+            struct timespec hw_ts = {0};
+            for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
             {
-                (void) memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));  // Copy to avoid alignment problems
-                assert(tv.tv_sec >= 0 && tv.tv_usec >= 0);
+                if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPNS))
+                {
+                    (void) memcpy(&sw_ts, CMSG_DATA(cmsg), sizeof(sw_ts));  // Copy to avoid alignment problems
+                }
+                else if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPING))
+                {
+                    struct timespec ts[3];
+                    (void) memcpy(&ts[0], CMSG_DATA(cmsg), sizeof(ts));  // Copy to avoid alignment problems
+                    hw_ts = ts[2];
+                }
             }
-            else
+            const struct timespec* const ts = ((hw_ts.tv_sec != 0) || (hw_ts.tv_nsec != 0)) ? &hw_ts : &sw_ts;
+            if ((ts->tv_sec == 0) && (ts->tv_nsec == 0))
             {
                 assert(0);
                 return -EIO;
             }
+            assert(ts->tv_sec >= 0 && ts->tv_nsec >= 0);
 
             (void) memset(out_frame, 0, sizeof(struct CanardFrame));
-            *out_timestamp_usec = (CanardMicrosecond) (((uint64_t) tv.tv_sec * MEGA) + (uint64_t) tv.tv_usec);
+            *out_timestamp_nsec = ((uint64_t) ts->tv_sec * GIGA) + (uint64_t) ts->tv_nsec;
         }
         out_frame->extended_can_id = sockcan_frame.can_id & CAN_EFF_MASK;
         out_frame->payload.size    = sockcan_frame.len;
@@ -296,3 +345,78 @@ int16_t socketcanFilter(const SocketCANFD fd, const size_t num_configs, const st
 
     return (ret < 0) ? getNegatedErrno() : 0;
 }
+
+int16_t socketcanEnableTxTime(const SocketCANFD fd, const bool deadline_mode)
+{
+    // ETF queuing discipline accepts CLOCK_TAI only.
+    struct sock_txtime txtime;
+    (void) memset(&txtime, 0, sizeof(txtime));
+    txtime.clockid = CLOCK_TAI;
+    txtime.flags   = SOF_TXTIME_REPORT_ERRORS | (deadline_mode ? SOF_TXTIME_DEADLINE_MODE : 0U);
+
+    const int ret = setsockopt(fd, SOL_SOCKET, SO_TXTIME, &txtime, sizeof(txtime));
+
+    return (ret < 0) ? getNegatedErrno() : 0;
+}
+
+int16_t socketcanEnableHardwareTimestamps(const SocketCANFD fd)
+{
+    const int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+
+    const int ret = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags));
+
+    return (ret < 0) ? getNegatedErrno() : 0;
+}
+
+int16_t socketcanReadTxTimeErrors(const SocketCANFD fd, uint64_t* const inout_missed, uint64_t* const inout_invalid)
+{
+    if ((inout_missed == NULL) || (inout_invalid == NULL))
+    {
+        return -EINVAL;
+    }
+
+    for (;;)
+    {
+        // The error queue returns the dropped frame itself, along with the extended error as ancillary data.
+        struct canfd_frame sockcan_frame = {0};
+        struct iovec       iov           = {.iov_base = &sockcan_frame, .iov_len = sizeof(sockcan_frame)};
+        union
+        {
+            uint8_t        buf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+            struct cmsghdr align;
+        } control;
+        (void) memset(control.buf, 0, sizeof(control.buf));
+
+        struct msghdr msg  = {0};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control.buf;
+        msg.msg_controllen = sizeof(control.buf);
+
+        if (recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            return ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? 0 : getNegatedErrno();
+        }
+
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if ((cmsg->cmsg_level != SOL_CAN_RAW) || (cmsg->cmsg_type != SCM_CAN_RAW_ERRQUEUE))
+            {
+                continue;
+            }
+            struct sock_extended_err err;
+            (void) memcpy(&err, CMSG_DATA(cmsg), sizeof(err));  // Copy to avoid alignment problems
+            if (err.ee_origin == SO_EE_ORIGIN_TXTIME)
+            {
+                if (err.ee_code == SO_EE_CODE_TXTIME_MISSED)
+                {
+                    ++*inout_missed;
+                }
+                else
+                {
+                    ++*inout_invalid;
+                }
+            }
+        }
+    }
+}
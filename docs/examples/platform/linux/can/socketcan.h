@@ -13,6 +13,15 @@
 /// --------------------------------------------------------------------------------------------------------------------
 /// Changelog
 ///
+/// v3.3 - Changed to nanosecond kernel time-stamping (SO_TIMESTAMPNS) of received frames; hardware time stamps
+///        (SO_TIMESTAMPING) could be opted in, see socketcanEnableHardwareTimestamps().
+///        API change in socketcanPop(): time stamp is now in nanoseconds.
+///
+/// v3.2 - Added support of kernel-side transmission deadlines (SO_TXTIME), see socketcanEnableTxTime().
+///        API change in socketcanPush(): transmission time of the frame is now accepted.
+///
+/// v3.1 - API change in socketcanPush(): bit rate switch (BRS) of CAN FD frames is now controlled by the caller.
+///
 /// v3.0 - Update for compatibility with Libcanard v3.
 ///
 /// v2.0 - Added loop-back functionality.
@@ -50,16 +59,25 @@ typedef int SocketCANFD;
 SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd);
 
 /// Enqueue a new extended CAN data frame for transmission.
+/// Frames with payload longer than 8 bytes are sent as CAN FD frames (requires the CAN FD socket option),
+/// and the bit rate switch flag enables faster data phase of such frames; shorter frames are sent as Classic CAN.
 /// Block until the frame is enqueued or until the timeout is expired.
 /// Zero timeout makes the operation non-blocking.
+/// The transmission time (CLOCK_TAI, in nanoseconds) is attached to the frame as the SCM_TXTIME control message;
+/// it requires the SO_TXTIME socket option (see socketcanEnableTxTime()). Zero transmission time means none.
 /// Returns 1 on success, 0 on timeout, negated errno on error.
-int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const frame, const CanardMicrosecond timeout_usec);
+int16_t socketcanPush(const SocketCANFD               fd,
+                      const struct CanardFrame* const frame,
+                      const CanardMicrosecond         timeout_usec,
+                      const bool                      bit_rate_switch,
+                      const uint64_t                  txtime_nsec);
 
 /// Fetch a new extended CAN data frame from the RX queue.
 /// If the received frame is not an extended-ID data frame, it will be dropped and the function will return early.
 /// The payload pointer of the returned frame will point to the payload_buffer. It can be a stack-allocated array.
 /// The payload_buffer_size shall be large enough (64 bytes is enough for CAN FD), otherwise an error is returned.
-/// The received frame timestamp will be set to CLOCK_REALTIME by the kernel, sampled near the moment of its arrival.
+/// The received frame timestamp (in nanoseconds) will be set to CLOCK_REALTIME by the kernel, sampled near the moment
+/// of its arrival. Hardware time stamps are used instead only if enabled by socketcanEnableHardwareTimestamps().
 /// The loopback flag pointer is used to both indicate and control behavior when a looped-back message is received.
 /// If the flag pointer is NULL, loopback frames are silently dropped; if not NULL, they are accepted and indicated
 /// using this flag.
@@ -68,7 +86,7 @@ int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const fram
 /// Returns 1 on success, 0 on timeout, negated errno on error.
 int16_t socketcanPop(const SocketCANFD        fd,
                      struct CanardFrame* const       out_frame,
-                     CanardMicrosecond* const out_timestamp_usec,
+                     uint64_t* const          out_timestamp_nsec,
                      const size_t             payload_buffer_size,
                      void* const              payload_buffer,
                      const CanardMicrosecond  timeout_usec,
@@ -80,6 +98,30 @@ int16_t socketcanPop(const SocketCANFD        fd,
 /// Returns 0 on success, negated errno on error.
 int16_t socketcanFilter(const SocketCANFD fd, const size_t num_configs, const struct CanardFilter* const configs);
 
+/// Enable the SO_TXTIME socket option (requires Linux 5.18+), so that frames pushed with non-zero transmission time
+/// are scheduled by the ETF queuing discipline of the interface (other disciplines ignore the transmission time).
+/// In the deadline mode, the transmission time is the latest moment when the frame may still be sent - ETF sends
+/// the frame as soon as possible, and drops it if the deadline has passed (requires ETF "deadline_mode" option).
+/// Otherwise, the transmission time is the exact launch time of the frame.
+/// Frames dropped by the kernel are reported via the socket error queue; see socketcanReadTxTimeErrors().
+/// Returns 0 on success, negated errno on error.
+int16_t socketcanEnableTxTime(const SocketCANFD fd, const bool deadline_mode);
+
+/// Enable reporting of hardware time stamps of received frames (SO_TIMESTAMPING), which are then preferred by
+/// socketcanPop() over the software ones (where the interface provides them).
+/// Hardware time stamps come from the clock of the interface (PHC), which is usually either free-running or TAI -
+/// so this is only correct if the PHC is synchronized to CLOCK_REALTIME (f.e. by phc2sys); otherwise leave it off.
+/// Returns 0 on success, negated errno on error.
+int16_t socketcanEnableHardwareTimestamps(const SocketCANFD fd);
+
+/// Drain the socket error queue, and count frames dropped by the kernel because of their transmission time:
+/// either because it has been missed while the frame was queued, or because it was invalid (already in the past,
+/// or earlier than transmission time of a previously queued frame) at the moment of the push.
+/// The counters are incremented (not assigned), so they can accumulate totals across calls.
+/// The function does not block. Errors of other origins are drained from the queue and ignored.
+/// Returns 0 on success, negated errno on error.
+int16_t socketcanReadTxTimeErrors(const SocketCANFD fd, uint64_t* const inout_missed, uint64_t* const inout_invalid);
+
 #ifdef __cplusplus
 }
 #endif
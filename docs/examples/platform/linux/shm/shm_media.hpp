@@ -0,0 +1,262 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_LINUX_SHM_MEDIA_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_LINUX_SHM_MEDIA_HPP_INCLUDED
+
+#include "../../posix/posix_executor_extension.hpp"
+#include "../../posix/posix_platform_error.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/shm/media.hpp>
+#include <libcyphal/transport/shm/segment.hpp>
+#include <libcyphal/types.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <fcntl.h>
+#include <string>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace example
+{
+namespace platform
+{
+// Can't use lowercased `linux` - gnuc++ defines it as macro.
+namespace Linux
+{
+
+/// Implements shared memory media on top of a POSIX named shared memory object (see `::shm_open`),
+/// and Linux `eventfd` descriptors as the "doorbells" between nodes.
+///
+/// Every media has its own `eventfd` descriptor, which is polled by the executor. Notification of other nodes
+/// is done by writing to their descriptors (see `addPeer`) - so within a single process it's enough to exchange
+/// descriptors between media instances; between processes the descriptors have to be either inherited
+/// (f.e. via `fork`) or passed over a UNIX domain socket (`SCM_RIGHTS`).
+///
+class ShmMedia final : public libcyphal::transport::shm::IMedia
+{
+public:
+    using MakeResult = cetl::variant<ShmMedia, libcyphal::transport::PlatformError>;
+
+    /// Makes media attached to the named shared memory segment.
+    ///
+    /// The very first node creates the segment (of the given layout) and formats it; all other nodes just map
+    /// the existing segment (their layout is ignored - the one stored in the segment is used instead).
+    ///
+    /// @param executor The executor to register the notification callback at.
+    /// @param name The name of the shared memory object, like "/cyphal". See `::shm_open` for details.
+    /// @param layout The layout of the segment (in use only when the segment is created).
+    ///
+    CETL_NODISCARD static MakeResult make(libcyphal::IExecutor&                         executor,
+                                          const std::string&                            name,
+                                          const libcyphal::transport::shm::SegmentLayout& layout)
+    {
+        using libcyphal::transport::PlatformError;
+
+        bool created = true;
+        int  shm_fd  = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if ((shm_fd < 0) && (errno == EEXIST))
+        {
+            created = false;
+            shm_fd  = ::shm_open(name.c_str(), O_RDWR, 0);
+        }
+        if (shm_fd < 0)
+        {
+            return PlatformError{posix::PosixPlatformError{errno}};
+        }
+
+        std::size_t segment_size = libcyphal::transport::shm::getSegmentSize(layout);
+        if (created)
+        {
+            if (::ftruncate(shm_fd, static_cast<::off_t>(segment_size)) < 0)
+            {
+                const int error_code = errno;
+                (void) ::shm_unlink(name.c_str());
+                return closeWithError(shm_fd, error_code);
+            }
+        }
+        else
+        {
+            struct ::stat shm_stat{};
+            if (::fstat(shm_fd, &shm_stat) < 0)
+            {
+                return closeWithError(shm_fd, errno);
+            }
+            segment_size = static_cast<std::size_t>(shm_stat.st_size);
+        }
+
+        void* const segment_ptr = ::mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+        if (segment_ptr == MAP_FAILED)  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        {
+            return closeWithError(shm_fd, errno);
+        }
+        // The mapping stays valid after closing of its descriptor.
+        (void) ::close(shm_fd);
+
+        const cetl::span<cetl::byte> segment{static_cast<cetl::byte*>(segment_ptr), segment_size};
+        if (created && libcyphal::transport::shm::formatSegment(segment, layout).has_value())
+        {
+            (void) ::munmap(segment_ptr, segment_size);
+            (void) ::shm_unlink(name.c_str());
+            return PlatformError{posix::PosixPlatformError{EINVAL}};
+        }
+
+        const int event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd < 0)
+        {
+            const int error_code = errno;
+            (void) ::munmap(segment_ptr, segment_size);
+            return PlatformError{posix::PosixPlatformError{error_code}};
+        }
+
+        return ShmMedia{executor, name, segment, event_fd};
+    }
+
+    ~ShmMedia()
+    {
+        if (!segment_.empty())
+        {
+            (void) ::munmap(segment_.data(), segment_.size());
+        }
+        if (event_fd_ >= 0)
+        {
+            (void) ::close(event_fd_);
+        }
+        for (const int peer_fd : peer_fds_)
+        {
+            (void) ::close(peer_fd);
+        }
+    }
+
+    ShmMedia(const ShmMedia&)            = delete;
+    ShmMedia& operator=(const ShmMedia&) = delete;
+
+    ShmMedia(ShmMedia&& other) noexcept
+        : executor_{other.executor_}
+        , name_{std::move(other.name_)}
+        , segment_{std::exchange(other.segment_, {})}
+        , event_fd_{std::exchange(other.event_fd_, -1)}
+        , peer_fds_{std::move(other.peer_fds_)}
+    {
+    }
+    ShmMedia& operator=(ShmMedia&&) noexcept = delete;
+
+    /// Gets `eventfd` descriptor of this media - to be added as a peer to other nodes' media.
+    ///
+    CETL_NODISCARD int getNotificationFd() const noexcept
+    {
+        return event_fd_;
+    }
+
+    /// Adds a peer node (its `eventfd` descriptor) to be notified on every publication.
+    ///
+    /// The media duplicates the descriptor, so the caller keeps ownership of the original one.
+    ///
+    CETL_NODISCARD cetl::optional<libcyphal::transport::PlatformError> addPeer(const int peer_event_fd)
+    {
+        const int peer_fd = ::fcntl(peer_event_fd, F_DUPFD_CLOEXEC, 0);  // NOLINT(*-vararg)
+        if (peer_fd < 0)
+        {
+            return libcyphal::transport::PlatformError{posix::PosixPlatformError{errno}};
+        }
+        peer_fds_.push_back(peer_fd);
+        return cetl::nullopt;
+    }
+
+    /// Removes the name of the shared memory object, so that the segment is destroyed
+    /// as soon as the last node unmaps it. Normally called by the "owner" node on its shutdown.
+    ///
+    void unlink() const
+    {
+        (void) ::shm_unlink(name_.c_str());
+    }
+
+private:
+    ShmMedia(libcyphal::IExecutor&        executor,
+             std::string                  name,
+             const cetl::span<cetl::byte> segment,
+             const int                    event_fd)
+        : executor_{executor}
+        , name_{std::move(name)}
+        , segment_{segment}
+        , event_fd_{event_fd}
+    {
+    }
+
+    static libcyphal::transport::PlatformError closeWithError(const int fd, const int error_code)
+    {
+        (void) ::close(fd);
+        return libcyphal::transport::PlatformError{posix::PosixPlatformError{error_code}};
+    }
+
+    // MARK: - IMedia
+
+    CETL_NODISCARD cetl::span<cetl::byte> getSegment() noexcept override
+    {
+        return segment_;
+    }
+
+    CETL_NODISCARD cetl::optional<libcyphal::transport::MediaFailure> notify() noexcept override
+    {
+        const std::uint64_t increment = 1;
+        for (const int peer_fd : peer_fds_)
+        {
+            // `EAGAIN` means that the peer counter is saturated - the peer is going to be woken up anyway.
+            if ((::write(peer_fd, &increment, sizeof(increment)) < 0) && (errno != EAGAIN) && (errno != EINTR))
+            {
+                return libcyphal::transport::PlatformError{posix::PosixPlatformError{errno}};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void clearNotifications() noexcept override
+    {
+        // Reading of `eventfd` resets its counter (unless it's in the semaphore mode, which is not the case).
+        std::uint64_t counter = 0;
+        (void) ::read(event_fd_, &counter, sizeof(counter));
+    }
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerNotificationCallback(
+        libcyphal::IExecutor::Callback::Function&& function) override
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<posix::IPosixExecutorExtension*>(&executor_);
+        if (nullptr == posix_executor_ext)
+        {
+            return {};
+        }
+
+        return posix_executor_ext->registerAwaitableCallback(  //
+            std::move(function),
+            posix::IPosixExecutorExtension::Trigger::Readable{event_fd_});
+    }
+
+    // MARK: Data members:
+
+    libcyphal::IExecutor&  executor_;
+    std::string            name_;
+    cetl::span<cetl::byte> segment_;
+    int                    event_fd_;
+    std::vector<int>       peer_fds_;
+
+};  // ShmMedia
+
+}  // namespace Linux
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_LINUX_SHM_MEDIA_HPP_INCLUDED
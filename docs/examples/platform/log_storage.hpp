@@ -0,0 +1,538 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef EXAMPLE_PLATFORM_LOG_STORAGE_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_LOG_STORAGE_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace example
+{
+namespace platform
+{
+namespace storage
+{
+
+/// Implements key-value storage as a single append-only log file with an in-memory index.
+///
+/// Compared to the one-file-per-key `KeyValue`, there is only one `open` at boot - the whole log is mapped
+/// into memory (`mmap`) and scanned once to build the index of the latest value offsets per key.
+///
+/// Log layout: an 8-byte file header (magic), followed by records. Each record is a 12-byte header
+/// (CRC-32C, key size, flags, value size), then the key and value bytes. The CRC covers everything
+/// of the record except the CRC field itself. A drop is recorded as a "tombstone" record without value.
+/// A record which is torn (f.e. due to power loss in the middle of `put`) or corrupted ends the log -
+/// the file is truncated to the last valid record on open.
+///
+/// Superseded records accumulate as garbage; `compactIfNeeded` (or `compact`) rewrites the log with only
+/// the live records, and atomically replaces the old file (via `rename`). Compaction is never done on
+/// the `put` path, but it is a blocking full rewrite of the log (proportional to the live data size) -
+/// so call it from a place where such a stall is acceptable (f.e. an idle executor callback).
+///
+class LogKeyValue final : public libcyphal::platform::storage::IKeyValue
+{
+public:
+    using Error = libcyphal::platform::storage::Error;
+
+    /// Opens (or creates) the log file, and builds the in-memory index.
+    ///
+    /// @param file_path Path to the log file.
+    /// @param sync_on_write If `true`, every `put` and `drop` is followed by `fsync`.
+    ///
+    explicit LogKeyValue(std::string file_path, const bool sync_on_write = false)
+        : file_path_{std::move(file_path)}
+        , sync_on_write_{sync_on_write}
+    {
+        open();
+    }
+
+    ~LogKeyValue()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+    }
+
+    LogKeyValue(LogKeyValue&&)                 = delete;
+    LogKeyValue(const LogKeyValue&)            = delete;
+    LogKeyValue& operator=(LogKeyValue&&)      = delete;
+    LogKeyValue& operator=(const LogKeyValue&) = delete;
+
+    /// Gets number of live keys.
+    ///
+    std::size_t size() const noexcept
+    {
+        return index_.size();
+    }
+
+    /// Gets total size of the log file, including the garbage.
+    ///
+    std::size_t getFileSize() const noexcept
+    {
+        return file_size_;
+    }
+
+    /// Gets number of bytes occupied by superseded (aka garbage) records.
+    ///
+    std::size_t getGarbageSize() const noexcept
+    {
+        return garbage_size_;
+    }
+
+    /// Compacts the log if more than a half of it is garbage.
+    ///
+    cetl::optional<Error> compactIfNeeded()
+    {
+        constexpr std::size_t MinGarbageSize = 4096;
+        if ((garbage_size_ > MinGarbageSize) && ((garbage_size_ * 2) > file_size_))
+        {
+            return compact();
+        }
+        return cetl::nullopt;
+    }
+
+    /// Rewrites the log with live records only.
+    ///
+    /// Blocks until the whole new log is written and synced. The new log is written to a temporary file,
+    /// which then atomically replaces the current one (and the parent directory is synced as well),
+    /// so power loss during compaction leaves either the old or the new log intact.
+    /// On failure the temporary file is removed, and the current log stays in use.
+    ///
+    cetl::optional<Error> compact()
+    {
+        const std::string tmp_file_path = file_path_ + ".tmp";
+        const int         tmp_fd        = ::open(tmp_file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (tmp_fd < 0)
+        {
+            reportError("Error opening file", tmp_file_path);
+            return Error::IO;
+        }
+
+        std::vector<std::uint8_t> log{Magic.cbegin(), Magic.cend()};
+        Index                     new_index;
+        new_index.reserve(index_.size());
+        std::vector<std::uint8_t> value;
+        for (const auto& entry : index_)
+        {
+            value.resize(entry.second.value_size);
+            if (!readExactly(fd_, value.data(), value.size(), entry.second.value_offset))
+            {
+                reportError("Error reading file", file_path_);
+                discardTmpFile(tmp_fd, tmp_file_path);
+                return Error::IO;
+            }
+            const auto value_offset = appendRecord(log, entry.first, {value.data(), value.size()}, false);
+            new_index.emplace(entry.first, Location{value_offset, entry.second.value_size});
+        }
+
+        if (!writeExactly(tmp_fd, log.data(), log.size(), 0) || (::fsync(tmp_fd) != 0) ||
+            (std::rename(tmp_file_path.c_str(), file_path_.c_str()) != 0))
+        {
+            reportError("Error writing file", tmp_file_path);
+            discardTmpFile(tmp_fd, tmp_file_path);
+            return Error::IO;
+        }
+
+        // The new log is already in place, so we switch to it even if the rename itself can't be made durable.
+        ::close(fd_);
+        fd_           = tmp_fd;
+        file_size_    = log.size();
+        garbage_size_ = 0;
+        index_        = std::move(new_index);
+
+        if (!syncParentDirectory())
+        {
+            reportError("Error syncing directory of", file_path_);
+            return Error::IO;
+        }
+        return cetl::nullopt;
+    }
+
+private:
+    struct Location final
+    {
+        std::size_t   value_offset;
+        std::uint32_t value_size;
+    };
+    using Index = std::unordered_map<std::string, Location>;
+
+    static constexpr std::size_t   RecordHeaderSize = 12;
+    static constexpr std::uint16_t TombstoneFlag    = 1U;
+
+    static constexpr std::array<std::uint8_t, 8> Magic{{'C', 'Y', 'K', 'V', 'L', 'O', 'G', '1'}};
+
+    static std::uint32_t crc32c(const std::uint8_t* const data, const std::size_t size, std::uint32_t crc = 0)
+    {
+        crc = ~crc;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            crc ^= data[i];
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1U) ^ (0x82F63B78U & (0U - (crc & 1U)));
+            }
+        }
+        return ~crc;
+    }
+
+    template <typename T>
+    static void appendLittleEndian(std::vector<std::uint8_t>& buffer, const T value)
+    {
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8U)));
+        }
+    }
+
+    template <typename T>
+    static T readLittleEndian(const std::uint8_t* const data)
+    {
+        T value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            value = static_cast<T>(value | (static_cast<T>(data[i]) << (i * 8U)));
+        }
+        return value;
+    }
+
+    /// Appends a new record to the buffer, and returns offset of its value within the buffer.
+    ///
+    static std::size_t appendRecord(std::vector<std::uint8_t>&           buffer,
+                                    const cetl::string_view              key,
+                                    const cetl::span<const std::uint8_t> value,
+                                    const bool                           is_tombstone)
+    {
+        const std::size_t record_offset = buffer.size();
+        appendLittleEndian<std::uint32_t>(buffer, 0);  // CRC placeholder
+        appendLittleEndian(buffer, static_cast<std::uint16_t>(key.size()));
+        appendLittleEndian(buffer, static_cast<std::uint16_t>(is_tombstone ? TombstoneFlag : 0U));
+        appendLittleEndian(buffer, static_cast<std::uint32_t>(value.size()));
+        buffer.insert(buffer.end(), key.cbegin(), key.cend());
+        const std::size_t value_offset = buffer.size();
+        buffer.insert(buffer.end(), value.begin(), value.end());
+
+        const auto crc = crc32c(buffer.data() + record_offset + 4, buffer.size() - record_offset - 4);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            buffer[record_offset + i] = static_cast<std::uint8_t>(crc >> (i * 8U));
+        }
+        return value_offset;
+    }
+
+    static bool readExactly(const int fd, std::uint8_t* data, std::size_t size, std::size_t offset)
+    {
+        while (size > 0)
+        {
+            const auto result = ::pread(fd, data, size, static_cast<off_t>(offset));
+            if (result <= 0)
+            {
+                if ((result < 0) && (errno == EINTR))
+                {
+                    continue;
+                }
+                return false;
+            }
+            data += result;
+            size -= static_cast<std::size_t>(result);
+            offset += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    static bool writeExactly(const int fd, const std::uint8_t* data, std::size_t size, std::size_t offset)
+    {
+        while (size > 0)
+        {
+            const auto result = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            data += result;
+            size -= static_cast<std::size_t>(result);
+            offset += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    static void reportError(const char* const what, const std::string& file_path)
+    {
+        std::cerr << what << ": '" << file_path << "'.\n";
+        std::cerr << "Error: " << std::strerror(errno) << std::endl;
+    }
+
+    static void discardTmpFile(const int tmp_fd, const std::string& tmp_file_path)
+    {
+        ::close(tmp_fd);
+        ::unlink(tmp_file_path.c_str());
+    }
+
+    /// Makes the latest `rename` of the log file durable - it's an entry of the parent directory.
+    ///
+    bool syncParentDirectory() const
+    {
+        const auto        slash_pos = file_path_.find_last_of('/');
+        const std::string dir_path  = (slash_pos == std::string::npos) ? "." : file_path_.substr(0, slash_pos + 1);
+
+        const int dir_fd = ::open(dir_path.c_str(), O_RDONLY | O_DIRECTORY);
+        if (dir_fd < 0)
+        {
+            return false;
+        }
+        const bool is_synced = (::fsync(dir_fd) == 0);
+        ::close(dir_fd);
+        return is_synced;
+    }
+
+    void open()
+    {
+        fd_ = ::open(file_path_.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0)
+        {
+            reportError("Error opening file", file_path_);
+            return;
+        }
+
+        struct stat file_stat{};
+        if (::fstat(fd_, &file_stat) != 0)
+        {
+            reportError("Error getting file size", file_path_);
+            return;
+        }
+
+        const auto mapped_size = static_cast<std::size_t>(file_stat.st_size);
+        if (mapped_size == 0)
+        {
+            // Brand new log - just write the header.
+            if (!writeExactly(fd_, Magic.data(), Magic.size(), 0))
+            {
+                reportError("Error writing file", file_path_);
+            }
+            file_size_ = Magic.size();
+            return;
+        }
+
+        void* const mapped = ::mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (mapped == MAP_FAILED)  // NOLINT(*-cstyle-cast)
+        {
+            reportError("Error mapping file", file_path_);
+            return;
+        }
+        (void) ::madvise(mapped, mapped_size, MADV_SEQUENTIAL);
+
+        file_size_ = scan(static_cast<const std::uint8_t*>(mapped), mapped_size);
+        (void) ::munmap(mapped, mapped_size);
+
+        if (file_size_ < mapped_size)
+        {
+            std::cerr << "Truncating torn or corrupted log tail: '" << file_path_ << "' (" << mapped_size << " -> "
+                      << file_size_ << " bytes).\n";
+            if (::ftruncate(fd_, static_cast<off_t>(file_size_)) != 0)
+            {
+                reportError("Error truncating file", file_path_);
+            }
+        }
+    }
+
+    /// Scans the mapped log, and builds the index.
+    ///
+    /// @return Size of the valid part of the log.
+    ///
+    std::size_t scan(const std::uint8_t* const log, const std::size_t log_size)
+    {
+        if ((log_size < Magic.size()) || (std::memcmp(log, Magic.data(), Magic.size()) != 0))
+        {
+            std::cerr << "Invalid log header - discarding: '" << file_path_ << "'.\n";
+            if (!writeExactly(fd_, Magic.data(), Magic.size(), 0))
+            {
+                reportError("Error writing file", file_path_);
+            }
+            return Magic.size();
+        }
+
+        std::size_t offset = Magic.size();
+        while ((log_size - offset) >= RecordHeaderSize)
+        {
+            const std::uint8_t* const record     = log + offset;
+            const auto                key_size   = readLittleEndian<std::uint16_t>(record + 4);
+            const auto                flags      = readLittleEndian<std::uint16_t>(record + 6);
+            const auto                value_size = readLittleEndian<std::uint32_t>(record + 8);
+
+            const std::size_t record_size = RecordHeaderSize + key_size + value_size;
+            if (((log_size - offset) < record_size) ||
+                (readLittleEndian<std::uint32_t>(record) != crc32c(record + 4, record_size - 4)))
+            {
+                break;
+            }
+
+            std::string key{reinterpret_cast<const char*>(record + RecordHeaderSize), key_size};
+            const auto  existing = index_.find(key);
+            if (existing != index_.end())
+            {
+                garbage_size_ += RecordHeaderSize + key_size + existing->second.value_size;
+            }
+            if ((flags & TombstoneFlag) != 0)
+            {
+                garbage_size_ += record_size;
+                if (existing != index_.end())
+                {
+                    index_.erase(existing);
+                }
+            }
+            else
+            {
+                const Location location{offset + RecordHeaderSize + key_size, value_size};
+                if (existing != index_.end())
+                {
+                    existing->second = location;
+                }
+                else
+                {
+                    index_.emplace(std::move(key), location);
+                }
+            }
+            offset += record_size;
+        }
+        return offset;
+    }
+
+    cetl::optional<Error> appendToLog(const cetl::string_view              key,
+                                      const cetl::span<const std::uint8_t> value,
+                                      const bool                           is_tombstone)
+    {
+        if (fd_ < 0)
+        {
+            return Error::IO;
+        }
+
+        std::vector<std::uint8_t> record;
+        record.reserve(RecordHeaderSize + key.size() + value.size());
+        const auto value_offset = file_size_ + appendRecord(record, key, value, is_tombstone);
+
+        // Either all or none of the record is written - a partially written record is cut off.
+        if (!writeExactly(fd_, record.data(), record.size(), file_size_) ||
+            (sync_on_write_ && (::fsync(fd_) != 0)))
+        {
+            reportError("Error writing file", file_path_);
+            (void) ::ftruncate(fd_, static_cast<off_t>(file_size_));
+            return Error::IO;
+        }
+        file_size_ += record.size();
+
+        std::string key_str{key.cbegin(), key.cend()};
+        const auto  existing = index_.find(key_str);
+        if (existing != index_.end())
+        {
+            garbage_size_ += RecordHeaderSize + key.size() + existing->second.value_size;
+        }
+        if (is_tombstone)
+        {
+            garbage_size_ += record.size();
+            if (existing != index_.end())
+            {
+                index_.erase(existing);
+            }
+        }
+        else
+        {
+            const Location location{value_offset, static_cast<std::uint32_t>(value.size())};
+            if (existing != index_.end())
+            {
+                existing->second = location;
+            }
+            else
+            {
+                index_.emplace(std::move(key_str), location);
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    // MARK: - libcyphal::platform::storage::IKeyValue
+
+    auto get(const cetl::string_view        key,
+             const cetl::span<std::uint8_t> data) const -> libcyphal::Expected<std::size_t, Error> override
+    {
+        const auto found = index_.find(std::string{key.cbegin(), key.cend()});
+        if (found == index_.end())
+        {
+            return Error::Existence;
+        }
+
+        const std::size_t data_size = std::min<std::size_t>(found->second.value_size, data.size());
+        if (!readExactly(fd_, data.data(), data_size, found->second.value_offset))
+        {
+            reportError("Error reading file", file_path_);
+            return Error::IO;
+        }
+        return data_size;
+    }
+
+    auto put(const cetl::string_view key, const cetl::span<const std::uint8_t> data)  //
+        -> cetl::optional<Error> override
+    {
+        if (key.size() > UINT16_MAX)
+        {
+            return Error::API;
+        }
+        return appendToLog(key, data, false);
+    }
+
+    auto drop(const cetl::string_view key) -> cetl::optional<Error> override
+    {
+        if (index_.find(std::string{key.cbegin(), key.cend()}) == index_.end())
+        {
+            return Error::Existence;
+        }
+        return appendToLog(key, {}, true);
+    }
+
+    // MARK: Data members:
+
+    const std::string file_path_;
+    const bool        sync_on_write_;
+    int               fd_{-1};
+    std::size_t       file_size_{0};
+    std::size_t       garbage_size_{0};
+    Index             index_;
+
+};  // LogKeyValue
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+// Before C++17 ODR-used static constexpr data members still need a definition at namespace scope.
+constexpr std::array<std::uint8_t, 8> LogKeyValue::Magic;
+#endif
+
+}  // namespace storage
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_LOG_STORAGE_HPP_INCLUDED
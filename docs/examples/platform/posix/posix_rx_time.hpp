@@ -0,0 +1,51 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_POSIX_RX_TIME_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_POSIX_RX_TIME_HPP_INCLUDED
+
+#include <libcyphal/types.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <time.h>
+
+namespace example
+{
+namespace platform
+{
+namespace posix
+{
+
+/// Maps a kernel receive time stamp (`CLOCK_REALTIME` nanoseconds) to the executor time domain.
+///
+/// The kernel stamps frames by the real time clock, while the executor time is monotonic, so the mapping is done
+/// by the age of the time stamp (relative to the current executor time). Thus, the result excludes any delay
+/// between the frame arrival and its reading (f.e. because of executor load). The result never exceeds `now`
+/// (f.e. if the real time clock has been stepped back). Zero time stamp (not available) is mapped to `now`.
+///
+inline libcyphal::TimePoint mapRxTime(const std::uint64_t kernel_nsec, const libcyphal::TimePoint now)
+{
+    timespec realtime_now{};
+    if ((kernel_nsec == 0) || (::clock_gettime(CLOCK_REALTIME, &realtime_now) != 0))
+    {
+        return now;
+    }
+    const std::chrono::nanoseconds age = std::chrono::seconds{realtime_now.tv_sec} +
+                                         std::chrono::nanoseconds{realtime_now.tv_nsec} -
+                                         std::chrono::nanoseconds{static_cast<std::int64_t>(kernel_nsec)};
+    if (age.count() <= 0)
+    {
+        return now;
+    }
+    return now - std::chrono::duration_cast<libcyphal::Duration>(age);
+}
+
+}  // namespace posix
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_POSIX_RX_TIME_HPP_INCLUDED
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_POSIX_TX_TIME_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_POSIX_TX_TIME_HPP_INCLUDED
+
+#include <libcyphal/types.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <time.h>
+
+namespace example
+{
+namespace platform
+{
+namespace posix
+{
+
+/// Defines counters of frames (or datagrams) dropped by the kernel because of their `SO_TXTIME` transmission time.
+///
+struct TxTimeDrops
+{
+    /// Number of frames which have been dropped because their deadline has passed while they were queued.
+    std::uint64_t missed;
+
+    /// Number of frames which have been rejected at the moment of sending (f.e. the deadline was already in the past).
+    std::uint64_t invalid;
+};
+
+/// Converts a transmission deadline (in executor time) to the `SCM_TXTIME` transmission time.
+///
+/// The ETF queuing discipline accepts `CLOCK_TAI` time only, so the deadline is converted relative to the current
+/// executor time. An already expired deadline is converted as well (to a time point in the past),
+/// so that the kernel will reject the frame. Returns zero (which means "no transmission time") if not supported.
+///
+inline std::uint64_t makeTxTime(const libcyphal::TimePoint deadline, const libcyphal::TimePoint now)
+{
+#ifdef CLOCK_TAI  // Linux
+    timespec tai_now{};
+    if (::clock_gettime(CLOCK_TAI, &tai_now) != 0)
+    {
+        return 0;
+    }
+    const auto tai_deadline = std::chrono::seconds{tai_now.tv_sec} + std::chrono::nanoseconds{tai_now.tv_nsec} +
+                              std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+    return (tai_deadline.count() > 0) ? static_cast<std::uint64_t>(tai_deadline.count()) : 1U;
+#else
+    (void) deadline;
+    (void) now;
+    return 0;
+#endif
+}
+
+}  // namespace posix
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_POSIX_TX_TIME_HPP_INCLUDED
@@ -0,0 +1,244 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+///
+
+#ifndef EXAMPLE_PLATFORM_POSIX_SERIAL_MEDIA_HPP_INCLUDED
+#define EXAMPLE_PLATFORM_POSIX_SERIAL_MEDIA_HPP_INCLUDED
+
+#include "../posix_executor_extension.hpp"
+#include "../posix_platform_error.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/config.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/serial/media.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+#include <utility>
+
+namespace example
+{
+namespace platform
+{
+namespace posix
+{
+
+/// Implements serial media on top of a POSIX file descriptor of a byte stream -
+/// f.e. one end of a UNIX socket pair, a pseudo-terminal, or a UART device.
+///
+class SerialMedia final : public libcyphal::transport::serial::IMedia
+{
+public:
+    using MakeResult = cetl::variant<SerialMedia, libcyphal::transport::PlatformError>;
+
+    /// Makes a pair of connected media (over `::socketpair`) - handy for local loopback tests.
+    ///
+    CETL_NODISCARD static cetl::variant<std::pair<SerialMedia, SerialMedia>, libcyphal::transport::PlatformError>
+    makeSocketPair(libcyphal::IExecutor& executor)
+    {
+        std::array<int, 2> fds{};
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()) < 0)
+        {
+            return libcyphal::transport::PlatformError{PosixPlatformError{errno}};
+        }
+
+        auto maybe_media0 = make(executor, fds[0]);
+        auto maybe_media1 = make(executor, fds[1]);
+        if (auto* const error = cetl::get_if<libcyphal::transport::PlatformError>(&maybe_media0))
+        {
+            return std::move(*error);
+        }
+        if (auto* const error = cetl::get_if<libcyphal::transport::PlatformError>(&maybe_media1))
+        {
+            return std::move(*error);
+        }
+        return std::make_pair(cetl::get<SerialMedia>(std::move(maybe_media0)),
+                              cetl::get<SerialMedia>(std::move(maybe_media1)));
+    }
+
+    /// Opens a serial (tty) device, like "/dev/ttyUSB0" or a pseudo-terminal, and switches it to the raw mode.
+    ///
+    CETL_NODISCARD static MakeResult open(libcyphal::IExecutor& executor, const std::string& device_path)
+    {
+        const int fd = ::open(device_path.c_str(), O_RDWR | O_NOCTTY);  // NOLINT(*-vararg)
+        if (fd < 0)
+        {
+            return libcyphal::transport::PlatformError{PosixPlatformError{errno}};
+        }
+
+        ::termios tio{};
+        if (::tcgetattr(fd, &tio) == 0)
+        {
+            ::cfmakeraw(&tio);
+            (void) ::tcsetattr(fd, TCSANOW, &tio);
+        }
+
+        return make(executor, fd);
+    }
+
+    /// Makes media on top of the given (already opened) byte stream file descriptor.
+    ///
+    /// The media takes ownership of the descriptor (even in case of a failure).
+    ///
+    CETL_NODISCARD static MakeResult make(libcyphal::IExecutor& executor, const int fd)
+    {
+        // We gonna register separate callbacks for rx & tx (aka read & write),
+        // so at executor (especially in case of the "epoll" one) we need separate file descriptors.
+        //
+        const int tx_fd = ::dup(fd);
+        if ((tx_fd < 0) || !setNonBlocking(fd) || !setNonBlocking(tx_fd))
+        {
+            const int error_code = errno;
+            (void) ::close(fd);
+            if (tx_fd >= 0)
+            {
+                (void) ::close(tx_fd);
+            }
+            return libcyphal::transport::PlatformError{PosixPlatformError{error_code}};
+        }
+
+        return SerialMedia{executor, fd, tx_fd};
+    }
+
+    ~SerialMedia()
+    {
+        if (rx_fd_ >= 0)
+        {
+            (void) ::close(rx_fd_);
+        }
+        if (tx_fd_ >= 0)
+        {
+            (void) ::close(tx_fd_);
+        }
+    }
+
+    SerialMedia(const SerialMedia&)            = delete;
+    SerialMedia& operator=(const SerialMedia&) = delete;
+
+    SerialMedia(SerialMedia&& other) noexcept
+        : executor_{other.executor_}
+        , rx_fd_{std::exchange(other.rx_fd_, -1)}
+        , tx_fd_{std::exchange(other.tx_fd_, -1)}
+    {
+    }
+    SerialMedia& operator=(SerialMedia&&) noexcept = delete;
+
+private:
+    static constexpr std::size_t MaxIoVectors = libcyphal::config::Transport::Serial::ISerialTransport_WriteMaxFrames();
+
+    SerialMedia(libcyphal::IExecutor& executor, const int rx_fd, const int tx_fd)
+        : executor_{executor}
+        , rx_fd_{rx_fd}
+        , tx_fd_{tx_fd}
+    {
+    }
+
+    static bool setNonBlocking(const int fd)
+    {
+        const int flags = ::fcntl(fd, F_GETFL, 0);  // NOLINT(*-vararg)
+        return (flags >= 0) && (::fcntl(fd, F_SETFL, flags | O_NONBLOCK) >= 0);  // NOLINT(*-vararg)
+    }
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerAwaitableCallback(
+        libcyphal::IExecutor::Callback::Function&&       function,
+        const IPosixExecutorExtension::Trigger::Variant& trigger) const
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor_);
+        if (nullptr == posix_executor_ext)
+        {
+            return {};
+        }
+
+        return posix_executor_ext->registerAwaitableCallback(std::move(function), trigger);
+    }
+
+    // MARK: - IMedia
+
+    CETL_NODISCARD ReadResult::Type read(const cetl::span<cetl::byte> buffer) noexcept override
+    {
+        const auto result = ::read(rx_fd_, buffer.data(), buffer.size());
+        if (result < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))
+            {
+                return cetl::nullopt;
+            }
+            return libcyphal::transport::PlatformError{PosixPlatformError{errno}};
+        }
+        if (result == 0)
+        {
+            // The other end has been closed - nothing to read anymore.
+            return cetl::nullopt;
+        }
+
+        return ReadResult::Metadata{executor_.now(), static_cast<std::size_t>(result)};
+    }
+
+    WriteResult::Type write(const libcyphal::transport::PayloadFragments fragments) noexcept override
+    {
+        // Vectorized write of (potentially) multiple frames by a single system call.
+        std::array<::iovec, MaxIoVectors> iov{};
+        std::size_t                       iov_count = 0;
+        for (const auto fragment : fragments)
+        {
+            if (iov_count == iov.size())
+            {
+                break;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            iov[iov_count++] = ::iovec{const_cast<cetl::byte*>(fragment.data()), fragment.size()};
+        }
+
+        const auto result = ::writev(tx_fd_, iov.data(), static_cast<int>(iov_count));
+        if (result < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))
+            {
+                return WriteResult::Success{0};
+            }
+            return libcyphal::transport::PlatformError{PosixPlatformError{errno}};
+        }
+
+        return WriteResult::Success{static_cast<std::size_t>(result)};
+    }
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerWriteCallback(
+        libcyphal::IExecutor::Callback::Function&& function) override
+    {
+        return registerAwaitableCallback(std::move(function), IPosixExecutorExtension::Trigger::Writable{tx_fd_});
+    }
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerReadCallback(
+        libcyphal::IExecutor::Callback::Function&& function) override
+    {
+        return registerAwaitableCallback(std::move(function), IPosixExecutorExtension::Trigger::Readable{rx_fd_});
+    }
+
+    // MARK: Data members:
+
+    libcyphal::IExecutor& executor_;
+    int                   rx_fd_;
+    int                   tx_fd_;
+
+};  // SerialMedia
+
+}  // namespace posix
+}  // namespace platform
+}  // namespace example
+
+#endif  // EXAMPLE_PLATFORM_POSIX_SERIAL_MEDIA_HPP_INCLUDED
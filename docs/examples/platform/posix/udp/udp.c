@@ -14,10 +14,18 @@
 #include <fcntl.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
+#include <sys/time.h>
 #include <unistd.h>
 #include <poll.h>
 #include <errno.h>
 #include <limits.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#    include <linux/errqueue.h>
+#    include <linux/net_tstamp.h>
+#endif
 
 /// This is the value recommended by the Cyphal/UDP specification.
 #define OVERRIDE_TTL 16
@@ -25,6 +33,9 @@
 /// RFC 2474.
 #define DSCP_MAX 63
 
+#define NANOS_PER_SECOND 1000000000ULL
+#define NANOS_PER_MICRO 1000ULL
+
 static bool isMulticast(const uint32_t address)
 {
     return (address & 0xF0000000UL) == 0xE0000000UL;  // NOLINT(*-magic-numbers)
@@ -70,7 +81,8 @@ int16_t udpTxSend(UDPTxHandle* const self,
                   const uint16_t     remote_port,
                   const uint8_t      dscp,
                   const size_t       payload_size,
-                  const void* const  payload)
+                  const void* const  payload,
+                  const uint64_t     txtime_nsec)
 {
     int16_t res = -EINVAL;
     if ((self != NULL) && (self->fd >= 0) && (remote_address > 0) && (remote_port > 0) && (payload != NULL) &&
@@ -78,15 +90,37 @@ int16_t udpTxSend(UDPTxHandle* const self,
     {
         const int dscp_int = dscp << 2U;  // The 2 least significant bits are used for the ECN field.
         (void) setsockopt(self->fd, IPPROTO_IP, IP_TOS, &dscp_int, sizeof(dscp_int));  // Best effort.
-        const ssize_t send_result =
-            sendto(self->fd,
-                   payload,
-                   payload_size,
-                   MSG_DONTWAIT,
-                   (struct sockaddr*) &(struct sockaddr_in){.sin_family = AF_INET,
-                                                            .sin_addr   = {.s_addr = htonl(remote_address)},
-                                                            .sin_port   = htons(remote_port)},
-                   sizeof(struct sockaddr_in));
+        struct sockaddr_in remote_addr = {.sin_family = AF_INET,
+                                          .sin_addr   = {.s_addr = htonl(remote_address)},
+                                          .sin_port   = htons(remote_port)};
+        struct iovec       iov         = {.iov_base = (void*) payload, .iov_len = payload_size};
+        struct msghdr      msg         = {.msg_name    = &remote_addr,
+                                          .msg_namelen = sizeof(remote_addr),
+                                          .msg_iov     = &iov,
+                                          .msg_iovlen  = 1};
+#ifdef SCM_TXTIME  // Linux
+        // The transmission time is passed to the kernel as ancillary data (see SO_TXTIME in socket(7)).
+        // The ancillary data buffer is wrapped in a union to ensure it is suitably aligned.
+        union
+        {
+            uint8_t        buf[CMSG_SPACE(sizeof(uint64_t))];
+            struct cmsghdr align;
+        } control;
+        if (txtime_nsec > 0)
+        {
+            (void) memset(control.buf, 0, sizeof(control.buf));
+            msg.msg_control            = control.buf;
+            msg.msg_controllen         = sizeof(control.buf);
+            struct cmsghdr* const cmsg = CMSG_FIRSTHDR(&msg);
+            cmsg->cmsg_level           = SOL_SOCKET;
+            cmsg->cmsg_type            = SCM_TXTIME;
+            cmsg->cmsg_len             = CMSG_LEN(sizeof(uint64_t));
+            (void) memcpy(CMSG_DATA(cmsg), &txtime_nsec, sizeof(txtime_nsec));  // Copy to avoid alignment problems.
+        }
+#else
+        (void) txtime_nsec;
+#endif
+        const ssize_t send_result = sendmsg(self->fd, &msg, MSG_DONTWAIT);
         if (send_result == (ssize_t) payload_size)
         {
             res = 1;
@@ -103,6 +137,79 @@ int16_t udpTxSend(UDPTxHandle* const self,
     return res;
 }
 
+int16_t udpTxEnableTxTime(UDPTxHandle* const self, const bool deadline_mode)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#ifdef SO_TXTIME  // Linux
+        // ETF queuing discipline accepts CLOCK_TAI only.
+        const struct sock_txtime txtime = {
+            .clockid = CLOCK_TAI,
+            .flags   = SOF_TXTIME_REPORT_ERRORS | (deadline_mode ? SOF_TXTIME_DEADLINE_MODE : 0U),
+        };
+        res = (setsockopt(self->fd, SOL_SOCKET, SO_TXTIME, &txtime, sizeof(txtime)) == 0) ? 0 : (int16_t) -errno;
+#else
+        (void) deadline_mode;
+        res = -ENOSYS;
+#endif
+    }
+    return res;
+}
+
+int16_t udpTxReadTxTimeErrors(UDPTxHandle* const self, uint64_t* const inout_missed, uint64_t* const inout_invalid)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (inout_missed != NULL) && (inout_invalid != NULL))
+    {
+#ifdef SO_TXTIME  // Linux
+        res = 0;
+        for (;;)
+        {
+            // IPv4 error queue reports the extended error along with the offender address (see ip(7) IP_RECVERR).
+            // The dropped datagram itself is not needed, so it is truncated.
+            union
+            {
+                uint8_t        buf[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in))];
+                struct cmsghdr align;
+            } control;
+            struct msghdr msg = {.msg_control = control.buf, .msg_controllen = sizeof(control.buf)};
+            if (recvmsg(self->fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+            {
+                if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+                {
+                    res = (int16_t) -errno;
+                }
+                break;
+            }
+            for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+            {
+                if ((cmsg->cmsg_level != IPPROTO_IP) || (cmsg->cmsg_type != IP_RECVERR))
+                {
+                    continue;
+                }
+                struct sock_extended_err err;
+                (void) memcpy(&err, CMSG_DATA(cmsg), sizeof(err));  // Copy to avoid alignment problems.
+                if (err.ee_origin == SO_EE_ORIGIN_TXTIME)
+                {
+                    if (err.ee_code == SO_EE_CODE_TXTIME_MISSED)
+                    {
+                        ++*inout_missed;
+                    }
+                    else
+                    {
+                        ++*inout_invalid;
+                    }
+                }
+            }
+        }
+#else
+        res = 0;  // There is no SO_TXTIME, so there are no such errors.
+#endif
+    }
+    return res;
+}
+
 void udpTxClose(UDPTxHandle* const self)
 {
     if ((self != NULL) && (self->fd >= 0))
@@ -149,6 +256,12 @@ int16_t udpRxInit(UDPRxHandle* const self,
         // This is needed to inform the networking stack of which local interface to use for IGMP membership reports.
         const struct in_addr tuple[2] = {{.s_addr = htonl(multicast_group)}, {.s_addr = htonl(local_iface_address)}};
         ok = ok && (setsockopt(self->fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &tuple[0], sizeof(tuple)) == 0);
+        // Enable kernel time-stamping of received datagrams.
+#ifdef SO_TIMESTAMPNS  // Linux
+        ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_TIMESTAMPNS, &reuse, sizeof(reuse)) == 0);
+#elif defined(SO_TIMESTAMP)
+        ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_TIMESTAMP, &reuse, sizeof(reuse)) == 0);
+#endif
         if (ok)
         {
             res = 0;
@@ -163,16 +276,91 @@ int16_t udpRxInit(UDPRxHandle* const self,
     return res;
 }
 
-int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size, void* const out_payload)
+int16_t udpRxEnableHardwareTimestamps(UDPRxHandle* const self)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#ifdef SO_TIMESTAMPING  // Linux
+        const int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+        res = (setsockopt(self->fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0) ? 0 : (int16_t) -errno;
+#else
+        res = -ENOSYS;
+#endif
+    }
+    return res;
+}
+
+/// Extracts the kernel time stamp from the ancillary data of a received message.
+/// The hardware time stamp is present only if enabled by udpRxEnableHardwareTimestamps(), and is preferred then.
+static uint64_t getRxTimestamp(struct msghdr* const msg)
+{
+    uint64_t sw_nsec = 0;
+    uint64_t hw_nsec = 0;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL; cmsg = CMSG_NXTHDR(msg, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET)
+        {
+            continue;
+        }
+#ifdef SCM_TIMESTAMPNS  // Linux
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            struct timespec ts;
+            (void) memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));  // Copy to avoid alignment problems.
+            sw_nsec = ((uint64_t) ts.tv_sec * NANOS_PER_SECOND) + (uint64_t) ts.tv_nsec;
+        }
+#elif defined(SCM_TIMESTAMP)
+        if (cmsg->cmsg_type == SCM_TIMESTAMP)
+        {
+            struct timeval tv;
+            (void) memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));  // Copy to avoid alignment problems.
+            sw_nsec = ((uint64_t) tv.tv_sec * NANOS_PER_SECOND) + ((uint64_t) tv.tv_usec * NANOS_PER_MICRO);
+        }
+#endif
+#ifdef SCM_TIMESTAMPING  // Linux
+        if (cmsg->cmsg_type == SCM_TIMESTAMPING)
+        {
+            struct timespec ts[3];  // Software, deprecated, and raw hardware time stamps.
+            (void) memcpy(&ts[0], CMSG_DATA(cmsg), sizeof(ts));  // Copy to avoid alignment problems.
+            hw_nsec = ((uint64_t) ts[2].tv_sec * NANOS_PER_SECOND) + (uint64_t) ts[2].tv_nsec;
+        }
+#endif
+    }
+    return (hw_nsec > 0) ? hw_nsec : sw_nsec;
+}
+
+int16_t udpRxReceive(UDPRxHandle* const self,
+                     size_t* const      inout_payload_size,
+                     void* const        out_payload,
+                     uint64_t* const    out_timestamp_nsec)
 {
     int16_t res = -EINVAL;
     if ((self != NULL) && (self->fd >= 0) && (inout_payload_size != NULL) && (out_payload != NULL))
     {
-        const ssize_t recv_result = recv(self->fd, out_payload, *inout_payload_size, MSG_DONTWAIT);
+        // The ancillary data buffer is wrapped in a union to ensure it is suitably aligned.
+        // It is large enough for both software and (three) hardware time stamps.
+        union
+        {
+            uint8_t        buf[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(3 * sizeof(struct timespec))];
+            struct cmsghdr align;
+        } control;
+        struct iovec  iov = {.iov_base = out_payload, .iov_len = *inout_payload_size};
+        struct msghdr msg = {.msg_iov = &iov, .msg_iovlen = 1};
+        if (out_timestamp_nsec != NULL)
+        {
+            msg.msg_control    = control.buf;
+            msg.msg_controllen = sizeof(control.buf);
+        }
+        const ssize_t recv_result = recvmsg(self->fd, &msg, MSG_DONTWAIT);
         if (recv_result >= 0)
         {
             *inout_payload_size = (size_t) recv_result;
-            res                 = 1;
+            if (out_timestamp_nsec != NULL)
+            {
+                *out_timestamp_nsec = getRxTimestamp(&msg);
+            }
+            res = 1;
         }
         else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
         {
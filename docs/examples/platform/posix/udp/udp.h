@@ -50,14 +50,33 @@ typedef struct
 int16_t udpTxInit(UDPTxHandle* const self, const uint32_t local_iface_address);
 
 /// Send a datagram to the specified endpoint without blocking using the specified IP DSCP field value.
-/// A real-time embedded system should normally accept a transmission deadline here for the networking stack.
+/// The transmission time (CLOCK_TAI, in nanoseconds) is passed to the networking stack along with the datagram;
+/// it requires the SO_TXTIME socket option (see udpTxEnableTxTime()). Zero transmission time means none.
 /// Returns 1 on success, 0 if the socket is not ready for sending, or a negative error code.
 int16_t udpTxSend(UDPTxHandle* const self,
                   const uint32_t     remote_address,
                   const uint16_t     remote_port,
                   const uint8_t      dscp,
                   const size_t       payload_size,
-                  const void* const  payload);
+                  const void* const  payload,
+                  const uint64_t     txtime_nsec);
+
+/// Enable the SO_TXTIME socket option (GNU/Linux only), so that datagrams sent with non-zero transmission time
+/// are scheduled by the ETF queuing discipline of the egress interface (other disciplines ignore the time).
+/// In the deadline mode, the transmission time is the latest moment when the datagram may still be sent - ETF sends
+/// the datagram as soon as possible, and drops it if the deadline has passed (requires ETF "deadline_mode" option).
+/// Otherwise, the transmission time is the exact launch time of the datagram.
+/// Datagrams dropped by the kernel are reported via the socket error queue; see udpTxReadTxTimeErrors().
+/// On error returns a negative error code.
+int16_t udpTxEnableTxTime(UDPTxHandle* const self, const bool deadline_mode);
+
+/// Drain the socket error queue without blocking, and count datagrams dropped by the kernel because of their
+/// transmission time: either because it has been missed while the datagram was queued, or because it was invalid
+/// (already in the past, or earlier than transmission time of a previously queued datagram) at the moment of sending.
+/// The counters are incremented (not assigned), so they can accumulate totals across calls.
+/// Errors of other origins (like ICMP ones) are drained from the queue and ignored.
+/// On error returns a negative error code.
+int16_t udpTxReadTxTimeErrors(UDPTxHandle* const self, uint64_t* const inout_missed, uint64_t* const inout_invalid);
 
 /// No effect if the argument is invalid.
 /// This function is guaranteed to invalidate the handle.
@@ -76,8 +95,21 @@ int16_t udpRxInit(UDPRxHandle* const self,
 /// Read one datagram from the socket without blocking.
 /// The size of the destination buffer is specified in inout_payload_size; it is updated to the actual size of the
 /// received datagram upon return.
+/// If out_timestamp_nsec is not NULL, it receives the kernel time stamp of the datagram arrival (CLOCK_REALTIME,
+/// in nanoseconds); a hardware time stamp is used instead only if enabled by udpRxEnableHardwareTimestamps().
+/// Zero is reported if the time stamp is not available.
 /// Returns 1 on success, 0 if the socket is not ready for reading, or a negative error code.
-int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size, void* const out_payload);
+int16_t udpRxReceive(UDPRxHandle* const self,
+                     size_t* const      inout_payload_size,
+                     void* const        out_payload,
+                     uint64_t* const    out_timestamp_nsec);
+
+/// Enable reporting of hardware time stamps of received datagrams (SO_TIMESTAMPING, GNU/Linux only), which are then
+/// preferred by udpRxReceive() over the software ones (where the interface has been configured to make them).
+/// Hardware time stamps come from the clock of the NIC (PHC), which is usually either free-running or TAI -
+/// so this is only correct if the PHC is synchronized to CLOCK_REALTIME (f.e. by phc2sys); otherwise leave it off.
+/// On error returns a negative error code.
+int16_t udpRxEnableHardwareTimestamps(UDPRxHandle* const self);
 
 /// No effect if the argument is invalid.
 /// This function is guaranteed to invalidate the handle.
@@ -7,6 +7,7 @@
 #ifndef EXAMPLE_PLATFORM_POSIX_UPD_MEDIA_HPP_INCLUDED
 #define EXAMPLE_PLATFORM_POSIX_UPD_MEDIA_HPP_INCLUDED
 
+#include "../posix_tx_time.hpp"
 #include "udp_sockets.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
@@ -53,6 +54,30 @@ public:
             return {media_ifaces_.data(), media_ifaces_.size()};
         }
 
+        /// Switches kernel-side transmission deadlines of all media of the collection (see `UdpMedia::setTxDeadlines`).
+        ///
+        void setTxDeadlines(const bool enabled)
+        {
+            for (auto& media : media_vector_)
+            {
+                media.setTxDeadlines(enabled);
+            }
+        }
+
+        /// Gets total numbers of datagrams dropped by the kernel (across all media of the collection).
+        ///
+        TxTimeDrops getTxTimeDrops()
+        {
+            TxTimeDrops total{};
+            for (auto& media : media_vector_)
+            {
+                const auto& drops = media.getTxTimeDrops();
+                total.missed += drops.missed;
+                total.invalid += drops.invalid;
+            }
+            return total;
+        }
+
         void reset()
         {
             media_vector_.clear();
@@ -68,6 +93,8 @@ public:
         : memory_{memory}
         , executor_{executor}
         , iface_address_{std::move(iface_address)}
+        , tx_deadlines_{false}
+        , tx_time_drops_{}
     {
     }
     ~UdpMedia() = default;
@@ -80,7 +107,32 @@ public:
         : memory_{other.memory_}
         , executor_{other.executor_}
         , iface_address_{other.iface_address_}
+        , tx_deadlines_{other.tx_deadlines_}
+        , tx_time_drops_{other.tx_time_drops_}
+    {
+    }
+
+    /// Switches kernel-side enforcement of transmission deadlines for TX sockets made afterward.
+    ///
+    /// Sockets with enabled deadlines turn on the `SO_TXTIME` socket option (in the deadline mode), and pass
+    /// the transfer deadline of every datagram to the kernel. Given that the ETF queuing discipline is configured
+    /// on the egress interface (f.e. `tc qdisc replace dev eth0 parent 100:1 etf clockid CLOCK_TAI delta 200000
+    /// deadline_mode`), stale datagrams are dropped in the kernel instead of going out late.
+    /// Other queuing disciplines (including the one of the loopback interface) ignore the deadlines.
+    /// Supported on GNU/Linux only - making of TX sockets fails on other platforms.
+    ///
+    void setTxDeadlines(const bool enabled) noexcept
+    {
+        tx_deadlines_ = enabled;
+    }
+
+    /// Gets total numbers of datagrams dropped by the kernel because of their transmission deadlines.
+    ///
+    /// Kernel reports such drops via socket error queues, which are drained here (as well as on every send).
+    ///
+    CETL_NODISCARD const TxTimeDrops& getTxTimeDrops()
     {
+        return tx_time_drops_.get();
     }
 
 private:
@@ -88,7 +140,7 @@ private:
 
     MakeTxSocketResult::Type makeTxSocket() override
     {
-        return UdpTxSocket::make(memory_, executor_, iface_address_);
+        return UdpTxSocket::make(memory_, executor_, iface_address_, tx_deadlines_ ? &tx_time_drops_ : nullptr);
     }
 
     MakeRxSocketResult::Type makeRxSocket(const libcyphal::transport::udp::IpEndpoint& multicast_endpoint) override
@@ -106,6 +158,8 @@ private:
     cetl::pmr::memory_resource& memory_;
     libcyphal::IExecutor&       executor_;
     std::string                 iface_address_;
+    bool                        tx_deadlines_;
+    UdpTxTimeDrops              tx_time_drops_;
 
 };  // UdpMedia
 
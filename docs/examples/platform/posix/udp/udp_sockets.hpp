@@ -9,6 +9,8 @@
 
 #include "../posix_executor_extension.hpp"
 #include "../posix_platform_error.hpp"
+#include "../posix_rx_time.hpp"
+#include "../posix_tx_time.hpp"
 #include "udp.h"
 
 #include <cetl/cetl.hpp>
@@ -22,12 +24,14 @@
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 #include <libcyphal/types.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace example
 {
@@ -36,22 +40,80 @@ namespace platform
 namespace posix
 {
 
+/// Accumulates kernel-side transmission time drops of TX sockets, and keeps track of the alive ones -
+/// so that their error queues could be drained on demand (and not only on the next send).
+///
+class UdpTxTimeDrops final
+{
+public:
+    /// Drains error queues of all alive sockets, and gets the total numbers of drops.
+    ///
+    CETL_NODISCARD const TxTimeDrops& get()
+    {
+        for (UDPTxHandle* const handle : handles_)
+        {
+            read(*handle);
+        }
+        return drops_;
+    }
+
+private:
+    friend class UdpTxSocket;
+
+    void read(UDPTxHandle& handle)
+    {
+        (void) ::udpTxReadTxTimeErrors(&handle, &drops_.missed, &drops_.invalid);
+    }
+
+    void add(UDPTxHandle& handle)
+    {
+        handles_.push_back(&handle);
+    }
+
+    void remove(UDPTxHandle& handle)
+    {
+        read(handle);
+        handles_.erase(std::remove(handles_.begin(), handles_.end(), &handle), handles_.end());
+    }
+
+    TxTimeDrops               drops_{};
+    std::vector<UDPTxHandle*> handles_;
+
+};  // UdpTxTimeDrops
+
+/// Implements UDP TX socket on top of POSIX sockets.
+///
+/// If the socket is made with transmission time drops counters, transfer deadlines are enforced by the kernel
+/// (via `SO_TXTIME` in the deadline mode) - see `UdpMedia::setTxDeadlines` for details. Every send drains
+/// the socket error queue and accumulates kernel-side drops into the counters (which must outlive the socket).
+/// The counters also drain the queue on demand (see `UdpTxTimeDrops::get`) for as long as the socket is alive.
+///
 class UdpTxSocket final : public libcyphal::transport::udp::ITxSocket
 {
 public:
     CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
         cetl::pmr::memory_resource& memory,
         libcyphal::IExecutor&       executor,
-        const std::string&          iface_address)
+        const std::string&          iface_address,
+        UdpTxTimeDrops* const       tx_time_drops = nullptr)
     {
         UDPTxHandle handle{-1};
-        const auto  result = ::udpTxInit(&handle, ::udpParseIfaceAddress(iface_address.c_str()));
+        auto        result = ::udpTxInit(&handle, ::udpParseIfaceAddress(iface_address.c_str()));
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
         }
+        if (tx_time_drops != nullptr)
+        {
+            result = ::udpTxEnableTxTime(&handle, true);
+            if (result < 0)
+            {
+                ::udpTxClose(&handle);
+                return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
+            }
+        }
 
-        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(memory, executor, handle);
+        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(memory, executor, handle, tx_time_drops);
         if (tx_socket == nullptr)
         {
             ::udpTxClose(&handle);
@@ -61,15 +123,25 @@ public:
         return tx_socket;
     }
 
-    UdpTxSocket(libcyphal::IExecutor& executor, UDPTxHandle udp_handle)
+    UdpTxSocket(libcyphal::IExecutor& executor, UDPTxHandle udp_handle, UdpTxTimeDrops* const tx_time_drops = nullptr)
         : udp_handle_{udp_handle}
         , executor_{executor}
+        , tx_time_drops_{tx_time_drops}
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+
+        if (tx_time_drops_ != nullptr)
+        {
+            tx_time_drops_->add(udp_handle_);
+        }
     }
 
     ~UdpTxSocket()
     {
+        if (tx_time_drops_ != nullptr)
+        {
+            tx_time_drops_->remove(udp_handle_);
+        }
         ::udpTxClose(&udp_handle_);
     }
 
@@ -81,7 +153,7 @@ public:
 private:
     // MARK: ITxSocket
 
-    SendResult::Type send(const libcyphal::TimePoint,
+    SendResult::Type send(const libcyphal::TimePoint                   deadline,
                           const libcyphal::transport::udp::IpEndpoint  multicast_endpoint,
                           const std::uint8_t                           dscp,
                           const libcyphal::transport::PayloadFragments payload_fragments) override
@@ -89,12 +161,20 @@ private:
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
         CETL_DEBUG_ASSERT(payload_fragments.size() == 1, "");
 
+        std::uint64_t txtime_nsec = 0;
+        if (tx_time_drops_ != nullptr)
+        {
+            tx_time_drops_->read(udp_handle_);
+            txtime_nsec = makeTxTime(deadline, executor_.now());
+        }
+
         const std::int16_t result = ::udpTxSend(&udp_handle_,
                                                 multicast_endpoint.ip_address,
                                                 multicast_endpoint.udp_port,
                                                 dscp,
                                                 payload_fragments[0].size(),
-                                                payload_fragments[0].data());
+                                                payload_fragments[0].data(),
+                                                txtime_nsec);
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
@@ -122,11 +202,17 @@ private:
 
     UDPTxHandle           udp_handle_;
     libcyphal::IExecutor& executor_;
+    UdpTxTimeDrops* const tx_time_drops_;
 
 };  // UdpTxSocket
 
 // MARK: -
 
+/// Implements UDP RX socket on top of POSIX sockets.
+///
+/// Received datagrams are stamped by the kernel (by `CLOCK_REALTIME`) at the moment of their arrival,
+/// and the time stamps are mapped into the executor time domain.
+///
 class UdpRxSocket final : public libcyphal::transport::udp::IRxSocket
 {
 public:
@@ -186,8 +272,9 @@ private:
         // TODO: Eliminate tmp buffer and memmove when https://github.com/OpenCyphal/libudpard/issues/58 is resolved.
         //
         std::array<cetl::byte, BufferSize> buffer{};
-        std::size_t                        inout_size = buffer.size();
-        const std::int16_t                 result     = ::udpRxReceive(&udp_handle_, &inout_size, buffer.data());
+        std::size_t                        inout_size     = buffer.size();
+        std::uint64_t                      timestamp_nsec = 0;
+        const std::int16_t result = ::udpRxReceive(&udp_handle_, &inout_size, buffer.data(), &timestamp_nsec);
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{PosixPlatformError{-result}};
@@ -204,7 +291,7 @@ private:
         }
         (void) std::memmove(allocated_buffer, buffer.data(), inout_size);
 
-        return ReceiveResult::Metadata{executor_.now(),
+        return ReceiveResult::Metadata{mapRxTime(timestamp_nsec, executor_.now()),
                                        {static_cast<cetl::byte*>(allocated_buffer),
                                         libcyphal::PmrRawBytesDeleter{inout_size, &memory_}}};
     }
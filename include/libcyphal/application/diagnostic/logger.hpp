@@ -0,0 +1,289 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_DIAGNOSTIC_LOGGER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_DIAGNOSTIC_LOGGER_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/types.hpp"
+#include "record_ring.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/diagnostic/Record_1_1.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace diagnostic
+{
+
+/// @brief Defines rate-limited diagnostic logger component (see `uavcan.diagnostic.Record`).
+///
+/// The logger periodically drains records from the given ring (see `RecordRing`), and publishes them.
+/// So, the (de)serialization and transport work is done in the executor context, and never inline
+/// with the code which logs (pushes records into the ring).
+///
+/// Publication is controlled by a per-severity token bucket rate limiter (see `setRateLimit`), so that
+/// logging can't starve the bus. Records exceeding the limit are suppressed (not published, and counted);
+/// as soon as publication of the severity resumes, a summary record (like "12 records suppressed")
+/// is published first - so that the receiving side knows about the gap.
+///
+/// Note that `timestamp` of published records is zero (aka unknown) - there is no synchronized time yet.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the draining callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class Logger final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the diagnostic record.
+    ///
+    using Message = uavcan::diagnostic::Record_1_1;
+
+    /// @brief Defines parameters of a token bucket rate limiter.
+    ///
+    struct RateLimit
+    {
+        /// Number of records per second which could be published on average. Zero suppresses all records.
+        std::uint32_t rate;
+
+        /// Max number of records which could be published in a burst (after a quiet period).
+        std::uint32_t burst;
+    };
+
+    /// @brief Factory method to create a diagnostic logger instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Record' publisher.
+    /// @param ring The ring of records to drain. Should outlive the logger.
+    /// @return The diagnostic logger instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation, RecordRing& ring)
+        -> Expected<Logger, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_pub = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_pub))
+        {
+            return std::move(*failure);
+        }
+
+        return Logger{presentation, ring, cetl::get<Publisher>(std::move(maybe_pub))};
+    }
+
+    Logger(Logger&& other) noexcept
+        : presentation_{other.presentation_}
+        , ring_{other.ring_}
+        , publisher_{std::move(other.publisher_)}
+        , message_{std::move(other.message_)}
+        , buckets_{other.buckets_}
+        , drain_period_{other.drain_period_}
+        , last_drain_time_{other.last_drain_time_}
+        , suppressed_count_{other.suppressed_count_}
+    {
+        // We can't move `drain_cb_` callback (b/c it captures its own `this` pointer),
+        // so we need to stop it in the moved-from object, and start in the new one.
+        other.stopDraining();
+        startDraining();
+    }
+
+    ~Logger() = default;
+
+    Logger(const Logger&)                = delete;
+    Logger& operator=(const Logger&)     = delete;
+    Logger& operator=(Logger&&) noexcept = delete;
+
+    /// @brief Sets rate limit of the given severity (default is 10 records per second, with burst of 10).
+    ///
+    /// Applied starting from the next drain. The bucket is refilled to the new burst value.
+    ///
+    Logger& setRateLimit(const Severity severity, const RateLimit rate_limit) noexcept
+    {
+        auto& bucket  = buckets_[static_cast<std::size_t>(severity)];
+        bucket.limit  = rate_limit;
+        bucket.credit = getMaxCredit(bucket);
+        return *this;
+    }
+
+    /// @brief Sets period of the ring draining (default is 10ms).
+    ///
+    Logger& setDrainPeriod(const Duration period)
+    {
+        CETL_DEBUG_ASSERT(period > Duration::zero(), "");
+
+        drain_period_ = period;
+        startDraining();
+        return *this;
+    }
+
+    /// @brief Gets total number of records suppressed by the rate limiter.
+    ///
+    /// Note that records dropped b/c of the full ring are counted separately (see `RecordRing::getDroppedCount`).
+    ///
+    std::uint32_t getSuppressedCount() const noexcept
+    {
+        return suppressed_count_;
+    }
+
+private:
+    using Callback  = IExecutor::Callback;
+    using Publisher = presentation::Publisher<Message>;
+
+    struct Bucket
+    {
+        RateLimit     limit;
+        Duration      credit;
+        std::uint32_t suppressed;
+    };
+
+    Logger(presentation::Presentation& presentation, RecordRing& ring, Publisher&& publisher)
+        : presentation_{presentation}
+        , ring_{ring}
+        , publisher_{std::move(publisher)}
+        , message_{Message::allocator_type{&presentation.memory()}}
+        , drain_period_{std::chrono::milliseconds{10}}
+        , last_drain_time_{presentation.executor().now()}
+        , suppressed_count_{0}
+    {
+        // Reserve the text once, so that draining doesn't allocate memory for each record.
+        message_.text.reserve(RecordRing::TextCapacity);
+
+        for (std::size_t severity = 0; severity < SeverityCount; ++severity)
+        {
+            setRateLimit(static_cast<Severity>(severity), RateLimit{10, 10});  // NOLINT(*-magic-numbers)
+        }
+        startDraining();
+    }
+
+    void startDraining()
+    {
+        drain_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            drain(arg.approx_now);
+        });
+
+        const auto first_exec_time = presentation_.executor().now() + drain_period_;
+        const auto result          = drain_cb_.schedule(Callback::Schedule::Repeat{first_exec_time, drain_period_});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void stopDraining()
+    {
+        drain_cb_.reset();
+    }
+
+    /// Each record costs `1s / rate` of credit, and the credit is accumulated with time - up to the `burst` records.
+    ///
+    static Duration getCost(const Bucket& bucket) noexcept
+    {
+        return std::chrono::duration_cast<Duration>(std::chrono::seconds{1}) / bucket.limit.rate;
+    }
+
+    static Duration getMaxCredit(const Bucket& bucket) noexcept
+    {
+        return (bucket.limit.rate > 0) ? getCost(bucket) * bucket.limit.burst : Duration::zero();
+    }
+
+    static bool tryConsume(Bucket& bucket) noexcept
+    {
+        if ((bucket.limit.rate == 0) || (bucket.credit < getCost(bucket)))
+        {
+            return false;
+        }
+        bucket.credit -= getCost(bucket);
+        return true;
+    }
+
+    void drain(const TimePoint now)
+    {
+        const auto elapsed = now - last_drain_time_;
+        last_drain_time_   = now;
+        for (auto& bucket : buckets_)
+        {
+            bucket.credit = std::min(bucket.credit + elapsed, getMaxCredit(bucket));
+        }
+
+        RecordRing::Record record;
+        while (ring_.pop(record))
+        {
+            auto& bucket = buckets_[static_cast<std::size_t>(record.severity)];
+            if (!tryConsume(bucket))
+            {
+                ++bucket.suppressed;
+                ++suppressed_count_;
+                continue;
+            }
+
+            if (bucket.suppressed > 0)
+            {
+                publishSuppressedSummary(now, record.severity, bucket.suppressed);
+                bucket.suppressed = 0;
+            }
+            publish(now, record.severity, record.getText());
+        }
+    }
+
+    void publishSuppressedSummary(const TimePoint now, const Severity severity, std::uint32_t suppressed)
+    {
+        constexpr char        Suffix[]   = " records suppressed";  // NOLINT(*-avoid-c-arrays)
+        constexpr std::size_t SuffixSize = sizeof(Suffix) - 1;
+
+        // Decimal digits of the number (up to 10 for 32-bit), followed by the suffix.
+        std::array<char, 10 + SuffixSize> text{};  // NOLINT(*-magic-numbers)
+        std::size_t                       size = 0;
+        do
+        {
+            text[size++] = static_cast<char>('0' + (suppressed % 10U));  // NOLINT(*-magic-numbers)
+            suppressed /= 10U;                                           // NOLINT(*-magic-numbers)
+        } while (suppressed > 0);
+        std::reverse(text.begin(), text.begin() + size);
+        (void) std::copy_n(Suffix, SuffixSize, text.begin() + size);
+        size += SuffixSize;
+
+        publish(now, severity, {text.data(), size});
+    }
+
+    void publish(const TimePoint now, const Severity severity, const cetl::string_view text)
+    {
+        message_.severity.value = static_cast<std::uint8_t>(severity);
+        message_.text.clear();
+        std::copy(text.cbegin(), text.cend(), std::back_inserter(message_.text));
+
+        // There is nothing we can do about possible publishing failures - we just ignore them.
+        // TODO: Introduce error handler at the node level.
+        (void) publisher_.publish(now + std::chrono::seconds{1}, message_);
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&       presentation_;
+    RecordRing&                       ring_;
+    Publisher                         publisher_;
+    Message                           message_;
+    std::array<Bucket, SeverityCount> buckets_{};
+    Duration                          drain_period_;
+    TimePoint                         last_drain_time_;
+    std::uint32_t                     suppressed_count_;
+    Callback::Any                     drain_cb_;
+
+};  // Logger
+
+}  // namespace diagnostic
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_DIAGNOSTIC_LOGGER_HPP_INCLUDED
@@ -0,0 +1,222 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_DIAGNOSTIC_RECORD_RING_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_DIAGNOSTIC_RECORD_RING_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace diagnostic
+{
+
+/// @brief Defines severity levels of diagnostic records (the same as `uavcan.diagnostic.Severity`).
+///
+enum class Severity : std::uint8_t
+{
+    Trace    = 0,
+    Debug    = 1,
+    Info     = 2,
+    Notice   = 3,
+    Warning  = 4,
+    Error    = 5,
+    Critical = 6,
+    Alert    = 7,
+
+};  // Severity
+
+/// @brief Defines total number of severity levels.
+///
+constexpr std::size_t SeverityCount = 8;
+
+/// @brief Defines a fixed-size lock-free ring of diagnostic records.
+///
+/// The ring is the hot path of the diagnostic logging - any code (including interrupt-like or other threads' code)
+/// could `push` a record into it cheaply: the text is just copied (and truncated if needed) into a preallocated slot,
+/// so there is neither memory allocation nor serialization. If the ring is full, the record is dropped (and counted),
+/// so that logging never blocks or starves the caller. Records are consumed (see `pop` and `dump`)
+/// by a single consumer - normally by the `Logger` in the executor context.
+///
+/// Implementation is a bounded multi-producer queue with per slot sequence numbers, so producers never wait
+/// for each other, and a slot is handed over between a producer and the consumer with acquire/release ordering.
+///
+/// The ring is neither copyable nor movable - it's supposed to have a static (or at least a long) lifetime,
+/// so that hot code could keep a reference to it.
+///
+class RecordRing final
+{
+public:
+    /// @brief Defines capacity (number of records) of the ring.
+    ///
+    static constexpr std::size_t Capacity = config::Application::Diagnostic::RecordRing_Capacity();
+
+    /// @brief Defines max number of text bytes of a single record.
+    ///
+    static constexpr std::size_t TextCapacity = config::Application::Diagnostic::RecordRing_TextCapacity();
+
+    static_assert((Capacity > 0) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be a power of two.");
+    static_assert(TextCapacity <= 255, "Text of diagnostic record can't exceed 255 bytes.");
+
+    /// @brief Defines a single record of the ring.
+    ///
+    struct Record
+    {
+        Severity                       severity{Severity::Trace};
+        std::uint8_t                   text_size{0};
+        std::array<char, TextCapacity> text{};
+
+        cetl::string_view getText() const noexcept
+        {
+            return {text.data(), text_size};
+        }
+    };
+
+    RecordRing() noexcept
+    {
+        for (std::size_t index = 0; index < Capacity; ++index)
+        {
+            slots_[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    ~RecordRing() = default;
+
+    RecordRing(const RecordRing&)                = delete;
+    RecordRing(RecordRing&&) noexcept            = delete;
+    RecordRing& operator=(const RecordRing&)     = delete;
+    RecordRing& operator=(RecordRing&&) noexcept = delete;
+
+    /// @brief Pushes a new record into the ring.
+    ///
+    /// Could be called concurrently from any number of threads.
+    ///
+    /// @param severity The severity of the record.
+    /// @param text The text of the record. Truncated to the `TextCapacity` if needed.
+    /// @return `true` if the record was pushed, `false` if it was dropped b/c the ring is full.
+    ///
+    bool push(const Severity severity, const cetl::string_view text) noexcept
+    {
+        std::size_t pos  = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot*       slot = nullptr;
+        for (;;)
+        {
+            slot            = &slots_[pos & Mask];
+            const auto seq  = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0)
+            {
+                // The slot is free - try to claim it (the `pos` is refreshed on failure).
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The slot is still occupied by a record of the previous lap - the ring is full.
+                (void) dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                // Other producer has claimed the slot already - try the next position.
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        auto&      record = slot->record;
+        const auto size   = (text.size() < TextCapacity) ? text.size() : TextCapacity;
+        record.severity   = severity;
+        record.text_size  = static_cast<std::uint8_t>(size);
+        (void) std::copy_n(text.data(), size, record.text.begin());
+
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pops the oldest record from the ring.
+    ///
+    /// Should be called by a single consumer only.
+    ///
+    /// @param out_record The record to fill.
+    /// @return `true` if a record was popped, `false` if there is no (completely pushed) record yet.
+    ///
+    bool pop(Record& out_record) noexcept
+    {
+        const std::size_t pos  = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot&             slot = slots_[pos & Mask];
+        if (slot.sequence.load(std::memory_order_acquire) != (pos + 1))
+        {
+            return false;
+        }
+
+        out_record = slot.record;
+        dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+        slot.sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Dumps (pops) all currently available records into the given visitor.
+    ///
+    /// Useful for local diagnostics (f.e. printing the ring to a console when there is no bus connection).
+    /// Should be called by a single consumer only (the same as `pop`).
+    ///
+    /// @param visitor The visitor to call for each record - `void(const Record&)`.
+    /// @return Number of dumped records.
+    ///
+    template <typename Visitor>
+    std::size_t dump(Visitor&& visitor)
+    {
+        std::size_t count = 0;
+        Record      record;
+        while (pop(record))
+        {
+            visitor(static_cast<const Record&>(record));
+            ++count;
+        }
+        return count;
+    }
+
+    /// @brief Gets total number of records dropped b/c the ring was full.
+    ///
+    std::uint32_t getDroppedCount() const noexcept
+    {
+        return dropped_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t Mask = Capacity - 1;
+
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence{0};
+        Record                   record;
+    };
+
+    // MARK: Data members:
+
+    std::array<Slot, Capacity> slots_;
+    std::atomic<std::size_t>   enqueue_pos_{0};
+    std::atomic<std::size_t>   dequeue_pos_{0};
+    std::atomic<std::uint32_t> dropped_count_{0};
+
+};  // RecordRing
+
+}  // namespace diagnostic
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_DIAGNOSTIC_RECORD_RING_HPP_INCLUDED
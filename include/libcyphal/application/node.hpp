@@ -10,7 +10,9 @@
 #include "libcyphal/types.hpp"
 #include "node/get_info_provider.hpp"
 #include "node/heartbeat_producer.hpp"
+#include "node/port_list_producer.hpp"
 #include "node/registry_provider.hpp"
+#include "node/transport_statistics_provider.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 
@@ -115,6 +117,71 @@ public:
         return cetl::nullopt;
     }
 
+    /// @brief Gets reference to the optional 'PortListProducer' component.
+    ///
+    /// By default, node does not create the port list producer (`cetl::nullopt`).
+    /// Use `makePortListProducer` method to create the producer.
+    ///
+    cetl::optional<node::PortListProducer>& getPortListProducer() noexcept
+    {
+        return port_list_producer_;
+    }
+
+    /// @brief Makes a new 'PortListProducer' component.
+    ///
+    /// Replaces the existing one if it was already created.
+    /// Use `getPortListProducer` method to get a reference to the producer optional.
+    ///
+    /// @return Possible failure to make a new producer instance. `nullptr` on success.
+    ///
+    cetl::optional<MakeFailure> makePortListProducer()
+    {
+        // Reset the existing producer if any - so that its publisher is released before making a new one.
+        port_list_producer_.reset();
+
+        auto maybe_producer = node::PortListProducer::make(presentation_);
+        if (auto* const failure = cetl::get_if<MakeFailure>(&maybe_producer))
+        {
+            return std::move(*failure);
+        }
+
+        (void) port_list_producer_.emplace(cetl::get<node::PortListProducer>(std::move(maybe_producer)));
+        return cetl::nullopt;
+    }
+
+    /// @brief Gets reference to the optional 'TransportStatisticsProvider' component.
+    ///
+    /// By default, node does not create the transport statistics provider (`cetl::nullopt`).
+    /// Use `makeTransportStatisticsProvider` method to create the provider.
+    ///
+    cetl::optional<node::TransportStatisticsProvider>& getTransportStatisticsProvider() noexcept
+    {
+        return transport_statistics_provider_;
+    }
+
+    /// @brief Makes a new 'TransportStatisticsProvider' component.
+    ///
+    /// Replaces the existing one if it was already created.
+    /// Use `getTransportStatisticsProvider` method to get a reference to the provider optional.
+    ///
+    /// @return Possible failure to make a new provider instance. `nullptr` on success.
+    ///
+    cetl::optional<MakeFailure> makeTransportStatisticsProvider()
+    {
+        // Reset the existing provider if any - so that its server is released before making a new one.
+        transport_statistics_provider_.reset();
+
+        auto maybe_provider = node::TransportStatisticsProvider::make(presentation_);
+        if (auto* const failure = cetl::get_if<MakeFailure>(&maybe_provider))
+        {
+            return std::move(*failure);
+        }
+
+        (void) transport_statistics_provider_.emplace(
+            cetl::get<node::TransportStatisticsProvider>(std::move(maybe_provider)));
+        return cetl::nullopt;
+    }
+
 private:
     Node(presentation::Presentation& presentation,
          node::GetInfoProvider&&     get_info_provider,
@@ -127,10 +194,12 @@ private:
 
     // MARK: Data members:
 
-    presentation::Presentation&            presentation_;
-    node::GetInfoProvider                  get_info_provider_;
-    node::HeartbeatProducer                heartbeat_producer_;
-    cetl::optional<node::RegistryProvider> registry_provider_;
+    presentation::Presentation&                       presentation_;
+    node::GetInfoProvider                             get_info_provider_;
+    node::HeartbeatProducer                           heartbeat_producer_;
+    cetl::optional<node::RegistryProvider>            registry_provider_;
+    cetl::optional<node::PortListProducer>            port_list_producer_;
+    cetl::optional<node::TransportStatisticsProvider> transport_statistics_provider_;
 
 };  // Node
 
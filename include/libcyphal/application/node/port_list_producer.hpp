@@ -0,0 +1,273 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/common_helpers.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/port/List_0_1.hpp>
+#include <uavcan/node/port/ServiceIDList_0_1.hpp>
+#include <uavcan/node/port/SubjectIDList_0_1.hpp>
+#include <uavcan/node/port/SubjectID_1_0.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'Port List' producer component for the application node.
+///
+/// Internally, it uses the 'uavcan.node.port.List' message publisher to periodically (every
+/// `MAX_PUBLICATION_PERIOD` seconds) publish the list of ports (publishers, subscribers, RPC clients and servers)
+/// in use by the presentation layer. Building of the message is relatively expensive (there could be hundreds
+/// of ports), so the message is rebuilt (and serialized) only when the set of ports has changed
+/// (see `Presentation::getPortsVersion`); otherwise, the cached serialized payload is published as is.
+/// Any change of the ports is published within the publication period, as required by the DSDL definition.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the publishing callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class PortListProducer final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the Port List.
+    ///
+    using Message = uavcan::node::port::List_0_1;
+
+    /// @brief Factory method to create a Port List producer instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'Port List' publisher,
+    ///                     as well as the source of the ports to publish.
+    /// @return The Port List producer instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<PortListProducer, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_port_list_pub = presentation.makePublisher<void>(Message::_traits_::FixedPortId);
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_port_list_pub))
+        {
+            return std::move(*failure);
+        }
+
+        return PortListProducer{presentation, cetl::get<Publisher>(std::move(maybe_port_list_pub))};
+    }
+
+    PortListProducer(PortListProducer&& other) noexcept
+        : presentation_{other.presentation_}
+        , publisher_{std::move(other.publisher_)}
+        , payload_{std::move(other.payload_)}
+        , payload_ports_version_{other.payload_ports_version_}
+        , is_payload_valid_{other.is_payload_valid_}
+        , next_exec_time_{other.next_exec_time_}
+    {
+        // We can't move `periodic_cb_` callback (b/c it captures its own `this` pointer),
+        // so we need to stop it in the moved-from object, and start in the new one.
+        other.stopPublishing();
+        startPublishing();
+    }
+
+    ~PortListProducer() = default;
+
+    PortListProducer(const PortListProducer&)                = delete;
+    PortListProducer& operator=(const PortListProducer&)     = delete;
+    PortListProducer& operator=(PortListProducer&&) noexcept = delete;
+
+private:
+    using Callback      = IExecutor::Callback;
+    using Publisher     = presentation::Publisher<void>;
+    using SubjectIdList = uavcan::node::port::SubjectIDList_0_1;
+    using ServiceIdList = uavcan::node::port::ServiceIDList_0_1;
+    using SubjectId     = uavcan::node::port::SubjectID_1_0;
+    using Payload       = libcyphal::detail::VarArray<cetl::byte>;
+
+    /// Max size of the `SubjectIDList.sparse_list` (see its DSDL definition).
+    /// A bigger list of subject ids is published as a bit mask.
+    static constexpr std::size_t MaxSparseListSize = 255;
+
+    PortListProducer(presentation::Presentation& presentation, Publisher&& publisher)
+        : presentation_{presentation}
+        , publisher_{std::move(publisher)}
+        , payload_{Payload::allocator_type{&presentation.memory()}}
+        , next_exec_time_{presentation.executor().now()}
+    {
+        publisher_.setPriority(transport::Priority::Optional);
+
+        startPublishing();
+    }
+
+    static constexpr Duration getPeriod()
+    {
+        return std::chrono::seconds(Message::MAX_PUBLICATION_PERIOD);
+    }
+
+    static void addSubjectId(SubjectIdList& subject_id_list, const transport::PortId port_id)
+    {
+        if (port_id >= SubjectIdList::CAPACITY)
+        {
+            return;
+        }
+
+        if (auto* const sparse_list = subject_id_list.get_sparse_list_if())
+        {
+            if (sparse_list->size() < MaxSparseListSize)
+            {
+                SubjectId subject_id{sparse_list->get_allocator()};
+                subject_id.value = port_id;
+                sparse_list->push_back(subject_id);
+                return;
+            }
+
+            // The sparse list is full - switch to the bit mask representation.
+            const auto subject_ids = std::move(*sparse_list);
+            auto&      mask        = subject_id_list.set_mask();
+            for (const auto& subject_id : subject_ids)
+            {
+                mask[subject_id.value] = true;
+            }
+        }
+
+        if (auto* const mask = subject_id_list.get_mask_if())
+        {
+            (*mask)[port_id] = true;
+        }
+    }
+
+    static void addServiceId(ServiceIdList& service_id_list, const transport::PortId port_id)
+    {
+        if (port_id < ServiceIdList::CAPACITY)
+        {
+            service_id_list.mask[port_id] = true;
+        }
+    }
+
+    void startPublishing()
+    {
+        periodic_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            // We keep track of the next execution time to allow
+            // smooth rescheduling to the new instance in the move constructor.
+            next_exec_time_ = arg.exec_time + getPeriod();
+
+            publishMessage(arg.approx_now);
+        });
+
+        const auto result = periodic_cb_.schedule(Callback::Schedule::Repeat{next_exec_time_, getPeriod()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void stopPublishing()
+    {
+        periodic_cb_.reset();
+    }
+
+    void publishMessage(const TimePoint approx_now)
+    {
+        // Publishing of port list makes sense only if the local node ID is known.
+        if (presentation_.transport().getLocalNodeId() == cetl::nullopt)
+        {
+            return;
+        }
+
+        const auto ports_version = presentation_.getPortsVersion();
+        if (!is_payload_valid_ || (payload_ports_version_ != ports_version))
+        {
+            is_payload_valid_      = updatePayload();
+            payload_ports_version_ = ports_version;
+        }
+        if (!is_payload_valid_)
+        {
+            return;
+        }
+
+        // There is nothing we can do about possible publishing failures - we just ignore them.
+        // TODO: Introduce error handler at the node level.
+        const cetl::span<const cetl::byte>                      data_span{payload_.data(), payload_.size()};
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{data_span};
+        (void) publisher_.publish(approx_now + getPeriod(), fragments);
+    }
+
+    /// Builds the message from the current set of ports, and serializes it into the cached payload.
+    ///
+    bool updatePayload()
+    {
+        Message message{Message::allocator_type{&presentation_.memory()}};
+        (void) message.publishers.set_sparse_list();
+        (void) message.subscribers.set_sparse_list();
+
+        presentation_.forEachPort([&message](const presentation::PortKind kind, const transport::PortId port_id) {
+            //
+            switch (kind)
+            {
+            case presentation::PortKind::Publisher:
+                addSubjectId(message.publishers, port_id);
+                break;
+            case presentation::PortKind::Subscriber:
+                addSubjectId(message.subscribers, port_id);
+                break;
+            case presentation::PortKind::Client:
+                addServiceId(message.clients, port_id);
+                break;
+            case presentation::PortKind::Server:
+                addServiceId(message.servers, port_id);
+                break;
+            }
+        });
+
+        using Result = cetl::optional<nunavut::support::Error>;
+
+        std::size_t payload_size = 0;
+        payload_.resize(Message::_traits_::SerializationBufferSizeBytes);
+        const auto result = presentation::detail::performOnSerializedInto<Message, Result>(  //
+            message,
+            {payload_.data(), payload_.size()},
+            [&payload_size](const auto fragments) -> Result {
+                //
+                payload_size = fragments[0].size();
+                return cetl::nullopt;
+            });
+
+        // Don't keep the max possible size buffer allocated - normally the serialized message is much smaller.
+        payload_.resize(result ? 0 : payload_size);
+        payload_.shrink_to_fit();
+        return !result;
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Publisher                   publisher_;
+    Callback::Any               periodic_cb_;
+    Payload                     payload_;
+    std::uint32_t               payload_ports_version_{0};
+    bool                        is_payload_valid_{false};
+    TimePoint                   next_exec_time_;
+
+};  // PortListProducer
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_PORT_LIST_PRODUCER_HPP_INCLUDED
@@ -0,0 +1,162 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_NODE_TRANSPORT_STATISTICS_PROVIDER_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_NODE_TRANSPORT_STATISTICS_PROVIDER_HPP_INCLUDED
+
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/server.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/node/GetTransportStatistics_0_1.hpp>
+#include <uavcan/node/IOStatistics_0_1.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace node
+{
+
+/// @brief Defines 'GetTransportStatistics' provider component for the application node.
+///
+/// Internally, it uses the 'GetTransportStatistics' service server to handle incoming requests.
+/// The response is built on demand from the transport statistics (see `ITransport::getTransferStatistics` and
+/// `ITransport::getMediaStatistics`), which contain counters of transfers (for the transport as a whole),
+/// and counters of frames (per each redundant media interface, up to `MAX_NETWORK_INTERFACES`).
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the request callback,
+/// but at the destructor level, we don't need to do anything.
+///
+class TransportStatisticsProvider final  // NOSONAR cpp:S3624
+{
+    using Service = uavcan::node::GetTransportStatistics_0_1;
+
+public:
+    /// @brief Defines the response type for the GetTransportStatistics provider.
+    ///
+    using Response = Service::Response;
+
+    /// @brief Factory method to create a GetTransportStatistics provider instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create 'GetTransportStatistics' service server,
+    ///                     as well as the source of the transport statistics.
+    /// @return The GetTransportStatistics provider instance or a failure.
+    ///
+    static auto make(presentation::Presentation& presentation)
+        -> Expected<TransportStatisticsProvider, presentation::Presentation::MakeFailure>
+    {
+        auto maybe_srv = presentation.makeServer<Service>();
+        if (auto* const failure = cetl::get_if<presentation::Presentation::MakeFailure>(&maybe_srv))
+        {
+            return std::move(*failure);
+        }
+
+        return TransportStatisticsProvider{presentation, cetl::get<Server>(std::move(maybe_srv))};
+    }
+
+    TransportStatisticsProvider(TransportStatisticsProvider&& other) noexcept
+        : presentation_{other.presentation_}
+        , server_{std::move(other.server_)}
+        , response_timeout_{other.response_timeout_}
+    {
+        // We have to set up request callback again (b/c it captures its own `this` pointer),
+        setupOnRequestCallback();
+    }
+
+    ~TransportStatisticsProvider() = default;
+
+    TransportStatisticsProvider(const TransportStatisticsProvider&)                = delete;
+    TransportStatisticsProvider& operator=(const TransportStatisticsProvider&)     = delete;
+    TransportStatisticsProvider& operator=(TransportStatisticsProvider&&) noexcept = delete;
+
+    /// @brief Sets the response transmission timeout (default is 1s).
+    ///
+    /// @param timeout Duration of the response transmission timeout. Applied for the next response transmission.
+    /// @return Reference to self for method chaining.
+    ///
+    TransportStatisticsProvider& setResponseTimeout(const Duration& timeout) noexcept
+    {
+        response_timeout_ = timeout;
+        return *this;
+    }
+
+    /// @brief Makes a new response from the current transport statistics.
+    ///
+    /// In use by the service server, but also could be used directly (f.e. for local diagnostics).
+    ///
+    Response makeResponse() const
+    {
+        Response response{Response::allocator_type{&presentation_.memory()}};
+
+        const transport::ITransport& transport = presentation_.transport();
+        fillIoStatistics(response.transfer_statistics, transport.getTransferStatistics());
+
+        for (std::uint8_t media_index = 0; media_index < Response::MAX_NETWORK_INTERFACES; ++media_index)
+        {
+            const auto media_stats = transport.getMediaStatistics(media_index);
+            if (!media_stats)
+            {
+                break;
+            }
+
+            IoStatistics io_statistics{};
+            fillIoStatistics(io_statistics, *media_stats);
+            response.network_interface_statistics.push_back(io_statistics);
+        }
+
+        return response;
+    }
+
+private:
+    using Server       = presentation::ServiceServer<Service>;
+    using IoStatistics = uavcan::node::IOStatistics_0_1;
+
+    TransportStatisticsProvider(presentation::Presentation& presentation, Server&& server)
+        : presentation_{presentation}
+        , server_{std::move(server)}
+        , response_timeout_{std::chrono::seconds{1}}
+    {
+        setupOnRequestCallback();
+    }
+
+    static void fillIoStatistics(IoStatistics& dst, const transport::IoStatistics& src) noexcept
+    {
+        dst.num_emitted  = src.num_emitted;
+        dst.num_received = src.num_received;
+        dst.num_errored  = src.num_errored;
+    }
+
+    void setupOnRequestCallback()
+    {
+        server_.setOnRequestCallback([this](const auto& arg, auto continuation) {
+            //
+            // There is nothing we can do about possible continuation failures - we just ignore them.
+            // TODO: Introduce error handler at the node level.
+            (void) continuation(arg.approx_now + response_timeout_, makeResponse());
+        });
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation& presentation_;
+    Server                      server_;
+    Duration                    response_timeout_;
+
+};  // TransportStatisticsProvider
+
+}  // namespace node
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_NODE_TRANSPORT_STATISTICS_PROVIDER_HPP_INCLUDED
@@ -0,0 +1,398 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_PNP_ALLOCATEE_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_PNP_ALLOCATEE_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+#include <cetl/visit_helpers.hpp>
+
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_2_0.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace pnp
+{
+
+/// @brief Defines plug-and-play node-ID allocatee (aka client) component.
+///
+/// The allocatee is in use by an anonymous node to get its node ID from a PNP allocator (see `uavcan.pnp`).
+/// Depending on the transport (in use by the presentation layer), the allocatee uses either
+/// 'NodeIDAllocationData.1.0' message (for transports with up to 128 nodes, like CAN),
+/// or 'NodeIDAllocationData.2.0' one (for others, like UDP).
+///
+/// The very first allocation request is published as soon as the allocatee is made. Subsequent requests
+/// (in case there is still no response from an allocator) are published with a randomized exponential backoff -
+/// this way nodes which were powered up simultaneously don't flood the network with synchronized requests.
+/// As soon as a matching allocation response arrives, the allocated node ID is assigned to the transport
+/// (see `ITransport::setLocalNodeId`), and no more requests are published. After that the allocatee
+/// could be destroyed by the user to release its publisher and subscriber.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks,
+/// but at the destructor level, we don't need to do anything.
+///
+class Allocatee final  // NOSONAR cpp:S3624
+{
+public:
+    /// @brief Defines the message type for the allocation over transports with small MTU (like CAN).
+    ///
+    using MessageV1 = uavcan::pnp::NodeIDAllocationData_1_0;
+
+    /// @brief Defines the message type for the allocation over all other transports (like UDP).
+    ///
+    using MessageV2 = uavcan::pnp::NodeIDAllocationData_2_0;
+
+    /// @brief Defines type of the 128-bit unique ID of the node (the same as in the 'GetInfo' response).
+    ///
+    using UniqueId = std::array<std::uint8_t, 16>;
+
+    /// @brief Defines the maximum number of nodes for which the 'NodeIDAllocationData.1.0' message is in use.
+    ///
+    static constexpr std::size_t MaxNodesOfV1 = 128;
+
+    /// @brief Umbrella type for allocation completion entities.
+    ///
+    struct OnAllocatedCallback
+    {
+        /// @brief Defines standard arguments for the allocation completion callback.
+        ///
+        struct Arg
+        {
+            /// Holds the allocated node ID (already assigned to the transport).
+            transport::NodeId node_id;
+
+            /// Holds the approximate time when the callback was called.
+            TimePoint approx_now;
+        };
+
+        static constexpr auto FunctionSize = config::Application::Pnp::Allocatee_OnAllocatedCallback_FunctionSize();
+        using Function                     = cetl::pmr::function<void(const Arg& arg), FunctionSize>;
+    };
+
+    /// @brief Factory method to create a PNP allocatee instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create allocation publisher and subscriber.
+    /// @param unique_id The 128-bit unique ID of the node (the same as in its 'GetInfo' response).
+    /// @param preferred_node_id Optional node ID which is preferred to be allocated. Supported by v2 only.
+    /// @return The allocatee instance or a failure.
+    ///
+    static auto make(presentation::Presentation&             presentation,
+                     const UniqueId&                         unique_id,
+                     const cetl::optional<transport::NodeId> preferred_node_id = cetl::nullopt)
+        -> Expected<Allocatee, presentation::Presentation::MakeFailure>
+    {
+        const auto max_nodes = presentation.transport().getProtocolParams().max_nodes;
+        if (max_nodes > MaxNodesOfV1)
+        {
+            return makeWith<MessageV2>(presentation, unique_id, preferred_node_id);
+        }
+        return makeWith<MessageV1>(presentation, unique_id, preferred_node_id);
+    }
+
+    Allocatee(Allocatee&& other) noexcept
+        : presentation_{other.presentation_}
+        , ports_{std::move(other.ports_)}
+        , unique_id_{other.unique_id_}
+        , preferred_node_id_{other.preferred_node_id_}
+        , allocated_node_id_{other.allocated_node_id_}
+        , on_allocated_cb_fn_{std::move(other.on_allocated_cb_fn_)}
+        , random_engine_{other.random_engine_}
+        , min_request_period_{other.min_request_period_}
+        , max_request_period_{other.max_request_period_}
+        , request_period_{other.request_period_}
+        , next_request_time_{other.next_request_time_}
+    {
+        // We can't move callbacks (b/c they capture its own `this` pointer),
+        // so we need to stop them in the moved-from object, and start in the new one.
+        other.stopRequesting();
+        setupOnReceiveCallback();
+        startRequesting();
+    }
+
+    ~Allocatee() = default;
+
+    Allocatee(const Allocatee&)                = delete;
+    Allocatee& operator=(const Allocatee&)     = delete;
+    Allocatee& operator=(Allocatee&&) noexcept = delete;
+
+    /// @brief Gets the allocated node ID (if any yet).
+    ///
+    cetl::optional<transport::NodeId> getAllocatedNodeId() const noexcept
+    {
+        return allocated_node_id_;
+    }
+
+    /// @brief Sets the allocation completion callback.
+    ///
+    /// @param on_allocated_cb_fn The function which will be called (once) when the node ID has been allocated,
+    ///                           and assigned to the transport.
+    ///
+    void setOnAllocatedCallback(OnAllocatedCallback::Function&& on_allocated_cb_fn)
+    {
+        on_allocated_cb_fn_ = std::move(on_allocated_cb_fn);
+    }
+
+    /// @brief Sets the range of periods between repeated allocation requests (default is 100ms...1s).
+    ///
+    /// The first repeated request is published after a random delay within `[min_period / 2, min_period]`.
+    /// Each next period is doubled (but not more than `max_period`), and the delay is randomized in the same way.
+    /// Applied starting from the next scheduled request.
+    ///
+    void setRequestPeriods(const Duration min_period, const Duration max_period) noexcept
+    {
+        CETL_DEBUG_ASSERT(min_period > Duration::zero(), "");
+        CETL_DEBUG_ASSERT(min_period <= max_period, "");
+
+        min_request_period_ = min_period;
+        max_request_period_ = max_period;
+        request_period_     = min_period;
+    }
+
+    /// @brief Makes 48-bit hash of the unique ID, as it's in use by the 'NodeIDAllocationData.1.0' message.
+    ///
+    /// The hash function is 64-bit FNV-1a, truncated to the lower 48 bits.
+    ///
+    static std::uint64_t makeUniqueIdHash(const UniqueId& unique_id) noexcept
+    {
+        constexpr std::uint64_t Offset = 0xCBF29CE484222325ULL;
+        constexpr std::uint64_t Prime  = 0x100000001B3ULL;
+        constexpr std::uint64_t Mask   = (1ULL << 48U) - 1U;
+
+        std::uint64_t hash = Offset;
+        for (const std::uint8_t byte : unique_id)
+        {
+            hash ^= byte;
+            hash *= Prime;
+        }
+        return hash & Mask;
+    }
+
+private:
+    using Callback = IExecutor::Callback;
+
+    template <typename Message>
+    struct Ports
+    {
+        presentation::Publisher<Message>  publisher;
+        presentation::Subscriber<Message> subscriber;
+    };
+    using PortsVariant = cetl::variant<Ports<MessageV1>, Ports<MessageV2>>;
+
+    template <typename Message>
+    static auto makeWith(presentation::Presentation&             presentation,
+                         const UniqueId&                         unique_id,
+                         const cetl::optional<transport::NodeId> preferred_node_id)
+        -> Expected<Allocatee, presentation::Presentation::MakeFailure>
+    {
+        using MakeFailure = presentation::Presentation::MakeFailure;
+
+        auto maybe_pub = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<MakeFailure>(&maybe_pub))
+        {
+            return std::move(*failure);
+        }
+        auto maybe_sub = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<MakeFailure>(&maybe_sub))
+        {
+            return std::move(*failure);
+        }
+
+        Ports<Message> ports{cetl::get<presentation::Publisher<Message>>(std::move(maybe_pub)),
+                             cetl::get<presentation::Subscriber<Message>>(std::move(maybe_sub))};
+        return Allocatee{presentation, PortsVariant{std::move(ports)}, unique_id, preferred_node_id};
+    }
+
+    Allocatee(presentation::Presentation&             presentation,
+              PortsVariant&&                          ports,
+              const UniqueId&                         unique_id,
+              const cetl::optional<transport::NodeId> preferred_node_id)
+        : presentation_{presentation}
+        , ports_{std::move(ports)}
+        , unique_id_{unique_id}
+        , preferred_node_id_{preferred_node_id}
+        , random_engine_{static_cast<std::minstd_rand::result_type>(makeUniqueIdHash(unique_id))}
+        , min_request_period_{std::chrono::milliseconds{100}}
+        , max_request_period_{std::chrono::seconds{1}}
+        , request_period_{min_request_period_}
+        , next_request_time_{presentation.executor().now()}
+    {
+        setupOnReceiveCallback();
+        startRequesting();
+    }
+
+    void setupOnReceiveCallback()
+    {
+        cetl::visit(
+            [this](auto& ports) {
+                //
+                using Arg = typename std::decay_t<decltype(ports.subscriber)>::OnReceiveCallback::Arg;
+                ports.subscriber.setOnReceiveCallback([this](const Arg& arg) {
+                    //
+                    // Requests from other allocatees are anonymous - we are interested only in allocator responses.
+                    if (arg.metadata.publisher_node_id.has_value())
+                    {
+                        handleResponse(arg.message, arg.approx_now);
+                    }
+                });
+            },
+            ports_);
+    }
+
+    void startRequesting()
+    {
+        if (allocated_node_id_.has_value())
+        {
+            return;
+        }
+
+        request_cb_ = presentation_.executor().registerCallback([this](const auto& arg) {
+            //
+            publishRequest(arg.approx_now);
+        });
+
+        const auto result = request_cb_.schedule(Callback::Schedule::Once{next_request_time_});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void stopRequesting()
+    {
+        request_cb_.reset();
+    }
+
+    /// Gets random delay till the next request, and advances (doubles) the request period.
+    ///
+    Duration nextRequestDelay()
+    {
+        const auto                                   period = request_period_.count();
+        std::uniform_int_distribution<Duration::rep> distribution{period / 2, period};
+        request_period_ = std::min(request_period_ * 2, max_request_period_);
+        return Duration{distribution(random_engine_)};
+    }
+
+    void publishRequest(const TimePoint approx_now)
+    {
+        // The local node ID could be assigned by other means (f.e. by the user) - then we are done.
+        const auto local_node_id = presentation_.transport().getLocalNodeId();
+        if (local_node_id.has_value())
+        {
+            allocated_node_id_ = local_node_id;
+            stopRequesting();
+            return;
+        }
+
+        next_request_time_ = approx_now + nextRequestDelay();
+        const auto result  = request_cb_.schedule(Callback::Schedule::Once{next_request_time_});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+
+        // There is nothing we can do about possible publishing failures - we just ignore them,
+        // and the request will be repeated later anyway.
+        // TODO: Introduce error handler at the node level.
+        cetl::visit(cetl::make_overloaded(
+                        [this](Ports<MessageV1>& ports) {
+                            //
+                            MessageV1 request{MessageV1::allocator_type{&presentation_.memory()}};
+                            request.unique_id_hash = makeUniqueIdHash(unique_id_);
+                            (void) ports.publisher.publish(next_request_time_, request);
+                        },
+                        [this](Ports<MessageV2>& ports) {
+                            //
+                            MessageV2 request{MessageV2::allocator_type{&presentation_.memory()}};
+                            request.node_id.value = preferred_node_id_.value_or(getMaxNodeId());
+                            std::copy(unique_id_.cbegin(), unique_id_.cend(), request.unique_id.begin());
+                            (void) ports.publisher.publish(next_request_time_, request);
+                        }),
+                    ports_);
+    }
+
+    void handleResponse(const MessageV1& response, const TimePoint approx_now)
+    {
+        if ((!response.allocated_node_id.empty()) && (response.unique_id_hash == makeUniqueIdHash(unique_id_)))
+        {
+            acceptNodeId(response.allocated_node_id.front().value, approx_now);
+        }
+    }
+
+    void handleResponse(const MessageV2& response, const TimePoint approx_now)
+    {
+        if (std::equal(unique_id_.cbegin(), unique_id_.cend(), response.unique_id.cbegin()))
+        {
+            acceptNodeId(response.node_id.value, approx_now);
+        }
+    }
+
+    void acceptNodeId(const transport::NodeId node_id, const TimePoint approx_now)
+    {
+        // Redundant allocators (or repeated responses) could respond more than once.
+        if (allocated_node_id_.has_value())
+        {
+            return;
+        }
+
+        // Transport might reject the node ID (f.e. if it's out of range) - then we keep requesting.
+        if (presentation_.transport().setLocalNodeId(node_id).has_value())
+        {
+            return;
+        }
+
+        allocated_node_id_ = node_id;
+        stopRequesting();
+
+        if (on_allocated_cb_fn_)
+        {
+            on_allocated_cb_fn_(OnAllocatedCallback::Arg{node_id, approx_now});
+        }
+    }
+
+    transport::NodeId getMaxNodeId() const
+    {
+        const auto max_nodes = presentation_.transport().getProtocolParams().max_nodes;
+        return static_cast<transport::NodeId>(max_nodes - 1);
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&       presentation_;
+    PortsVariant                      ports_;
+    const UniqueId                    unique_id_;
+    cetl::optional<transport::NodeId> preferred_node_id_;
+    cetl::optional<transport::NodeId> allocated_node_id_;
+    OnAllocatedCallback::Function     on_allocated_cb_fn_;
+    std::minstd_rand                  random_engine_;
+    Duration                          min_request_period_;
+    Duration                          max_request_period_;
+    Duration                          request_period_;
+    TimePoint                         next_request_time_;
+    Callback::Any                     request_cb_;
+
+};  // Allocatee
+
+}  // namespace pnp
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_PNP_ALLOCATEE_HPP_INCLUDED
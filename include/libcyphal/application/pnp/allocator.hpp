@@ -0,0 +1,643 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_PNP_ALLOCATOR_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_PNP_ALLOCATOR_HPP_INCLUDED
+
+#include "allocatee.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/storage.hpp"
+#include "libcyphal/presentation/presentation.hpp"
+#include "libcyphal/presentation/publisher.hpp"
+#include "libcyphal/presentation/subscriber.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <cetl/visit_helpers.hpp>
+
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_2_0.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace pnp
+{
+
+/// @brief Defines plug-and-play node-ID allocator (aka server) component.
+///
+/// The allocator listens for anonymous allocation requests (see `Allocatee`), and responds with allocated node IDs.
+/// The same message version as the allocatee's one is used - it depends on the transport (see `Allocatee::make`).
+///
+/// Allocations are kept in a fixed capacity table, which is loaded from (and saved to) the key-value storage as
+/// a single blob (see `TableKey`), so that the same node always gets the same node ID (even across allocator
+/// restarts). In memory, the table is an open addressing hash table keyed by the 128-bit unique ID (or by the 48-bit
+/// unique ID hash in case of v1), so lookup is O(1). Occupied node IDs are tracked by a bitset. A new node ID is
+/// the preferred one (v2 only) if it's free, otherwise the highest free one - found by scanning the bitset
+/// downwards from a cursor, below which the free IDs are; so the search is amortized O(1).
+///
+/// Allocation storms (f.e. after a fleet power-up) are handled as follows. Reception of a request does only
+/// the in-memory lookup/allocation, and queues the response, so the reception path stays short and never allocates
+/// memory. The queue has the same capacity as the table, and each table entry is queued at most once, so no request
+/// is dropped. Queued responses are published in a batch by a deferred executor callback - right after a single
+/// storage write of the whole table (only if it was changed), so a response is never sent for a not yet persisted
+/// allocation.
+///
+/// No Sonar cpp:S3624 "Customize this class' destructor to participate in resource management."
+/// We need custom move constructor to reset up the callbacks,
+/// but at the destructor level, we don't need to do anything.
+///
+class Allocator final  // NOSONAR cpp:S3624
+{
+public:
+    using MessageV1 = Allocatee::MessageV1;
+    using MessageV2 = Allocatee::MessageV2;
+    using UniqueId  = Allocatee::UniqueId;
+
+    /// @brief Defines the storage key of the allocation table.
+    ///
+    static constexpr const char* TableKey = "pnp.allocation_table";
+
+    /// @brief Defines size of a single allocation table record in the storage (node ID + unique ID).
+    ///
+    static constexpr std::size_t RecordSize = sizeof(std::uint16_t) + sizeof(UniqueId);
+
+    /// @brief Defines failures which could happen during the allocator creation.
+    ///
+    /// The storage error is reported only if the table exists, but can't be read (or it's corrupted).
+    /// A stored table with more records than the allocator capacity is reported as `Error::Capacity`.
+    ///
+    using MakeFailure = cetl::variant<presentation::Presentation::MakeFailure, platform::storage::Error>;
+
+    /// @brief Factory method to create a PNP allocator instance.
+    ///
+    /// @param presentation The presentation layer instance. In use to create allocation publisher and subscriber,
+    ///                     as well as the source of memory for the allocation table.
+    /// @param key_value The key-value storage of the allocation table. Should outlive the allocator.
+    /// @param capacity Maximum number of allocations which the allocator could keep.
+    /// @return The allocator instance or a failure.
+    ///
+    static auto make(presentation::Presentation&   presentation,
+                     platform::storage::IKeyValue& key_value,
+                     const std::size_t             capacity) -> Expected<Allocator, MakeFailure>
+    {
+        if (capacity == 0)
+        {
+            return presentation::Presentation::MakeFailure{ArgumentError{}};
+        }
+
+        const auto max_nodes = presentation.transport().getProtocolParams().max_nodes;
+        if (max_nodes > Allocatee::MaxNodesOfV1)
+        {
+            return makeWith<MessageV2>(presentation, key_value, capacity);
+        }
+        return makeWith<MessageV1>(presentation, key_value, capacity);
+    }
+
+    Allocator(Allocator&& other) noexcept
+        : presentation_{other.presentation_}
+        , key_value_{other.key_value_}
+        , ports_{std::move(other.ports_)}
+        , max_nodes_{other.max_nodes_}
+        , capacity_{other.capacity_}
+        , entries_{std::move(other.entries_)}
+        , entries_count_{other.entries_count_}
+        , occupied_{std::move(other.occupied_)}
+        , search_word_{other.search_word_}
+        , pending_{std::move(other.pending_)}
+        , blob_{std::move(other.blob_)}
+        , is_dirty_{other.is_dirty_}
+        , response_timeout_{other.response_timeout_}
+        , last_error_{other.last_error_}
+    {
+        // We can't move callbacks (b/c they capture its own `this` pointer),
+        // so we need to reset them in the moved-from object, and set up again in the new one.
+        other.flush_cb_.reset();
+        setupCallbacks();
+        if (!pending_.empty())
+        {
+            scheduleFlush();
+        }
+    }
+
+    ~Allocator() = default;
+
+    Allocator(const Allocator&)                = delete;
+    Allocator& operator=(const Allocator&)     = delete;
+    Allocator& operator=(Allocator&&) noexcept = delete;
+
+    /// @brief Sets the response transmission timeout (default is 1s).
+    ///
+    /// @param timeout Duration of the response transmission timeout. Applied for the next response transmission.
+    /// @return Reference to self for method chaining.
+    ///
+    Allocator& setResponseTimeout(const Duration& timeout) noexcept
+    {
+        response_timeout_ = timeout;
+        return *this;
+    }
+
+    /// @brief Marks the given node ID as occupied, so it won't be allocated.
+    ///
+    /// Useful for node IDs of statically configured nodes (including the allocator's own node ID,
+    /// which is reserved automatically if it's already assigned at the allocator creation).
+    ///
+    void reserveNodeId(const transport::NodeId node_id) noexcept
+    {
+        if (node_id < max_nodes_)
+        {
+            markOccupied(node_id);
+        }
+    }
+
+    /// @brief Finds node ID which is allocated to the given unique ID (if any).
+    ///
+    /// For v1 (see `Allocatee::MessageV1`), the table is keyed by the unique ID hash -
+    /// use `Allocatee::makeUniqueIdHash` and `makeV1Key` to build the key.
+    ///
+    cetl::optional<transport::NodeId> findNodeId(const UniqueId& unique_id) const noexcept
+    {
+        const auto* const entry = findEntry(unique_id);
+        if (entry == nullptr)
+        {
+            return cetl::nullopt;
+        }
+        return entry->node_id;
+    }
+
+    /// @brief Gets total number of allocations in the table.
+    ///
+    std::size_t size() const noexcept
+    {
+        return entries_count_;
+    }
+
+    /// @brief Saves the table (if it has been changed), and publishes all pending responses.
+    ///
+    /// Normally, it's called automatically (by the executor) as soon as there are pending responses.
+    ///
+    /// @return Storage error (if any). In such case pending responses are discarded (not published),
+    ///         and will be published again on repeated requests - once the table is saved successfully.
+    ///
+    cetl::optional<platform::storage::Error> flush()
+    {
+        if (is_dirty_)
+        {
+            last_error_ = saveTable();
+            if (last_error_.has_value())
+            {
+                discardPending();
+                return last_error_;
+            }
+            is_dirty_ = false;
+        }
+
+        const auto now = presentation_.executor().now();
+        for (const auto index : pending_)
+        {
+            auto& entry      = entries_[index];
+            entry.is_pending = false;
+            publishResponse(entry, now);
+        }
+        pending_.clear();
+        return cetl::nullopt;
+    }
+
+    /// @brief Gets the last storage error (if any) of the table saving.
+    ///
+    cetl::optional<platform::storage::Error> getLastError() const noexcept
+    {
+        return last_error_;
+    }
+
+    /// @brief Makes the v1 table key from the given 48-bit unique ID hash.
+    ///
+    static UniqueId makeV1Key(const std::uint64_t unique_id_hash) noexcept
+    {
+        UniqueId key{};
+        for (std::size_t i = 0; i < V1HashSize; ++i)
+        {
+            key[i] = static_cast<std::uint8_t>(unique_id_hash >> (i * 8U));  // NOLINT(*-magic-numbers)
+        }
+        return key;
+    }
+
+    /// @brief Extracts the 48-bit unique ID hash back from the given v1 table key.
+    ///
+    static std::uint64_t getV1Hash(const UniqueId& key) noexcept
+    {
+        std::uint64_t unique_id_hash = 0;
+        for (std::size_t i = 0; i < V1HashSize; ++i)
+        {
+            unique_id_hash |= static_cast<std::uint64_t>(key[i]) << (i * 8U);  // NOLINT(*-magic-numbers)
+        }
+        return unique_id_hash;
+    }
+
+private:
+    using Callback = IExecutor::Callback;
+    using Word     = std::uint64_t;
+
+    static constexpr std::size_t WordBits   = sizeof(Word) * 8U;
+    static constexpr std::size_t V1HashSize = 6;
+
+    template <typename Message>
+    struct Ports
+    {
+        presentation::Publisher<Message>  publisher;
+        presentation::Subscriber<Message> subscriber;
+    };
+    using PortsVariant = cetl::variant<Ports<MessageV1>, Ports<MessageV2>>;
+
+    struct Entry
+    {
+        UniqueId          unique_id;
+        transport::NodeId node_id;
+        bool              is_used;
+        bool              is_pending;
+    };
+
+    template <typename Message>
+    static auto makeWith(presentation::Presentation&   presentation,
+                         platform::storage::IKeyValue& key_value,
+                         const std::size_t             capacity) -> Expected<Allocator, MakeFailure>
+    {
+        using PresentationFailure = presentation::Presentation::MakeFailure;
+
+        auto maybe_pub = presentation.makePublisher<Message>();
+        if (auto* const failure = cetl::get_if<PresentationFailure>(&maybe_pub))
+        {
+            return std::move(*failure);
+        }
+        auto maybe_sub = presentation.makeSubscriber<Message>();
+        if (auto* const failure = cetl::get_if<PresentationFailure>(&maybe_sub))
+        {
+            return std::move(*failure);
+        }
+
+        Ports<Message> ports{cetl::get<presentation::Publisher<Message>>(std::move(maybe_pub)),
+                             cetl::get<presentation::Subscriber<Message>>(std::move(maybe_sub))};
+        Allocator allocator{presentation, key_value, PortsVariant{std::move(ports)}};
+        if (!allocator.allocateTables(capacity))
+        {
+            return PresentationFailure{MemoryError{}};
+        }
+        if (const auto local_node_id = presentation.transport().getLocalNodeId())
+        {
+            allocator.reserveNodeId(*local_node_id);
+        }
+        if (const auto error = allocator.loadTable())
+        {
+            return *error;
+        }
+        return allocator;
+    }
+
+    Allocator(presentation::Presentation& presentation, platform::storage::IKeyValue& key_value, PortsVariant&& ports)
+        : presentation_{presentation}
+        , key_value_{key_value}
+        , ports_{std::move(ports)}
+        , max_nodes_{presentation.transport().getProtocolParams().max_nodes}
+        , entries_{&presentation.memory()}
+        , entries_count_{0}
+        , occupied_{&presentation.memory()}
+        , search_word_{0}
+        , pending_{&presentation.memory()}
+        , blob_{&presentation.memory()}
+        , is_dirty_{false}
+        , response_timeout_{std::chrono::seconds{1}}
+    {
+        setupCallbacks();
+    }
+
+    /// Allocates all the memory in advance, so that request handling never allocates.
+    ///
+    CETL_NODISCARD bool allocateTables(const std::size_t capacity)
+    {
+        // Power of two, and at least twice the capacity - to keep the hash table load factor under 50%.
+        std::size_t slots = 1;
+        while (slots < capacity * 2)
+        {
+            slots <<= 1U;
+        }
+        const std::size_t words = (max_nodes_ + WordBits - 1) / WordBits;
+
+        entries_.reserve(slots);
+        occupied_.reserve(words);
+        pending_.reserve(capacity);
+        // One extra record - so that a stored table which doesn't fit the capacity is detected on loading.
+        blob_.reserve((capacity + 1) * RecordSize);
+        if ((entries_.capacity() < slots) || (occupied_.capacity() < words) || (pending_.capacity() < capacity) ||
+            (blob_.capacity() < (capacity + 1) * RecordSize))
+        {
+            return false;
+        }
+        entries_.resize(slots, Entry{});
+        occupied_.resize(words, Word{0});
+        capacity_    = capacity;
+        search_word_ = words - 1;
+
+        // Node IDs beyond the max nodes (in the last word) are never allocatable.
+        for (std::size_t node_id = max_nodes_; node_id < words * WordBits; ++node_id)
+        {
+            markOccupied(node_id);
+        }
+        return true;
+    }
+
+    void setupCallbacks()
+    {
+        flush_cb_ = presentation_.executor().registerCallback([this](const auto&) {
+            //
+            // There is nothing we can do about possible storage failures here - they are kept as the last error.
+            (void) flush();
+        });
+        CETL_DEBUG_ASSERT(flush_cb_, "Should not fail b/c we pass proper lambda.");
+
+        cetl::visit(
+            [this](auto& ports) {
+                //
+                using Arg = typename std::decay_t<decltype(ports.subscriber)>::OnReceiveCallback::Arg;
+                ports.subscriber.setOnReceiveCallback([this](const Arg& arg) {
+                    //
+                    // Only anonymous messages are requests - others are responses (of this or other allocators).
+                    if (!arg.metadata.publisher_node_id.has_value())
+                    {
+                        handleRequest(arg.message);
+                    }
+                });
+            },
+            ports_);
+    }
+
+    void scheduleFlush()
+    {
+        const auto result = flush_cb_.schedule(Callback::Schedule::Once{presentation_.executor().now()});
+        CETL_DEBUG_ASSERT(result, "");
+        (void) result;
+    }
+
+    void handleRequest(const MessageV1& request)
+    {
+        // Allocatee's request never contains node ID - otherwise it's a response of some v1 allocator.
+        if (request.allocated_node_id.empty())
+        {
+            handleRequest(makeV1Key(request.unique_id_hash), cetl::nullopt);
+        }
+    }
+
+    void handleRequest(const MessageV2& request)
+    {
+        UniqueId unique_id{};
+        std::copy(request.unique_id.cbegin(), request.unique_id.cend(), unique_id.begin());
+        handleRequest(unique_id, request.node_id.value);
+    }
+
+    void handleRequest(const UniqueId& unique_id, const cetl::optional<transport::NodeId> preferred_node_id)
+    {
+        auto* entry = findEntry(unique_id);
+        if (entry == nullptr)
+        {
+            entry = allocateEntry(unique_id, preferred_node_id);
+            if (entry == nullptr)
+            {
+                return;
+            }
+        }
+
+        if (!entry->is_pending)
+        {
+            entry->is_pending = true;
+            pending_.push_back(static_cast<std::size_t>(entry - entries_.data()));
+            CETL_DEBUG_ASSERT(pending_.size() <= capacity_, "Should never grow beyond reserved capacity.");
+            if (pending_.size() == 1)
+            {
+                scheduleFlush();
+            }
+        }
+    }
+
+    Entry* allocateEntry(const UniqueId& unique_id, const cetl::optional<transport::NodeId> preferred_node_id)
+    {
+        if (entries_count_ >= capacity_)
+        {
+            return nullptr;
+        }
+
+        cetl::optional<transport::NodeId> node_id;
+        if (preferred_node_id.has_value() && (*preferred_node_id < max_nodes_) && !isOccupied(*preferred_node_id))
+        {
+            node_id = preferred_node_id;
+        }
+        else
+        {
+            node_id = findHighestFreeNodeId();
+        }
+        if (!node_id.has_value())
+        {
+            return nullptr;
+        }
+
+        is_dirty_ = true;
+        return insertEntry(unique_id, *node_id);
+    }
+
+    Entry* insertEntry(const UniqueId& unique_id, const transport::NodeId node_id) noexcept
+    {
+        auto& entry = entries_[findSlot(unique_id)];
+        CETL_DEBUG_ASSERT(!entry.is_used, "");
+        entry = Entry{unique_id, node_id, true, false};
+        ++entries_count_;
+        markOccupied(node_id);
+        return &entry;
+    }
+
+    /// Finds either the slot of the given unique ID, or the first free one (linear probing).
+    ///
+    std::size_t findSlot(const UniqueId& unique_id) const noexcept
+    {
+        const std::size_t mask  = entries_.size() - 1;
+        std::size_t       index = static_cast<std::size_t>(Allocatee::makeUniqueIdHash(unique_id)) & mask;
+        while (entries_[index].is_used && (entries_[index].unique_id != unique_id))
+        {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    const Entry* findEntry(const UniqueId& unique_id) const noexcept
+    {
+        const auto& entry = entries_[findSlot(unique_id)];
+        return entry.is_used ? &entry : nullptr;
+    }
+
+    Entry* findEntry(const UniqueId& unique_id) noexcept
+    {
+        auto& entry = entries_[findSlot(unique_id)];
+        return entry.is_used ? &entry : nullptr;
+    }
+
+    bool isOccupied(const std::size_t node_id) const noexcept
+    {
+        return (occupied_[node_id / WordBits] & (Word{1} << (node_id % WordBits))) != 0;
+    }
+
+    void markOccupied(const std::size_t node_id) noexcept
+    {
+        occupied_[node_id / WordBits] |= Word{1} << (node_id % WordBits);
+    }
+
+    /// All words above the search one are fully occupied, so the search cursor only moves downwards,
+    /// and each fully occupied word is skipped just once.
+    ///
+    cetl::optional<transport::NodeId> findHighestFreeNodeId() noexcept
+    {
+        while (occupied_[search_word_] == ~Word{0})
+        {
+            if (search_word_ == 0)
+            {
+                return cetl::nullopt;
+            }
+            --search_word_;
+        }
+
+        const Word  free_bits = ~occupied_[search_word_];
+        std::size_t bit       = WordBits - 1;
+        while ((free_bits & (Word{1} << bit)) == 0)
+        {
+            --bit;
+        }
+        return static_cast<transport::NodeId>(search_word_ * WordBits + bit);
+    }
+
+    void discardPending() noexcept
+    {
+        for (const auto index : pending_)
+        {
+            entries_[index].is_pending = false;
+        }
+        pending_.clear();
+    }
+
+    void publishResponse(const Entry& entry, const TimePoint now)
+    {
+        // There is nothing we can do about possible publishing failures - we just ignore them;
+        // the allocatee will repeat its request anyway.
+        // TODO: Introduce error handler at the node level.
+        const auto deadline = now + response_timeout_;
+        cetl::visit(cetl::make_overloaded(
+                        [this, &entry, deadline](Ports<MessageV1>& ports) {
+                            //
+                            MessageV1 response{MessageV1::allocator_type{&presentation_.memory()}};
+                            response.unique_id_hash = getV1Hash(entry.unique_id);
+                            response.allocated_node_id.emplace_back();
+                            response.allocated_node_id.front().value = entry.node_id;
+                            (void) ports.publisher.publish(deadline, response);
+                        },
+                        [this, &entry, deadline](Ports<MessageV2>& ports) {
+                            //
+                            MessageV2 response{MessageV2::allocator_type{&presentation_.memory()}};
+                            response.node_id.value = entry.node_id;
+                            std::copy(entry.unique_id.cbegin(), entry.unique_id.cend(), response.unique_id.begin());
+                            (void) ports.publisher.publish(deadline, response);
+                        }),
+                    ports_);
+    }
+
+    cetl::optional<platform::storage::Error> loadTable()
+    {
+        blob_.resize((capacity_ + 1) * RecordSize);
+        const auto result = key_value_.get(TableKey, {blob_.data(), blob_.size()});
+        if (const auto* const error = cetl::get_if<platform::storage::Error>(&result))
+        {
+            if (*error == platform::storage::Error::Existence)
+            {
+                return cetl::nullopt;  // No table yet - nothing to load.
+            }
+            return *error;
+        }
+
+        const auto size = cetl::get<std::size_t>(result);
+        if (size > capacity_ * RecordSize)
+        {
+            return platform::storage::Error::Capacity;  // Partial loading would lose allocations.
+        }
+        if ((size % RecordSize) != 0)
+        {
+            return platform::storage::Error::Internal;
+        }
+        for (std::size_t offset = 0; offset < size; offset += RecordSize)
+        {
+            const auto* const record  = blob_.data() + offset;
+            const auto        node_id = static_cast<transport::NodeId>(record[0] | (record[1] << 8U));
+            UniqueId          unique_id{};
+            std::copy(record + 2, record + RecordSize, unique_id.begin());
+            if ((node_id >= max_nodes_) || (findEntry(unique_id) != nullptr))
+            {
+                return platform::storage::Error::Internal;
+            }
+            if (isOccupied(node_id))
+            {
+                // F.e. the node ID has become the own one of the allocator (see `reserveNodeId`) -
+                // such record is dropped, and the table will be saved without it on the next change.
+                is_dirty_ = true;
+                continue;
+            }
+            (void) insertEntry(unique_id, node_id);
+        }
+        return cetl::nullopt;
+    }
+
+    cetl::optional<platform::storage::Error> saveTable()
+    {
+        blob_.clear();
+        for (const auto& entry : entries_)
+        {
+            if (entry.is_used)
+            {
+                blob_.push_back(static_cast<std::uint8_t>(entry.node_id & 0xFFU));  // NOLINT(*-magic-numbers)
+                blob_.push_back(static_cast<std::uint8_t>(entry.node_id >> 8U));    // NOLINT(*-magic-numbers)
+                std::copy(entry.unique_id.cbegin(), entry.unique_id.cend(), std::back_inserter(blob_));
+            }
+        }
+        return key_value_.put(TableKey, {blob_.data(), blob_.size()});
+    }
+
+    // MARK: Data members:
+
+    presentation::Presentation&               presentation_;
+    platform::storage::IKeyValue&             key_value_;
+    PortsVariant                              ports_;
+    std::size_t                               max_nodes_;
+    std::size_t                               capacity_{0};
+    libcyphal::detail::VarArray<Entry>        entries_;
+    std::size_t                               entries_count_;
+    libcyphal::detail::VarArray<Word>         occupied_;
+    std::size_t                               search_word_;
+    libcyphal::detail::VarArray<std::size_t>  pending_;
+    libcyphal::detail::VarArray<std::uint8_t> blob_;
+    bool                                      is_dirty_;
+    Duration                                  response_timeout_;
+    cetl::optional<platform::storage::Error>  last_error_;
+    Callback::Any                             flush_cb_;
+
+};  // Allocator
+
+}  // namespace pnp
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_PNP_ALLOCATOR_HPP_INCLUDED
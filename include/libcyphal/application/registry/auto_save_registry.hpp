@@ -0,0 +1,172 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_APPLICATION_REGISTRY_AUTO_SAVE_REGISTRY_HPP_INCLUDED
+#define LIBCYPHAL_APPLICATION_REGISTRY_AUTO_SAVE_REGISTRY_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/platform/storage.hpp"
+#include "libcyphal/types.hpp"
+#include "register.hpp"
+#include "registry.hpp"
+#include "registry_impl.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstddef>
+
+namespace libcyphal
+{
+namespace application
+{
+namespace registry
+{
+
+/// Defines a registry decorator which automatically saves changed registers to the storage.
+///
+/// All calls are forwarded to the decorated registry. Every successful `set` (re)schedules a deferred save
+/// (see `registry::saveDirty`) via the executor - `debounce` time after the latest change. So, a burst of changes
+/// (f.e. a tool writing a bunch of registers one by one) is coalesced into a single save, which in turn writes only
+/// the changed registers. Pass this decorator (instead of the decorated registry) to the `RegistryProvider`,
+/// so that register changes made over the network are persisted automatically.
+///
+/// Registers changed bypassing this decorator (f.e. via `RegisterHandle`) are still tracked as dirty, but they are
+/// saved only on the next scheduled save - use `requestSave` to schedule it explicitly.
+///
+class AutoSaveRegistry final : public IIntrospectableRegistry
+{
+public:
+    /// Constructs a new auto-save decorator.
+    ///
+    /// @param executor The executor to schedule deferred saves with.
+    /// @param registry The registry to decorate. Should outlive this decorator.
+    /// @param key_value The key-value storage to save registers to. Should outlive this decorator.
+    /// @param debounce The delay of a save since the latest register change.
+    ///
+    AutoSaveRegistry(IExecutor&                    executor,
+                     IIntrospectableRegistry&      registry,
+                     platform::storage::IKeyValue& key_value,
+                     const Duration                debounce)
+        : executor_{executor}
+        , registry_{registry}
+        , key_value_{key_value}
+        , debounce_{debounce}
+    {
+        save_callback_ = executor_.registerCallback([this](const auto&) {
+            //
+            if (is_save_pending_)
+            {
+                (void) flush();
+            }
+        });
+        CETL_DEBUG_ASSERT(save_callback_, "Should not fail b/c we pass proper lambda.");
+    }
+
+    /// Note that a pending save (if any) is not performed on destruction - use `flush` if needed.
+    ///
+    ~AutoSaveRegistry() = default;
+
+    AutoSaveRegistry(AutoSaveRegistry&&)                 = delete;
+    AutoSaveRegistry(const AutoSaveRegistry&)            = delete;
+    AutoSaveRegistry& operator=(AutoSaveRegistry&&)      = delete;
+    AutoSaveRegistry& operator=(const AutoSaveRegistry&) = delete;
+
+    /// Schedules (or re-schedules) a deferred save - `debounce` time from now.
+    ///
+    void requestSave()
+    {
+        is_save_pending_ = true;
+        (void) save_callback_.schedule(IExecutor::Callback::Schedule::Once{executor_.now() + debounce_});
+    }
+
+    /// Checks whether there is a deferred save scheduled.
+    ///
+    bool isSavePending() const noexcept
+    {
+        return is_save_pending_;
+    }
+
+    /// Immediately saves all changed registers (and cancels a pending deferred save if any).
+    ///
+    /// @return Nothing in case of success. Otherwise, the very first storage error - it's also
+    ///         retained as the last error (see `getLastError`), and failed registers stay dirty.
+    ///
+    cetl::optional<platform::storage::Error> flush()
+    {
+        is_save_pending_ = false;
+        last_error_      = saveDirty(key_value_, registry_);
+        return last_error_;
+    }
+
+    /// Gets result of the latest save - either a deferred one or explicit `flush`.
+    ///
+    cetl::optional<platform::storage::Error> getLastError() const noexcept
+    {
+        return last_error_;
+    }
+
+    // MARK: - IRegistry
+
+    cetl::optional<IRegister::ValueAndFlags> get(const IRegister::Name name) const override
+    {
+        return registry_.get(name);
+    }
+
+    cetl::optional<SetError> set(const IRegister::Name name, const IRegister::Value& new_value) override
+    {
+        auto result = registry_.set(name, new_value);
+        if (!result.has_value())
+        {
+            requestSave();
+        }
+        return result;
+    }
+
+    // MARK: - IIntrospectableRegistry
+
+    std::size_t size() const override
+    {
+        return registry_.size();
+    }
+
+    IRegister::Name index(const std::size_t index) const override
+    {
+        return registry_.index(index);
+    }
+
+    bool append(IRegister& reg) override
+    {
+        return registry_.append(reg);
+    }
+
+    bool isDirty(const IRegister::Name name) const override
+    {
+        return registry_.isDirty(name);
+    }
+
+    void clearDirty(const IRegister::Name name) override
+    {
+        registry_.clearDirty(name);
+    }
+
+private:
+    // MARK: Data members:
+
+    IExecutor&                               executor_;
+    IIntrospectableRegistry&                 registry_;
+    platform::storage::IKeyValue&            key_value_;
+    const Duration                           debounce_;
+    IExecutor::Callback::Any                 save_callback_;
+    bool                                     is_save_pending_{false};
+    cetl::optional<platform::storage::Error> last_error_;
+
+};  // AutoSaveRegistry
+
+}  // namespace registry
+}  // namespace application
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_APPLICATION_REGISTRY_AUTO_SAVE_REGISTRY_HPP_INCLUDED
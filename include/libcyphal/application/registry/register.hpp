@@ -18,6 +18,7 @@
 #include <uavcan/primitive/String_1_0.hpp>
 
 #include <cstdint>
+#include <utility>
 
 namespace libcyphal
 {
@@ -49,9 +50,14 @@ enum class SetError : std::uint8_t
 
 };  // SetError
 
+class Registry;
+
 /// Defines interface for a register.
 ///
-class IRegister : public common::cavl::Node<IRegister>
+/// Registers are kept in an order-statistic tree (see `SubtreeSizeAugmentation`), so that the registry
+/// introspection by index (f.e. by the `uavcan.register.List` service) is O(log n) per register.
+///
+class IRegister : public common::cavl::Node<IRegister, common::cavl::SubtreeSizeAugmentation>
 {
     // 1AD1885B-954B-48CF-BAC4-FA0A251D3FC0
     // clang-format off
@@ -123,6 +129,15 @@ public:
         {
         }
 
+        /// Gets the raw hash value of the key.
+        ///
+        /// Could be used to build external (f.e. flat sorted) lookup indices of registers.
+        ///
+        CETL_NODISCARD std::uint64_t getValue() const noexcept
+        {
+            return value_;
+        }
+
         /// Positive if this one is greater than the other.
         ///
         CETL_NODISCARD std::int8_t compare(const Key other) const noexcept
@@ -171,6 +186,24 @@ public:
         return key_;
     }
 
+    /// Checks whether the register value has been changed since it was last saved.
+    ///
+    /// A new register is considered dirty, so that its value is saved (see `registry::saveDirty`) at least once.
+    /// The flag is set by a successful `IRegistry::set` of the registry (so for any register implementation),
+    /// and by a successful `setTyped` of the built-in register implementation.
+    ///
+    bool isDirty() const noexcept
+    {
+        return is_dirty_;
+    }
+
+    /// Marks the register value as changed (or as saved, aka clean).
+    ///
+    void setDirty(const bool is_dirty) noexcept
+    {
+        is_dirty_ = is_dirty;
+    }
+
     /// Compares the register by key with a given one.
     ///
     CETL_NODISCARD std::int8_t compareBy(const Key other_key) const noexcept
@@ -198,11 +231,16 @@ protected:
     IRegister(IRegister&& other) noexcept
         : Node{std::move(static_cast<Node&&>(other))}
         , key_{other.key_}
+        , is_dirty_{other.is_dirty_}
+        , frozen_flag_{std::exchange(other.frozen_flag_, nullptr)}
     {
+        // The frozen index (if any) still refers to the old (moved from) register.
+        dropFrozenIndex();
     }
 
     ~IRegister()
     {
+        dropFrozenIndex();
         if (isLinked())
         {
             remove();
@@ -210,9 +248,22 @@ protected:
     }
 
 private:
+    friend class Registry;
+
+    void dropFrozenIndex() noexcept
+    {
+        if (frozen_flag_ != nullptr)
+        {
+            *frozen_flag_ = false;
+        }
+    }
+
     // MARK: Data members:
 
     const Key key_;
+    bool      is_dirty_{true};
+    // Points to the "is frozen" flag of the registry which has this register in its frozen index (see `freeze`).
+    bool* frozen_flag_{nullptr};
 
 };  // IRegister
 
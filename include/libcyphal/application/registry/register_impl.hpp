@@ -9,7 +9,18 @@
 #include "register.hpp"
 
 #include <cetl/cetl.hpp>
-
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <uavcan/primitive/Empty_1_0.hpp>
+#include <uavcan/primitive/String_1_0.hpp>
+#include <uavcan/primitive/Unstructured_1_0.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 namespace libcyphal
@@ -18,6 +29,286 @@ namespace application
 {
 namespace registry
 {
+
+/// Internal implementation details of the Application layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// Checks whether the given type is a plain scalar which has direct counterpart in the register value.
+///
+template <typename T>
+struct IsPlainScalar : std::false_type
+{};
+template <>
+struct IsPlainScalar<bool> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::int8_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::uint8_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::int16_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::uint16_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::int32_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::uint32_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::int64_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<std::uint64_t> : std::true_type
+{};
+template <>
+struct IsPlainScalar<float> : std::true_type
+{};
+template <>
+struct IsPlainScalar<double> : std::true_type
+{};
+
+/// Checks whether the given type is a plain value (scalar or fixed size array of scalars),
+/// which could be used by a register instead of the register value variant.
+///
+template <typename T>
+struct IsPlainValue : IsPlainScalar<T>
+{};
+template <typename T, std::size_t N>
+struct IsPlainValue<std::array<T, N>> : IsPlainScalar<T>
+{};
+
+// Gets the array of the register value which corresponds to the given plain scalar type.
+//
+inline auto& emplaceArrayOf(IRegister::Value& value, const bool)
+{
+    return value.set_bit().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::int8_t)
+{
+    return value.set_integer8().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::uint8_t)
+{
+    return value.set_natural8().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::int16_t)
+{
+    return value.set_integer16().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::uint16_t)
+{
+    return value.set_natural16().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::int32_t)
+{
+    return value.set_integer32().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::uint32_t)
+{
+    return value.set_natural32().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::int64_t)
+{
+    return value.set_integer64().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const std::uint64_t)
+{
+    return value.set_natural64().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const float)
+{
+    return value.set_real32().value;
+}
+inline auto& emplaceArrayOf(IRegister::Value& value, const double)
+{
+    return value.set_real64().value;
+}
+
+/// Assigns the register value from a plain scalar.
+///
+template <typename T>
+auto assignValue(IRegister::Value& dst, const T src) -> std::enable_if_t<IsPlainScalar<T>::value>
+{
+    auto& dst_array = emplaceArrayOf(dst, src);
+    dst_array.push_back(src);
+}
+
+/// Assigns the register value from a plain fixed size array.
+///
+template <typename T, std::size_t N>
+auto assignValue(IRegister::Value& dst, const std::array<T, N>& src) -> std::enable_if_t<IsPlainScalar<T>::value>
+{
+    auto& dst_array = emplaceArrayOf(dst, T{});
+    dst_array.reserve(N);
+    for (const auto& item : src)
+    {
+        dst_array.push_back(item);
+    }
+}
+
+// Non-numeric alternatives of the register value can't be converted to plain values.
+//
+template <typename T, std::size_t N>
+bool convertArray(const uavcan::primitive::Empty_1_0&, std::array<T, N>&)
+{
+    return false;
+}
+template <typename T, std::size_t N>
+bool convertArray(const uavcan::primitive::String_1_0&, std::array<T, N>&)
+{
+    return false;
+}
+template <typename T, std::size_t N>
+bool convertArray(const uavcan::primitive::Unstructured_1_0&, std::array<T, N>&)
+{
+    return false;
+}
+
+/// Checks whether the given type is a plain integer (but not a bit).
+///
+template <typename T>
+struct IsPlainInteger : std::integral_constant<bool, IsPlainScalar<T>::value && std::is_integral<T>::value>
+{};
+template <>
+struct IsPlainInteger<bool> : std::false_type
+{};
+
+/// Checks whether the integral value is negative (without "always false" comparisons of unsigned types).
+///
+template <typename S>
+constexpr auto isNegative(const S value) -> std::enable_if_t<std::is_signed<S>::value, bool>
+{
+    return value < 0;
+}
+template <typename S>
+constexpr auto isNegative(const S) -> std::enable_if_t<!std::is_signed<S>::value, bool>
+{
+    return false;
+}
+
+// Converts a numeric scalar to the plain scalar type, but only if the value is representable by the type.
+// Any non-NaN value is a valid bit (non-zero is `true`).
+//
+template <typename S>
+bool convertScalar(const S src, bool& dst)
+{
+    if (std::isnan(src))
+    {
+        return false;
+    }
+    dst = static_cast<bool>(src);
+    return true;
+}
+template <typename S, typename T>
+auto convertScalar(const S src, T& dst) -> std::enable_if_t<std::is_floating_point<T>::value, bool>
+{
+    // Finite values beyond the range (f.e. `double` to `float`) are rejected; NaN and infinities are kept as is.
+    if (std::isfinite(src) && (std::fabs(static_cast<double>(src)) > std::numeric_limits<T>::max()))
+    {
+        return false;
+    }
+    dst = static_cast<T>(src);
+    return true;
+}
+template <typename S, typename T>
+auto convertScalar(const S src, T& dst)
+    -> std::enable_if_t<std::is_integral<S>::value && IsPlainInteger<T>::value, bool>
+{
+    using Limits = std::numeric_limits<T>;
+
+    if (isNegative(src) ? (static_cast<std::intmax_t>(src) < static_cast<std::intmax_t>(Limits::min()))
+                        : (static_cast<std::uintmax_t>(src) > static_cast<std::uintmax_t>(Limits::max())))
+    {
+        return false;
+    }
+    dst = static_cast<T>(src);
+    return true;
+}
+template <typename S, typename T>
+auto convertScalar(const S src, T& dst)
+    -> std::enable_if_t<std::is_floating_point<S>::value && IsPlainInteger<T>::value, bool>
+{
+    using Limits = std::numeric_limits<T>;
+
+    if (std::isnan(src))
+    {
+        return false;
+    }
+    // The fractional part is discarded anyway, so only the integral part has to fit into the range.
+    // Both bounds are powers of two, and so are exactly representable by the floating point type.
+    const S integral = std::trunc(src);
+    const S upper    = std::ldexp(S{1}, Limits::digits);
+    const S lower    = Limits::is_signed ? -upper : S{};
+    if ((integral < lower) || (integral >= upper))
+    {
+        return false;
+    }
+    dst = static_cast<T>(integral);
+    return true;
+}
+
+// Numeric arrays (including bits) are converted element-wise, but only if their size matches exactly,
+// and every element is representable by the plain scalar type.
+//
+template <typename Array, typename T, std::size_t N>
+auto convertArray(const Array& src, std::array<T, N>& dst) -> decltype(src.value.size(), bool())
+{
+    using Item = typename std::decay_t<decltype(src.value)>::value_type;
+
+    if (src.value.size() != N)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (!convertScalar(static_cast<Item>(src.value[i]), dst[i]))  // NOLINT(*-constant-array-index)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Tries to convert the register value to a plain fixed size array.
+///
+/// Any numeric (or bit) array value of the same size is accepted - as long as each element is representable
+/// by the plain scalar type (f.e. `300` or `-1` can't be converted to `std::uint8_t`, NaN - to any integer).
+///
+/// @return `true` if the value has been converted; `false` if the value is not compatible with the array.
+///
+template <typename T, std::size_t N>
+auto tryConvertValue(const IRegister::Value& src, std::array<T, N>& dst)
+    -> std::enable_if_t<IsPlainScalar<T>::value, bool>
+{
+    return cetl::visit([&dst](const auto& alternative) { return convertArray(alternative, dst); }, src.union_value);
+}
+
+/// Tries to convert the register value to a plain scalar.
+///
+/// @return `true` if the value has been converted; `false` if the value is not a single element numeric array.
+///
+template <typename T>
+auto tryConvertValue(const IRegister::Value& src, T& dst) -> std::enable_if_t<IsPlainScalar<T>::value, bool>
+{
+    std::array<T, 1> dst_array{};
+    if (!tryConvertValue(src, dst_array))
+    {
+        return false;
+    }
+    dst = dst_array.front();
+    return true;
+}
+
+}  // namespace detail
+
 /// Defines abstract base class for a register implementation.
 ///
 /// Implements common functionality for all register types like name, options, and value accessors.
@@ -55,7 +346,7 @@ protected:
         return {value, {is_mutable, options_.persistent}};
     }
 
-    template <typename T>
+    template <typename T, std::enable_if_t<!detail::IsPlainValue<T>::value, bool> = true>
     ValueAndFlags getImpl(const T& value, const bool is_mutable) const
     {
         ValueAndFlags out{Value{allocator_}, {is_mutable, options_.persistent}};
@@ -63,6 +354,14 @@ protected:
         return out;
     }
 
+    template <typename T, std::enable_if_t<detail::IsPlainValue<T>::value, bool> = true>
+    ValueAndFlags getImpl(const T& value, const bool is_mutable) const
+    {
+        ValueAndFlags out{Value{allocator_}, {is_mutable, options_.persistent}};
+        detail::assignValue(out.value, value);
+        return out;
+    }
+
 private:
     // MARK: Data members:
 
@@ -76,18 +375,29 @@ private:
 
 /// Defines a read-write register implementation.
 ///
-/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants.
+/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants,
+///                or a plain value - a scalar (`bool`, fixed width integer, `float` or `double`)
+///                or a fixed size `std::array` of such scalars.
 /// @tparam Setter The setter function `cetl::optional<SetError>(const Value&)` type.
+///                For a plain value `T` the setter should be `cetl::optional<SetError>(const T&)` instead.
 ///
 /// The actual value is provided by the getter function,
 /// and the setter function is used to update the value.
 ///
+/// Registers of plain values are converted to/from the `Value` variant only at the network boundary
+/// (by `get` and `set` methods). The application could use the typed `getTyped` and `setTyped` accessors instead,
+/// which neither construct `Value` nor allocate any memory.
+///
 template <typename Getter, typename Setter>
 class RegisterImpl final : public RegisterBase
 {
     using Base = RegisterBase;
 
 public:
+    /// Defines type of the value provided by the getter.
+    ///
+    using ValueType = std::decay_t<decltype(std::declval<const Getter&>()())>;
+
     /// Constructs a new read-write detached register, which is not yet linked to any registry (aka detached).
     ///
     /// A detached register must be appended to a registry before its value could be exposed by the registry.
@@ -128,10 +438,52 @@ public:
 
     cetl::optional<SetError> set(const Value& new_value) override
     {
-        return setter_(new_value);
+        return setImpl(new_value, std::integral_constant<bool, detail::IsPlainValue<ValueType>::value>{});
+    }
+
+    // MARK: Typed accessors
+
+    /// Gets the register current plain value - directly from the getter, without any conversion or allocation.
+    ///
+    template <typename T = ValueType, typename = std::enable_if_t<detail::IsPlainValue<T>::value>>
+    T getTyped() const
+    {
+        return getter_();
+    }
+
+    /// Sets the register plain value - directly via the setter, without any conversion or allocation.
+    ///
+    /// A successfully set value marks the register as dirty (see `IRegister::isDirty`).
+    ///
+    /// @return Optional error if the value cannot be set.
+    ///
+    template <typename T = ValueType, typename = std::enable_if_t<detail::IsPlainValue<T>::value>>
+    cetl::optional<SetError> setTyped(const T& new_value)
+    {
+        auto result = setter_(new_value);
+        if (!result.has_value())
+        {
+            this->setDirty(true);
+        }
+        return result;
     }
 
 private:
+    cetl::optional<SetError> setImpl(const Value& new_value, std::false_type /* is_plain */)
+    {
+        return setter_(new_value);
+    }
+
+    cetl::optional<SetError> setImpl(const Value& new_value, std::true_type /* is_plain */)
+    {
+        ValueType typed_value{};
+        if (!detail::tryConvertValue(new_value, typed_value))
+        {
+            return SetError::Semantics;
+        }
+        return setter_(typed_value);
+    }
+
     // MARK: Data members:
 
     Getter getter_;
@@ -139,7 +491,8 @@ private:
 };
 /// Defines a read-only register implementation.
 ///
-/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants.
+/// @tparam Getter The getter function `T()` type, where `T` is either `Value` or one of its variants,
+///                or a plain value (see the read-write register implementation above).
 ///
 /// The actual value is provided by the getter function.
 ///
@@ -149,6 +502,10 @@ class RegisterImpl<Getter, void> final : public RegisterBase
     using Base = RegisterBase;
 
 public:
+    /// Defines type of the value provided by the getter.
+    ///
+    using ValueType = std::decay_t<decltype(std::declval<const Getter&>()())>;
+
     /// Constructs a new read-only register, which is not yet linked to any registry (aka detached).
     ///
     /// A detached register must be appended to a registry before its value could be exposed by the registry.
@@ -186,6 +543,16 @@ public:
         return SetError::Mutability;
     }
 
+    // MARK: Typed accessors
+
+    /// Gets the register current plain value - directly from the getter, without any conversion or allocation.
+    ///
+    template <typename T = ValueType, typename = std::enable_if_t<detail::IsPlainValue<T>::value>>
+    T getTyped() const
+    {
+        return getter_();
+    }
+
 private:
     // MARK: Data members:
 
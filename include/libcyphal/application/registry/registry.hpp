@@ -87,6 +87,29 @@ public:
     ///
     virtual bool append(IRegister& reg) = 0;
 
+    /// Checks whether value of the register has been changed since it was last saved (see `registry::saveDirty`).
+    ///
+    /// The default implementation doesn't track changes, and so considers all registers as dirty.
+    ///
+    /// @param name The name of the register.
+    ///
+    virtual bool isDirty(const IRegister::Name name) const
+    {
+        (void) name;
+        return true;
+    }
+
+    /// Marks value of the register as saved (aka clean).
+    ///
+    /// The default implementation doesn't track changes, and so does nothing.
+    ///
+    /// @param name The name of the register.
+    ///
+    virtual void clearDirty(const IRegister::Name name)
+    {
+        (void) name;
+    }
+
 protected:
     IIntrospectableRegistry()  = default;
     ~IIntrospectableRegistry() = default;
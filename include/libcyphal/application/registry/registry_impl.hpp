@@ -17,8 +17,10 @@
 
 #include <uavcan/_register/Value_1_0.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace libcyphal
@@ -28,6 +30,87 @@ namespace application
 namespace registry
 {
 
+/// Defines a handle of a register which was resolved by name once (see `Registry::getHandle`).
+///
+/// Application code which accesses the same register repeatedly (f.e. in a loop) could keep the handle,
+/// and so skip name hashing and lookup on every access.
+///
+/// The handle doesn't own the register - it's just a pointer to it, so the register must outlive the handle,
+/// and must not be moved while the handle is in use.
+///
+class RegisterHandle final
+{
+public:
+    /// Constructs an invalid handle (not referring to any register).
+    ///
+    RegisterHandle() = default;
+
+    /// Checks if the handle refers to a register.
+    ///
+    bool isValid() const noexcept
+    {
+        return register_ != nullptr;
+    }
+
+    /// Gets name of the referred register.
+    ///
+    /// @return Name of the register. Empty if the handle is invalid.
+    ///
+    IRegister::Name getName() const
+    {
+        return isValid() ? register_->getName() : IRegister::Name{};
+    }
+
+    /// Reads the current value and flags of the referred register.
+    ///
+    /// @return Value and flags. Empty if the handle is invalid.
+    ///
+    cetl::optional<IRegister::ValueAndFlags> get() const
+    {
+        if (isValid())
+        {
+            return register_->get();
+        }
+        return cetl::nullopt;
+    }
+
+    /// Assigns the referred register with the specified value.
+    ///
+    /// Like `Registry::set`, marks the register as dirty on success.
+    ///
+    /// @return Empty if value was set successfully, otherwise the error.
+    ///         `SetError::Existence` if the handle is invalid.
+    ///
+    cetl::optional<SetError> set(const IRegister::Value& new_value) const
+    {
+        if (isValid())
+        {
+            auto result = register_->set(new_value);
+            if (!result.has_value())
+            {
+                register_->setDirty(true);
+            }
+            return result;
+        }
+        return SetError::Existence;
+    }
+
+private:
+    friend class Registry;
+
+    explicit RegisterHandle(IRegister* const reg) noexcept
+        : register_{reg}
+    {
+    }
+
+    // MARK: Data members:
+
+    IRegister* register_{nullptr};
+
+};  // RegisterHandle
+
+// MARK: -
+
 /// Defines the registry implementation.
 ///
 class Registry final : public IIntrospectableRegistry
@@ -41,7 +124,10 @@ public:
         : memory_{memory}
     {
     }
-    ~Registry() = default;
+    ~Registry()
+    {
+        releaseIndex();
+    }
 
     Registry(Registry&&)                 = delete;
     Registry(const Registry&)            = delete;
@@ -53,6 +139,77 @@ public:
         return memory_;
     }
 
+    /// Freezes the current set of registers into a flat lookup index.
+    ///
+    /// Intended for applications which create all (or most) of their registers at startup. Once frozen,
+    /// lookup of registers by name (see `get`, `set` and `getHandle`) does a binary search over a contiguous
+    /// sorted array of name hashes, instead of chasing tree node pointers scattered all over the memory.
+    ///
+    /// The index is dropped as soon as the set of registers changes (a register is appended, destroyed or moved),
+    /// and then lookup falls back to the tree - call this method again to rebuild the index.
+    /// Note that lookup by name still hashes the name (CRC-64) on every call - keep a `RegisterHandle`
+    /// (see `getHandle`) to skip both the hashing and the lookup.
+    ///
+    /// @return `true` if the index has been built. `false` if there is not enough memory for the index -
+    ///         the registry stays functional but not frozen.
+    ///
+    bool freeze()
+    {
+        static_assert(alignof(IRegister*) <= alignof(std::uint64_t), "");
+
+        releaseIndex();
+
+        const std::size_t count = registers_tree_.size();
+        if (count > 0)
+        {
+            void* const raw_index = memory_.allocate(indexSizeBytes(count), alignof(std::uint64_t));
+            if (raw_index == nullptr)
+            {
+                return false;
+            }
+
+            // Both arrays share the same allocation: keys first, and then the registers.
+            index_keys_      = static_cast<std::uint64_t*>(raw_index);
+            index_registers_ = reinterpret_cast<IRegister**>(index_keys_ + count);  // NOLINT
+
+            // The tree is ordered by descending keys, so reversed in-order traversal gives us sorted keys.
+            std::size_t position = 0;
+            registers_tree_.traverseInOrder(
+                [this, &position](IRegister& reg) {
+                    //
+                    index_keys_[position]      = reg.getKey().getValue();  // NOLINT(*-pointer-arithmetic)
+                    index_registers_[position] = &reg;                     // NOLINT(*-pointer-arithmetic)
+                    reg.frozen_flag_           = &is_frozen_;
+                    ++position;
+                },
+                true);
+            CETL_DEBUG_ASSERT(position == count, "");
+            CETL_DEBUG_ASSERT(std::is_sorted(index_keys_, index_keys_ + count), "");  // NOLINT
+        }
+
+        index_size_ = count;
+        is_frozen_  = true;
+        return true;
+    }
+
+    /// Checks if the registry has an up-to-date frozen lookup index (see `freeze`).
+    ///
+    bool isFrozen() const noexcept
+    {
+        CETL_DEBUG_ASSERT(!is_frozen_ || (index_size_ == registers_tree_.size()), "Index should be dropped.");
+        return is_frozen_;
+    }
+
+    /// Resolves a register by name once, so that it could be accessed later without name lookup.
+    ///
+    /// @param name The name of the register.
+    /// @return Handle of the register. Invalid if there is no such register.
+    ///
+    RegisterHandle getHandle(const IRegister::Name name)
+    {
+        return RegisterHandle{findRegisterBy(name)};
+    }
+
     // MARK: - IRegistry
 
     cetl::optional<IRegister::ValueAndFlags> get(const IRegister::Name name) const override
@@ -68,7 +225,12 @@ public:
     {
         if (auto* const reg = findRegisterBy(name))
         {
-            return reg->set(new_value);
+            auto result = reg->set(new_value);
+            if (!result.has_value())
+            {
+                reg->setDirty(true);
+            }
+            return result;
         }
         return SetError::Existence;
     }
@@ -93,6 +255,8 @@ public:
     {
         CETL_DEBUG_ASSERT(!reg.isLinked(), "Should not be linked yet.");
 
+        releaseIndex();
+
         auto register_existing = registers_tree_.search(
             [key = reg.getKey()](const IRegister& other) {
                 //
@@ -108,6 +272,20 @@ public:
         return !std::get<1>(register_existing);
     }
 
+    bool isDirty(const IRegister::Name name) const override
+    {
+        const auto* const reg = findRegisterBy(name);
+        return (reg != nullptr) && reg->isDirty();
+    }
+
+    void clearDirty(const IRegister::Name name) override
+    {
+        if (auto* const reg = findRegisterBy(name))
+        {
+            reg->setDirty(false);
+        }
+    }
+
     // MARK: - Other factory methods:
 
     /// Constructs a new read-only register, and links it to this registry.
@@ -147,20 +325,64 @@ public:
     }
 
 private:
+    static constexpr std::size_t indexSizeBytes(const std::size_t count) noexcept
+    {
+        return count * (sizeof(std::uint64_t) + sizeof(IRegister*));
+    }
+
     CETL_NODISCARD IRegister* findRegisterBy(const IRegister::Name name)
     {
-        return registers_tree_.search(
-            [key = IRegister::Key{name}](const IRegister& other) { return other.compareBy(key); });
+        const IRegister::Key key{name};
+        if (isFrozen())
+        {
+            return findRegisterInIndex(key);
+        }
+        return registers_tree_.search([key](const IRegister& other) { return other.compareBy(key); });
     }
 
     CETL_NODISCARD const IRegister* findRegisterBy(const IRegister::Name name) const
     {
-        return registers_tree_.search(
-            [key = IRegister::Key{name}](const IRegister& other) { return other.compareBy(key); });
+        const IRegister::Key key{name};
+        if (isFrozen())
+        {
+            return findRegisterInIndex(key);
+        }
+        return registers_tree_.search([key](const IRegister& other) { return other.compareBy(key); });
+    }
+
+    CETL_NODISCARD IRegister* findRegisterInIndex(const IRegister::Key key) const noexcept
+    {
+        const std::uint64_t        key_value  = key.getValue();
+        const std::uint64_t* const keys_begin = index_keys_;
+        const std::uint64_t* const keys_end   = keys_begin + index_size_;  // NOLINT(*-pointer-arithmetic)
+        const std::uint64_t* const found      = std::lower_bound(keys_begin, keys_end, key_value);
+        if ((found != keys_end) && (*found == key_value))
+        {
+            return index_registers_[found - keys_begin];  // NOLINT(*-pointer-arithmetic)
+        }
+        return nullptr;
+    }
+
+    void releaseIndex() noexcept
+    {
+        if (index_keys_ != nullptr)
+        {
+            memory_.deallocate(index_keys_, indexSizeBytes(index_size_), alignof(std::uint64_t));
+        }
+        index_keys_      = nullptr;
+        index_registers_ = nullptr;
+        index_size_      = 0;
+        is_frozen_       = false;
     }
 
-    cetl::pmr::memory_resource&   memory_;
-    common::cavl::Tree<IRegister> registers_tree_;
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    IRegister::TreeType         registers_tree_;
+    std::uint64_t*              index_keys_{nullptr};
+    IRegister**                 index_registers_{nullptr};
+    std::size_t                 index_size_{0};
+    bool                        is_frozen_{false};
 
 };  // Registry
 
@@ -228,7 +450,11 @@ inline auto handleKeyValueGet(const platform::storage::IKeyValue& key_value,
     {
         // Assign the value to the register.
         // Shall it fail, the error is likely to be corrected during the next save().
-        (void) registry.set(register_name, value_storage);
+        if (!registry.set(register_name, value_storage).has_value())
+        {
+            // The register value is in sync with the storage now, so there is no need to save it.
+            registry.clearDirty(register_name);
+        }
     }
 
     return cetl::nullopt;
@@ -268,6 +494,23 @@ inline auto handleKeyValueDrop(platform::storage::IKeyValue& key_value,
     return cetl::nullopt;
 }
 
+inline auto handleRegisterSave(platform::storage::IKeyValue&  key_value,
+                               const IIntrospectableRegistry& registry,
+                               const IRegister::Name          register_name) -> OptStorageError
+{
+    // If we get nothing, this means that the register has disappeared from the register.
+    if (const auto reg_meta = registry.get(register_name))
+    {
+        // We do not save immutable registers because they are assumed to be constant, so no
+        // need to waste storage.
+        if (reg_meta->flags.persistent && reg_meta->flags._mutable)
+        {
+            return handleKeyValueSet(key_value, register_name, reg_meta->value);
+        }
+    }
+    return cetl::nullopt;
+}
+
 }  // namespace detail
 
 /// Scan all persistent registers in the registry and load their values from the storage if present.
@@ -324,6 +567,9 @@ inline auto load(const platform::storage::IKeyValue& key_value, IIntrospectableR
 /// The removal predicate allows the caller to specify which registers need to be removed from the storage
 /// instead of being saved. This is useful for implementing the "factory reset" feature.
 ///
+/// Registers are saved regardless of their dirty flags (see `IRegister::isDirty`), which stay untouched -
+/// use `saveDirty` to save only changed registers.
+///
 /// @param key_value The key-value storage to save the registers to.
 /// @param registry The registry to save the registers from.
 /// @param reset_predicate The predicate to determine which registers should be removed from the storage.
@@ -345,25 +591,62 @@ auto save(platform::storage::IKeyValue&  key_value,
             {
                 return detail::handleKeyValueDrop(key_value, reg_name);
             }
+            return detail::handleRegisterSave(key_value, registry, reg_name);
+        });
+}
+inline auto save(platform::storage::IKeyValue&  key_value,
+                 const IIntrospectableRegistry& registry) -> cetl::optional<platform::storage::Error>
+{
+    return save(key_value, registry, [](const IRegister::Name) { return false; });
+}
+
+/// Saves all changed (aka dirty) persistent mutable registers from the registry to the storage.
+///
+/// Same as `save` above, but registers which haven't been changed since the last save
+/// (or load) are skipped - see `IIntrospectableRegistry::isDirty`, so only the changed ones are serialized and
+/// written to the storage. Successfully saved registers are marked as clean (see `clearDirty`), while registers
+/// that failed to be written stay dirty, so that they will be retried on the next save.
+///
+/// @param key_value The key-value storage to save the registers to.
+/// @param registry The registry to save the registers from.
+/// @param reset_predicate The predicate to determine which registers should be removed from the storage.
+///                        Should have `bool(const IRegister::Name)` signature.
+/// @return Nothing in case of success.
+///         Otherwise, the very first error encountered (on which we stopped the registry enumeration).
+///
+template <typename ResetPredicate>
+auto saveDirty(platform::storage::IKeyValue& key_value,
+               IIntrospectableRegistry&      registry,
+               const ResetPredicate&         reset_predicate) -> cetl::optional<platform::storage::Error>
+{
+    return detail::introspectRegistry(  //
+        registry,
+        [&key_value, &registry, &reset_predicate](const IRegister::Name reg_name) -> detail::OptStorageError {
+            //
+            // Reset is handled before any other checks to enhance forward compatibility.
+            if (reset_predicate(reg_name))
+            {
+                return detail::handleKeyValueDrop(key_value, reg_name);
+            }
 
-            // If we get nothing, this means that the register has disappeared from the register.
-            if (const auto reg_meta = registry.get(reg_name))
+            // Unchanged registers are skipped even before getting their values.
+            if (!registry.isDirty(reg_name))
             {
-                // We do not save immutable registers because they are assumed to be constant, so no
-                // need to waste storage.
-                if (reg_meta->flags.persistent && reg_meta->flags._mutable)
-                {
-                    return detail::handleKeyValueSet(key_value, reg_name, reg_meta->value);
-                }
+                return cetl::nullopt;
             }
 
+            if (const auto err = detail::handleRegisterSave(key_value, registry, reg_name))
+            {
+                return err;
+            }
+            registry.clearDirty(reg_name);
             return cetl::nullopt;
         });
 }
-inline auto save(platform::storage::IKeyValue&  key_value,
-                 const IIntrospectableRegistry& registry) -> cetl::optional<platform::storage::Error>
+inline auto saveDirty(platform::storage::IKeyValue& key_value,
+                      IIntrospectableRegistry&      registry) -> cetl::optional<platform::storage::Error>
 {
-    return save(key_value, registry, [](const IRegister::Name) { return false; });
+    return saveDirty(key_value, registry, [](const IRegister::Name) { return false; });
 }
 
 }  // namespace registry
@@ -52,18 +52,74 @@ namespace common
 {
 namespace cavl
 {
-template <typename Derived>
+
+/// Node augmentation policies. The policy is an optional (second) template parameter of both `Node` and `Tree`.
+///
+/// - `NoAugmentation` is the default one - nodes don't keep any extra data.
+/// - `SubtreeSizeAugmentation` makes every node to keep size of its subtree (which is maintained on every insertion,
+///   removal, and rotation at the cost of O(log n) extra pointer hops). This turns the tree into an order-statistic
+///   one: `Tree::size` becomes constant-complexity, and `Tree::operator[]` (aka rank selection) becomes O(log n).
+///
+struct NoAugmentation final
+{};
+struct SubtreeSizeAugmentation final
+{};
+
+template <typename Derived, typename Augmentation = NoAugmentation>
 class Tree;
 
+namespace detail
+{
+
+/// Defines per-node storage of the subtree size (if any) for the given augmentation policy.
+///
+template <typename Augmentation>
+class SubtreeSize;
+
+template <>
+class SubtreeSize<NoAugmentation> final
+{
+public:
+    static constexpr bool Enabled = false;
+
+    static auto get() noexcept -> std::size_t
+    {
+        return 0U;
+    }
+    static void set(const std::size_t /*unused*/) noexcept {}
+};
+
+template <>
+class SubtreeSize<SubtreeSizeAugmentation> final
+{
+public:
+    static constexpr bool Enabled = true;
+
+    auto get() const noexcept -> std::size_t
+    {
+        return value_;
+    }
+    void set(const std::size_t value) noexcept
+    {
+        value_ = value;
+    }
+
+private:
+    std::size_t value_ = 1U;
+};
+
+}  // namespace detail
+
 /// The tree node type is to be composed with the user type through CRTP inheritance.
 /// For instance, the derived type might be a key-value pair struct defined in the user code.
 /// The worst-case complexity of all operations is O(log n), unless specifically noted otherwise.
 /// Note that this class has no public members. The user type should re-export them if needed (usually it is not).
-/// The size of this type is 4x pointer size (16 bytes on a 32-bit platform).
+/// The size of this type is 4x pointer size (16 bytes on a 32-bit platform);
+/// `SubtreeSizeAugmentation` policy adds one more `std::size_t` field.
 ///
 /// No Sonar cpp:S1448 b/c this is the main node entity without public members - maintainability is not a concern here.
 ///
-template <typename Derived>
+template <typename Derived, typename Augmentation = NoAugmentation>
 class Node  // NOSONAR cpp:S1448
 {
     // Polyfill for C++17's std::invoke_result_t.
@@ -77,8 +133,9 @@ class Node  // NOSONAR cpp:S1448
 
 public:
     /// Helper aliases.
-    using TreeType    = Tree<Derived>;
-    using DerivedType = Derived;
+    using TreeType         = Tree<Derived, Augmentation>;
+    using DerivedType      = Derived;
+    using AugmentationType = Augmentation;
 
     // Tree nodes cannot be copied for obvious reasons.
     Node(const Node&)                    = delete;
@@ -206,6 +263,27 @@ protected:
         return extremum(root, true);
     }
 
+    /// Gets number of nodes in the subtree of the given node (including the node itself); zero for nullptr.
+    /// Available only with the `SubtreeSizeAugmentation` policy, and it is constant-complexity.
+    static auto getSubtreeSize(const Node* const node) noexcept -> std::size_t
+    {
+        static_assert(HasSubtreeSize, "Requires `SubtreeSizeAugmentation` policy.");
+        return subtreeSizeOf(node);
+    }
+
+    /// Gets i-th (in order) node of the given subtree, or nullptr if the index is out of bounds.
+    /// Available only with the `SubtreeSizeAugmentation` policy, and it is O(log n) (aka rank selection).
+    static auto getNodeAt(Node* const root, const std::size_t index) noexcept -> Derived*
+    {
+        static_assert(HasSubtreeSize, "Requires `SubtreeSizeAugmentation` policy.");
+        return getNodeAtImpl<Derived>(root, index);
+    }
+    static auto getNodeAt(const Node* const root, const std::size_t index) noexcept -> const Derived*
+    {
+        static_assert(HasSubtreeSize, "Requires `SubtreeSizeAugmentation` policy.");
+        return getNodeAtImpl<const Derived>(root, index);
+    }
+
     /// In-order or reverse-in-order traversal of the tree; the visitor is invoked with a reference to each node.
     /// If the return type is non-void, then it shall be default-constructable and convertible to bool; in this case,
     /// traversal will stop when the first true value is returned, which is propagated back to the caller; if none
@@ -262,6 +340,57 @@ protected:
     }
 
 private:
+    static constexpr bool HasSubtreeSize = detail::SubtreeSize<Augmentation>::Enabled;
+
+    static auto subtreeSizeOf(const Node* const node) noexcept -> std::size_t
+    {
+        return (nullptr != node) ? node->subtree_size.get() : 0U;
+    }
+
+    /// Recomputes the subtree size of this node from the (already correct) sizes of its children.
+    void updateSubtreeSize() noexcept
+    {
+        subtree_size.set(1U + subtreeSizeOf(lr[0]) + subtreeSizeOf(lr[1]));
+    }
+
+    /// Increments (or decrements) the subtree sizes of all ancestors of this node - from its parent up to the root.
+    void adjustAncestorsSubtreeSize(const bool increment) const noexcept
+    {
+        if (HasSubtreeSize)
+        {
+            for (Node* a = up; (a != nullptr) && a->isLinked(); a = a->up)
+            {
+                const std::size_t size = a->subtree_size.get();
+                a->subtree_size.set(increment ? (size + 1U) : (size - 1U));
+            }
+        }
+    }
+
+    template <typename DerivedT, typename NodeT>
+    static auto getNodeAtImpl(NodeT* const root, const std::size_t index) noexcept -> DerivedT*
+    {
+        std::size_t i = index;
+        NodeT*      n = root;
+        while (n != nullptr)
+        {
+            const std::size_t left_size = subtreeSizeOf(n->lr[0]);
+            if (i == left_size)
+            {
+                return down(n);
+            }
+            if (i < left_size)
+            {
+                n = n->lr[0];
+            }
+            else
+            {
+                i -= left_size + 1U;
+                n = n->lr[1];
+            }
+        }
+        return nullptr;
+    }
+
     void moveFrom(Node& other) noexcept
     {
         CAVL_ASSERT(!isLinked());  // Should not be part of any tree yet.
@@ -270,6 +399,7 @@ private:
         lr[0] = other.lr[0];
         lr[1] = other.lr[1];
         bf    = other.bf;
+        subtree_size.set(other.subtree_size.get());
         other.unlink();
 
         if (nullptr != up)
@@ -300,6 +430,13 @@ private:
             lr[!r]->up = this;
         }
         z->lr[r] = this;
+
+        // The pivot `z` takes over the whole subtree (so its size), and this node has lost some of it.
+        if (HasSubtreeSize)
+        {
+            z->subtree_size.set(subtree_size.get());
+            updateSubtreeSize();
+        }
     }
 
     auto adjustBalance(const bool increment) noexcept -> Node*;
@@ -364,6 +501,7 @@ private:
         lr[0] = nullptr;
         lr[1] = nullptr;
         bf    = 0;
+        subtree_size.set(1U);
     }
 
     static auto extremum(Node* const root, const bool maximum) noexcept -> Derived*
@@ -399,16 +537,18 @@ private:
         return static_cast<const Derived*>(x);
     }
 
-    friend class Tree<Derived>;
+    friend class Tree<Derived, Augmentation>;
 
-    Node*                up = nullptr;
-    std::array<Node*, 2> lr{};
-    std::int8_t          bf = 0;
+    Node*                             up = nullptr;
+    std::array<Node*, 2>              lr{};
+    std::int8_t                       bf = 0;
+    detail::SubtreeSize<Augmentation> subtree_size{};
 };
 
-template <typename Derived>
+template <typename Derived, typename Augmentation>
 template <typename Pre, typename Fac>
-auto Node<Derived>::search(Node& origin, const Pre& predicate, const Fac& factory) -> std::tuple<Derived*, bool>
+auto Node<Derived, Augmentation>::search(Node& origin, const Pre& predicate, const Fac& factory)
+    -> std::tuple<Derived*, bool>
 {
     CAVL_ASSERT(!origin.isLinked());
     Node*& root = origin.lr[0];
@@ -456,6 +596,8 @@ auto Node<Derived>::search(Node& origin, const Pre& predicate, const Fac& factor
         root    = out;
         out->up = &origin;
     }
+    // Subtree sizes must be correct before retracing b/c rotations rely on them.
+    out->adjustAncestorsSubtreeSize(true);
     if (Node* const rt = out->retraceOnGrowth())
     {
         root = rt;
@@ -463,12 +605,16 @@ auto Node<Derived>::search(Node& origin, const Pre& predicate, const Fac& factor
     return std::make_tuple(down(out), false);
 }
 
-template <typename Derived>
-void Node<Derived>::removeImpl(const Node* const node) noexcept
+template <typename Derived, typename Augmentation>
+void Node<Derived, Augmentation>::removeImpl(const Node* const node) noexcept
 {
     CAVL_ASSERT(node != nullptr);
     CAVL_ASSERT(node->isLinked());
 
+    // Subtree sizes are updated upfront (while the topology is still intact) b/c rotations of the retracing rely on
+    // them. All ancestors of the node lose one node; see also below the special case of the replacement node.
+    node->adjustAncestorsSubtreeSize(false);
+
     Node* p = nullptr;  // The lowest parent node that suffered a shortening of its subtree.
     bool  r = false;    // Which side of the above was shortened.
     // The first step is to update the topology and remember the node where to start the retracing from later.
@@ -477,6 +623,16 @@ void Node<Derived>::removeImpl(const Node* const node) noexcept
     {
         Node* const re = min(node->lr[1]);
         CAVL_ASSERT((re != nullptr) && (nullptr == re->lr[0]) && (re->up != nullptr));
+        if (HasSubtreeSize)
+        {
+            // The replacement node leaves its current place (below the node being removed),
+            // and takes over the whole subtree of the removed node (except the node itself).
+            for (Node* a = re->up; a != node; a = a->up)
+            {
+                a->subtree_size.set(a->subtree_size.get() - 1U);
+            }
+            re->subtree_size.set(node->subtree_size.get() - 1U);
+        }
         re->bf        = node->bf;
         re->lr[0]     = node->lr[0];
         re->lr[0]->up = re;
@@ -543,8 +699,8 @@ void Node<Derived>::removeImpl(const Node* const node) noexcept
     }
 }
 
-template <typename Derived>
-auto Node<Derived>::adjustBalance(const bool increment) noexcept -> Node*
+template <typename Derived, typename Augmentation>
+auto Node<Derived, Augmentation>::adjustBalance(const bool increment) noexcept -> Node*
 {
     CAVL_ASSERT(isLinked());
     CAVL_ASSERT(((bf >= -1) && (bf <= +1)));
@@ -605,8 +761,8 @@ auto Node<Derived>::adjustBalance(const bool increment) noexcept -> Node*
     return out;
 }
 
-template <typename Derived>
-auto Node<Derived>::retraceOnGrowth() noexcept -> Node*
+template <typename Derived, typename Augmentation>
+auto Node<Derived, Augmentation>::retraceOnGrowth() noexcept -> Node*
 {
     CAVL_ASSERT(0 == bf);
     Node* c = this;                   // Child
@@ -627,9 +783,9 @@ auto Node<Derived>::retraceOnGrowth() noexcept -> Node*
 }
 
 // No Sonar cpp:S134 b/c this is the main in-order traversal tool - maintainability is not a concern here.
-template <typename Derived>
+template <typename Derived, typename Augmentation>
 template <typename NodeT, typename DerivedT, typename Vis>
-void Node<Derived>::traverseInOrderImpl(DerivedT* const root, const Vis& visitor, const bool reverse)
+void Node<Derived, Augmentation>::traverseInOrderImpl(DerivedT* const root, const Vis& visitor, const bool reverse)
 {
     NodeT* node = root;
     NodeT* prev = nullptr;
@@ -675,9 +831,11 @@ void Node<Derived>::traverseInOrderImpl(DerivedT* const root, const Vis& visitor
 }
 
 // No Sonar cpp:S134 b/c this is the main in-order returning traversal tool - maintainability is not a concern here.
-template <typename Derived>
+template <typename Derived, typename Augmentation>
 template <typename Result, typename NodeT, typename DerivedT, typename Vis>
-auto Node<Derived>::traverseInOrderImpl(DerivedT* const root, const Vis& visitor, const bool reverse) -> Result
+auto Node<Derived, Augmentation>::traverseInOrderImpl(DerivedT* const root,
+                                                      const Vis&      visitor,
+                                                      const bool      reverse) -> Result
 {
     NodeT* node = root;
     NodeT* prev = nullptr;
@@ -730,9 +888,9 @@ auto Node<Derived>::traverseInOrderImpl(DerivedT* const root, const Vis& visitor
     return Result{};
 }
 
-template <typename Derived>
+template <typename Derived, typename Augmentation>
 template <typename NodeT, typename DerivedT, typename Vis>
-void Node<Derived>::traversePostOrderImpl(DerivedT* const root, const Vis& visitor, const bool reverse)
+void Node<Derived, Augmentation>::traversePostOrderImpl(DerivedT* const root, const Vis& visitor, const bool reverse)
 {
     NodeT* node = root;
     NodeT* prev = nullptr;
@@ -787,12 +945,12 @@ void Node<Derived>::traversePostOrderImpl(DerivedT* const root, const Vis& visit
 ///
 /// No Sonar cpp:S3624 b/c it's by design that ~Tree destructor is default one - resource management (allocation
 /// and de-allocation of nodes) is client responsibility.
-template <typename Derived>
+template <typename Derived, typename Augmentation>
 class Tree final  // NOSONAR cpp:S3624
 {
 public:
     /// Helper alias of the compatible node type.
-    using NodeType    = Node<Derived>;
+    using NodeType    = Node<Derived, Augmentation>;
     using DerivedType = Derived;
 
     Tree()  = default;
@@ -919,26 +1077,22 @@ public:
         return getRootNode();
     }
 
-    /// Access i-th element of the tree in linear time. Returns nullptr if the index is out of bounds.
+    /// Access i-th element of the tree. Returns nullptr if the index is out of bounds.
+    /// Complexity is linear, or O(log n) with the `SubtreeSizeAugmentation` policy.
     auto operator[](const std::size_t index) -> Derived*
     {
-        std::size_t i = index;
-        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
-        return traverseInOrder([&i](auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+        return getNodeAt(index, HasSubtreeSize{});
     }
     auto operator[](const std::size_t index) const -> const Derived*
     {
-        std::size_t i = index;
-        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
-        return traverseInOrder([&i](const auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+        return getNodeAt(index, HasSubtreeSize{});
     }
 
-    /// Beware that this convenience method has linear complexity. Use responsibly.
-    auto size() const noexcept
+    /// Beware that this convenience method has linear complexity (unless the `SubtreeSizeAugmentation` policy
+    /// is in use - then it's constant-complexity). Use responsibly.
+    auto size() const noexcept -> std::size_t
     {
-        auto i = 0UL;
-        traverseInOrder([&i](auto& /*unused*/) { i++; });
-        return i;
+        return getSize(HasSubtreeSize{});
     }
 
     /// Unlike size(), this one is constant-complexity.
@@ -950,7 +1104,42 @@ public:
 private:
     static_assert(!std::is_polymorphic<NodeType>::value,
                   "Internal check: The node type must not be a polymorphic type");
-    static_assert(std::is_same<Tree<Derived>, typename NodeType::TreeType>::value, "Internal check: Bad type alias");
+    static_assert(std::is_same<Tree<Derived, Augmentation>, typename NodeType::TreeType>::value,
+                  "Internal check: Bad type alias");
+
+    using HasSubtreeSize = std::integral_constant<bool, detail::SubtreeSize<Augmentation>::Enabled>;
+
+    auto getNodeAt(const std::size_t index, std::false_type /*unused*/) -> Derived*
+    {
+        std::size_t i = index;
+        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
+        return traverseInOrder([&i](auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+    }
+    auto getNodeAt(const std::size_t index, std::false_type /*unused*/) const -> const Derived*
+    {
+        std::size_t i = index;
+        // No Sonar cpp:S881 b/c this decrement is pretty much straightforward - no maintenance concerns.
+        return traverseInOrder([&i](const auto& x) { return (i-- == 0) ? &x : nullptr; });  // NOSONAR cpp:S881
+    }
+    auto getNodeAt(const std::size_t index, std::true_type /*unused*/) noexcept -> Derived*
+    {
+        return NodeType::getNodeAt(getRootNode(), index);
+    }
+    auto getNodeAt(const std::size_t index, std::true_type /*unused*/) const noexcept -> const Derived*
+    {
+        return NodeType::getNodeAt(getRootNode(), index);
+    }
+
+    auto getSize(std::false_type /*unused*/) const noexcept -> std::size_t
+    {
+        std::size_t i = 0U;
+        traverseInOrder([&i](auto& /*unused*/) { i++; });
+        return i;
+    }
+    auto getSize(std::true_type /*unused*/) const noexcept -> std::size_t
+    {
+        return NodeType::getSubtreeSize(getRootNode());
+    }
 
     /// We use a simple boolean flag instead of a nesting counter to avoid race conditions on the counter update.
     /// This implies that in the case of concurrent or recursive traversal (more than one call to traverseXxx() within
@@ -994,7 +1183,7 @@ private:
     // This is the only node which has the `up` pointer set to `nullptr`;
     // all other "real" nodes always have non-null `up` pointer,
     // including the root node whos `up` points to this origin node (see `isRoot` method).
-    Node<Derived> origin_node_{};
+    NodeType origin_node_{};
 
     // No Sonar cpp:S3687 b/c of implicit modification by the `TraversalIndicatorUpdater` RAII class,
     // even for `const` instance of the `Tree` class (hence the `mutable volatile` keywords).
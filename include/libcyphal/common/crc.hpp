@@ -6,7 +6,12 @@
 #ifndef LIBCYPHAL_COMMON_CRC_HPP_INCLUDED
 #define LIBCYPHAL_COMMON_CRC_HPP_INCLUDED
 
+#include <cetl/cetl.hpp>
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 
 namespace libcyphal
 {
@@ -132,6 +137,195 @@ private:
 
 };  // CRC64WE
 
+/// Defines helper for CRC-32C (Castagnoli) calculation.
+///
+/// In use f.e. by Cyphal/serial transport for the transfer payload integrity checks.
+/// Supports incremental calculation (see `add`), so that a scattered payload could be processed piece by piece.
+///
+class CRC32C final
+{
+public:
+    /// Defines the result of `get` for a valid data block followed by its own (little-endian) CRC.
+    ///
+    static constexpr std::uint32_t Residue = 0x48674BC7UL;
+
+    CRC32C() = default;
+
+    /// Calculates the CRC for a given raw data.
+    ///
+    /// No Sonar `cpp:S5008` b/c they are unavoidable - raw data!
+    ///
+    CRC32C(const void* const begin, const void* const end)  // NOSONAR cpp:S5008
+    {
+        add(begin, end);
+    }
+
+    /// Adds the next piece of raw data to the CRC.
+    ///
+    /// No Sonar `cpp:S5008` and `cpp:S5356` b/c they are unavoidable - raw data!
+    ///
+    void add(const void* const begin, const void* const end) noexcept  // NOSONAR cpp:S5008
+    {
+        const auto* it = static_cast<const std::uint8_t*>(begin);  // NOSONAR cpp:S5356
+        while (it != static_cast<const std::uint8_t*>(end))        // NOSONAR cpp:S5356
+        {
+            add(*it);
+            // No lint for cppcoreguidelines-pro-bounds-pointer-arithmetic - this is a low-level utility.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ++it;
+        }
+    }
+
+    CETL_NODISCARD auto get() const noexcept -> std::uint32_t
+    {
+        return ~crc_;
+    }
+
+private:
+    void add(const std::uint8_t b) noexcept
+    {
+        // No lint for cppcoreguidelines-avoid-magic-numbers and readability-magic-numbers.
+        // Also ignore cppcoreguidelines-pro-bounds-constant-array-index - we are using a lookup table.
+        // NOLINTNEXTLINE
+        crc_ = getTable()[(crc_ ^ b) & 0xFFU] ^ (crc_ >> 8U);
+    }
+
+    // No lint for cppcoreguidelines-avoid-magic-numbers and readability-magic-numbers.
+    static const std::array<std::uint32_t, 256>& getTable() noexcept  // NOLINT
+    {
+        static constexpr std::array<std::uint32_t, 256> table_s{{
+            0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU,
+            0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U,
+            0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+            0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU, 0xBC267848U, 0x4E4DFB4BU,
+            0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+            0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+            0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U, 0xE4292D5AU,
+            0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU, 0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U,
+            0x417B1DBCU, 0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+            0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+            0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U,
+            0xDBFC821CU, 0x2997011FU, 0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+            0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U,
+            0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U,
+            0x7198540DU, 0x83F3D70EU, 0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+            0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U,
+            0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U,
+            0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+            0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU, 0xB4091BFFU, 0x466298FCU,
+            0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+            0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+            0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U, 0xFC588982U,
+            0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU, 0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U,
+            0x38CC2A06U, 0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+            0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+            0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U,
+            0xD3D3E1ABU, 0x21B862A8U, 0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+            0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU,
+            0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U,
+            0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+            0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU,
+            0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U,
+        }};
+        return table_s;
+    }
+
+    std::uint32_t crc_ = std::numeric_limits<std::uint32_t>::max();
+
+};  // CRC32C
+
+/// Defines helper for CRC-16/CCITT-FALSE calculation.
+///
+/// In use f.e. by Cyphal/serial transport for the frame header integrity checks.
+///
+class CRC16CCITTFalse final
+{
+public:
+    CRC16CCITTFalse() = default;
+
+    /// Calculates the CRC for a given raw data.
+    ///
+    /// No Sonar `cpp:S5008` b/c they are unavoidable - raw data!
+    ///
+    CRC16CCITTFalse(const void* const begin, const void* const end)  // NOSONAR cpp:S5008
+    {
+        add(begin, end);
+    }
+
+    /// Adds the next piece of raw data to the CRC.
+    ///
+    /// No Sonar `cpp:S5008` and `cpp:S5356` b/c they are unavoidable - raw data!
+    ///
+    void add(const void* const begin, const void* const end) noexcept  // NOSONAR cpp:S5008
+    {
+        const auto* it = static_cast<const std::uint8_t*>(begin);  // NOSONAR cpp:S5356
+        while (it != static_cast<const std::uint8_t*>(end))        // NOSONAR cpp:S5356
+        {
+            add(*it);
+            // No lint for cppcoreguidelines-pro-bounds-pointer-arithmetic - this is a low-level utility.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ++it;
+        }
+    }
+
+    CETL_NODISCARD auto get() const noexcept -> std::uint16_t
+    {
+        return crc_;
+    }
+
+private:
+    void add(const std::uint8_t b) noexcept
+    {
+        // No lint for cppcoreguidelines-avoid-magic-numbers and readability-magic-numbers.
+        // Also ignore cppcoreguidelines-pro-bounds-constant-array-index - we are using a lookup table.
+        // NOLINTNEXTLINE
+        crc_ = static_cast<std::uint16_t>((crc_ << 8U) ^ getTable()[((crc_ >> 8U) ^ b) & 0xFFU]);
+    }
+
+    // No lint for cppcoreguidelines-avoid-magic-numbers and readability-magic-numbers.
+    static const std::array<std::uint16_t, 256>& getTable() noexcept  // NOLINT
+    {
+        static constexpr std::array<std::uint16_t, 256> table_s{{
+            0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+            0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+            0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+            0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+            0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+            0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+            0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+            0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+            0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+            0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+            0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+            0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+            0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+            0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+            0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+            0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+            0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+            0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+            0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+            0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+            0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+            0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+            0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+            0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+            0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+            0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+            0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+            0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+            0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+            0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+            0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+            0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+        }};
+        return table_s;
+    }
+
+    std::uint16_t crc_ = std::numeric_limits<std::uint16_t>::max();
+
+};  // CRC16CCITTFalse
+
 }  // namespace common
 }  // namespace libcyphal
 
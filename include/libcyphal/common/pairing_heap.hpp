@@ -0,0 +1,283 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_COMMON_PAIRING_HEAP_HPP_INCLUDED
+#define LIBCYPHAL_COMMON_PAIRING_HEAP_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+
+#include <utility>
+
+namespace libcyphal
+{
+namespace common
+{
+
+template <typename Derived, typename Less>
+class PairingHeap;
+
+/// @brief Defines an intrusive node of a pairing heap.
+///
+/// The node type is to be composed with the user type through CRTP inheritance (the same way as `cavl::Node`).
+/// The node does not own any memory - all heap operations are just pointer manipulations,
+/// so there is neither dynamic memory nor any capacity limits involved.
+///
+/// Nodes can be moved (in constant time) while being linked into a heap -
+/// pointers of the adjacent nodes (as well as the heap root pointer) are updated accordingly.
+///
+template <typename Derived>
+class PairingHeapNode
+{
+public:
+    PairingHeapNode(const PairingHeapNode&)                = delete;
+    PairingHeapNode& operator=(const PairingHeapNode&)     = delete;
+    PairingHeapNode& operator=(PairingHeapNode&&) noexcept = delete;
+
+    PairingHeapNode(PairingHeapNode&& other) noexcept
+        : prev_{std::exchange(other.prev_, nullptr)}
+        , next_{std::exchange(other.next_, nullptr)}
+        , child_{std::exchange(other.child_, nullptr)}
+    {
+        if (nullptr != prev_)
+        {
+            // Previous node is either the parent (if we are the leftmost child), or the left sibling.
+            // The root node is always the leftmost child of the heap "origin" node.
+            if (prev_->child_ == &other)
+            {
+                prev_->child_ = this;
+            }
+            else
+            {
+                CETL_DEBUG_ASSERT(prev_->next_ == &other, "");
+                prev_->next_ = this;
+            }
+        }
+        if (nullptr != next_)
+        {
+            next_->prev_ = this;
+        }
+        if (nullptr != child_)
+        {
+            child_->prev_ = this;
+        }
+    }
+
+protected:
+    PairingHeapNode()  = default;
+    ~PairingHeapNode() = default;
+
+    bool isLinked() const noexcept
+    {
+        return nullptr != prev_;
+    }
+
+private:
+    template <typename, typename>
+    friend class PairingHeap;
+
+    void unlink() noexcept
+    {
+        prev_  = nullptr;
+        next_  = nullptr;
+        child_ = nullptr;
+    }
+
+    // MARK: Data members:
+
+    PairingHeapNode* prev_{nullptr};
+    PairingHeapNode* next_{nullptr};
+    PairingHeapNode* child_{nullptr};
+
+};  // PairingHeapNode
+
+/// @brief Defines an intrusive pairing heap (aka min-heap) of nodes.
+///
+/// Complexity of operations:
+/// - `min` is O(1);
+/// - `insert` is O(1);
+/// - `remove` (of any node, including the minimum one) is O(log n) amortized.
+///
+/// Nodes which compare equal are not guaranteed to be extracted in order of their insertion.
+///
+/// @tparam Derived The user type which is derived from the `PairingHeapNode<Derived>`.
+/// @tparam Less Stateless binary predicate type, which is `true` if its first node argument
+///              should be closer to the top of the heap (aka "less") than the second one.
+///
+template <typename Derived, typename Less>
+class PairingHeap final
+{
+    using Node = PairingHeapNode<Derived>;
+
+public:
+    PairingHeap() = default;
+
+    PairingHeap(const PairingHeap&)                = delete;
+    PairingHeap(PairingHeap&&) noexcept            = delete;
+    PairingHeap& operator=(const PairingHeap&)     = delete;
+    PairingHeap& operator=(PairingHeap&&) noexcept = delete;
+
+    ~PairingHeap()
+    {
+        CETL_DEBUG_ASSERT(empty(), "Heap nodes must be removed before the heap destruction.");
+    }
+
+    /// @brief Gets the top (aka minimum) node of the heap, or `nullptr` if the heap is empty.
+    ///
+    Derived* min() noexcept
+    {
+        return down(origin_.child_);
+    }
+    const Derived* min() const noexcept
+    {
+        return down(origin_.child_);
+    }
+
+    bool empty() const noexcept
+    {
+        return nullptr == origin_.child_;
+    }
+
+    /// @brief Inserts a new (not yet linked) node into the heap.
+    ///
+    void insert(Derived& derived) noexcept
+    {
+        Node& node = derived;
+        CETL_DEBUG_ASSERT(!node.isLinked(), "Node is already linked.");
+
+        node.unlink();
+        setRoot((nullptr == origin_.child_) ? &node : meld(origin_.child_, &node));
+    }
+
+    /// @brief Removes the given node from the heap.
+    ///
+    /// Has no effect if the node is not linked.
+    ///
+    void remove(Derived& derived) noexcept
+    {
+        Node& node = derived;
+        if (!node.isLinked())
+        {
+            return;
+        }
+
+        // Detach the node (together with its subtree) from the heap.
+        //
+        if (node.prev_->child_ == &node)
+        {
+            node.prev_->child_ = node.next_;
+        }
+        else
+        {
+            node.prev_->next_ = node.next_;
+        }
+        if (nullptr != node.next_)
+        {
+            node.next_->prev_ = node.prev_;
+        }
+
+        // Merge node's children (if any) into a single subtree, and then meld it back with the rest of the heap.
+        //
+        if (Node* const subtree = mergePairs(node.child_))
+        {
+            setRoot((nullptr == origin_.child_) ? subtree : meld(origin_.child_, subtree));
+        }
+
+        node.unlink();
+    }
+
+private:
+    static Derived* down(Node* const node) noexcept
+    {
+        return static_cast<Derived*>(node);
+    }
+    static const Derived* down(const Node* const node) noexcept
+    {
+        return static_cast<const Derived*>(node);
+    }
+
+    void setRoot(Node* const root) noexcept
+    {
+        CETL_DEBUG_ASSERT(root != nullptr, "");
+
+        origin_.child_ = root;
+        root->prev_    = &origin_;
+        root->next_    = nullptr;
+    }
+
+    /// Melds two detached subtrees. The loser becomes the leftmost child of the winner.
+    /// Siblings of the winner are left untouched (it's up to the caller to link them).
+    ///
+    static Node* meld(Node* const lhs, Node* const rhs) noexcept
+    {
+        CETL_DEBUG_ASSERT((lhs != nullptr) && (rhs != nullptr), "");
+
+        // On equality the left one wins, so that an older root is kept on top of an inserted peer.
+        const bool  rhs_wins = Less{}(*down(rhs), *down(lhs));
+        Node* const winner   = rhs_wins ? rhs : lhs;
+        Node* const loser    = rhs_wins ? lhs : rhs;
+
+        loser->prev_ = winner;
+        loser->next_ = winner->child_;
+        if (nullptr != loser->next_)
+        {
+            loser->next_->prev_ = loser;
+        }
+        winner->child_ = loser;
+        return winner;
+    }
+
+    /// Standard two-pass merge of the list of siblings into a single subtree.
+    ///
+    /// The first pass melds siblings pairwise (from left to right), and pushes results onto a stack
+    /// (reusing `next_` links); the second pass melds the stack content (from right to left) into the result.
+    ///
+    static Node* mergePairs(Node* const first) noexcept
+    {
+        Node* stack = nullptr;
+        Node* curr  = first;
+        while (nullptr != curr)
+        {
+            Node* const lhs = curr;
+            Node* const rhs = lhs->next_;
+            if (nullptr == rhs)
+            {
+                lhs->next_ = stack;
+                stack      = lhs;
+                break;
+            }
+            curr = rhs->next_;
+
+            Node* const winner = meld(lhs, rhs);
+            winner->next_      = stack;
+            stack              = winner;
+        }
+        if (nullptr == stack)
+        {
+            return nullptr;
+        }
+
+        Node* result = std::exchange(stack, stack->next_);
+        while (nullptr != stack)
+        {
+            Node* const next = std::exchange(stack, stack->next_);
+            result           = meld(result, next);
+        }
+        result->next_ = nullptr;
+        return result;
+    }
+
+    // MARK: Data members:
+
+    // This a "fake" node, is not part of the heap itself, but it is used to store the root node pointer.
+    // The root node pointer is stored as the leftmost child (and its `prev_` points back to the origin).
+    // So, every linked node always has non-null `prev_` pointer (see `PairingHeapNode::isLinked`).
+    Node origin_;
+
+};  // PairingHeap
+
+}  // namespace common
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_COMMON_PAIRING_HEAP_HPP_INCLUDED
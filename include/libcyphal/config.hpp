@@ -57,6 +57,38 @@ struct Config
 
         };  // Node
 
+        struct Pnp
+        {
+            /// Defines max footprint of a callback function in use by the plug-and-play allocatee.
+            ///
+            static constexpr std::size_t Allocatee_OnAllocatedCallback_FunctionSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store any lambda or function pointer.
+                return sizeof(void*) * 4;
+            }
+
+        };  // Pnp
+
+        struct Diagnostic
+        {
+            /// Defines capacity (number of records) of the diagnostic records ring. Must be a power of two.
+            ///
+            static constexpr std::size_t RecordRing_Capacity()  // NOSONAR cpp:S799
+            {
+                /// Capacity is chosen to absorb a burst of records between two consecutive drains of the logger.
+                return 32;
+            }
+
+            /// Defines max number of text bytes kept per a diagnostic record in the ring. Longer text is truncated.
+            ///
+            static constexpr std::size_t RecordRing_TextCapacity()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen so that a ring slot fits into 128 bytes (the message itself allows up to 255 bytes).
+                return 112;
+            }
+
+        };  // Diagnostic
+
     };  // Application
 
     /// Defines various configuration parameters for the presentation layer.
@@ -71,6 +103,29 @@ struct Config
             return sizeof(void*) * 4;
         }
 
+        /// Defines initial number of buckets in the hash table of pending (aka still in progress) RPC client requests.
+        ///
+        /// The table is keyed by transfer ID, and it must be a power of two. If number of buckets is greater or equal
+        /// to the transfer ID modulo (f.e. 32 for CAN), then the table is effectively a direct-indexed array. For
+        /// transports with huge transfer ID modulo (like UDP), sequentially allocated transfer IDs are spread evenly
+        /// across buckets, and the table doubles its buckets (PMR allocated) whenever number of pending requests
+        /// exceeds number of buckets - so the average lookup cost stays within `2` node visits.
+        /// The initial buckets are embedded into every shared client (one pointer each).
+        ///
+        static constexpr std::size_t SharedClient_CallbackNodesBucketsCount()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen to match the CAN transfer ID modulo (2^5), so that CAN clients never grow.
+            return 32;
+        }
+
+        /// Defines number of (logarithmic) bins in the round-trip time histogram of RPC client statistics.
+        ///
+        static constexpr std::size_t ClientStatistics_RttHistogramBinsCount()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen to cover RTTs up to ~4s (2^22 us) - the last bin accumulates everything above.
+            return 24;
+        }
+
         /// Defines max footprint of a callback function in use by the RPC server response continuation.
         ///
         static constexpr std::size_t ServerBase_ContinuationImpl_FunctionMaxSize()  // NOSONAR cpp:S799
@@ -145,6 +200,22 @@ struct Config
             return sizeof(void*) * 8;
         }
 
+        /// Defines max number of capture interfaces (within a section) which are supported by the pcapng reader.
+        ///
+        static constexpr std::size_t Pcapng_MaxInterfaces()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary. Packets of interfaces beyond this limit are skipped.
+            return 8;
+        }
+
+        /// Defines max number of payload fragments which the transport bridge forwards without copying.
+        ///
+        static constexpr std::size_t Bridge_MaxFragments()  // NOSONAR cpp:S799
+        {
+            /// Size is chosen arbitrary. Payloads with more fragments are gathered into a temporary buffer.
+            return 8;
+        }
+
         /// Defines various configuration parameters for the CAN transport sublayer.
         ///
         struct Can
@@ -157,6 +228,38 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines max number of TX mailboxes of a single virtual CAN bus media.
+            ///
+            static constexpr std::size_t VirtualBus_MaxMailboxes()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen to cover typical CAN controllers (which have from 3 to 32 TX mailboxes/buffers).
+                return 32;
+            }
+
+            /// Defines max number of frames in the RX FIFO of a single virtual CAN bus media.
+            ///
+            static constexpr std::size_t VirtualBus_MaxRxFifoCapacity()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to cover typical hardware & driver FIFOs.
+                return 64;
+            }
+
+            /// Defines max number of acceptance filters of a single virtual CAN bus media.
+            ///
+            static constexpr std::size_t VirtualBus_MaxFilters()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary. If more filters are requested, the media accepts all frames.
+                return 16;
+            }
+
+            /// Defines max number of received frames which could be delayed by a single impaired CAN media.
+            ///
+            static constexpr std::size_t ImpairedMedia_MaxDelayedFrames()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen to hold ~10ms worth of frames of a fully loaded 1 Mbit/s Classic CAN bus.
+                return 64;
+            }
+
         };  // Can
 
         /// Defines various configuration parameters for the UDO transport sublayer.
@@ -171,8 +274,84 @@ struct Config
                 return sizeof(void*) * 3;
             }
 
+            /// Defines max number of received datagrams which could be delayed by a single impaired UDP RX socket.
+            ///
+            static constexpr std::size_t ImpairedMedia_MaxDelayedDatagrams()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary. Delayed datagrams keep their payload buffers allocated.
+                return 16;
+            }
+
         };  // Udp
 
+        /// Defines various configuration parameters for the serial transport sublayer.
+        ///
+        struct Serial
+        {
+            /// Defines max footprint of a callback function in use by the serial transport transient error handler.
+            ///
+            static constexpr std::size_t ISerialTransport_TransientErrorHandlerMaxSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store simple lambda or function pointer.
+                return sizeof(void*) * 3;
+            }
+
+            /// Defines max payload size (in bytes) of a single serial frame (bigger transfers are split into frames).
+            ///
+            static constexpr std::size_t ISerialTransport_Mtu()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen to match the default MTU of other Cyphal/serial implementations (f.e. PyCyphal).
+                return 1024;
+            }
+
+            /// Defines size (in bytes) of the buffer which is used to read a chunk of raw bytes from the media.
+            ///
+            static constexpr std::size_t ISerialTransport_ReadChunkSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen so that a single read could yield multiple (small) frames at once,
+                /// but still cheap enough to be stored inside of the transport instance.
+                return 4096;
+            }
+
+            /// Defines max number of queued frames which could be written to the media by a single write call.
+            ///
+            static constexpr std::size_t ISerialTransport_WriteMaxFrames()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to amortize the cost of a write call.
+                return 8;
+            }
+
+        };  // Serial
+
+        /// Defines various configuration parameters for the shared memory transport sublayer.
+        ///
+        struct Shm
+        {
+            /// Defines max footprint of a callback function in use by the shared memory transport transient error
+            /// handler.
+            ///
+            static constexpr std::size_t IShmTransport_TransientErrorHandlerMaxSize()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen arbitrary, but it should be enough to store simple lambda or function pointer.
+                return sizeof(void*) * 3;
+            }
+
+        };  // Shm
+
+        /// Defines various configuration parameters for the redundant transport sublayer.
+        ///
+        struct Redundant
+        {
+            /// Defines max number of inferior transports which could be aggregated by a redundant transport.
+            ///
+            static constexpr std::size_t IRedundantTransport_MaxInferiors()  // NOSONAR cpp:S799
+            {
+                /// Size is chosen to match the max redundancy factor of CAN and UDP transports.
+                return 3;
+            }
+
+        };  // Redundant
+
     };  // Transport
 
 };  // Config
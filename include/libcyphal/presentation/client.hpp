@@ -7,19 +7,23 @@
 #define LIBCYPHAL_PRESENTATION_CLIENT_HPP_INCLUDED
 
 #include "client_impl.hpp"
+#include "client_statistics.hpp"
 #include "common_helpers.hpp"
 #include "presentation_delegate.hpp"
 #include "response_promise.hpp"
 
+#include "libcyphal/errors.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 
 #include <nunavut/support/serialization.hpp>
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -44,6 +48,7 @@ public:
     /// The total number of possible pending requests is limited by the transport layer, namely by the range of
     /// possible transfer IDs. For example, in the case of CAN transport, the range is 0-31 (32 in total).
     /// For UDP transport, the range is virtually unlimited (2^64), but practically limited by the available memory.
+    /// See also `setRequestQueueCapacity` for how to make excess requests wait (instead of failing immediately).
     ///
     struct TooManyPendingRequestsError
     {};
@@ -127,6 +132,65 @@ public:
         priority_ = priority;
     }
 
+    /// @brief Gets maximum number of requests which could wait in the queue for a free transfer ID.
+    ///
+    std::size_t getRequestQueueCapacity() const noexcept
+    {
+        return getSharedClient().getRequestQueueCapacity();
+    }
+
+    /// @brief Sets maximum number of requests which could wait in the queue for a free transfer ID.
+    ///
+    /// By default, the capacity is zero, so a new request fails immediately with `TooManyPendingRequestsError`
+    /// if there is no free transfer ID (see the error docs). With non-zero capacity, such request is queued
+    /// instead (together with a PMR allocated copy of its payload), and its promise is returned immediately.
+    /// Queued requests are sent (in FIFO order) as soon as transfer IDs are released by the pending ones.
+    /// A queued request expires (see `ResponsePromiseExpired`) if it could not be sent before its request deadline
+    /// (or the response deadline of its promise, whichever is earlier).
+    ///
+    /// Note that the queue is shared between all clients of the same server node and service ids
+    /// (see `Presentation::makeClient`), so the capacity is shared as well.
+    ///
+    void setRequestQueueCapacity(const std::size_t capacity)
+    {
+        getSharedClient().setRequestQueueCapacity(capacity);
+    }
+
+    /// @brief Enables (and resets) collection of the request/response statistics.
+    ///
+    /// Statistics are disabled by default, so there is no overhead unless enabled. Once enabled, statistics
+    /// memory is PMR allocated, and it stays allocated until `disableStatistics` (or the last client destruction).
+    ///
+    /// Note that statistics are shared between all clients of the same server node and service ids
+    /// (see `Presentation::makeClient`), so they all contribute to (and could reset) the same statistics.
+    ///
+    /// @return `MemoryError` if statistics memory could not be allocated; otherwise `nullopt`.
+    ///
+    CETL_NODISCARD cetl::optional<MemoryError> enableStatistics()
+    {
+        return getSharedClient().enableStatistics();
+    }
+
+    /// @brief Disables collection of the request/response statistics.
+    ///
+    void disableStatistics() noexcept
+    {
+        getSharedClient().disableStatistics();
+    }
+
+    /// @brief Gets snapshot of the current request/response statistics.
+    ///
+    /// @return Copy of the statistics, or `nullopt` if statistics are not enabled.
+    ///
+    cetl::optional<ClientStatistics> getStatistics() const
+    {
+        if (const auto* const statistics = getSharedClient().getStatistics())
+        {
+            return *statistics;
+        }
+        return cetl::nullopt;
+    }
+
 protected:
     ~ClientBase()
     {
@@ -155,6 +219,53 @@ protected:
         return *shared_client_;
     }
 
+    /// @brief Common implementation of the request sending for both typed and raw clients.
+    ///
+    /// See `Client::request` and `RawServiceClient::request` for details.
+    ///
+    template <typename Promise, typename Failure>
+    Expected<Promise, Failure> sendRequest(const TimePoint                   request_deadline,
+                                           const transport::PayloadFragments request_payload,
+                                           const TimePoint                   response_deadline) const
+    {
+        // 1. For request (and following response) we need to allocate a transfer ID,
+        //    which will be in use to pair the request with the response.
+        //    Already queued requests (if any) go first, so new ones have to wait in the queue as well.
+        //
+        auto& shared_client   = getSharedClient();
+        auto  opt_transfer_id = shared_client.hasQueuedRequests() ? cetl::nullopt : shared_client.nextTransferId();
+        if (!opt_transfer_id)
+        {
+            if (!shared_client.canQueueRequest())
+            {
+                return TooManyPendingRequestsError{};
+            }
+
+            auto* const queued_request = shared_client.makeQueuedRequest(priority_, request_deadline, request_payload);
+            if (nullptr == queued_request)
+            {
+                return MemoryError{};
+            }
+            // The promise takes ownership of the queued request.
+            return Promise{shared_client_, *queued_request, response_deadline};
+        }
+        const auto transfer_id = *opt_transfer_id;
+
+        // 2. Create and register a response promise object, which will be used to handle the response.
+        //    Its done specifically before sending the request, so that we will be ready to handle a response
+        //    immediately, even if it happens to be received in context (during) the request sending call.
+        //
+        Promise response_promise{shared_client_, transfer_id, response_deadline};
+        //
+        const transport::TransferTxMetadata tx_metadata{{transfer_id, priority_}, request_deadline};
+        if (auto failure = shared_client.sendRequestPayload(tx_metadata, request_payload))
+        {
+            return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
+        }
+
+        return response_promise;
+    }
+
 private:
     // MARK: Data members:
 
@@ -196,7 +307,8 @@ public:
     /// @brief Initiates a strong-typed request to the server, and returns a promise object to handle the response.
     ///
     /// If `BufferSize` is less or equal to `config::presentation::SmallPayloadSize`,
-    /// the message will be serialized using a stack-allocated buffer; otherwise, PMR allocation will be used.
+    /// the message will be serialized using a stack-allocated buffer; otherwise, either the attached buffer
+    /// (see `setSerializationBuffer`) or PMR allocation will be used.
     ///
     /// Issuing a new request involves the following steps:
     /// 1. Serialize the request object to a raw payload buffer, which might fail with `nunavut::support::Error`.
@@ -205,7 +317,8 @@ public:
     ///    where range of transfer ids is 2^64 huge, so simple increment is in use to generate next "unique" id),
     ///    OR it could take O(N) complexity in the worst-case (where N is the number of pending requests), like for
     ///    CAN transport, where N is limited by 2^5. Such limited range of CAN transfer ids is the cause of possible
-    ///    `TooManyPendingRequestsError` failure to allocate a new not in use id.
+    ///    `TooManyPendingRequestsError` failure to allocate a new not in use id - unless the request queue is enabled
+    ///    (see `setRequestQueueCapacity`), in which case the request will wait in the queue for a free id.
     /// 3. Creation and registration of a response promise object, which will be used to handle the raw response, from
     ///    the server, try to deserialize it to the strong-typed response, and deliver end result to the user.
     /// 4. Sending the raw request payload to the server, which might fail with a transport layer error.
@@ -232,37 +345,33 @@ public:
         return detail::tryPerformOnSerialized<Request, Result, BufferSize, IsOnStack>(  //
             request,
             memory(),
+            serialization_buffer_,
             [this, request_deadline, response_deadline](const auto serialized_fragments) -> Result {
                 //
-                // For request (and the following response) we need to allocate a transfer ID,
-                // which will be in use to pair the request with the response.
-                //
-                auto& shared_client   = getSharedClient();
-                auto  opt_transfer_id = shared_client.nextTransferId();
-                if (!opt_transfer_id)
-                {
-                    return TooManyPendingRequestsError{};
-                }
-                const auto transfer_id = *opt_transfer_id;
-
-                // Create and register a response promise object, which will be used to handle the response.
-                // Its done specifically before sending the request, so that we will be ready to handle a response
-                // immediately, even if it happens to be received in context (during) the request sending call.
-                //
-                ResponsePromise<Response> response_promise{&shared_client,
-                                                           transfer_id,
-                                                           response_deadline.value_or(request_deadline)};
-                //
-                const transport::TransferTxMetadata tx_metadata{{transfer_id, getPriority()}, request_deadline};
-                if (auto failure = shared_client.sendRequestPayload(tx_metadata, serialized_fragments))
-                {
-                    return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
-                }
-
-                return response_promise;
+                return sendRequest<ResponsePromise<Response>, Failure>(request_deadline,
+                                                                       serialized_fragments,
+                                                                       response_deadline.value_or(request_deadline));
             });
     }
 
+    /// @brief Attaches a persistent serialization buffer to this client.
+    ///
+    /// By default, a request larger than `config::Presentation::SmallPayloadSize` is serialized into a temporary
+    /// PMR allocated buffer on every `request` call. If the attached buffer is big enough to fit the serialized
+    /// request, serialization is done directly into it, so steady-state operation does no allocations.
+    /// A buffer which is too small is ignored, and PMR is in use instead.
+    ///
+    /// The buffer memory is owned by the user, and it must outlive this client (and its copies, which share
+    /// the attached buffer). The buffer is in use only during the serialization and sending, so the same buffer
+    /// can be shared by several publishers, clients and servers as long as they are all used from the same thread.
+    ///
+    /// @param buffer The buffer to attach. Use empty span (`{}`) to detach current buffer.
+    ///
+    void setSerializationBuffer(const cetl::span<cetl::byte> buffer) noexcept
+    {
+        serialization_buffer_ = buffer;
+    }
+
 private:
     friend class Presentation;  // NOLINT cppcoreguidelines-virtual-class-destructor
 
@@ -271,6 +380,10 @@ private:
     {
     }
 
+    // MARK: Data members:
+
+    cetl::span<cetl::byte> serialization_buffer_{};
+
 };  // Client<Request, Response>
 
 /// @brief Defines a service typed RPC client class.
@@ -303,7 +416,8 @@ public:
     ///    where range of transfer ids is 2^64 huge, so simple increment is in use to generate next "unique" id),
     ///    OR it could take O(N) complexity in the worst-case (where N is the number of pending requests), like for
     ///    CAN transport, where N is limited by 2^5. Such limited range of CAN transfer ids is the cause of possible
-    ///    `TooManyPendingRequestsError` failure to allocate a new not in use id.
+    ///    `TooManyPendingRequestsError` failure to allocate a new not in use id - unless the request queue is enabled
+    ///    (see `setRequestQueueCapacity`), in which case the request will wait in the queue for a free id.
     /// 3. Creation and registration of a response promise object,
     ///    which will be used to handle the raw response from server, and deliver it to the user.
     /// 4. Sending the raw request payload to the server, which might fail with a transport layer error.
@@ -322,32 +436,9 @@ public:
                                                      const transport::PayloadFragments& request_payload,
                                                      const cetl::optional<TimePoint>    response_deadline = {}) const
     {
-        // 1. For request (and following response) we need to allocate a transfer ID,
-        //    which will be in use to pair the request with the response.
-        //
-        auto& shared_client   = getSharedClient();
-        auto  opt_transfer_id = shared_client.nextTransferId();
-        if (!opt_transfer_id)
-        {
-            return TooManyPendingRequestsError{};
-        }
-        const auto transfer_id = *opt_transfer_id;
-
-        // 2. Create and register a response promise object, which will be used to handle the response.
-        //    Its done specifically before sending the request, so that we will be ready to handle a response
-        //    immediately, even if it happens to be received in context (during) the request sending call.
-        //
-        ResponsePromise<void> response_promise{&shared_client,
-                                               transfer_id,
-                                               response_deadline.value_or(request_deadline)};
-        //
-        const transport::TransferTxMetadata tx_metadata{{transfer_id, getPriority()}, request_deadline};
-        if (auto failure = shared_client.sendRequestPayload(tx_metadata, request_payload))
-        {
-            return libcyphal::detail::upcastVariant<Failure>(std::move(*failure));
-        }
-
-        return response_promise;
+        return sendRequest<ResponsePromise<void>, Failure>(request_deadline,
+                                                           request_payload,
+                                                           response_deadline.value_or(request_deadline));
     }
 
 private:
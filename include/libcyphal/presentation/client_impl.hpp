@@ -6,10 +6,13 @@
 #ifndef LIBCYPHAL_PRESENTATION_CLIENT_IMPL_HPP_INCLUDED
 #define LIBCYPHAL_PRESENTATION_CLIENT_IMPL_HPP_INCLUDED
 
+#include "client_statistics.hpp"
 #include "presentation_delegate.hpp"
 #include "shared_object.hpp"
 
 #include "libcyphal/common/cavl/cavl.hpp"
+#include "libcyphal/common/pairing_heap.hpp"
+#include "libcyphal/config.hpp"
 #include "libcyphal/executor.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/svc_sessions.hpp"
@@ -20,7 +23,11 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <new>
 #include <utility>
 
 namespace libcyphal
@@ -40,7 +47,47 @@ public:
     using Node::remove;
     using Node::isLinked;
 
-    class TimeoutNode : public Node<TimeoutNode>
+    class CallbackNode;
+
+    /// @brief Holds a request (together with a copy of its payload), which is waiting for a free transfer ID.
+    ///
+    /// Allocated from PMR as a single memory block - payload bytes immediately follow this header.
+    ///
+    class QueuedRequest final
+    {
+    public:
+        QueuedRequest(const transport::Priority priority,
+                      const TimePoint           request_deadline,
+                      const std::size_t         payload_size) noexcept
+            : priority_{priority}
+            , request_deadline_{request_deadline}
+            , response_deadline_{request_deadline}
+            , payload_size_{payload_size}
+        {
+        }
+
+        cetl::span<cetl::byte> payload() noexcept
+        {
+            void* const raw_payload = this + 1;
+            return {static_cast<cetl::byte*>(raw_payload), payload_size_};  // NOSONAR cpp:S5356 cpp:S5357
+        }
+
+    private:
+        friend class SharedClient;
+
+        // MARK: Data members:
+
+        CallbackNode*             callback_node_{nullptr};
+        QueuedRequest*            next_{nullptr};
+        QueuedRequest*            prev_{nullptr};
+        const transport::Priority priority_;
+        const TimePoint           request_deadline_;
+        TimePoint                 response_deadline_;
+        const std::size_t         payload_size_;
+
+    };  // QueuedRequest
+
+    class TimeoutNode : public common::PairingHeapNode<TimeoutNode>
     {
     public:
         bool isTimeoutLinked() const noexcept
@@ -58,13 +105,15 @@ public:
             deadline_ = timeout_deadline;
         }
 
-        CETL_NODISCARD std::int8_t compareByTimeoutDeadline(const TimePoint timeout_deadline) const noexcept
+        /// Defines ordering of timeout nodes in the heap - the nearest deadline is on top.
+        ///
+        struct Less
         {
-            // No two deadline times compare equal, which allows us to have multiple nodes
-            // with the same deadline time in the tree. With two nodes sharing the same deadline time,
-            // the one added later is considered to be later.
-            return (timeout_deadline >= deadline_) ? +1 : -1;
-        }
+            bool operator()(const TimeoutNode& lhs, const TimeoutNode& rhs) const noexcept
+            {
+                return lhs.deadline_ < rhs.deadline_;
+            }
+        };
 
     protected:
         explicit TimeoutNode(const TimePoint timeout_deadline)
@@ -79,7 +128,7 @@ public:
 
     };  // TimeoutNode
 
-    class CallbackNode : public Node<CallbackNode>, public TimeoutNode
+    class CallbackNode : public TimeoutNode
     {
     public:
         CallbackNode(const CallbackNode&)                = delete;
@@ -88,7 +137,14 @@ public:
 
         bool isCallbackLinked() const noexcept
         {
-            return Node<CallbackNode>::isLinked();
+            return nullptr != bucket_prev_;
+        }
+
+        /// Queued node is not linked into the table of pending requests yet - it still waits for a transfer ID.
+        ///
+        bool isCallbackQueued() const noexcept
+        {
+            return nullptr != queued_request_;
         }
 
         transport::TransferId getTransferId() const noexcept
@@ -96,32 +152,74 @@ public:
             return transfer_id_;
         }
 
-        CETL_NODISCARD std::int8_t compareByTransferId(const transport::TransferId transfer_id) const noexcept
+        /// @return Gets the time when the request was initiated.
+        ///
+        /// Useful to track the request-response latency, f.e. for implementing custom timeout/deadline handling like:
+        /// - by periodically polling result of the promise (using `getResult` or `fetchResult`)
+        /// - by also checking that `time_provider.now() - promise.getRequestTime()` within some limits.
+        ///
+        /// More simple approach is based on `response_deadline` parameter of the `Client::request` method, as well as
+        /// on the `setDeadline()` method of the promise itself - `Expired` result will be automatically delivered to
+        /// the callback (if any) as soon as deadline is reached (the same with `getResult`/`fetchResult` when called).
+        ///
+        TimePoint getRequestTime() const noexcept
         {
-            if (transfer_id == transfer_id_)
-            {
-                return 0;
-            }
-            return (transfer_id > transfer_id_) ? +1 : -1;
+            return request_time_;
         }
 
-        virtual void onResponseTimeout(const TimePoint deadline, const TimePoint approx_now)                  = 0;
-        virtual void onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) = 0;
+        virtual void onResponseTimeout(const TimePoint deadline, const TimePoint approx_now) = 0;
+
+        /// @return `false` if the response was rejected (f.e. b/c it could not be deserialized).
+        ///
+        virtual bool onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) = 0;
 
     protected:
-        CallbackNode(const transport::TransferId transfer_id, const TimePoint response_deadline)
+        CallbackNode(const transport::TransferId transfer_id,
+                     const TimePoint             request_time,
+                     const TimePoint             response_deadline)
             : TimeoutNode{response_deadline}
             , transfer_id_{transfer_id}
+            , request_time_{request_time}
         {
         }
 
-        ~CallbackNode()                       = default;
-        CallbackNode(CallbackNode&&) noexcept = default;
+        ~CallbackNode() = default;
+
+        // Callback nodes can be moved while being linked into a bucket of pending nodes - we update
+        // the pointers in the adjacent nodes (or the bucket head) to keep the chain valid.
+        CallbackNode(CallbackNode&& other) noexcept
+            : TimeoutNode{std::move(static_cast<TimeoutNode&&>(other))}
+            , transfer_id_{other.transfer_id_}
+            , request_time_{other.request_time_}
+            , bucket_next_{std::exchange(other.bucket_next_, nullptr)}
+            , bucket_prev_{std::exchange(other.bucket_prev_, nullptr)}
+            , queued_request_{std::exchange(other.queued_request_, nullptr)}
+        {
+            if (nullptr != bucket_prev_)
+            {
+                *bucket_prev_ = this;
+            }
+            if (nullptr != bucket_next_)
+            {
+                bucket_next_->bucket_prev_ = &bucket_next_;
+            }
+            if (nullptr != queued_request_)
+            {
+                queued_request_->callback_node_ = this;
+            }
+        }
 
     private:
+        friend class SharedClient;
+
         // MARK: Data members:
 
         transport::TransferId transfer_id_;
+        const TimePoint       request_time_;
+        CallbackNode*         bucket_next_{nullptr};
+        // Points either to the bucket head, or to the `bucket_next_` field of the previous node in the chain.
+        CallbackNode** bucket_prev_{nullptr};
+        QueuedRequest* queued_request_{nullptr};
 
     };  // CallbackNode
 
@@ -134,6 +232,9 @@ public:
         , svc_request_tx_session_{std::move(svc_request_tx_session)}
         , svc_response_rx_session_{std::move(svc_response_rx_session)}
         , response_rx_params_{svc_response_rx_session_->getParams()}
+        , cb_nodes_inline_buckets_{}
+        , cb_nodes_buckets_{cb_nodes_inline_buckets_.data()}
+        , cb_nodes_buckets_count_{cb_nodes_inline_buckets_.size()}
         , nearest_deadline_{DistantFuture()}
     {
         CETL_DEBUG_ASSERT(svc_request_tx_session_ != nullptr, "");
@@ -169,6 +270,16 @@ public:
         return delegate_.memory();
     }
 
+    CETL_NODISCARD cetl::pmr::memory_resource& deserializationMemory() const noexcept
+    {
+        return delegate_.deserializationMemory();
+    }
+
+    CETL_NODISCARD transport::PortId getServiceId() const noexcept
+    {
+        return response_rx_params_.service_id;
+    }
+
     CETL_NODISCARD std::int32_t compareByNodeAndServiceIds(const transport::ResponseRxParams& rx_params) const
     {
         if (response_rx_params_.server_node_id != rx_params.server_node_id)
@@ -189,22 +300,187 @@ public:
         insertNewCallbackNode(callback_node);
     }
 
+    /// @brief Retains a callback node of the request which has to wait for a free transfer ID.
+    ///
+    /// The node takes ownership of the given queued request (which is made by `makeQueuedRequest`). Until dispatch,
+    /// the node's timeout deadline is the earliest of request and response deadlines - there is no point to wait
+    /// in the queue for longer than that. Current (response) deadline of the node is restored on dispatch.
+    ///
+    void retainQueuedCallbackNode(CallbackNode& callback_node, QueuedRequest& queued_request) noexcept
+    {
+        CETL_DEBUG_ASSERT(!callback_node.isCallbackLinked(), "");
+        CETL_DEBUG_ASSERT(!callback_node.isCallbackQueued(), "");
+        CETL_DEBUG_ASSERT(queued_request.callback_node_ == nullptr, "");
+
+        retain();
+
+        callback_node.queued_request_     = &queued_request;
+        queued_request.callback_node_     = &callback_node;
+        queued_request.response_deadline_ = callback_node.getTimeoutDeadline();
+
+        // Append to the tail of the queue.
+        //
+        queued_request.prev_ = queued_requests_tail_;
+        if (nullptr != queued_requests_tail_)
+        {
+            queued_requests_tail_->next_ = &queued_request;
+        }
+        else
+        {
+            queued_requests_head_ = &queued_request;
+        }
+        queued_requests_tail_ = &queued_request;
+        ++queued_requests_count_;
+
+        callback_node.setTimeoutDeadline(std::min(queued_request.request_deadline_, queued_request.response_deadline_));
+        insertTimeoutNodeAndReschedule(callback_node);
+    }
+
+    /// @brief Gets maximum number of requests which could wait in the queue for a free transfer ID.
+    ///
+    std::size_t getRequestQueueCapacity() const noexcept
+    {
+        return queued_requests_capacity_;
+    }
+
+    /// @brief Sets maximum number of requests which could wait in the queue for a free transfer ID.
+    ///
+    /// Zero capacity (the default) disables the queue. Already queued requests are not affected
+    /// if the new capacity is less than the current number of queued requests.
+    ///
+    void setRequestQueueCapacity(const std::size_t capacity)
+    {
+        queued_requests_capacity_ = capacity;
+
+        // Dispatch callback is registered lazily, so that there is no overhead if the queue is never in use.
+        if ((capacity > 0) && !dispatch_queued_requests_callback_)
+        {
+            dispatch_queued_requests_callback_ = executor_.registerCallback([this](const auto&) {
+                //
+                onDispatchQueuedRequests();
+            });
+            CETL_DEBUG_ASSERT(dispatch_queued_requests_callback_, "Should not fail b/c we pass proper lambda.");
+        }
+    }
+
+    /// @brief Enables (and resets) collection of the client statistics.
+    ///
+    /// Statistics are allocated from PMR on the first enabling, and freed on disabling.
+    ///
+    /// @return `MemoryError` if statistics could not be allocated; otherwise `nullopt`.
+    ///
+    CETL_NODISCARD cetl::optional<MemoryError> enableStatistics()
+    {
+        if (nullptr == statistics_)
+        {
+            libcyphal::detail::PmrAllocator<ClientStatistics> allocator{&memory()};
+            statistics_ = allocator.allocate(1);
+            if (nullptr == statistics_)
+            {
+                return MemoryError{};
+            }
+            allocator.construct(statistics_);
+        }
+        else
+        {
+            *statistics_ = ClientStatistics{};
+        }
+
+        statistics_->in_flight_high_water_mark = cb_nodes_count_;
+        return cetl::nullopt;
+    }
+
+    /// @brief Disables collection of the client statistics (and frees its memory).
+    ///
+    void disableStatistics() noexcept
+    {
+        if (nullptr != statistics_)
+        {
+            libcyphal::detail::PmrAllocator<ClientStatistics> allocator{&memory()};
+            statistics_->~ClientStatistics();  // NOSONAR cpp:S3432 cpp:M23_329
+            allocator.deallocate(std::exchange(statistics_, nullptr), 1);
+        }
+    }
+
+    /// @brief Gets the client statistics (if enabled).
+    ///
+    const ClientStatistics* getStatistics() const noexcept
+    {
+        return statistics_;
+    }
+
+    /// @brief Determines whether a new request has to be queued (instead of being sent immediately).
+    ///
+    /// Already queued requests have precedence over new ones, so that FIFO order of requests is preserved.
+    ///
+    bool hasQueuedRequests() const noexcept
+    {
+        return nullptr != queued_requests_head_;
+    }
+
+    /// @brief Determines whether there is still room in the queue for a new request.
+    ///
+    bool canQueueRequest() const noexcept
+    {
+        return queued_requests_count_ < queued_requests_capacity_;
+    }
+
+    /// @brief Makes a new queued request by copying its payload into a PMR allocated memory.
+    ///
+    /// @return Pointer to the new queued request, or `nullptr` if memory allocation has failed.
+    ///         The result is expected to be passed to the `retainQueuedCallbackNode` (which takes ownership of it).
+    ///
+    CETL_NODISCARD QueuedRequest* makeQueuedRequest(const transport::Priority         priority,
+                                                    const TimePoint                   request_deadline,
+                                                    const transport::PayloadFragments payload_fragments) const
+    {
+        std::size_t payload_size = 0;
+        for (const auto fragment : payload_fragments)
+        {
+            payload_size += fragment.size();
+        }
+
+        void* const raw_memory = memory().allocate(sizeof(QueuedRequest) + payload_size);
+        if (nullptr == raw_memory)
+        {
+            return nullptr;
+        }
+
+        auto* const queued_request = new (raw_memory) QueuedRequest{priority, request_deadline, payload_size};
+
+        auto* payload_ptr = queued_request->payload().data();
+        for (const auto fragment : payload_fragments)
+        {
+            payload_ptr = std::copy(fragment.begin(), fragment.end(), payload_ptr);
+        }
+
+        return queued_request;
+    }
+
     cetl::optional<transport::AnyFailure> sendRequestPayload(const transport::TransferTxMetadata& tx_metadata,
                                                              const transport::PayloadFragments    payload) const
     {
         return svc_request_tx_session_->send(tx_metadata, payload);
     }
 
-    void updateDeadlineOfTimeoutNode(TimeoutNode& timeout_node, const TimePoint new_deadline)
+    void updateDeadlineOfTimeoutNode(CallbackNode& callback_node, TimePoint new_deadline)
     {
-        if (timeout_node.isTimeoutLinked())
+        if (callback_node.isTimeoutLinked())
         {
+            // Queued request can't wait (in the queue) for longer than its request deadline.
+            //
+            if (auto* const queued_request = callback_node.queued_request_)
+            {
+                queued_request->response_deadline_ = new_deadline;
+                new_deadline                       = std::min(queued_request->request_deadline_, new_deadline);
+            }
+
             // Remove previous timeout node (if any),
             // and then reinsert the node with updated/given new deadline time.
             //
-            timeout_nodes_by_deadline_.remove(&timeout_node);
-            timeout_node.setTimeoutDeadline(new_deadline);
-            insertTimeoutNodeAndReschedule(timeout_node);
+            removeTimeoutNodeAndReschedule(callback_node);
+            callback_node.setTimeoutDeadline(new_deadline);
+            insertTimeoutNodeAndReschedule(callback_node);
         }
     }
 
@@ -226,7 +502,8 @@ public:
     {
         if (SharedObject::release())
         {
-            CETL_DEBUG_ASSERT(cb_nodes_by_transfer_id_.empty(), "");
+            CETL_DEBUG_ASSERT(cb_nodes_count_ == 0, "");
+            CETL_DEBUG_ASSERT(queued_requests_count_ == 0, "");
             CETL_DEBUG_ASSERT(timeout_nodes_by_deadline_.empty(), "");
 
             delegate_.markSharedObjAsUnreferenced(*this);
@@ -240,6 +517,8 @@ public:
 
     void destroy() noexcept override
     {
+        disableStatistics();
+        releaseGrownBuckets();
         delegate_.forgetSharedClient(*this);
     }
 
@@ -247,25 +526,55 @@ protected:
     virtual void insertNewCallbackNode(CallbackNode& callback_node)
     {
         CETL_DEBUG_ASSERT(!callback_node.isCallbackLinked(), "");
+        CETL_DEBUG_ASSERT(findCallbackNode(callback_node.getTransferId()) == nullptr,
+                          "Unexpected existing callback node.");
 
-        const auto cb_node_existing = cb_nodes_by_transfer_id_.search(                       //
-            [transfer_id = callback_node.getTransferId()](const CallbackNode& other_node) {  // predicate
-                //
-                return other_node.compareByTransferId(transfer_id);
-            },
-            [&callback_node]() { return &callback_node; });  // "factory"
-
-        (void) cb_node_existing;
-        CETL_DEBUG_ASSERT(callback_node.isCallbackLinked(), "");
-        CETL_DEBUG_ASSERT(!std::get<1>(cb_node_existing), "Unexpected existing callback node.");
-        CETL_DEBUG_ASSERT(&callback_node == std::get<0>(cb_node_existing), "Unexpected callback node.");
+        // Keep chains short (see `config::Presentation::SharedClient_CallbackNodesBucketsCount`).
+        //
+        if (cb_nodes_count_ >= cb_nodes_buckets_count_)
+        {
+            tryGrowBuckets();
+        }
+        linkIntoBucket(callback_node, getBucketOf(callback_node.getTransferId()));
+        ++cb_nodes_count_;
+        if ((nullptr != statistics_) && (statistics_->in_flight_high_water_mark < cb_nodes_count_))
+        {
+            statistics_->in_flight_high_water_mark = cb_nodes_count_;
+        }
 
         insertTimeoutNodeAndReschedule(callback_node);
     }
 
     virtual void removeCallbackNode(CallbackNode& callback_node)
     {
-        cb_nodes_by_transfer_id_.remove(&callback_node);
+        if (callback_node.isCallbackLinked())
+        {
+            *callback_node.bucket_prev_ = callback_node.bucket_next_;
+            if (nullptr != callback_node.bucket_next_)
+            {
+                callback_node.bucket_next_->bucket_prev_ = callback_node.bucket_prev_;
+            }
+            callback_node.bucket_next_ = nullptr;
+            callback_node.bucket_prev_ = nullptr;
+
+            CETL_DEBUG_ASSERT(cb_nodes_count_ > 0, "");
+            --cb_nodes_count_;
+
+            // Transfer ID of the removed node might be released, so try to dispatch waiting requests (if any).
+            // Dispatching is deferred (to the executor) b/c we might be in context of a user (f.e. promise
+            // destructor) or of a response reception - not a good place to send new requests.
+            if (hasQueuedRequests())
+            {
+                const auto result = dispatch_queued_requests_callback_.schedule(Schedule::Once{now()});
+                CETL_DEBUG_ASSERT(result, "Should not fail b/c queued requests imply registered callback.");
+                (void) result;
+            }
+        }
+        if (auto* const queued_request = callback_node.queued_request_)
+        {
+            unlinkQueuedRequest(*queued_request);
+            destroyQueuedRequest(queued_request);
+        }
         if (callback_node.isTimeoutLinked())
         {
             removeTimeoutNodeAndReschedule(callback_node);
@@ -273,24 +582,200 @@ protected:
     }
 
 private:
-    using Schedule = IExecutor::Callback::Schedule;
+    using Schedule     = IExecutor::Callback::Schedule;
+    using TimeoutNodes = common::PairingHeap<TimeoutNode, TimeoutNode::Less>;
+
+    static constexpr std::size_t InitialBucketsCount = config::Presentation::SharedClient_CallbackNodesBucketsCount();
+    static_assert((InitialBucketsCount > 0) && ((InitialBucketsCount & (InitialBucketsCount - 1)) == 0),
+                  "Number of buckets must be a power of two.");
 
     static constexpr TimePoint DistantFuture()
     {
         return TimePoint::max();
     }
 
+    CallbackNode*& getBucketOf(const transport::TransferId transfer_id) noexcept
+    {
+        return cb_nodes_buckets_[static_cast<std::size_t>(transfer_id & (cb_nodes_buckets_count_ - 1))];
+    }
+
+    /// Links the given node as the head of the given bucket chain.
+    ///
+    static void linkIntoBucket(CallbackNode& callback_node, CallbackNode*& bucket_head) noexcept
+    {
+        callback_node.bucket_next_ = bucket_head;
+        callback_node.bucket_prev_ = &bucket_head;
+        if (nullptr != bucket_head)
+        {
+            bucket_head->bucket_prev_ = &callback_node.bucket_next_;
+        }
+        bucket_head = &callback_node;
+    }
+
+    /// Doubles number of buckets (and rehashes all pending nodes), so that the average chain length stays
+    /// within a single node. If there is no memory for the new buckets, the current ones are kept as is -
+    /// the lookup just gets slower (proportionally to the chain length), but it's still correct.
+    ///
+    void tryGrowBuckets() noexcept
+    {
+        const std::size_t new_buckets_count = cb_nodes_buckets_count_ * 2;
+        auto* const       new_buckets       = static_cast<CallbackNode**>(  // NOSONAR cpp:S5356 cpp:S5357
+            memory().allocate(new_buckets_count * sizeof(CallbackNode*), alignof(CallbackNode*)));
+        if (nullptr == new_buckets)
+        {
+            return;
+        }
+        std::fill_n(new_buckets, new_buckets_count, nullptr);
+
+        CallbackNode** const old_buckets       = cb_nodes_buckets_;
+        const std::size_t    old_buckets_count = cb_nodes_buckets_count_;
+        cb_nodes_buckets_                      = new_buckets;
+        cb_nodes_buckets_count_                = new_buckets_count;
+        for (std::size_t index = 0; index < old_buckets_count; ++index)
+        {
+            CallbackNode* callback_node = old_buckets[index];
+            while (nullptr != callback_node)
+            {
+                CallbackNode* const next_node = callback_node->bucket_next_;
+                linkIntoBucket(*callback_node, getBucketOf(callback_node->getTransferId()));
+                callback_node = next_node;
+            }
+        }
+        deallocateGrownBuckets(old_buckets, old_buckets_count);
+    }
+
+    void releaseGrownBuckets() noexcept
+    {
+        CETL_DEBUG_ASSERT(cb_nodes_count_ == 0, "");
+
+        deallocateGrownBuckets(cb_nodes_buckets_, cb_nodes_buckets_count_);
+        cb_nodes_buckets_       = cb_nodes_inline_buckets_.data();
+        cb_nodes_buckets_count_ = cb_nodes_inline_buckets_.size();
+    }
+
+    void deallocateGrownBuckets(CallbackNode** const buckets, const std::size_t buckets_count) const noexcept
+    {
+        if (buckets != cb_nodes_inline_buckets_.data())
+        {
+            memory().deallocate(buckets, buckets_count * sizeof(CallbackNode*), alignof(CallbackNode*));
+        }
+    }
+
+    CallbackNode* findCallbackNode(const transport::TransferId transfer_id) noexcept
+    {
+        CallbackNode* callback_node = getBucketOf(transfer_id);
+        while ((nullptr != callback_node) && (callback_node->getTransferId() != transfer_id))
+        {
+            callback_node = callback_node->bucket_next_;
+        }
+        return callback_node;
+    }
+
     void onResponseRxTransfer(transport::ServiceRxTransfer& transfer)
     {
-        const auto transfer_id = transfer.metadata.rx_meta.base.transfer_id;
-        if (auto* const callback_node = cb_nodes_by_transfer_id_.search(  //
-                [transfer_id](const CallbackNode& other_node) {           // predicate
-                    //
-                    return other_node.compareByTransferId(transfer_id);
-                }))
+        auto* const callback_node = findCallbackNode(transfer.metadata.rx_meta.base.transfer_id);
+        if (nullptr == callback_node)
+        {
+            if (nullptr != statistics_)
+            {
+                ++statistics_->late_or_duplicate_responses;
+            }
+            return;
+        }
+
+        if (nullptr != statistics_)
         {
-            removeCallbackNode(*callback_node);
-            callback_node->onResponseRxTransfer(transfer, now());
+            const auto rtt = transfer.metadata.rx_meta.timestamp - callback_node->getRequestTime();
+            ++statistics_->rtt_histogram[ClientStatistics::getRttHistogramBinIndex(rtt)];
+            ++statistics_->responses;
+        }
+
+        // Note that statistics might be disabled by the user during the response handling,
+        // but this client itself stays alive (b/c its destruction is deferred, see `SharedObject::release`).
+        removeCallbackNode(*callback_node);
+        if (!callback_node->onResponseRxTransfer(transfer, now()) && (nullptr != statistics_))
+        {
+            ++statistics_->deserialization_failures;
+        }
+    }
+
+    void unlinkQueuedRequest(QueuedRequest& queued_request) noexcept
+    {
+        CETL_DEBUG_ASSERT(queued_requests_count_ > 0, "");
+        CETL_DEBUG_ASSERT(queued_request.callback_node_ != nullptr, "");
+
+        if (nullptr != queued_request.prev_)
+        {
+            queued_request.prev_->next_ = queued_request.next_;
+        }
+        else
+        {
+            queued_requests_head_ = queued_request.next_;
+        }
+        if (nullptr != queued_request.next_)
+        {
+            queued_request.next_->prev_ = queued_request.prev_;
+        }
+        else
+        {
+            queued_requests_tail_ = queued_request.prev_;
+        }
+        --queued_requests_count_;
+
+        queued_request.callback_node_->queued_request_ = nullptr;
+        queued_request.callback_node_                  = nullptr;
+        queued_request.next_                           = nullptr;
+        queued_request.prev_                           = nullptr;
+    }
+
+    void destroyQueuedRequest(QueuedRequest* const queued_request) const noexcept
+    {
+        const auto total_size = sizeof(QueuedRequest) + queued_request->payload_size_;
+        queued_request->~QueuedRequest();  // NOSONAR cpp:S3432 cpp:M23_329
+        memory().deallocate(queued_request, total_size);
+    }
+
+    /// Sends waiting requests (in FIFO order) until transfer IDs are available.
+    ///
+    void onDispatchQueuedRequests()
+    {
+        while (auto* const queued_request = queued_requests_head_)
+        {
+            const auto opt_transfer_id = nextTransferId();
+            if (!opt_transfer_id)
+            {
+                break;
+            }
+
+            // Move the node from the queue into the table of pending requests,
+            // and restore its response deadline (which was in effect before queueing).
+            //
+            auto& callback_node = *queued_request->callback_node_;
+            unlinkQueuedRequest(*queued_request);
+            removeTimeoutNodeAndReschedule(callback_node);
+            callback_node.transfer_id_ = *opt_transfer_id;
+            callback_node.setTimeoutDeadline(queued_request->response_deadline_);
+            insertNewCallbackNode(callback_node);
+
+            const transport::TransferTxMetadata tx_metadata{{callback_node.transfer_id_, queued_request->priority_},
+                                                            queued_request->request_deadline_};
+            const cetl::span<const cetl::byte>                      payload{queued_request->payload()};
+            const std::array<const cetl::span<const cetl::byte>, 1> payload_fragments{payload};
+            const auto failure = sendRequestPayload(tx_metadata, payload_fragments);
+            destroyQueuedRequest(queued_request);
+
+            // There is no one to report the transport failure to (the request method has already returned),
+            // so the promise just expires immediately - as if the request was dropped by the transport.
+            //
+            if (failure)
+            {
+                if (nullptr != statistics_)
+                {
+                    ++statistics_->timeouts;
+                }
+                removeCallbackNode(callback_node);
+                callback_node.onResponseTimeout(tx_metadata.deadline, now());
+            }
         }
     }
 
@@ -306,6 +791,10 @@ private:
             // Downcast is safe here b/c every timeout node is always a callback node.
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
             auto& callback_node = static_cast<CallbackNode&>(*nearest_deadline_node);
+            if (nullptr != statistics_)
+            {
+                ++statistics_->timeouts;
+            }
 
             removeCallbackNode(callback_node);
             callback_node.onResponseTimeout(callback_node.getTimeoutDeadline(), approx_now);
@@ -320,17 +809,8 @@ private:
 
         // 1. Insert the new timeout node.
         //
-        const auto timeout_node_existing = timeout_nodes_by_deadline_.search(  //
-            [new_node_deadline](const TimeoutNode& other_node) {               // predicate
-                //
-                return other_node.compareByTimeoutDeadline(new_node_deadline);
-            },
-            [&timeout_node]() { return &timeout_node; });  // "factory"
-
-        (void) timeout_node_existing;
+        timeout_nodes_by_deadline_.insert(timeout_node);
         CETL_DEBUG_ASSERT(timeout_node.isTimeoutLinked(), "");
-        CETL_DEBUG_ASSERT(!std::get<1>(timeout_node_existing), "Unexpected existing timeout node.");
-        CETL_DEBUG_ASSERT(&timeout_node == std::get<0>(timeout_node_existing), "Unexpected timeout node.");
 
         // 2. Reschedule the nearest deadline callback if it's gonna happen earlier than it was before.
         //
@@ -347,7 +827,7 @@ private:
     {
         CETL_DEBUG_ASSERT(timeout_node.isTimeoutLinked(), "");
 
-        timeout_nodes_by_deadline_.remove(&timeout_node);
+        timeout_nodes_by_deadline_.remove(timeout_node);
         const auto old_cb_node_deadline = timeout_node.getTimeoutDeadline();
 
         // No need to reschedule the nearest deadline callback if deadline of the removed node was not the nearest.
@@ -388,10 +868,19 @@ private:
     const UniquePtr<transport::IRequestTxSession>  svc_request_tx_session_;
     const UniquePtr<transport::IResponseRxSession> svc_response_rx_session_;
     const transport::ResponseRxParams              response_rx_params_;
-    common::cavl::Tree<CallbackNode>               cb_nodes_by_transfer_id_;
+    std::array<CallbackNode*, InitialBucketsCount> cb_nodes_inline_buckets_;
+    CallbackNode**                                 cb_nodes_buckets_;
+    std::size_t                                    cb_nodes_buckets_count_;
+    std::size_t                                    cb_nodes_count_{0};
     TimePoint                                      nearest_deadline_;
-    common::cavl::Tree<TimeoutNode>                timeout_nodes_by_deadline_;
+    TimeoutNodes                                   timeout_nodes_by_deadline_;
     IExecutor::Callback::Any                       nearest_deadline_callback_;
+    QueuedRequest*                                 queued_requests_head_{nullptr};
+    QueuedRequest*                                 queued_requests_tail_{nullptr};
+    std::size_t                                    queued_requests_count_{0};
+    std::size_t                                    queued_requests_capacity_{0};
+    IExecutor::Callback::Any                       dispatch_queued_requests_callback_;
+    ClientStatistics*                              statistics_{nullptr};
 
 };  // SharedClient
 
@@ -439,7 +928,12 @@ private:
 
     void removeCallbackNode(CallbackNode& callback_node) override
     {
-        TransferIdGeneratorMixin::releaseTransferId(callback_node.getTransferId());
+        // The node could be already removed (f.e. on response reception), and its transfer id
+        // could be already reused by another request - so release the id only for still linked node.
+        if (callback_node.isCallbackLinked())
+        {
+            TransferIdGeneratorMixin::releaseTransferId(callback_node.getTransferId());
+        }
         SharedClient::removeCallbackNode(callback_node);
     }
 
@@ -0,0 +1,77 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_CLIENT_STATISTICS_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_CLIENT_STATISTICS_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/types.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines statistics of RPC requests and responses of a client.
+///
+/// Statistics are collected (if enabled) per shared client, so all clients of the same server node and
+/// service ids contribute to the same statistics. See `Client::enableStatistics` for details.
+///
+struct ClientStatistics final
+{
+    /// @brief Defines number of bins in the round-trip time histogram.
+    ///
+    static constexpr std::size_t RttHistogramBinsCount = config::Presentation::ClientStatistics_RttHistogramBinsCount();
+    static_assert(RttHistogramBinsCount > 1, "At least two bins are expected.");
+
+    /// @brief Gets index of the histogram bin for the given round-trip time.
+    ///
+    /// Bins are logarithmic: #0 bin counts RTTs less than 1us, bin #i counts RTTs within `[2^(i-1), 2^i)` us,
+    /// and the last bin counts everything above (including RTTs which don't fit into the previous bins).
+    ///
+    static std::size_t getRttHistogramBinIndex(const Duration rtt) noexcept
+    {
+        const auto rtt_us = std::chrono::duration_cast<std::chrono::microseconds>(rtt).count();
+
+        std::size_t bin_index = 0;
+        for (auto value = static_cast<std::uint64_t>((rtt_us > 0) ? rtt_us : 0); value != 0; value >>= 1U)
+        {
+            ++bin_index;
+        }
+        return (bin_index < RttHistogramBinsCount) ? bin_index : (RttHistogramBinsCount - 1);
+    }
+
+    /// Histogram of request-response round-trip times - from the request initiation
+    /// (see `ResponsePromise::getRequestTime`) to the timestamp of the response reception.
+    /// The time requests spend in the client queue (see `Client::setRequestQueueCapacity`) is included.
+    std::array<std::uint32_t, RttHistogramBinsCount> rtt_histogram{};
+
+    /// Total number of responses matched to pending requests (including the ones which failed deserialization).
+    std::uint32_t responses{0};
+
+    /// Total number of requests which have expired without getting a response.
+    std::uint32_t timeouts{0};
+
+    /// Total number of responses which could not be deserialized.
+    std::uint32_t deserialization_failures{0};
+
+    /// Total number of responses with unknown transfer ID - the ones which came late (after the request expiry
+    /// or cancellation), as well as duplicates (f.e. from redundant transports).
+    std::uint32_t late_or_duplicate_responses{0};
+
+    /// The maximum number of simultaneously pending (aka in-flight) requests, not counting queued ones.
+    std::size_t in_flight_high_water_mark{0};
+
+};  // ClientStatistics
+
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_CLIENT_STATISTICS_HPP_INCLUDED
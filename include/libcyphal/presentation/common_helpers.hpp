@@ -9,6 +9,7 @@
 #include "libcyphal/config.hpp"
 #include "libcyphal/errors.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/types.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <cetl/pf20/cetlpf.hpp>
@@ -76,25 +77,19 @@ static cetl::optional<DeserializationFailure> tryDeserializePayload(const transp
     return result ? cetl::nullopt : cetl::optional<DeserializationFailure>(result.error());
 }
 
-template <typename Message, typename Result, std::size_t BufferSize, bool IsOnStack, typename Action>
-static auto tryPerformOnSerialized(const Message&                    message,
-                                   const cetl::pmr::memory_resource& memory,
-                                   Action&&                          action) -> std::enable_if_t<IsOnStack, Result>
+/// Serializes the message into the given buffer, and then performs the action on the serialized payload.
+///
+template <typename Message, typename Result, typename Action>
+static Result performOnSerializedInto(const Message& message, const cetl::span<cetl::byte> buffer, Action&& action)
 {
-    // Not in use b/c we use stack buffer for small messages.
-    (void) memory;
-
     // Try to serialize the message to raw payload buffer.
     //
-    // Next nolint b/c we use a buffer to serialize the message, so no need to zero it (and performance better).
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
-    std::array<cetl::byte, BufferSize> buffer;
     // TODO: Eliminate `reinterpret_cast` when Nunavut supports `cetl::byte` at its `serialize`.
     const auto result_size = serialize(message,
                                        // Next nolint & NOSONAR are currently unavoidable.
                                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
                                        {reinterpret_cast<std::uint8_t*>(buffer.data()),  // NOSONAR cpp:S3630,
-                                        BufferSize});
+                                        buffer.size()});
     if (!result_size)
     {
         return result_size.error();
@@ -107,10 +102,37 @@ static auto tryPerformOnSerialized(const Message&                    message,
 }
 
 template <typename Message, typename Result, std::size_t BufferSize, bool IsOnStack, typename Action>
-static auto tryPerformOnSerialized(const Message&              message,
-                                   cetl::pmr::memory_resource& memory,
-                                   Action&&                    action) -> std::enable_if_t<!IsOnStack, Result>
+static auto tryPerformOnSerialized(const Message&                    message,
+                                   const cetl::pmr::memory_resource& memory,
+                                   const cetl::span<cetl::byte>      attached_buffer,
+                                   Action&&                          action) -> std::enable_if_t<IsOnStack, Result>
 {
+    // Not in use b/c we use stack buffer for small messages.
+    (void) memory;
+    (void) attached_buffer;
+
+    // Next nolint b/c we use a buffer to serialize the message, so no need to zero it (and performance better).
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+    std::array<cetl::byte, BufferSize> buffer;
+    return performOnSerializedInto<Message, Result>(message, buffer, std::forward<Action>(action));
+}
+
+/// Serializes large messages either into the attached (persistent, and pre-allocated by the user) buffer
+/// if it's big enough, or into a temporary PMR allocated buffer otherwise.
+///
+template <typename Message, typename Result, std::size_t BufferSize, bool IsOnStack, typename Action>
+static auto tryPerformOnSerialized(const Message&               message,
+                                   cetl::pmr::memory_resource&  memory,
+                                   const cetl::span<cetl::byte> attached_buffer,
+                                   Action&&                     action) -> std::enable_if_t<!IsOnStack, Result>
+{
+    if (attached_buffer.size() >= BufferSize)
+    {
+        return performOnSerializedInto<Message, Result>(message,
+                                                        attached_buffer.first(BufferSize),
+                                                        std::forward<Action>(action));
+    }
+
     // Nolint and NoSonar b/c we use PMR allocation for raw bytes buffer.
     // NOLINTNEXTLINE(*-avoid-c-arrays)
     const std::unique_ptr<cetl::byte[], PmrRawBytesDeleter> buffer  // NOSONAR cpp:S5945 cpp:M23_356
@@ -121,24 +143,7 @@ static auto tryPerformOnSerialized(const Message&              message,
         return MemoryError{};
     }
 
-    // Try to serialize the message to raw payload buffer.
-    //
-    // Next nolint b/c we use a buffer to serialize the message, so no need to zero it (and performance better).
-    // TODO: Eliminate `reinterpret_cast` when Nunavut supports `cetl::byte` at its `serialize`.
-    const auto result_size = serialize(message,
-                                       // Next nolint & NOSONAR are currently unavoidable.
-                                       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-                                       {reinterpret_cast<std::uint8_t*>(buffer.get()),  // NOSONAR cpp:S3630,
-                                        BufferSize});
-    if (!result_size)
-    {
-        return result_size.error();
-    }
-
-    const cetl::span<const cetl::byte>                      data_span{buffer.get(), result_size.value()};
-    const std::array<const cetl::span<const cetl::byte>, 1> fragments{data_span};
-
-    return std::forward<Action>(action)(fragments);
+    return performOnSerializedInto<Message, Result>(message, {buffer.get(), BufferSize}, std::forward<Action>(action));
 }
 
 }  // namespace detail
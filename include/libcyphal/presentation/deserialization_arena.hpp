@@ -0,0 +1,178 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_PRESENTATION_DESERIALIZATION_ARENA_HPP_INCLUDED
+#define LIBCYPHAL_PRESENTATION_DESERIALIZATION_ARENA_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+namespace libcyphal
+{
+namespace presentation
+{
+
+/// @brief Defines a monotonic (aka bump) memory resource for deserialization of received data.
+///
+/// The arena allocates sequentially from a user provided buffer, and individual deallocations are just counted -
+/// the whole buffer is rewound as soon as the last live allocation of the arena is released.
+///
+/// When attached to the presentation layer (see `Presentation::setDeserializationArena`), the arena serves all memory
+/// needed to deserialize received messages, RPC requests and responses (including variable-length arrays and
+/// temporary payload buffers). Such memory is normally released right after all user callbacks of a dispatch
+/// have been run, so the arena is effectively reset once per dispatch, and the general memory resource
+/// is not involved on the receive path at all (neither its allocation traffic nor fragmentation).
+///
+/// If a deserialized object outlives its dispatch (f.e. a response result which is stored in a promise,
+/// or a message which was moved out of the subscriber callback), the arena is not rewound until the object
+/// is destroyed, and subsequent allocations just continue from the current position. Allocations which
+/// don't fit into the rest of the buffer are forwarded to the upstream memory resource (and are returned to it
+/// on deallocation), so the arena never fails as long as the upstream one doesn't.
+///
+/// NB! The arena is not thread-safe. Its buffer memory is owned by the user, and it must outlive the arena.
+/// The arena itself must outlive any object which was allocated from it.
+///
+class DeserializationArena final : public cetl::pmr::memory_resource
+{
+public:
+    /// @brief Constructs a new arena.
+    ///
+    /// @param buffer The buffer to allocate from. Its size should fit the largest expected deserialized object
+    ///               (plus some alignment padding) - anything beyond the buffer is allocated from the upstream.
+    /// @param upstream The memory resource to use for allocations which don't fit into the buffer.
+    ///
+    DeserializationArena(const cetl::span<cetl::byte> buffer, cetl::pmr::memory_resource& upstream) noexcept
+        : buffer_{buffer}
+        , upstream_{upstream}
+    {
+    }
+
+    DeserializationArena(const DeserializationArena&)                = delete;
+    DeserializationArena(DeserializationArena&&) noexcept            = delete;
+    DeserializationArena& operator=(const DeserializationArena&)     = delete;
+    DeserializationArena& operator=(DeserializationArena&&) noexcept = delete;
+
+    ~DeserializationArena() override
+    {
+        CETL_DEBUG_ASSERT(live_allocations_ == 0, "All arena allocations must be released before its destruction.");
+    }
+
+    /// @brief Gets number of buffer bytes which are currently in use (including alignment padding).
+    ///
+    /// Zero means that the arena has been rewound, and the whole buffer is available again.
+    ///
+    std::size_t getUsedBytes() const noexcept
+    {
+        return offset_;
+    }
+
+    /// @brief Gets the maximum number of buffer bytes which were ever in use simultaneously.
+    ///
+    /// Could be used to tune size of the arena buffer.
+    ///
+    std::size_t getHighWaterMark() const noexcept
+    {
+        return high_water_mark_;
+    }
+
+    /// @brief Gets total number of allocations which didn't fit into the buffer, and so were forwarded to upstream.
+    ///
+    std::size_t getUpstreamAllocationsCount() const noexcept
+    {
+        return upstream_allocations_;
+    }
+
+private:
+    bool isInBuffer(const void* const ptr) const noexcept
+    {
+        const auto* const                  byte_ptr = static_cast<const cetl::byte*>(ptr);
+        const std::less<const cetl::byte*> less{};
+        return !less(byte_ptr, buffer_.data()) && less(byte_ptr, buffer_.data() + buffer_.size());
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        // Even zero-sized allocation occupies one byte, so that all buffer pointers are strictly inside the buffer
+        // (see `isInBuffer`), and can't be confused with upstream ones on deallocation.
+        const std::size_t occupied_bytes = std::max<std::size_t>(size_bytes, 1U);
+
+        void*       ptr   = buffer_.data() + offset_;  // NOLINT(*-pointer-arithmetic)
+        std::size_t space = buffer_.size() - offset_;
+        if ((ptr != nullptr) && (std::align(alignment, occupied_bytes, ptr, space) != nullptr))
+        {
+            offset_          = buffer_.size() - space + occupied_bytes;
+            high_water_mark_ = std::max(high_water_mark_, offset_);
+            ++live_allocations_;
+            return ptr;
+        }
+
+        ++upstream_allocations_;
+        return upstream_.allocate(size_bytes, alignment);
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (!isInBuffer(ptr))
+        {
+            upstream_.deallocate(ptr, size_bytes, alignment);
+            return;
+        }
+
+        CETL_DEBUG_ASSERT(live_allocations_ > 0, "");
+        --live_allocations_;
+        if (live_allocations_ == 0)
+        {
+            offset_ = 0;
+        }
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        void* const new_ptr = do_allocate(new_size_bytes, alignment);
+        if ((new_ptr != nullptr) && (ptr != nullptr))
+        {
+            // No Sonar cpp:S5356 b/c we do need to copy raw bytes of the previous allocation.
+            (void) std::memcpy(new_ptr, ptr, std::min(old_size_bytes, new_size_bytes));  // NOSONAR cpp:S5356
+            do_deallocate(ptr, old_size_bytes, alignment);
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    // MARK: Data members:
+
+    const cetl::span<cetl::byte> buffer_;
+    cetl::pmr::memory_resource&  upstream_;
+    std::size_t                  offset_{0};
+    std::size_t                  high_water_mark_{0};
+    std::size_t                  live_allocations_{0};
+    std::size_t                  upstream_allocations_{0};
+
+};  // DeserializationArena
+
+}  // namespace presentation
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_PRESENTATION_DESERIALIZATION_ARENA_HPP_INCLUDED
@@ -8,6 +8,7 @@
 
 #include "client.hpp"
 #include "client_impl.hpp"
+#include "deserialization_arena.hpp"
 #include "presentation_delegate.hpp"
 #include "publisher.hpp"
 #include "publisher_impl.hpp"
@@ -32,6 +33,7 @@
 #include <cetl/pf17/cetlpf.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -92,6 +94,16 @@ struct IsFixedPortIdMessageTrait<T, true>
 
 }  // namespace detail
 
+/// @brief Defines kinds of ports in use by the presentation layer (see `Presentation::forEachPort`).
+///
+enum class PortKind : std::uint8_t
+{
+    Publisher,
+    Subscriber,
+    Client,
+    Server,
+};
+
 /// @brief Defines the main presentation layer class.
 ///
 /// Instance of this class is supposed to be created once per transport instance (or even per application).
@@ -136,6 +148,8 @@ public:
                           "Message publishers must be destroyed before presentation.");
         CETL_DEBUG_ASSERT(subscriber_impl_nodes_.empty(),  //
                           "Message subscribers must be destroyed before presentation.");
+        CETL_DEBUG_ASSERT(server_impl_nodes_.empty(),  //
+                          "RPC servers must be destroyed before presentation.");
     }
 
     /// @brief Gets reference to the executor instance of this presentation object.
@@ -152,6 +166,69 @@ public:
         return transport_;
     }
 
+    /// @brief Sets (or resets) the deserialization arena of this presentation object.
+    ///
+    /// By default, memory needed to deserialize received messages, RPC requests and responses is allocated from
+    /// the general memory resource (see `memory`), and is released again right after the user callbacks.
+    /// With an attached arena, all such allocations are served by the arena instead, which gets rewound as soon as
+    /// all received data allocated from it is released - see `DeserializationArena` for details.
+    ///
+    /// NB! The arena is owned by the user, and it must outlive this presentation object
+    /// (as well as any deserialized object which was allocated from the arena).
+    ///
+    /// @param arena The arena to attach. Use `nullptr` to detach the current arena (if any), and so
+    ///              fall back to the general memory resource for subsequent deserializations.
+    ///
+    void setDeserializationArena(DeserializationArena* const arena) noexcept
+    {
+        deserialization_arena_ = arena;
+    }
+
+    /// @brief Gets current version of the set of ports in use by this presentation object.
+    ///
+    /// The version is incremented whenever a port (publisher, subscriber, RPC client or server) appears or
+    /// disappears, so it could be used to cheaply detect that the set of ports has changed since the last
+    /// `forEachPort` introspection. Note that multiple publishers (subscribers or clients) to the same port
+    /// share internal implementation - hence don't change the version, unless it's the very first or last one.
+    ///
+    std::uint32_t getPortsVersion() const noexcept
+    {
+        return ports_version_;
+    }
+
+    /// @brief Visits all ports currently in use by this presentation object.
+    ///
+    /// Ports are visited grouped by their kind (publishers, subscribers, clients, and then servers), and in ascending
+    /// order of their ids. The exception is RPC clients - they are ordered by server node id first, so the same
+    /// service id could be visited multiple times - once per each server node id the clients are bound to.
+    ///
+    /// @param visitor The function to call for each port. Has `void(const PortKind, const transport::PortId)`
+    ///                signature. Should not create or destroy any ports.
+    ///
+    template <typename Visitor>
+    void forEachPort(const Visitor& visitor) const
+    {
+        // All the trees are ordered by descending port ids (see `compareBy...` predicates), hence reverse traversal.
+        constexpr bool Reverse = true;
+
+        publisher_impl_nodes_.traverseInOrder([&visitor](const detail::PublisherImpl& publisher_impl) {
+            //
+            visitor(PortKind::Publisher, publisher_impl.getSubjectId());
+        }, Reverse);
+        subscriber_impl_nodes_.traverseInOrder([&visitor](const detail::SubscriberImpl& subscriber_impl) {
+            //
+            visitor(PortKind::Subscriber, subscriber_impl.getSubjectId());
+        }, Reverse);
+        shared_client_nodes_.traverseInOrder([&visitor](const detail::SharedClient& shared_client) {
+            //
+            visitor(PortKind::Client, shared_client.getServiceId());
+        }, Reverse);
+        server_impl_nodes_.traverseInOrder([&visitor](const detail::ServerImpl& server_impl) {
+            //
+            visitor(PortKind::Server, server_impl.getServiceId());
+        }, Reverse);
+    }
+
     /// @brief Makes a message publisher.
     ///
     /// The publisher must never outlive this presentation object.
@@ -183,6 +260,10 @@ public:
 
         auto* const publisher_impl = std::get<0>(publisher_existing);
         CETL_DEBUG_ASSERT(publisher_impl != nullptr, "");
+        if (!std::get<1>(publisher_existing))
+        {
+            ++ports_version_;
+        }
 
         // This publisher impl node might be in the list of previously unreferenced nodes -
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
@@ -296,6 +377,8 @@ public:
 
     /// @brief Makes a custom typed RPC server bound to a specific service id.
     ///
+    /// The server must never outlive this presentation object.
+    ///
     /// @tparam Request The request type of the server. See `Server<Request, ...>` for more details.
     /// @tparam Response The response type of the server. See `Server<..., Response>` for more details.
     /// @param service_id The service ID of the server.
@@ -325,6 +408,8 @@ public:
 
     /// @brief Makes a service typed RPC server bound to a specific service id.
     ///
+    /// The server must never outlive this presentation object.
+    ///
     /// @tparam Service The service type generated by DSDL tool. See `ServiceServer<Service>` for more details.
     /// @param service_id The service ID of the server.
     /// @param on_request_cb_fn Optional callback function to be called when a request is received.
@@ -341,6 +426,8 @@ public:
 
     /// @brief Makes a typed RPC server bound to its fixed service id.
     ///
+    /// The server must never outlive this presentation object.
+    ///
     /// @tparam Service The service type generated by DSDL tool. The type expected to have a fixed port ID.
     /// @param on_request_cb_fn Optional callback function to be called when a request is received.
     ///                         Can be assigned (or reset) later via `Server::setOnRequestCallback`.
@@ -354,6 +441,8 @@ public:
 
     /// @brief Makes a raw (aka untyped) RPC server bound to a specific service id.
     ///
+    /// The server must never outlive this presentation object.
+    ///
     /// @param service_id The service ID of the server.
     /// @param extent_bytes Defines the size of the transfer payload memory buffer;
     ///                     or, in other words, the maximum possible size of received objects,
@@ -547,6 +636,10 @@ private:
 
         auto* const subscriber_impl = std::get<0>(subscriber_existing);
         CETL_DEBUG_ASSERT(subscriber_impl != nullptr, "");
+        if (!std::get<1>(subscriber_existing))
+        {
+            ++ports_version_;
+        }
 
         // This subscriber impl node might be in the list of previously unreferenced nodes -
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
@@ -579,7 +672,26 @@ private:
             const transport::ResponseTxParams tx_params{params.service_id};
             if (auto tx_session = getIfSession(transport_.makeResponseTxSession(tx_params), out_failure))
             {
-                return detail::ServerImpl{memory_, executor_, std::move(rx_session), std::move(tx_session)};
+                detail::ServerImpl server_impl{asDelegate(),
+                                               executor_,
+                                               params.service_id,
+                                               std::move(rx_session),
+                                               std::move(tx_session)};
+
+                // Transport doesn't allow multiple request RX sessions on the same service id,
+                // so there should be no existing server node with the same id.
+                const auto server_existing = server_impl_nodes_.search(
+                    [&params](const detail::ServerImpl& other_server) {  // predicate
+                        //
+                        return other_server.compareByServiceId(params.service_id);
+                    },
+                    [&server_impl]() { return &server_impl; });  // factory
+                CETL_DEBUG_ASSERT(!std::get<1>(server_existing), "");
+                (void) server_existing;
+                ++ports_version_;
+
+                // The tree node is moved together with the server impl (see `cavl::Node` move constructor).
+                return Expected<detail::ServerImpl, MakeFailure>{std::move(server_impl)};
             }
         }
         CETL_DEBUG_ASSERT(out_failure, "");
@@ -607,6 +719,10 @@ private:
 
         auto* const shared_client = std::get<0>(shared_client_existing);
         CETL_DEBUG_ASSERT(shared_client != nullptr, "");
+        if (!std::get<1>(shared_client_existing))
+        {
+            ++ports_version_;
+        }
 
         // This client impl node might be in the list of previously unreferenced nodes -
         // the ones that are going to be deleted asynchronously (by the `destroyUnreferencedNodes`).
@@ -670,7 +786,7 @@ private:
     }
 
     template <typename SharedNode>
-    static void forgetSharedNode(SharedNode& shared_node) noexcept
+    void forgetSharedNode(SharedNode& shared_node) noexcept
     {
         CETL_DEBUG_ASSERT(shared_node.isLinked(), "");
         CETL_DEBUG_ASSERT(!shared_node.isReferenced(), "");
@@ -679,6 +795,7 @@ private:
         // as well as from the list of unreferenced nodes (b/c we gonna finally destroy it).
         shared_node.remove();              // from the tree
         shared_node.unlinkIfReferenced();  // from the list
+        ++ports_version_;
     }
 
     void destroyUnreferencedNodes() const noexcept
@@ -696,6 +813,15 @@ private:
 
     // MARK: IPresentationDelegate
 
+    cetl::pmr::memory_resource& deserializationMemory() const noexcept override
+    {
+        if (deserialization_arena_ != nullptr)
+        {
+            return *deserialization_arena_;
+        }
+        return memory_;
+    }
+
     void markSharedObjAsUnreferenced(detail::SharedObject& shared_obj) noexcept override
     {
         // We are not going to destroy the shared object immediately, but schedule it for deletion.
@@ -725,6 +851,14 @@ private:
         forgetSharedNode(subscriber_impl);
     }
 
+    void forgetServerImpl(detail::ServerImpl& server_impl) noexcept override
+    {
+        CETL_DEBUG_ASSERT(server_impl.isLinked(), "");
+
+        server_impl.remove();
+        ++ports_version_;
+    }
+
     // MARK: Data members:
 
     cetl::pmr::memory_resource&                memory_;
@@ -733,8 +867,11 @@ private:
     common::cavl::Tree<detail::SharedClient>   shared_client_nodes_;
     common::cavl::Tree<detail::PublisherImpl>  publisher_impl_nodes_;
     common::cavl::Tree<detail::SubscriberImpl> subscriber_impl_nodes_;
+    common::cavl::Tree<detail::ServerImpl>     server_impl_nodes_;
     detail::UnRefNode                          unreferenced_nodes_;
     IExecutor::Callback::Any                   unref_nodes_deleter_callback_;
+    DeserializationArena*                      deserialization_arena_{nullptr};
+    std::uint32_t                              ports_version_{0};
 
 };  // Presentation
 
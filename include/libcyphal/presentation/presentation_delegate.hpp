@@ -73,6 +73,7 @@ struct IsServiceTrait<T, true>
 class SharedClient;
 class PublisherImpl;
 class SubscriberImpl;
+class ServerImpl;
 
 /// @brief Defines internal interface for the Presentation layer delegate.
 ///
@@ -86,10 +87,17 @@ public:
 
     virtual cetl::pmr::memory_resource& memory() const noexcept = 0;
 
+    /// Gets memory resource to be used for deserialization of received messages, RPC requests and responses.
+    ///
+    /// It's either the attached deserialization arena (if any), or the general `memory` resource.
+    ///
+    virtual cetl::pmr::memory_resource& deserializationMemory() const noexcept = 0;
+
     virtual void markSharedObjAsUnreferenced(SharedObject& shared_obj) noexcept = 0;
     virtual void forgetSharedClient(SharedClient& shared_client) noexcept       = 0;
     virtual void forgetPublisherImpl(PublisherImpl& publisher_impl) noexcept    = 0;
     virtual void forgetSubscriberImpl(SubscriberImpl& subscriber_impl) noexcept = 0;
+    virtual void forgetServerImpl(ServerImpl& server_impl) noexcept             = 0;
 
 protected:
     IPresentationDelegate()  = default;
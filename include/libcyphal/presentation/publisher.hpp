@@ -15,9 +15,11 @@
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 
 #include <nunavut/support/serialization.hpp>
 
+#include <cstddef>
 #include <utility>
 
 namespace libcyphal
@@ -171,7 +173,8 @@ public:
     /// Publishes the message on libcyphal network.
     ///
     /// If `BufferSize` is less or equal to `config::presentation::SmallPayloadSize`,
-    /// the message will be serialized using a stack-allocated buffer; otherwise, PMR allocation will be used.
+    /// the message will be serialized using a stack-allocated buffer; otherwise, either the attached buffer
+    /// (see `setSerializationBuffer`) or PMR allocation will be used.
     ///
     /// @tparam BufferSize The size of the buffer to serialize the message.
     /// @param deadline The latest time to send the message. Will be dropped if exceeded.
@@ -186,6 +189,7 @@ public:
         return detail::tryPerformOnSerialized<Message, Result, BufferSize, IsOnStack>(  //
             message,
             memory(),
+            serialization_buffer_,
             [this, deadline](const auto serialized_fragments) -> Result {
                 //
                 if (auto failure = publishRawData(deadline, serialized_fragments))
@@ -196,6 +200,24 @@ public:
             });
     }
 
+    /// @brief Attaches a persistent serialization buffer to this publisher.
+    ///
+    /// By default, a message larger than `config::Presentation::SmallPayloadSize` is serialized into a temporary
+    /// PMR allocated buffer on every `publish` call. If the attached buffer is big enough to fit the serialized
+    /// message, serialization is done directly into it, so steady-state operation does no allocations.
+    /// A buffer which is too small is ignored, and PMR is in use instead.
+    ///
+    /// The buffer memory is owned by the user, and it must outlive this publisher (and its copies, which share
+    /// the attached buffer). The buffer is in use only during the serialization and sending, so the same buffer
+    /// can be shared by several publishers, clients and servers as long as they are all used from the same thread.
+    ///
+    /// @param buffer The buffer to attach. Use empty span (`{}`) to detach current buffer.
+    ///
+    void setSerializationBuffer(const cetl::span<cetl::byte> buffer) noexcept
+    {
+        serialization_buffer_ = buffer;
+    }
+
 private:
     friend class Presentation;  // NOLINT cppcoreguidelines-virtual-class-destructor
 
@@ -204,6 +226,10 @@ private:
     {
     }
 
+    // MARK: Data members:
+
+    cetl::span<cetl::byte> serialization_buffer_{};
+
 };  // Publisher<Message>
 
 /// @brief Defines a raw (aka untyped) publisher class.
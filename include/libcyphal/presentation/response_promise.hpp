@@ -29,6 +29,13 @@ namespace libcyphal
 namespace presentation
 {
 
+namespace detail
+{
+
+class ClientBase;
+
+}  // namespace detail
+
 /// @brief Defines terminal 'expired' error state of the response promise.
 ///
 /// See `response_deadline` parameter of the `Client::request` method,
@@ -109,7 +116,6 @@ public:
     ResponsePromiseBase(ResponsePromiseBase&& other) noexcept
         : CallbackNode{std::move(static_cast<CallbackNode&&>(other))}
         , shared_client_{std::exchange(other.shared_client_, nullptr)}
-        , request_time_{other.request_time_}
         , callback_fn_{std::move(other.callback_fn_)}
         , opt_result_{std::move(other.opt_result_)}
     {
@@ -153,33 +159,27 @@ public:
         return cetl::nullopt;
     }
 
-    /// @return Gets the time when the request was initiated.
-    ///
-    /// Useful to track the request-response latency, f.e. for implementing custom timeout/deadline handling like:
-    /// - by periodically polling result of the promise (using `getResult` or `fetchResult`)
-    /// - by also checking that `time_provider.now() - promise.getRequestTime()` within some limits.
-    ///
-    /// More simple approach is based on `response_deadline` parameter of the `Client::request` method, as well as
-    /// on the `setDeadline()` method of the promise itself - `Expired` result will be automatically delivered to
-    /// the callback (if any) as soon as deadline is reached (the same with `getResult`/`fetchResult` when called).
-    ///
-    TimePoint getRequestTime() const noexcept
-    {
-        return request_time_;
-    }
-
 protected:
     ResponsePromiseBase(detail::SharedClient* const shared_client,
                         const transport::TransferId transfer_id,
                         const TimePoint             response_deadline)
-        : CallbackNode{transfer_id, response_deadline}
+        : CallbackNode{transfer_id, shared_client->now(), response_deadline}
         , shared_client_{shared_client}
-        , request_time_{shared_client->now()}
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
         shared_client_->retainCallbackNode(*this);
     }
 
+    ResponsePromiseBase(detail::SharedClient* const          shared_client,
+                        detail::SharedClient::QueuedRequest& queued_request,
+                        const TimePoint                      response_deadline)
+        : CallbackNode{0 /* assigned on dispatch */, shared_client->now(), response_deadline}
+        , shared_client_{shared_client}
+    {
+        CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
+        shared_client_->retainQueuedCallbackNode(*this, queued_request);
+    }
+
     ~ResponsePromiseBase()
     {
         if (shared_client_ != nullptr)
@@ -188,10 +188,10 @@ protected:
         }
     }
 
-    cetl::pmr::memory_resource& memory() const noexcept
+    cetl::pmr::memory_resource& deserializationMemory() const noexcept
     {
         CETL_DEBUG_ASSERT(shared_client_ != nullptr, "");
-        return shared_client_->memory();
+        return shared_client_->deserializationMemory();
     }
 
     void acceptResult(Result&& result, const TimePoint approx_now)
@@ -246,7 +246,6 @@ private:
     // MARK: Data members:
 
     detail::SharedClient*       shared_client_;
-    const TimePoint             request_time_;
     typename Callback::Function callback_fn_;
     cetl::optional<Result>      opt_result_;
 
@@ -262,7 +261,7 @@ template <typename Response>
 class ResponsePromise final : public ResponsePromiseBase<Response, ResponsePromiseFailure>
 {
     using Base = ResponsePromiseBase<Response, ResponsePromiseFailure>;
-    using Base::memory;
+    using Base::deserializationMemory;
     using Base::acceptResult;
     using Base::acceptNewCallback;
     using Base::acceptNewDeadline;
@@ -294,6 +293,9 @@ public:
     ///
     /// Has no effect if the promise already has a result (either "success" or "expired").
     ///
+    /// If the request is still waiting in the client's queue (for a free transfer ID), then the promise
+    /// will expire not later than the request deadline, regardless of the new deadline.
+    ///
     /// @param deadline The future time point when the promise should be considered as expired.
     ///                 Use `TimePoint::max()` to disable the deadline. Anything in the past (less than `now`)
     ///                 will expire the promise very soon (on the next scheduler run). Default (initial) deadline
@@ -308,15 +310,14 @@ public:
     }
 
 private:
-    template <typename Request, typename Response_>
-    friend class Client;
+    friend class detail::ClientBase;
     using Base::Base;
 
     // MARK: CallbackNode
 
-    void onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) override
+    bool onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) override
     {
-        auto&   mr = memory();
+        auto&   mr = deserializationMemory();
         Success success{Response{typename Response::allocator_type{&mr}}, transfer.metadata};
         if (auto failure = detail::tryDeserializePayload(transfer.payload, mr, success.response))
         {
@@ -326,10 +327,11 @@ private:
                     acceptResult(error, approx_now);
                 },
                 *failure);
-            return;
+            return false;
         }
 
         acceptResult(std::move(success), approx_now);
+        return true;
     }
 
 };  // ResponsePromise<Response>
@@ -370,6 +372,9 @@ public:
     ///
     /// Has no effect if the promise already has a result (either "success" or "expired").
     ///
+    /// If the request is still waiting in the client's queue (for a free transfer ID), then the promise
+    /// will expire not later than the request deadline, regardless of the new deadline.
+    ///
     /// @param deadline The future time point when the promise should be considered as expired.
     ///                 Use `TimePoint::max()` to disable the deadline. Anything in the past (less than `now`)
     ///                 will expire the promise very soon (on the next scheduler run). Default (initial) deadline
@@ -384,14 +389,15 @@ public:
     }
 
 private:
-    friend class RawServiceClient;
+    friend class detail::ClientBase;
     using Base::Base;
 
     // MARK: CallbackNode
 
-    void onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) override
+    bool onResponseRxTransfer(transport::ServiceRxTransfer& transfer, const TimePoint approx_now) override
     {
         acceptResult(Success{std::move(transfer.payload), transfer.metadata}, approx_now);
+        return true;
     }
 
 };  // ResponsePromise<void>
@@ -126,6 +126,11 @@ protected:
         return impl_.memory();
     }
 
+    cetl::pmr::memory_resource& deserializationMemory() const noexcept
+    {
+        return impl_.deserializationMemory();
+    }
+
     template <typename Request>
     bool tryDeserialize(const transport::ScatteredBuffer& buffer, Request& request)
     {
@@ -203,6 +208,24 @@ public:
         on_request_cb_fn_ = std::move(on_request_cb_fn);
     }
 
+    /// @brief Attaches a persistent serialization buffer to this server.
+    ///
+    /// By default, a response larger than `config::Presentation::SmallPayloadSize` is serialized into a temporary
+    /// PMR allocated buffer on every response continuation call. If the attached buffer is big enough to fit
+    /// the serialized response, serialization is done directly into it, so steady-state operation does no allocations.
+    /// A buffer which is too small is ignored, and PMR is in use instead.
+    ///
+    /// The buffer memory is owned by the user, and it must outlive this server.
+    /// The buffer is in use only during the serialization and sending, so the same buffer can be shared
+    /// by several publishers, clients and servers as long as they are all used from the same thread.
+    ///
+    /// @param buffer The buffer to attach. Use empty span (`{}`) to detach current buffer.
+    ///
+    void setSerializationBuffer(const cetl::span<cetl::byte> buffer) noexcept
+    {
+        serialization_buffer_ = buffer;
+    }
+
 private:
     friend class Presentation;
 
@@ -222,7 +245,8 @@ private:
         // Try to deserialize the strong-typed request from raw bytes.
         // We just drop it if deserialization fails.
         //
-        Request request{typename Request::allocator_type{&memory()}};
+        // The request (and so its deserialization memory) lives only until the callback returns.
+        Request request{typename Request::allocator_type{&deserializationMemory()}};
         if (!tryDeserialize(rx_transfer.payload, request))
         {
             return;
@@ -244,6 +268,7 @@ private:
                     return detail::tryPerformOnSerialized<Response, Result, BufferSize, IsOnStack>(  //
                         response,
                         memory(),
+                        serialization_buffer_,
                         [this, base_metadata, client_node_id, deadline](const auto serialized_fragments) -> Result {
                             //
                             const transport::ServiceTxMetadata tx_metadata{{base_metadata, deadline}, client_node_id};
@@ -259,6 +284,7 @@ private:
     // MARK: Data members:
 
     typename OnRequestCallback::Function on_request_cb_fn_;
+    cetl::span<cetl::byte>               serialization_buffer_{};
 
 };  // Server<Request, Response>
 
@@ -7,7 +7,9 @@
 #define LIBCYPHAL_PRESENTATION_SERVER_IMPL_HPP_INCLUDED
 
 #include "common_helpers.hpp"
+#include "presentation_delegate.hpp"
 
+#include "libcyphal/common/cavl/cavl.hpp"
 #include "libcyphal/time_provider.hpp"
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/scattered_buffer.hpp"
@@ -18,6 +20,7 @@
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstdint>
 #include <utility>
 
 namespace libcyphal
@@ -31,9 +34,18 @@ namespace presentation
 namespace detail
 {
 
-class ServerImpl final
+/// Implementation of a RPC server.
+///
+/// Unlike shared publisher, subscriber and client implementations, the server one is not shared - it's owned
+/// (and moved around) by its server object. Still, the presentation layer keeps track of all alive servers
+/// (so that their ports could be introspected, see `Presentation::forEachPort`) - hence the tree node base.
+///
+class ServerImpl final : public common::cavl::Node<ServerImpl>
 {
 public:
+    using Node::isLinked;
+    using Node::remove;
+
     class Callback
     {
     public:
@@ -51,12 +63,14 @@ public:
 
     };  // Callback
 
-    ServerImpl(cetl::pmr::memory_resource&              memory,
+    ServerImpl(IPresentationDelegate&                   delegate,
                ITimeProvider&                           time_provider,
+               const transport::PortId                  service_id,
                UniquePtr<transport::IRequestRxSession>  svc_req_rx_session,
                UniquePtr<transport::IResponseTxSession> svc_res_tx_session)
-        : memory_{memory}
+        : delegate_{delegate}
         , time_provider_{time_provider}
+        , service_id_{service_id}
         , svc_req_rx_session_{std::move(svc_req_rx_session)}
         , svc_res_tx_session_{std::move(svc_res_tx_session)}
     {
@@ -64,6 +78,31 @@ public:
         CETL_DEBUG_ASSERT(svc_res_tx_session_ != nullptr, "");
     }
 
+    ServerImpl(ServerImpl&& other) noexcept = default;
+
+    ~ServerImpl()
+    {
+        // Moved-from server is not linked to the tree anymore (its new owner is).
+        if (isLinked())
+        {
+            delegate_.forgetServerImpl(*this);
+        }
+    }
+
+    ServerImpl(const ServerImpl& other)                = delete;
+    ServerImpl& operator=(const ServerImpl& other)     = delete;
+    ServerImpl& operator=(ServerImpl&& other) noexcept = delete;
+
+    CETL_NODISCARD transport::PortId getServiceId() const noexcept
+    {
+        return service_id_;
+    }
+
+    CETL_NODISCARD std::int32_t compareByServiceId(const transport::PortId service_id) const
+    {
+        return static_cast<std::int32_t>(service_id_) - static_cast<std::int32_t>(service_id);
+    }
+
     void setOnReceiveCallback(Callback& callback) const
     {
         CETL_DEBUG_ASSERT(svc_req_rx_session_ != nullptr, "");
@@ -84,19 +123,25 @@ public:
     template <typename Request>
     bool tryDeserialize(const transport::ScatteredBuffer& buffer, Request& request)
     {
-        return tryDeserializePayload(buffer, memory_, request) == cetl::nullopt;
+        return tryDeserializePayload(buffer, deserializationMemory(), request) == cetl::nullopt;
     }
 
     CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
     {
-        return memory_;
+        return delegate_.memory();
+    }
+
+    CETL_NODISCARD cetl::pmr::memory_resource& deserializationMemory() const noexcept
+    {
+        return delegate_.deserializationMemory();
     }
 
 private:
     // MARK: Data members:
 
-    cetl::pmr::memory_resource&              memory_;
+    IPresentationDelegate&                   delegate_;
     ITimeProvider&                           time_provider_;
+    const transport::PortId                  service_id_;
     UniquePtr<transport::IRequestRxSession>  svc_req_rx_session_;
     UniquePtr<transport::IResponseTxSession> svc_res_tx_session_;
 
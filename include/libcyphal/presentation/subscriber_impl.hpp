@@ -199,6 +199,11 @@ public:
         return time_provider_.now();
     }
 
+    CETL_NODISCARD transport::PortId getSubjectId() const noexcept
+    {
+        return subject_id_;
+    }
+
     CETL_NODISCARD std::int32_t compareBySubjectId(const transport::PortId subject_id) const
     {
         return static_cast<std::int32_t>(subject_id_) - static_cast<std::int32_t>(subject_id);
@@ -278,7 +283,9 @@ private:
         }
 
         next_cb_node_ = callback_nodes_.min();
-        CallbackNode::Deserializer::Context context{delegate_.memory(),
+        // A deserialized message lives only until all its subscribers have been called back, so an attached
+        // deserialization arena (if any) is rewound on every dispatch - see `DeserializationArena` for details.
+        CallbackNode::Deserializer::Context context{delegate_.deserializationMemory(),
                                                     time_provider_.now(),
                                                     arg.transfer.payload,
                                                     arg.transfer.metadata,
@@ -0,0 +1,290 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_BRIDGE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_BRIDGE_HPP_INCLUDED
+
+#include "errors.hpp"
+#include "msg_sessions.hpp"
+#include "scattered_buffer.hpp"
+#include "statistics.hpp"
+#include "transport.hpp"
+#include "types.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines a transport level bridge, which forwards messages of selected subjects from one transport to another.
+///
+/// Every subject added to the bridge gets a raw message RX session on the source transport,
+/// and a message TX session on the target one. Received transfers are forwarded as is - without any DSDL
+/// deserialization and serialization - fragments of the received payload are passed straight to the target
+/// TX session (see `ScatteredBuffer::observeFragments`). Only payloads made of more than
+/// `config::Transport::Bridge_MaxFragments` fragments (or payloads whose storage can't expose its fragments)
+/// are gathered into a temporary buffer first.
+///
+/// Priority of a forwarded transfer is the same as the received one. Transfer IDs are not forwarded though -
+/// on the target transport the bridge is the publisher (with its own local node ID), so it numbers transfers of every
+/// subject sequentially (like a regular publisher does), and the target transport takes them modulo its own
+/// transfer ID modulo. This is what makes forwarding from CAN (with its 2^5 modulo, and with possibly multiple
+/// publishers of the same subject) to UDP (with its practically unbounded modulo) and back correct.
+///
+/// The consequence of such renumbering is that the source publishers' identity is lost: on the target transport
+/// all publishers of a subject are merged into the single one - the bridge (under its node ID), and their
+/// transfers are interleaved into one sequence. So subjects which are meaningful per publisher must not be bridged -
+/// f.e. forwarded `Heartbeat`s of several CAN nodes would look as heartbeats of the bridge node only (with its
+/// health and mode flipping between theirs), and the nodes themselves would be invisible on the target transport.
+///
+/// Transmission deadline of a forwarded transfer is its reception timestamp plus the TX timeout.
+///
+/// The bridge is unidirectional. Two bridges (with swapped transports) make a bidirectional gateway,
+/// but the same subject must not be forwarded in both directions - otherwise its messages would loop forever.
+/// Both transports must outlive the bridge. The bridge is not movable b/c its sessions refer back to it.
+///
+class Bridge final
+{
+public:
+    Bridge(cetl::pmr::memory_resource& memory, ITransport& source, ITransport& target)
+        : memory_{memory}
+        , source_{source}
+        , target_{target}
+        , tx_timeout_{std::chrono::seconds{1}}
+        , routes_{&memory}
+    {
+    }
+
+    ~Bridge()                            = default;
+    Bridge(const Bridge&)                = delete;
+    Bridge(Bridge&&) noexcept            = delete;
+    Bridge& operator=(const Bridge&)     = delete;
+    Bridge& operator=(Bridge&&) noexcept = delete;
+
+    /// @brief Starts forwarding messages of the given subject.
+    ///
+    /// @param subject_id The subject to forward. It must not be already forwarded by this bridge.
+    /// @param extent_bytes The max payload size which is accepted by the source RX session.
+    ///                     Bigger payloads are truncated (by the source transport) to this size.
+    /// @return `nullopt` on success; otherwise a failure of making the sessions (or the `ArgumentError`
+    ///         if the subject is already forwarded).
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> addSubject(const PortId subject_id, const std::size_t extent_bytes)
+    {
+        const Route* const begin = routes_.data();
+        if (std::any_of(begin, begin + routes_.size(), [subject_id](const Route& route) {
+                return route.subject_id == subject_id;
+            }))
+        {
+            return ArgumentError{};
+        }
+
+        if (routes_.size() == routes_.capacity())
+        {
+            routes_.reserve(std::max<std::size_t>(routes_.capacity() * 2, 4));
+            if (routes_.size() == routes_.capacity())
+            {
+                return MemoryError{};
+            }
+        }
+
+        auto maybe_tx_session = target_.makeMessageTxSession({subject_id});
+        if (auto* const failure = cetl::get_if<AnyFailure>(&maybe_tx_session))
+        {
+            return std::move(*failure);
+        }
+        auto maybe_rx_session = source_.makeMessageRxSession({extent_bytes, subject_id});
+        if (auto* const failure = cetl::get_if<AnyFailure>(&maybe_rx_session))
+        {
+            return std::move(*failure);
+        }
+
+        const std::size_t route_index = routes_.size();
+        routes_.push_back(Route{subject_id,
+                                cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session)),
+                                cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session)),
+                                0});
+
+        // Routes are addressed by index (rather than by pointer) b/c the array might be reallocated later.
+        routes_[route_index].rx_session->setOnReceiveCallback(
+            [this, route_index](const IMessageRxSession::OnReceiveCallback::Arg& arg) {
+                //
+                forward(routes_[route_index], arg.transfer);
+            });
+        return cetl::nullopt;
+    }
+
+    /// @brief Sets timeout of forwarded transfers, which is counted from their reception timestamps.
+    ///
+    /// Default is 1 second.
+    ///
+    void setTxTimeout(const Duration tx_timeout) noexcept
+    {
+        tx_timeout_ = tx_timeout;
+    }
+
+    /// @brief Gets number of forwarded subjects.
+    ///
+    CETL_NODISCARD std::size_t getSubjectsCount() const noexcept
+    {
+        return routes_.size();
+    }
+
+    /// @brief Gets forwarding statistics.
+    ///
+    /// `num_received` counts transfers received from the source transport, and `num_emitted` - those which were
+    /// successfully sent to the target one. Failures to send (f.e. because of a full TX queue) are counted by
+    /// `num_errored` (and `num_overruns`) - such transfers are dropped.
+    ///
+    CETL_NODISCARD IoStatistics getStatistics() const noexcept
+    {
+        return counters_.snapshot();
+    }
+
+private:
+    using Fragments = std::array<cetl::span<const cetl::byte>, config::Transport::Bridge_MaxFragments()>;
+
+    struct Route final
+    {
+        PortId                       subject_id;
+        UniquePtr<IMessageRxSession> rx_session;
+        UniquePtr<IMessageTxSession> tx_session;
+        TransferId                   transfer_id;
+    };
+
+    /// Collects fragments of a payload (up to the `Fragments` capacity) without copying them.
+    ///
+    class FragmentsCollector final : public ScatteredBuffer::IFragmentsObserver
+    {
+    public:
+        FragmentsCollector()
+            : fragments_{}
+            , count_{0}
+            , size_{0}
+            , is_complete_{true}
+        {
+        }
+
+        ~FragmentsCollector()                                        = default;
+        FragmentsCollector(const FragmentsCollector&)                = delete;
+        FragmentsCollector(FragmentsCollector&&) noexcept            = delete;
+        FragmentsCollector& operator=(const FragmentsCollector&)     = delete;
+        FragmentsCollector& operator=(FragmentsCollector&&) noexcept = delete;
+
+        /// `false` if there were more fragments than could be collected,
+        /// or the collected ones don't cover the whole payload of the given size.
+        ///
+        CETL_NODISCARD bool isComplete(const std::size_t payload_size) const noexcept
+        {
+            return is_complete_ && (size_ == payload_size);
+        }
+
+        CETL_NODISCARD PayloadFragments getFragments() const noexcept
+        {
+            return {fragments_.data(), count_};
+        }
+
+        // MARK: IFragmentsObserver
+
+        void onNext(const cetl::span<const cetl::byte> fragment) override
+        {
+            if (count_ < fragments_.size())
+            {
+                fragments_[count_++] = fragment;
+                size_ += fragment.size();
+                return;
+            }
+            is_complete_ = false;
+        }
+
+    private:
+        // MARK: Data members:
+
+        Fragments   fragments_;
+        std::size_t count_;
+        std::size_t size_;
+        bool        is_complete_;
+
+    };  // FragmentsCollector
+
+    void forward(Route& route, const MessageRxTransfer& transfer)
+    {
+        counters_.onReceived();
+
+        route.transfer_id += 1;
+        const TransferTxMetadata metadata{{route.transfer_id, transfer.metadata.rx_meta.base.priority},
+                                          transfer.metadata.rx_meta.timestamp + tx_timeout_};
+
+        // Fall back to gathering whenever the storage has no (or not all) fragments to expose.
+        FragmentsCollector collector;
+        const bool         is_observed = transfer.payload.observeFragments(collector);
+
+        const auto failure = (is_observed && collector.isComplete(transfer.payload.size()))
+                                 ? route.tx_session->send(metadata, collector.getFragments())
+                                 : sendGathered(*route.tx_session, metadata, transfer.payload);
+        if (failure.has_value())
+        {
+            counters_.onFailure(*failure);
+            return;
+        }
+        counters_.onEmitted();
+    }
+
+    /// Slow path for payloads with too many (or not observable) fragments -
+    /// gathers them into a temporary contiguous buffer.
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> sendGathered(IMessageTxSession&        tx_session,
+                                                           const TransferTxMetadata& metadata,
+                                                           const ScatteredBuffer&    payload)
+    {
+        const std::size_t payload_size = payload.size();
+        if (payload_size == 0)
+        {
+            return tx_session.send(metadata, {});
+        }
+
+        auto* const buffer = static_cast<cetl::byte*>(memory_.allocate(payload_size));
+        if (buffer == nullptr)
+        {
+            return MemoryError{};
+        }
+        (void) payload.copy(0, buffer, payload_size);
+
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{{{buffer, payload_size}}};
+        auto                                              failure = tx_session.send(metadata, fragments);
+
+        memory_.deallocate(buffer, payload_size);
+        return failure;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&        memory_;
+    ITransport&                        source_;
+    ITransport&                        target_;
+    Duration                           tx_timeout_;
+    detail::IoCounters                 counters_;
+    libcyphal::detail::VarArray<Route> routes_;
+
+};  // Bridge
+
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_BRIDGE_HPP_INCLUDED
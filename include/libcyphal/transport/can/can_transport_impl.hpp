@@ -19,6 +19,7 @@
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/lizard_helpers.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
 #include "libcyphal/transport/svc_sessions.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -62,7 +63,7 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
         explicit Spec() = default;
     };
 
-    /// @brief Defines private storage of a media index, its interface and TX queue.
+    /// @brief Defines private storage of a media index, its interface, TX queue and statistics counters.
     ///
     struct Media final
     {
@@ -104,6 +105,13 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
             canard_tx_queue_.mtu_bytes = interface_.getMtu();
         }
 
+        /// Counters are not part of the logical state of the media, so they are mutable.
+        ///
+        transport::detail::IoCounters& counters() const noexcept
+        {
+            return counters_;
+        }
+
     private:
         CETL_NODISCARD static CanardMemoryResource makeTxMemoryResource(IMedia& media_interface)
         {
@@ -117,11 +125,12 @@ class TransportImpl final : private TransportDelegate, public ICanTransport
                 media_interface.getTxMemoryResource());
         }
 
-        const std::uint8_t       index_;
-        IMedia&                  interface_;
-        CanardTxQueue            canard_tx_queue_;
-        IExecutor::Callback::Any rx_callback_;
-        IExecutor::Callback::Any tx_callback_;
+        const std::uint8_t                    index_;
+        IMedia&                               interface_;
+        CanardTxQueue                         canard_tx_queue_;
+        IExecutor::Callback::Any              rx_callback_;
+        IExecutor::Callback::Any              tx_callback_;
+        mutable transport::detail::IoCounters counters_;
 
     };  // Media
     using MediaArray = libcyphal::detail::VarArray<Media>;
@@ -268,6 +277,22 @@ private:
                               CANARD_NODE_ID_MAX + 1};
     }
 
+    CETL_NODISCARD IoStatistics getTransferStatistics() const noexcept override
+    {
+        return transfer_counters_.snapshot();
+    }
+
+    CETL_NODISCARD cetl::optional<IoStatistics> getMediaStatistics(
+        const std::uint8_t media_index) const noexcept override
+    {
+        if (media_index >= media_array_.size())
+        {
+            return cetl::nullopt;
+        }
+
+        return media_array_[media_index].counters().snapshot();
+    }
+
     CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
         const MessageRxParams& params) override
     {
@@ -321,6 +346,7 @@ private:
         const transport::detail::ContiguousPayload payload{memory(), payload_fragments};
         if ((payload.data() == nullptr) && (payload.size() > 0))
         {
+            transfer_counters_.onFailure(MemoryError{});
             return MemoryError{};
         }
 
@@ -345,6 +371,7 @@ private:
             {
                 // The handler (if any) just said that it's NOT fine to continue with pushing to other media TX queues,
                 // and the failure should not be ignored but propagated outside.
+                transfer_counters_.onFailure(*failure);
                 return failure;
             }
 
@@ -355,6 +382,7 @@ private:
             }
         }
 
+        transfer_counters_.onEmitted();
         return cetl::nullopt;
     }
 
@@ -474,6 +502,7 @@ private:
     void tryHandleTransientMediaFailure(const Media& media, MediaFailure&& media_failure)
     {
         auto failure = libcyphal::detail::upcastVariant<AnyFailure>(std::move(media_failure));
+        media.counters().onFailure(failure);
         (void) tryHandleTransientFailure<Report>(std::move(failure), media.index(), media.interface());
     }
 
@@ -485,6 +514,7 @@ private:
         {
             return cetl::nullopt;
         }
+        media.counters().onFailure(*failure);
 
         return tryHandleTransientFailure<Report>(std::move(*failure), media.index(), canardInstance());
     }
@@ -545,6 +575,7 @@ private:
         }
 
         const IMedia::PopResult::Metadata& pop_meta = pop_success.value();
+        media.counters().onReceived();
 
         const auto timestamp_us =
             std::chrono::duration_cast<std::chrono::microseconds>(pop_meta.timestamp.time_since_epoch());
@@ -560,9 +591,15 @@ private:
                                                     &out_transfer,
                                                     &out_subscription);
 
+        if (const auto rx_failure = optAnyFailureFromCanard(result))
+        {
+            transfer_counters_.onFailure(*rx_failure);
+        }
         (void) tryHandleTransientCanardResult<TransientErrorReport::CanardRxAccept>(media, result);
         if (result > 0)
         {
+            transfer_counters_.onReceived();
+
             CETL_DEBUG_ASSERT(out_subscription != nullptr, "Expected subscription.");
             CETL_DEBUG_ASSERT(out_subscription->user_reference != nullptr, "Expected session delegate.");
 
@@ -592,7 +629,11 @@ private:
 
         if (const auto* const push = cetl::get_if<IMedia::PushResult::Success>(&push_result))
         {
-            if (!push->is_accepted)
+            if (push->is_accepted)
+            {
+                media.counters().onEmitted();
+            }
+            else
             {
                 // Media has not accepted the frame, so we need return original payload back to the item,
                 // so that in the future potential retry could try to push it again.
@@ -787,12 +828,13 @@ private:
 
     // MARK: Data members:
 
-    IExecutor&            executor_;
-    MediaArray            media_array_;
-    std::size_t           total_msg_rx_ports_;
-    std::size_t           total_svc_rx_ports_;
-    TransientErrorHandler transient_error_handler_;
-    Callback::Any         configure_filters_callback_;
+    IExecutor&                    executor_;
+    MediaArray                    media_array_;
+    std::size_t                   total_msg_rx_ports_;
+    std::size_t                   total_svc_rx_ports_;
+    TransientErrorHandler         transient_error_handler_;
+    Callback::Any                 configure_filters_callback_;
+    transport::detail::IoCounters transfer_counters_;
 
 };  // TransportImpl
 
@@ -0,0 +1,169 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_CAPTURE_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_CAPTURE_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/pcapng.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines CAN media decorator which captures all frames passing through the inner media into pcapng.
+///
+/// Frames accepted by `push` are captured as outbound ones (timestamped by the current executor time),
+/// and frames returned by `pop` - as inbound ones (with their reception timestamps). Frames are written
+/// using the SocketCAN link type, so captures could be inspected by Wireshark, and replayed by `ReplayMedia`.
+/// Timestamps are the executor time points (since its epoch) in nanoseconds.
+///
+/// The capture interface is added to the writer on the very first captured frame.
+/// The writer must outlive the decorator, and the inner media must outlive the decorator.
+///
+class CaptureMedia final : public IMedia
+{
+public:
+    CaptureMedia(IExecutor& executor, IMedia& inner, pcapng::Writer& writer)
+        : executor_{executor}
+        , inner_{inner}
+        , writer_{writer}
+    {
+    }
+
+    ~CaptureMedia()                                  = default;
+    CaptureMedia(const CaptureMedia&)                = delete;
+    CaptureMedia(CaptureMedia&&) noexcept            = delete;
+    CaptureMedia& operator=(const CaptureMedia&)     = delete;
+    CaptureMedia& operator=(CaptureMedia&&) noexcept = delete;
+
+    // MARK: IMedia
+
+    std::size_t getMtu() const noexcept override
+    {
+        return inner_.getMtu();
+    }
+
+    cetl::optional<MediaFailure> setFilters(const Filters filters) noexcept override
+    {
+        return inner_.setFilters(filters);
+    }
+
+    PushResult::Type push(const TimePoint deadline, const CanId can_id, MediaPayload& payload) noexcept override
+    {
+        // Inner media might release the payload immediately, so we need a copy of it for capturing.
+        const auto                             payload_span = payload.getSpan();
+        const std::size_t                      payload_size = std::min(payload_span.size(), MaxPayloadSize);
+        std::array<cetl::byte, MaxPayloadSize> payload_copy{};
+        (void) std::memmove(payload_copy.data(), payload_span.data(), payload_size);
+
+        auto result = inner_.push(deadline, can_id, payload);
+        if (const auto* const success = cetl::get_if<PushResult::Success>(&result))
+        {
+            if (success->is_accepted)
+            {
+                capture(executor_.now(), pcapng::Direction::Outbound, can_id, {payload_copy.data(), payload_size});
+            }
+        }
+        return result;
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        auto result = inner_.pop(payload_buffer);
+        if (const auto* const success = cetl::get_if<PopResult::Success>(&result))
+        {
+            if (success->has_value())
+            {
+                const auto& metadata = **success;
+                capture(metadata.timestamp,
+                        pcapng::Direction::Inbound,
+                        metadata.can_id,
+                        payload_buffer.first(std::min(metadata.payload_size, payload_buffer.size())));
+            }
+        }
+        return result;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        return inner_.registerPushCallback(std::move(function));
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        return inner_.registerPopCallback(std::move(function));
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return inner_.getTxMemoryResource();
+    }
+
+private:
+    static constexpr std::size_t MaxPayloadSize = pcapng::SocketCan::FdPayloadSize;
+
+    void capture(const TimePoint                    timestamp,
+                 const pcapng::Direction            direction,
+                 const CanId                        can_id,
+                 const cetl::span<const cetl::byte> payload)
+    {
+        if (!interface_id_.has_value())
+        {
+            interface_id_ = writer_.addInterface(pcapng::LinkType::CanSocketCan,
+                                                 pcapng::SocketCan::HeaderSize + MaxPayloadSize);
+            if (!interface_id_.has_value())
+            {
+                return;
+            }
+        }
+
+        const bool is_fd  = (inner_.getMtu() > pcapng::SocketCan::ClassicPayloadSize) ||
+                           (payload.size() > pcapng::SocketCan::ClassicPayloadSize);
+        const auto header = pcapng::SocketCan::makeHeader(can_id, payload.size(), is_fd);
+
+        static constexpr std::array<cetl::byte, MaxPayloadSize> Padding{};
+
+        const std::array<cetl::span<const cetl::byte>, 3> fragments{
+            {header, payload, {Padding.data(), pcapng::SocketCan::getPaddingSize(payload.size(), is_fd)}}};
+
+        (void) writer_.writePacket(*interface_id_,
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()),
+                                   direction,
+                                   fragments);
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                    executor_;
+    IMedia&                       inner_;
+    pcapng::Writer&               writer_;
+    cetl::optional<std::uint32_t> interface_id_;
+
+};  // CaptureMedia
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_CAPTURE_MEDIA_HPP_INCLUDED
@@ -105,6 +105,15 @@ public:
             return bytes_to_copy;
         }
 
+        bool observeFragments(ScatteredBuffer::IFragmentsObserver& observer) const override
+        {
+            if ((buffer_ != nullptr) && (payload_size_ > 0))
+            {
+                observer.onNext({buffer_, payload_size_});
+            }
+            return true;
+        }
+
     private:
         // MARK: Data members:
 
@@ -0,0 +1,212 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_IMPAIRED_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_IMPAIRED_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/impairment.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines CAN media decorator which applies network impairments to frames received by the inner media.
+///
+/// Drop, delay (fixed and jittered), reorder and duplication models are applied on the receive path only;
+/// transmission is forwarded to the inner media as is. To impair both directions of a link, decorate media
+/// on both of its ends. If impairments are disabled, the decorator just forwards all calls to the inner media.
+///
+/// The decorator must outlive the transport which uses it, and the inner media must outlive the decorator.
+///
+class ImpairedMedia final : public IMedia
+{
+public:
+    ImpairedMedia(IExecutor& executor, IMedia& inner, const Impairments& impairments)
+        : executor_{executor}
+        , inner_{inner}
+        , queue_{impairments, counters_}
+        , pop_callback_{executor}
+    {
+    }
+
+    ~ImpairedMedia()                                   = default;
+    ImpairedMedia(const ImpairedMedia&)                = delete;
+    ImpairedMedia(ImpairedMedia&&) noexcept            = delete;
+    ImpairedMedia& operator=(const ImpairedMedia&)     = delete;
+    ImpairedMedia& operator=(ImpairedMedia&&) noexcept = delete;
+
+    /// @brief Gets counters of what impairments have been applied so far.
+    ///
+    CETL_NODISCARD const ImpairmentCounters& getCounters() const noexcept
+    {
+        return counters_;
+    }
+
+    // MARK: IMedia
+
+    std::size_t getMtu() const noexcept override
+    {
+        return inner_.getMtu();
+    }
+
+    cetl::optional<MediaFailure> setFilters(const Filters filters) noexcept override
+    {
+        return inner_.setFilters(filters);
+    }
+
+    PushResult::Type push(const TimePoint deadline, const CanId can_id, MediaPayload& payload) noexcept override
+    {
+        return inner_.push(deadline, can_id, payload);
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        if (!queue_.isEnabled())
+        {
+            auto result = inner_.pop(payload_buffer);
+            if (const auto* const success = cetl::get_if<PopResult::Success>(&result))
+            {
+                if (success->has_value())
+                {
+                    queue_.onPassed();
+                }
+            }
+            return result;
+        }
+
+        if (pending_failure_.has_value())
+        {
+            MediaFailure failure = std::move(*pending_failure_);
+            pending_failure_.reset();
+            return failure;
+        }
+
+        const auto now   = executor_.now();
+        auto       frame = queue_.popDue(now);
+        scheduleDueFrames(now);
+        if (!frame.has_value())
+        {
+            return cetl::nullopt;
+        }
+        if (frame->payload_size > payload_buffer.size())
+        {
+            return ArgumentError{};
+        }
+        (void) std::memmove(payload_buffer.data(), frame->payload.data(), frame->payload_size);
+        return PopResult::Metadata{frame->timestamp, frame->can_id, frame->payload_size};
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        return inner_.registerPushCallback(std::move(function));
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        if (!queue_.isEnabled())
+        {
+            return inner_.registerPopCallback(std::move(function));
+        }
+
+        auto inner_registration = inner_.registerPopCallback([this](const auto&) {
+            //
+            receiveInnerFrames();
+        });
+        return pop_callback_.registerCallback(std::move(function), std::move(inner_registration));
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return inner_.getTxMemoryResource();
+    }
+
+private:
+    static constexpr std::size_t MaxDelayedFrames = config::Transport::Can::ImpairedMedia_MaxDelayedFrames();
+    static constexpr std::size_t MaxPayloadSize   = 64;  // CAN FD
+
+    struct Frame
+    {
+        TimePoint                              timestamp;
+        CanId                                  can_id;
+        std::size_t                            payload_size;
+        std::array<cetl::byte, MaxPayloadSize> payload;
+    };
+
+    /// Moves all frames which are currently available at the inner media into the impairment queue.
+    ///
+    void receiveInnerFrames()
+    {
+        const auto now = executor_.now();
+        while (!pending_failure_.has_value())
+        {
+            Frame frame{};
+            auto  result = inner_.pop(frame.payload);
+            if (auto* const failure = cetl::get_if<MediaFailure>(&result))
+            {
+                // Failure will be reported to the transport on its next pop attempt.
+                pending_failure_.emplace(std::move(*failure));
+                pop_callback_.scheduleAt(now);
+                return;
+            }
+
+            const auto& success = cetl::get<PopResult::Success>(result);
+            if (!success.has_value())
+            {
+                break;
+            }
+            frame.timestamp    = success->timestamp;
+            frame.can_id       = success->can_id;
+            frame.payload_size = success->payload_size;
+            queue_.admit(std::move(frame), now, [](const Frame& original) { return cetl::optional<Frame>{original}; });
+        }
+        scheduleDueFrames(now);
+    }
+
+    /// Schedules the transport's "ready to pop" callback at the time when the next delayed frame becomes due.
+    ///
+    void scheduleDueFrames(const TimePoint now)
+    {
+        if (const auto due_time = queue_.getNextDueTime())
+        {
+            pop_callback_.scheduleAt(std::max(*due_time, now));
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                                                  executor_;
+    IMedia&                                                     inner_;
+    ImpairmentCounters                                          counters_;
+    transport::detail::ImpairmentQueue<Frame, MaxDelayedFrames> queue_;
+    transport::detail::ImpairmentCallback                       pop_callback_;
+    cetl::optional<MediaFailure>                                pending_failure_;
+
+};  // ImpairedMedia
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_IMPAIRED_MEDIA_HPP_INCLUDED
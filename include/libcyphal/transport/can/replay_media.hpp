@@ -0,0 +1,234 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_REPLAY_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_REPLAY_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/impairment.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/pcapng.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines CAN media which feeds frames of a pcapng capture back into a transport.
+///
+/// All inbound (and direction-less) SocketCAN frames of the capture are delivered by `pop` - either at their
+/// recorded time (relative to the very first frame, and starting from the moment of the "ready to pop" callback
+/// registration), or as fast as the transport consumes them. The latter is handy as a benchmark of the RX path
+/// on real traffic. Outbound frames of the capture (f.e. made by `CaptureMedia::push`) are skipped.
+///
+/// Pushed frames are accepted and discarded. Filters are not applied - frames of the capture were already
+/// filtered by the media of the capturing node (and the transport filters received frames anyway).
+///
+/// The capture memory must outlive the media.
+///
+class ReplayMedia final : public IMedia
+{
+public:
+    struct Options
+    {
+        /// How frames are fed back into the transport.
+        pcapng::ReplayMode mode{pcapng::ReplayMode::AsFastAsPossible};
+
+        /// MTU reported to the transport; so it's Classic CAN by default.
+        std::size_t mtu{pcapng::SocketCan::ClassicPayloadSize};
+    };
+
+    ReplayMedia(IExecutor&                         executor,
+                cetl::pmr::memory_resource&        tx_memory,
+                const cetl::span<const cetl::byte> capture,
+                const Options&                     options)
+        : executor_{executor}
+        , tx_memory_{tx_memory}
+        , mtu_{options.mtu}
+        , reader_{capture}
+        , timeline_{options.mode}
+        , pop_callback_{executor}
+        , next_frame_{readNextFrame()}
+        , frames_count_{0}
+    {
+    }
+
+    ~ReplayMedia()                                 = default;
+    ReplayMedia(const ReplayMedia&)                = delete;
+    ReplayMedia(ReplayMedia&&) noexcept            = delete;
+    ReplayMedia& operator=(const ReplayMedia&)     = delete;
+    ReplayMedia& operator=(ReplayMedia&&) noexcept = delete;
+
+    /// @brief Gets whether all frames of the capture have been delivered.
+    ///
+    CETL_NODISCARD bool isFinished() const noexcept
+    {
+        return !next_frame_.has_value();
+    }
+
+    /// @brief Gets total number of frames delivered so far (including previous rounds of replay).
+    ///
+    CETL_NODISCARD std::uint64_t getFramesCount() const noexcept
+    {
+        return frames_count_;
+    }
+
+    /// @brief Starts replay of the capture again from its very beginning.
+    ///
+    void restart()
+    {
+        reader_.rewind();
+        next_frame_ = readNextFrame();
+        timeline_.stop();
+        startTimeline();
+    }
+
+    // MARK: IMedia
+
+    std::size_t getMtu() const noexcept override
+    {
+        return mtu_;
+    }
+
+    cetl::optional<MediaFailure> setFilters(const Filters) noexcept override
+    {
+        return cetl::nullopt;
+    }
+
+    PushResult::Type push(const TimePoint, const CanId, MediaPayload& payload) noexcept override
+    {
+        if (payload.getSpan().size() > mtu_)
+        {
+            return ArgumentError{};
+        }
+        payload.reset();
+        return PushResult::Success{true};
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        if (!next_frame_.has_value())
+        {
+            return cetl::nullopt;
+        }
+
+        const auto now      = executor_.now();
+        const auto due_time = timeline_.getDueTime(next_frame_->timestamp, now);
+        if (due_time > now)
+        {
+            pop_callback_.scheduleAt(due_time);
+            return cetl::nullopt;
+        }
+
+        // The frame is consumed even if it doesn't fit - otherwise replay would get stuck on it.
+        const auto frame = *next_frame_;
+        next_frame_      = readNextFrame();
+        scheduleNextFrame(now);
+        if (frame.payload.size() > payload_buffer.size())
+        {
+            return ArgumentError{};
+        }
+
+        ++frames_count_;
+        (void) std::memmove(payload_buffer.data(), frame.payload.data(), frame.payload.size());
+        return PopResult::Metadata{due_time, frame.can_id, frame.payload.size()};
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        // Pushed frames are always accepted, so there is no need to ever notify the transport.
+        return executor_.registerCallback(std::move(function));
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        auto callback = pop_callback_.registerCallback(std::move(function), IExecutor::Callback::Any{});
+        startTimeline();
+        return callback;
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return tx_memory_;
+    }
+
+private:
+    struct Frame
+    {
+        std::chrono::nanoseconds     timestamp;
+        CanId                        can_id;
+        cetl::span<const cetl::byte> payload;
+    };
+
+    cetl::optional<Frame> readNextFrame() noexcept
+    {
+        while (const auto packet = reader_.next())
+        {
+            if ((packet->link_type != pcapng::LinkType::CanSocketCan) ||
+                (packet->direction == pcapng::Direction::Outbound))
+            {
+                continue;
+            }
+            if (const auto frame = pcapng::SocketCan::parse(packet->data))
+            {
+                return Frame{packet->timestamp, frame->can_id, frame->payload};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void startTimeline()
+    {
+        const auto now = executor_.now();
+        if (next_frame_.has_value())
+        {
+            timeline_.start(now, next_frame_->timestamp);
+        }
+        scheduleNextFrame(now);
+    }
+
+    void scheduleNextFrame(const TimePoint now)
+    {
+        if (next_frame_.has_value())
+        {
+            pop_callback_.scheduleAt(std::max(timeline_.getDueTime(next_frame_->timestamp, now), now));
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                            executor_;
+    cetl::pmr::memory_resource&           tx_memory_;
+    const std::size_t                     mtu_;
+    pcapng::Reader                        reader_;
+    pcapng::detail::ReplayTimeline        timeline_;
+    transport::detail::ImpairmentCallback pop_callback_;
+    cetl::optional<Frame>                 next_frame_;
+    std::uint64_t                         frames_count_;
+
+};  // ReplayMedia
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_REPLAY_MEDIA_HPP_INCLUDED
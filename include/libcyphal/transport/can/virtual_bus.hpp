@@ -0,0 +1,769 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_CAN_VIRTUAL_BUS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_CAN_VIRTUAL_BUS_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace can
+{
+
+/// @brief Defines an in-process simulated CAN bus.
+///
+/// The bus connects several `VirtualBus::Media` instances (and so several CAN transports) within the same process,
+/// and models the following aspects of a physical CAN bus:
+/// - ID-based arbitration - among all pending TX mailboxes of all media, the frame with the lowest CAN ID wins;
+/// - bus bitrate - duration of every frame is estimated from its length (including bit stuffing and, for CAN FD,
+///   the data phase bitrate), and the bus is busy for that long;
+/// - limited number of TX mailboxes per media - a media which has all its mailboxes occupied doesn't accept
+///   frames (so the transport keeps them in its own TX queue), which exposes priority inversion issues;
+/// - limited RX FIFO per media, and acceptance filters.
+///
+/// All timing is driven by the given executor, so the bus runs against a virtual clock if the executor is
+/// a virtual time one - deterministically, and faster than real time.
+///
+class VirtualBus final
+{
+public:
+    /// @brief Defines configuration of the bus.
+    ///
+    struct Config
+    {
+        /// Nominal (arbitration phase) bitrate in bits per second.
+        std::uint32_t nominal_bitrate;
+
+        /// Data phase bitrate in bits per second. In use only for CAN FD frames with bit rate switch.
+        std::uint32_t data_bitrate;
+
+        /// Whether the worst-case number of stuff bits is included into the frame duration.
+        /// Otherwise, only fixed stuff bits (of CAN FD CRC field) are counted - which is the best case.
+        bool worst_case_stuffing;
+    };
+
+    /// @brief Defines statistics of the bus.
+    ///
+    struct Statistics
+    {
+        /// Total number of transmitted frames.
+        std::uint64_t frames;
+
+        /// Total time the bus was busy with transmission of frames.
+        std::chrono::nanoseconds busy_time;
+    };
+
+    class Media;
+
+    /// @brief Defines max payload size of a single CAN frame.
+    ///
+    static constexpr std::size_t MaxPayloadSize = 64;
+
+    /// @brief Defines payload size of Classic CAN frames.
+    ///
+    static constexpr std::size_t ClassicPayloadSize = 8;
+
+    VirtualBus(IExecutor& executor, const Config& config)
+        : executor_{executor}
+        , config_{config}
+        , media_list_{nullptr}
+        , transmitting_{nullptr, 0}
+        , busy_until_{0}
+        , statistics_{0, std::chrono::nanoseconds{0}}
+    {
+        CETL_DEBUG_ASSERT(config.nominal_bitrate > 0, "");
+        CETL_DEBUG_ASSERT(config.data_bitrate > 0, "");
+
+        bus_callback_ = executor_.registerCallback([this](const auto&) {
+            //
+            onBusEvent();
+        });
+    }
+
+    ~VirtualBus()
+    {
+        CETL_DEBUG_ASSERT(media_list_ == nullptr, "All media must be destroyed before the bus.");
+    }
+
+    VirtualBus(const VirtualBus&)                = delete;
+    VirtualBus(VirtualBus&&) noexcept            = delete;
+    VirtualBus& operator=(const VirtualBus&)     = delete;
+    VirtualBus& operator=(VirtualBus&&) noexcept = delete;
+
+    CETL_NODISCARD const Config& getConfig() const noexcept
+    {
+        return config_;
+    }
+
+    CETL_NODISCARD const Statistics& getStatistics() const noexcept
+    {
+        return statistics_;
+    }
+
+    /// @brief Rounds the given payload size up to the nearest valid CAN FD data length.
+    ///
+    CETL_NODISCARD static std::size_t roundUpToFdLength(const std::size_t payload_size) noexcept
+    {
+        constexpr std::array<std::size_t, 7> FdLengths{{12, 16, 20, 24, 32, 48, MaxPayloadSize}};
+        if (payload_size <= ClassicPayloadSize)
+        {
+            return payload_size;
+        }
+        return *std::lower_bound(FdLengths.cbegin(), FdLengths.cend() - 1, payload_size);
+    }
+
+    /// @brief Estimates duration of an extended ID data frame (including the interframe space).
+    ///
+    /// For Classic CAN frames the well known worst-case formula is used: `54 + 8n + 13 + (53 + 8n) / 4` bits,
+    /// where the last term is the max number of stuff bits. CAN FD frames consist of the arbitration phase
+    /// (at the nominal bitrate) and the data phase (at the data bitrate if bit rate switch is on) -
+    /// each phase is estimated separately, including the fixed stuff bits of the CRC field.
+    ///
+    /// @param config The bus configuration (bitrates & stuffing mode).
+    /// @param payload_size The payload size (in bytes). CAN FD payload is rounded up to a valid data length.
+    /// @param is_fd Whether the frame is CAN FD one.
+    /// @param bit_rate_switch Whether CAN FD frame uses bit rate switch.
+    ///
+    CETL_NODISCARD static std::chrono::nanoseconds getFrameDuration(const Config&     config,
+                                                                   const std::size_t payload_size,
+                                                                   const bool        is_fd,
+                                                                   const bool        bit_rate_switch) noexcept
+    {
+        const std::uint64_t stuffing = config.worst_case_stuffing ? 1U : 0U;
+
+        std::uint64_t nominal_bits = 0;
+        std::uint64_t data_bits    = 0;
+        if (!is_fd)
+        {
+            // SOF, ID (11 + 18), SRR, IDE, RTR, r1, r0, DLC, data and CRC are subject to stuffing;
+            // CRC delimiter, ACK (2), EOF (7) and IFS (3) are not.
+            const std::uint64_t stuffed = 54U + (8U * std::min(payload_size, ClassicPayloadSize));
+            nominal_bits                = stuffed + 13U + (stuffing * ((stuffed - 1U) / 4U));
+        }
+        else
+        {
+            const std::uint64_t data_length = roundUpToFdLength(payload_size);
+            const std::uint64_t crc_length  = (data_length <= 16U) ? 17U : 21U;
+
+            // Arbitration phase: SOF, ID (11 + 18), SRR, IDE, RRS, FDF, res and BRS (plus their stuff bits);
+            // and, at the end, ACK (2), EOF (7) and IFS (3).
+            constexpr std::uint64_t ArbitrationBits = 36U;
+            nominal_bits = ArbitrationBits + 12U + (stuffing * ((ArbitrationBits - 1U) / 4U));
+
+            // Data phase: ESI, DLC and data (plus their stuff bits); then stuff count (4), CRC with its fixed
+            // stuff bits (one per 4 bits), and CRC delimiter.
+            const std::uint64_t stuffed = 5U + (8U * data_length);
+            data_bits = stuffed + (stuffing * (stuffed / 4U)) + 4U + crc_length + ((4U + crc_length + 3U) / 4U) + 1U;
+            if (!bit_rate_switch)
+            {
+                nominal_bits += data_bits;
+                data_bits = 0;
+            }
+        }
+
+        constexpr std::uint64_t NanosPerSecond = 1000000000U;
+        return std::chrono::nanoseconds{
+            static_cast<std::int64_t>(((nominal_bits * NanosPerSecond) / config.nominal_bitrate) +
+                                      ((data_bits * NanosPerSecond) / config.data_bitrate))};
+    }
+
+private:
+    /// Defines a frame in a TX mailbox or in a RX FIFO.
+    ///
+    struct Frame
+    {
+        CanId                                  can_id;
+        std::size_t                            payload_size;
+        std::array<cetl::byte, MaxPayloadSize> payload;
+        bool                                   is_fd;
+        bool                                   bit_rate_switch;
+        TimePoint                              timestamp;  // Deadline of TX frames; reception time of RX frames.
+        std::uint64_t                          sequence;   // Order of pushing - to keep FIFO order of equal IDs.
+    };
+
+    /// Defines a transmitting frame - its media (if still alive) and mailbox index.
+    ///
+    struct Transmission
+    {
+        Media*      media;
+        std::size_t mailbox_index;
+    };
+
+    // MARK: Media list
+
+    void attach(Media& media) noexcept;
+    void detach(Media& media) noexcept;
+
+    // MARK: Bus events
+
+    void scheduleArbitration()
+    {
+        if (transmitting_.media == nullptr)
+        {
+            const auto result = bus_callback_.schedule(IExecutor::Callback::Schedule::Once{executor_.now()});
+            CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `bus_callback_`.");
+            (void) result;
+        }
+    }
+
+    /// Schedules bus event at the end of the current frame - rounded up to the executor's time resolution.
+    ///
+    void scheduleBusEndEvent()
+    {
+        const auto busy_until =
+            std::chrono::duration_cast<Duration>(busy_until_ + Duration{1} - std::chrono::nanoseconds{1});
+        const auto result = bus_callback_.schedule(IExecutor::Callback::Schedule::Once{TimePoint{busy_until}});
+        CETL_DEBUG_ASSERT(result, "Should not fail b/c we never reset `bus_callback_`.");
+        (void) result;
+    }
+
+    void onBusEvent();
+    void completeTransmission(const TimePoint now);
+    void arbitrate(const TimePoint now);
+
+    // MARK: Data members:
+
+    IExecutor&               executor_;
+    const Config             config_;
+    IExecutor::Callback::Any bus_callback_;
+    Media*                   media_list_;
+    Transmission             transmitting_;
+    std::chrono::nanoseconds busy_until_;
+    Statistics               statistics_;
+
+};  // VirtualBus
+
+// MARK: -
+
+/// @brief Defines CAN media which is attached to a virtual bus.
+///
+/// The media is attached to the bus for its whole lifetime, and it must outlive the transport which uses it.
+///
+class VirtualBus::Media final : public IMedia
+{
+public:
+    /// @brief Defines options of the media.
+    ///
+    struct Options
+    {
+        /// Initial MTU of the media - either 8 bytes (Classic CAN) or 64 bytes (CAN FD). See also `setMtu`.
+        std::size_t mtu;
+
+        /// Whether CAN FD frames use bit rate switch.
+        bool bit_rate_switch;
+
+        /// Number of TX mailboxes. Should be in the range [1, `VirtualBus_MaxMailboxes`].
+        std::size_t mailbox_count;
+
+        /// Capacity of RX FIFO. Should be in the range [1, `VirtualBus_MaxRxFifoCapacity`].
+        std::size_t rx_fifo_capacity;
+    };
+
+    /// @brief Defines statistics of the media.
+    ///
+    struct Statistics
+    {
+        /// Number of frames transmitted to the bus.
+        std::uint64_t tx_frames;
+
+        /// Number of TX frames which have been dropped from mailboxes due to their expired deadline.
+        std::uint64_t tx_expired;
+
+        /// Number of frames received (and accepted by filters) from the bus.
+        std::uint64_t rx_frames;
+
+        /// Number of received frames which have been dropped b/c RX FIFO was full.
+        std::uint64_t rx_overruns;
+    };
+
+    Media(VirtualBus& bus, cetl::pmr::memory_resource& tx_memory, const Options& options)
+        : bus_{bus}
+        , tx_memory_{tx_memory}
+        , mtu_{options.mtu}
+        , bit_rate_switch_{options.bit_rate_switch}
+        , mailbox_count_{std::min(std::max<std::size_t>(options.mailbox_count, 1U), MaxMailboxes)}
+        , mailboxes_{}
+        , mailbox_busy_{}
+        , rx_fifo_capacity_{std::min(std::max<std::size_t>(options.rx_fifo_capacity, 1U), MaxRxFifoCapacity)}
+        , rx_fifo_{}
+        , rx_fifo_head_{0}
+        , rx_fifo_size_{0}
+        , filters_{}
+        , filters_count_{0}
+        , accept_all_{true}
+        , push_sequence_{0}
+        , statistics_{0, 0, 0, 0}
+        , push_callback_{{}, {}, nullptr}
+        , pop_callback_{{}, {}, nullptr}
+        , next_{nullptr}
+    {
+        bus_.attach(*this);
+    }
+
+    ~Media()
+    {
+        CETL_DEBUG_ASSERT((push_callback_.handle == nullptr) && (pop_callback_.handle == nullptr),
+                          "Media must outlive its callback registrations.");
+        bus_.detach(*this);
+    }
+
+    Media(const Media&)                = delete;
+    Media(Media&&) noexcept            = delete;
+    Media& operator=(const Media&)     = delete;
+    Media& operator=(Media&&) noexcept = delete;
+
+    /// @brief Changes MTU of the media at runtime (f.e. switching between Classic CAN and CAN FD).
+    ///
+    /// The transport picks up new MTU with its next transfer. Frames which are already in mailboxes are not affected.
+    ///
+    void setMtu(const std::size_t mtu) noexcept
+    {
+        mtu_ = std::min(mtu, MaxPayloadSize);
+    }
+
+    CETL_NODISCARD const Statistics& getStatistics() const noexcept
+    {
+        return statistics_;
+    }
+
+    /// @brief Gets number of currently occupied TX mailboxes.
+    ///
+    CETL_NODISCARD std::size_t getBusyMailboxes() const noexcept
+    {
+        return static_cast<std::size_t>(std::count(mailbox_busy_.cbegin(), mailbox_busy_.cend(), true));
+    }
+
+    // MARK: IMedia
+
+    std::size_t getMtu() const noexcept override
+    {
+        return mtu_;
+    }
+
+    cetl::optional<MediaFailure> setFilters(const Filters filters) noexcept override
+    {
+        accept_all_    = filters.size() > filters_.size();
+        filters_count_ = accept_all_ ? 0 : filters.size();
+        std::copy_n(filters.begin(), filters_count_, filters_.begin());
+        return cetl::nullopt;
+    }
+
+    PushResult::Type push(const TimePoint deadline, const CanId can_id, MediaPayload& payload) noexcept override
+    {
+        const auto payload_span = payload.getSpan();
+        if (payload_span.size() > mtu_)
+        {
+            return ArgumentError{};
+        }
+
+        const auto mailboxes_end = mailbox_busy_.cbegin() + mailbox_count_;
+        const auto free_mailbox  = std::find(mailbox_busy_.cbegin(), mailboxes_end, false);
+        if (free_mailbox == mailboxes_end)
+        {
+            return PushResult::Success{false};
+        }
+        const auto index = static_cast<std::size_t>(free_mailbox - mailbox_busy_.cbegin());
+
+        Frame& frame          = mailboxes_[index];
+        frame.can_id          = can_id;
+        frame.payload_size    = payload_span.size();
+        frame.is_fd           = mtu_ > ClassicPayloadSize;
+        frame.bit_rate_switch = bit_rate_switch_;
+        frame.timestamp       = deadline;
+        frame.sequence        = push_sequence_++;
+        (void) std::memmove(frame.payload.data(), payload_span.data(), payload_span.size());
+        mailbox_busy_[index] = true;
+
+        // Payload is not needed anymore, so return memory asap.
+        payload.reset();
+
+        bus_.scheduleArbitration();
+        scheduleReadyCallbacks();
+        return PushResult::Success{true};
+    }
+
+    CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
+    {
+        if (rx_fifo_size_ == 0)
+        {
+            return cetl::nullopt;
+        }
+
+        const Frame& frame = rx_fifo_[rx_fifo_head_];
+        if (frame.payload_size > payload_buffer.size())
+        {
+            return ArgumentError{};
+        }
+        (void) std::memmove(payload_buffer.data(), frame.payload.data(), frame.payload_size);
+        const PopResult::Metadata metadata{frame.timestamp, frame.can_id, frame.payload_size};
+
+        rx_fifo_head_ = (rx_fifo_head_ + 1U) % rx_fifo_capacity_;
+        --rx_fifo_size_;
+
+        scheduleReadyCallbacks();
+        return metadata;
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPushCallback(IExecutor::Callback::Function&& function) override
+    {
+        return registerReadyCallback(push_callback_, std::move(function));
+    }
+
+    CETL_NODISCARD IExecutor::Callback::Any registerPopCallback(IExecutor::Callback::Function&& function) override
+    {
+        return registerReadyCallback(pop_callback_, std::move(function));
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return tx_memory_;
+    }
+
+private:
+    friend class VirtualBus;
+
+    static constexpr std::size_t MaxMailboxes      = config::Transport::Can::VirtualBus_MaxMailboxes();
+    static constexpr std::size_t MaxRxFifoCapacity = config::Transport::Can::VirtualBus_MaxRxFifoCapacity();
+    static constexpr std::size_t MaxFilters        = config::Transport::Can::VirtualBus_MaxFilters();
+
+    class CallbackHandle;
+
+    /// Holds the transport's function, the actual callback (registered at the executor) which invokes it,
+    /// and the handle which currently controls them. The function is kept until the next registration
+    /// (b/c the handle might be dropped by the function itself - while it's still executing).
+    ///
+    struct ReadyCallback
+    {
+        IExecutor::Callback::Function function;
+        IExecutor::Callback::Any      callback;
+        CallbackHandle*               handle;
+    };
+
+    /// Represents a callback registration which is returned to the transport.
+    ///
+    /// The actual callback is owned by the media, so that the media could schedule it whenever it becomes ready
+    /// (to push or pop). The handle just forwards scheduling, and cancels the callback when the transport drops
+    /// the registration. A handle is detached (becomes no-op) if the callback is registered again.
+    ///
+    class CallbackHandle final : public IExecutor::Callback::Interface
+    {
+    public:
+        explicit CallbackHandle(ReadyCallback& ready_callback)
+            : ready_callback_{&ready_callback}
+        {
+            if (ready_callback.handle != nullptr)
+            {
+                ready_callback.handle->ready_callback_ = nullptr;
+            }
+            ready_callback.handle = this;
+        }
+
+        CallbackHandle(CallbackHandle&& other) noexcept
+            : ready_callback_{std::exchange(other.ready_callback_, nullptr)}
+        {
+            if (ready_callback_ != nullptr)
+            {
+                ready_callback_->handle = this;
+            }
+        }
+
+        ~CallbackHandle()
+        {
+            if (ready_callback_ != nullptr)
+            {
+                ready_callback_->handle = nullptr;
+                ready_callback_->callback.reset();
+            }
+        }
+
+        CallbackHandle(const CallbackHandle&)                = delete;
+        CallbackHandle& operator=(const CallbackHandle&)     = delete;
+        CallbackHandle& operator=(CallbackHandle&&) noexcept = delete;
+
+        // MARK: Callback::Interface
+
+        void schedule(const IExecutor::Callback::Schedule::Variant& schedule) override
+        {
+            if (ready_callback_ != nullptr)
+            {
+                (void) ready_callback_->callback.schedule(schedule);
+            }
+        }
+
+    private:
+        ReadyCallback* ready_callback_;
+
+    };  // CallbackHandle
+
+    IExecutor::Callback::Any registerReadyCallback(ReadyCallback&                  ready_callback,
+                                                   IExecutor::Callback::Function&& function)
+    {
+        ready_callback.function = std::move(function);
+        ready_callback.callback = bus_.executor_.registerCallback([this, &ready_callback](const auto& arg) {
+            //
+            onReadyCallback(ready_callback, arg);
+        });
+        IExecutor::Callback::Any handle{CallbackHandle{ready_callback}};
+        scheduleReadyCallbacks();
+        return handle;
+    }
+
+    /// Invokes the transport's function, and keeps polling it while the media is ready to push.
+    ///
+    /// A real media (like `poll`-ed socket) reports readiness to push for as long as it has room for a frame,
+    /// no matter whether the transport has anything to push - so the transport relies on being called again
+    /// once it has enqueued new frames. The media doesn't know about these, so if the function hasn't pushed
+    /// anything (while there is still a free mailbox), it's called again at the next executor tick.
+    ///
+    void onReadyCallback(ReadyCallback& ready_callback, const IExecutor::Callback::Arg& arg)
+    {
+        const std::size_t busy_before = getBusyMailboxes();
+        ready_callback.function(arg);
+        const std::size_t busy_after = getBusyMailboxes();
+
+        if ((&ready_callback == &push_callback_) && (push_callback_.handle != nullptr) &&
+            (busy_after <= busy_before) && (busy_after < mailbox_count_))
+        {
+            (void) push_callback_.callback.schedule(
+                IExecutor::Callback::Schedule::Once{bus_.executor_.now() + Duration{1}});
+        }
+    }
+
+    /// Emulates "level triggered" readiness of a real media (like `poll`-ed socket) -
+    /// callbacks are scheduled for as long as the media is ready to push or pop (see also `onReadyCallback`).
+    ///
+    void scheduleReadyCallbacks()
+    {
+        const IExecutor::Callback::Schedule::Once now{bus_.executor_.now()};
+        if (getBusyMailboxes() < mailbox_count_)
+        {
+            (void) push_callback_.callback.schedule(now);
+        }
+        if (rx_fifo_size_ > 0)
+        {
+            (void) pop_callback_.callback.schedule(now);
+        }
+    }
+
+    /// Finds the mailbox with the highest priority (the lowest CAN ID) frame.
+    ///
+    /// Also drops frames which deadline has already passed (unless the mailbox is in transmission).
+    ///
+    CETL_NODISCARD const Frame* findTopMailbox(const TimePoint now, std::size_t& out_index)
+    {
+        bool         has_expired = false;
+        const Frame* top         = nullptr;
+        for (std::size_t index = 0; index < mailbox_count_; ++index)
+        {
+            if (!mailbox_busy_[index])
+            {
+                continue;
+            }
+            const Frame& frame = mailboxes_[index];
+            if (frame.timestamp < now)
+            {
+                mailbox_busy_[index] = false;
+                ++statistics_.tx_expired;
+                has_expired = true;
+                continue;
+            }
+            if ((top == nullptr) || (frame.can_id < top->can_id) ||
+                ((frame.can_id == top->can_id) && (frame.sequence < top->sequence)))
+            {
+                top       = &frame;
+                out_index = index;
+            }
+        }
+        if (has_expired)
+        {
+            scheduleReadyCallbacks();
+        }
+        return top;
+    }
+
+    void completeTransmission(const std::size_t mailbox_index)
+    {
+        mailbox_busy_[mailbox_index] = false;
+        ++statistics_.tx_frames;
+        scheduleReadyCallbacks();
+    }
+
+    void receive(const Frame& frame, const TimePoint now)
+    {
+        if (!accept(frame.can_id))
+        {
+            return;
+        }
+        if (rx_fifo_size_ == rx_fifo_capacity_)
+        {
+            ++statistics_.rx_overruns;
+            return;
+        }
+
+        Frame& rx_frame    = rx_fifo_[(rx_fifo_head_ + rx_fifo_size_) % rx_fifo_capacity_];
+        rx_frame           = frame;
+        rx_frame.timestamp = now;
+        ++rx_fifo_size_;
+        ++statistics_.rx_frames;
+
+        scheduleReadyCallbacks();
+    }
+
+    CETL_NODISCARD bool accept(const CanId can_id) const noexcept
+    {
+        return accept_all_ || std::any_of(filters_.cbegin(),
+                                          filters_.cbegin() + filters_count_,
+                                          [can_id](const Filter& filter) {
+                                              return ((can_id ^ filter.id) & filter.mask) == 0;
+                                          });
+    }
+
+    // MARK: Data members:
+
+    VirtualBus&                          bus_;
+    cetl::pmr::memory_resource&          tx_memory_;
+    std::size_t                          mtu_;
+    bool                                 bit_rate_switch_;
+    const std::size_t                    mailbox_count_;
+    std::array<Frame, MaxMailboxes>      mailboxes_;
+    std::array<bool, MaxMailboxes>       mailbox_busy_;
+    const std::size_t                    rx_fifo_capacity_;
+    std::array<Frame, MaxRxFifoCapacity> rx_fifo_;
+    std::size_t                          rx_fifo_head_;
+    std::size_t                          rx_fifo_size_;
+    std::array<Filter, MaxFilters>       filters_;
+    std::size_t                          filters_count_;
+    bool                                 accept_all_;
+    std::uint64_t                        push_sequence_;
+    Statistics                           statistics_;
+    ReadyCallback                        push_callback_;
+    ReadyCallback                        pop_callback_;
+    Media*                               next_;
+
+};  // Media
+
+// MARK: - VirtualBus implementation:
+
+inline void VirtualBus::attach(Media& media) noexcept
+{
+    media.next_ = media_list_;
+    media_list_ = &media;
+}
+
+inline void VirtualBus::detach(Media& media) noexcept
+{
+    Media** link = &media_list_;
+    while (*link != &media)
+    {
+        CETL_DEBUG_ASSERT(*link != nullptr, "Media is not attached to the bus.");
+        link = &(*link)->next_;
+    }
+    *link = media.next_;
+
+    // The frame in transmission (if any) is lost together with its media - the bus just completes its time slot.
+    if (transmitting_.media == &media)
+    {
+        transmitting_.media = nullptr;
+        scheduleBusEndEvent();
+    }
+}
+
+inline void VirtualBus::onBusEvent()
+{
+    const TimePoint now = executor_.now();
+    if (transmitting_.media != nullptr)
+    {
+        completeTransmission(now);
+    }
+    arbitrate(now);
+}
+
+inline void VirtualBus::completeTransmission(const TimePoint now)
+{
+    Media&       sender = *transmitting_.media;
+    const Frame& frame  = sender.mailboxes_[transmitting_.mailbox_index];
+
+    // The frame is seen by all other media on the bus (but not by the sender itself).
+    for (Media* media = media_list_; media != nullptr; media = media->next_)
+    {
+        if (media != &sender)
+        {
+            media->receive(frame, now);
+        }
+    }
+
+    transmitting_.media = nullptr;
+    ++statistics_.frames;
+    sender.completeTransmission(transmitting_.mailbox_index);
+}
+
+inline void VirtualBus::arbitrate(const TimePoint now)
+{
+    // Bus is still busy (f.e. with a frame of already destroyed media) - arbitration will happen when it's free.
+    if (now.time_since_epoch() < std::chrono::duration_cast<Duration>(busy_until_))
+    {
+        scheduleBusEndEvent();
+        return;
+    }
+
+    // Every media offers its top priority mailbox; the lowest CAN ID wins the bus.
+    Media*       winner       = nullptr;
+    const Frame* winner_frame = nullptr;
+    std::size_t  winner_index = 0;
+    for (Media* media = media_list_; media != nullptr; media = media->next_)
+    {
+        std::size_t        index = 0;
+        const Frame* const frame = media->findTopMailbox(now, index);
+        if ((frame != nullptr) && ((winner_frame == nullptr) || (frame->can_id < winner_frame->can_id)))
+        {
+            winner       = media;
+            winner_frame = frame;
+            winner_index = index;
+        }
+    }
+    if (winner == nullptr)
+    {
+        return;
+    }
+
+    // Back-to-back frames follow each other precisely (in nanoseconds), even if the executor has
+    // only microsecond resolution - so that bus throughput is not affected by the rounding.
+    const auto frame_duration =
+        getFrameDuration(config_, winner_frame->payload_size, winner_frame->is_fd, winner_frame->bit_rate_switch);
+    const auto start = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()),  //
+                                busy_until_);
+    busy_until_      = start + frame_duration;
+    statistics_.busy_time += frame_duration;
+
+    transmitting_ = Transmission{winner, winner_index};
+    scheduleBusEndEvent();
+}
+
+}  // namespace can
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_CAN_VIRTUAL_BUS_HPP_INCLUDED
@@ -0,0 +1,436 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_IMPAIRMENT_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_IMPAIRMENT_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines a model of network impairments, which are applied to received frames by impaired media decorators.
+///
+/// All random decisions are made by a seeded pseudo-random generator, so the same seed (and the same sequence of
+/// received frames and their times) always gives the same outcome. Default (zero) values disable the impairments.
+///
+struct Impairments final
+{
+    /// Seed of the pseudo-random generator.
+    std::uint64_t seed{};
+
+    /// Probability (in the range [0, 1]) of a received frame to be dropped.
+    float drop_probability{};
+
+    /// Probability (in the range [0, 1]) of a received frame to be delivered twice.
+    float duplicate_probability{};
+
+    /// Fixed delay of every received frame.
+    Duration delay{};
+
+    /// Max additional random delay (uniformly distributed in the range [0, jitter]) of every received frame.
+    /// Note that jitter which is bigger than interval between frames reorders them as well.
+    Duration jitter{};
+
+    /// Probability (in the range [0, 1]) of a received frame to be held back for reordering.
+    float reorder_probability{};
+
+    /// Number of subsequent frames which are delivered ahead of a frame which is held back for reordering.
+    std::size_t reorder_window{};
+
+    /// Max time a frame could be held back for reordering (in case there are not enough subsequent frames).
+    Duration reorder_timeout{};
+
+    CETL_NODISCARD bool isEnabled() const noexcept
+    {
+        return (drop_probability > 0) || (duplicate_probability > 0) || (delay > Duration::zero()) ||
+               (jitter > Duration::zero()) || ((reorder_probability > 0) && (reorder_window > 0));
+    }
+};
+
+/// @brief Defines counters of what impairments have been applied to received frames.
+///
+struct ImpairmentCounters final
+{
+    /// Number of frames which were delivered (including duplicates).
+    std::uint64_t passed{};
+
+    /// Number of frames which were dropped by the drop probability model.
+    std::uint64_t dropped{};
+
+    /// Number of extra frame copies which were made by the duplicate probability model.
+    std::uint64_t duplicated{};
+
+    /// Number of frames which were delayed (by fixed delay and/or jitter).
+    std::uint64_t delayed{};
+
+    /// Number of frames which were held back by the reorder model.
+    std::uint64_t reordered{};
+
+    /// Number of frames which were dropped b/c there was no more room to keep delayed frames.
+    std::uint64_t overflows{};
+};
+
+/// Internal implementation details.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Implements the impairments model over a fixed capacity queue of delayed frames.
+///
+/// Counters are kept outside of the queue, so that several queues (f.e. of different UDP RX sockets)
+/// could share them.
+///
+/// @tparam Frame Type of the frame. Should be default constructible, movable, and have `timestamp` field.
+/// @tparam Capacity Max number of frames which could be delayed at the same time.
+///
+template <typename Frame, std::size_t Capacity>
+class ImpairmentQueue final
+{
+public:
+    ImpairmentQueue(const Impairments& impairments, ImpairmentCounters& counters)
+        : impairments_{impairments}
+        , is_enabled_{impairments.isEnabled()}
+        , drop_threshold_{toThreshold(impairments.drop_probability)}
+        , duplicate_threshold_{toThreshold(impairments.duplicate_probability)}
+        , reorder_threshold_{toThreshold(impairments.reorder_probability)}
+        , prng_state_{(impairments.seed != 0) ? impairments.seed : DefaultSeed}
+        , entries_{}
+        , size_{0}
+        , sequence_{0}
+        , counters_{counters}
+    {
+    }
+
+    CETL_NODISCARD bool isEnabled() const noexcept
+    {
+        return is_enabled_;
+    }
+
+    /// @brief Counts a frame which has been delivered without going through the queue (when disabled).
+    ///
+    void onPassed() noexcept
+    {
+        ++counters_.passed;
+    }
+
+    /// @brief Applies the impairments to a freshly received frame, and keeps the frame(s) in the queue if not dropped.
+    ///
+    /// @param frame The received frame.
+    /// @param now The current time.
+    /// @param copy_frame The function to make a copy of the frame (for duplication).
+    ///                   Should return an empty optional if copy could not be made.
+    ///
+    template <typename CopyFrame>
+    void admit(Frame&& frame, const TimePoint now, CopyFrame&& copy_frame)
+    {
+        if (chance(drop_threshold_))
+        {
+            ++counters_.dropped;
+            return;
+        }
+        if (chance(duplicate_threshold_))
+        {
+            cetl::optional<Frame> frame_copy = std::forward<CopyFrame>(copy_frame)(frame);
+            if (frame_copy.has_value())
+            {
+                ++counters_.duplicated;
+                enqueue(std::move(*frame_copy), now);
+            }
+        }
+        enqueue(std::move(frame), now);
+    }
+
+    /// @brief Pops the next frame which is due for delivery (if any).
+    ///
+    /// Timestamp of the popped frame is shifted by the time it has spent in the queue.
+    ///
+    CETL_NODISCARD cetl::optional<Frame> popDue(const TimePoint now)
+    {
+        std::size_t due_index = size_;
+        for (std::size_t index = 0; index < size_; ++index)
+        {
+            const Entry& entry = entries_[index];
+            if ((getDueTime(entry) <= now) &&
+                ((due_index == size_) || (entry.release_time < entries_[due_index].release_time) ||
+                 ((entry.release_time == entries_[due_index].release_time) &&
+                  (entry.sequence < entries_[due_index].sequence))))
+            {
+                due_index = index;
+            }
+        }
+        if (due_index == size_)
+        {
+            return cetl::nullopt;
+        }
+
+        Entry& due_entry = entries_[due_index];
+        due_entry.frame.timestamp += now - due_entry.admitted_time;
+        const auto due_sequence = due_entry.sequence;
+
+        cetl::optional<Frame> frame{std::move(due_entry.frame)};
+        --size_;
+        if (due_index != size_)
+        {
+            due_entry = std::move(entries_[size_]);
+        }
+        entries_[size_] = Entry{};
+
+        // Earlier frames which are held back for reordering have been overtaken by one more frame.
+        for (std::size_t index = 0; index < size_; ++index)
+        {
+            Entry& entry = entries_[index];
+            if ((entry.hold_count > 0) && (entry.sequence < due_sequence))
+            {
+                --entry.hold_count;
+            }
+        }
+
+        ++counters_.passed;
+        return frame;
+    }
+
+    /// @brief Gets the earliest time when a frame becomes due for delivery (if there are any frames in the queue).
+    ///
+    CETL_NODISCARD cetl::optional<TimePoint> getNextDueTime() const noexcept
+    {
+        cetl::optional<TimePoint> next_due_time;
+        for (std::size_t index = 0; index < size_; ++index)
+        {
+            const auto due_time = getDueTime(entries_[index]);
+            if (!next_due_time.has_value() || (due_time < *next_due_time))
+            {
+                next_due_time = due_time;
+            }
+        }
+        return next_due_time;
+    }
+
+private:
+    // 64-bit golden ratio - used as the PRNG state when zero seed is given (xorshift can't work with zero state).
+    static constexpr std::uint64_t DefaultSeed = 0x9E3779B97F4A7C15ULL;
+
+    struct Entry
+    {
+        Frame         frame{};
+        TimePoint     admitted_time{};
+        TimePoint     release_time{};
+        std::size_t   hold_count{};
+        std::uint64_t sequence{};
+    };
+
+    /// Converts probability to a threshold for 32-bit random numbers - saturated to the range [0, 2^32].
+    ///
+    static std::uint64_t toThreshold(const float probability) noexcept
+    {
+        constexpr float Scale = 4294967296.0F;  // 2^32
+        if (!(probability > 0))
+        {
+            return 0;
+        }
+        return (probability >= 1) ? static_cast<std::uint64_t>(Scale) : static_cast<std::uint64_t>(probability * Scale);
+    }
+
+    /// Generates next pseudo-random 32-bit number using "xorshift64*" algorithm.
+    ///
+    std::uint32_t nextRandom() noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        prng_state_ ^= prng_state_ >> 12U;
+        prng_state_ ^= prng_state_ << 25U;
+        prng_state_ ^= prng_state_ >> 27U;
+        return static_cast<std::uint32_t>((prng_state_ * 0x2545F4914F6CDD1DULL) >> 32U);
+        // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+
+    CETL_NODISCARD bool chance(const std::uint64_t threshold) noexcept
+    {
+        return (threshold > 0) && (nextRandom() < threshold);
+    }
+
+    CETL_NODISCARD TimePoint getDueTime(const Entry& entry) const noexcept
+    {
+        return (entry.hold_count == 0)
+                   ? entry.release_time
+                   : std::max(entry.release_time, entry.admitted_time + impairments_.reorder_timeout);
+    }
+
+    void enqueue(Frame&& frame, const TimePoint now)
+    {
+        if (size_ == Capacity)
+        {
+            ++counters_.overflows;
+            return;
+        }
+
+        auto delay = impairments_.delay;
+        if (impairments_.jitter > Duration::zero())
+        {
+            const auto jitter = static_cast<std::uint64_t>(impairments_.jitter.count());
+            delay += Duration{static_cast<Duration::rep>((jitter * nextRandom()) >> 32U)};
+        }
+        if (delay > Duration::zero())
+        {
+            ++counters_.delayed;
+        }
+
+        std::size_t hold_count = 0;
+        if ((impairments_.reorder_window > 0) && chance(reorder_threshold_))
+        {
+            ++counters_.reordered;
+            hold_count = impairments_.reorder_window;
+        }
+
+        entries_[size_++] = Entry{std::move(frame), now, now + delay, hold_count, sequence_++};
+    }
+
+    // MARK: Data members:
+
+    const Impairments           impairments_;
+    const bool                  is_enabled_;
+    const std::uint64_t         drop_threshold_;
+    const std::uint64_t         duplicate_threshold_;
+    const std::uint64_t         reorder_threshold_;
+    std::uint64_t               prng_state_;
+    std::array<Entry, Capacity> entries_;
+    std::size_t                 size_;
+    std::uint64_t               sequence_;
+    ImpairmentCounters&         counters_;
+
+};  // ImpairmentQueue
+
+/// @brief Implements "ready" callback of an impaired media (or socket), which is exposed to the transport.
+///
+/// The transport's callback function is registered at the executor (so that the impaired media could schedule it
+/// whenever delayed frames become due), together with the inner media registration (which feeds the impairment
+/// queue). Both registrations are owned by this object, and are dropped when the transport drops its handle.
+///
+class ImpairmentCallback final
+{
+public:
+    explicit ImpairmentCallback(IExecutor& executor)
+        : executor_{executor}
+        , handle_{nullptr}
+    {
+    }
+
+    ~ImpairmentCallback()
+    {
+        // The handle might still be alive (if the transport releases it after the media) - make it no-op.
+        if (handle_ != nullptr)
+        {
+            handle_->detach();
+        }
+    }
+
+    ImpairmentCallback(const ImpairmentCallback&)                = delete;
+    ImpairmentCallback(ImpairmentCallback&&) noexcept            = delete;
+    ImpairmentCallback& operator=(const ImpairmentCallback&)     = delete;
+    ImpairmentCallback& operator=(ImpairmentCallback&&) noexcept = delete;
+
+    /// @brief Registers the transport's callback function, and returns the handle to it.
+    ///
+    /// @param function The transport's callback function.
+    /// @param inner_registration The registration at the inner media (or socket).
+    ///
+    CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function,
+                                                            IExecutor::Callback::Any&&      inner_registration)
+    {
+        callback_           = executor_.registerCallback(std::move(function));
+        inner_registration_ = std::move(inner_registration);
+        return IExecutor::Callback::Any{Handle{*this}};
+    }
+
+    /// @brief Schedules the transport's callback (if registered) to be called at the given time.
+    ///
+    void scheduleAt(const TimePoint time_point)
+    {
+        (void) callback_.schedule(IExecutor::Callback::Schedule::Once{time_point});
+    }
+
+private:
+    class Handle final : public IExecutor::Callback::Interface
+    {
+    public:
+        explicit Handle(ImpairmentCallback& owner)
+            : owner_{&owner}
+        {
+            if (owner.handle_ != nullptr)
+            {
+                owner.handle_->detach();
+            }
+            owner.handle_ = this;
+        }
+
+        Handle(Handle&& other) noexcept
+            : owner_{std::exchange(other.owner_, nullptr)}
+        {
+            if (owner_ != nullptr)
+            {
+                owner_->handle_ = this;
+            }
+        }
+
+        ~Handle()
+        {
+            if (owner_ != nullptr)
+            {
+                owner_->handle_ = nullptr;
+                owner_->callback_.reset();
+                owner_->inner_registration_.reset();
+            }
+        }
+
+        Handle(const Handle&)                = delete;
+        Handle& operator=(const Handle&)     = delete;
+        Handle& operator=(Handle&&) noexcept = delete;
+
+        void detach() noexcept
+        {
+            owner_ = nullptr;
+        }
+
+        // MARK: Callback::Interface
+
+        void schedule(const IExecutor::Callback::Schedule::Variant& schedule) override
+        {
+            if (owner_ != nullptr)
+            {
+                (void) owner_->callback_.schedule(schedule);
+            }
+        }
+
+    private:
+        ImpairmentCallback* owner_;
+
+    };  // Handle
+
+    // MARK: Data members:
+
+    IExecutor&               executor_;
+    IExecutor::Callback::Any callback_;
+    IExecutor::Callback::Any inner_registration_;
+    Handle*                  handle_;
+
+};  // ImpairmentCallback
+
+}  // namespace detail
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_IMPAIRMENT_HPP_INCLUDED
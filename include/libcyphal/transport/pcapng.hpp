@@ -0,0 +1,830 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_PCAPNG_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_PCAPNG_HPP_INCLUDED
+
+#include "types.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines minimal support of the pcapng capture file format.
+///
+/// Only what is needed to capture frames of libcyphal media (and to replay them back) is supported:
+/// Section Header, Interface Description and Enhanced Packet blocks. All other blocks are skipped by the reader.
+/// The writer always produces little-endian sections with nanosecond timestamp resolution; the reader accepts
+/// sections of any byte order and any timestamp resolution.
+///
+/// See https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html
+///
+namespace pcapng
+{
+
+/// @brief Defines link types (see https://www.tcpdump.org/linktypes.html) in use by libcyphal captures.
+///
+enum class LinkType : std::uint16_t
+{
+    Ethernet     = 1,
+    Raw          = 101,
+    LinuxSll     = 113,
+    CanSocketCan = 227,
+    Ipv4         = 228,
+};
+
+/// @brief Defines direction of a captured packet (as it's stored in the `epb_flags` option).
+///
+enum class Direction : std::uint8_t
+{
+    Unknown  = 0,
+    Inbound  = 1,
+    Outbound = 2,
+};
+
+/// @brief Defines how a capture is fed back into a transport by replay media.
+///
+enum class ReplayMode : std::uint8_t
+{
+    /// Packets are delivered at their recorded time (relative to the very first packet of the capture).
+    Recorded,
+
+    /// Packets are delivered one after another as fast as the transport consumes them.
+    AsFastAsPossible,
+};
+
+/// @brief Defines interface to a sink of the pcapng writer (f.e. a file, or an in-memory buffer).
+///
+/// Implementation is supposed to be provided by an user of the library.
+///
+class ISink
+{
+public:
+    ISink(const ISink&)                = delete;
+    ISink(ISink&&) noexcept            = delete;
+    ISink& operator=(const ISink&)     = delete;
+    ISink& operator=(ISink&&) noexcept = delete;
+
+    /// @brief Writes the whole given data to the sink.
+    ///
+    /// @return `true` if all data has been written; otherwise `false`.
+    ///
+    virtual bool write(const cetl::span<const cetl::byte> data) = 0;
+
+protected:
+    ISink()  = default;
+    ~ISink() = default;
+
+};  // ISink
+
+/// @brief Implements writer of the pcapng format.
+///
+/// The section header is written together with the very first interface description.
+/// Failures of the sink are not fatal - the affected blocks are just counted (and missing in the capture).
+///
+class Writer final
+{
+public:
+    explicit Writer(ISink& sink)
+        : sink_{sink}
+        , interfaces_count_{0}
+        , is_section_written_{false}
+        , packets_count_{0}
+        , failures_count_{0}
+    {
+    }
+
+    ~Writer()                            = default;
+    Writer(const Writer&)                = delete;
+    Writer(Writer&&) noexcept            = delete;
+    Writer& operator=(const Writer&)     = delete;
+    Writer& operator=(Writer&&) noexcept = delete;
+
+    /// @brief Adds a new capture interface (with nanosecond timestamp resolution).
+    ///
+    /// @param link_type Link type of all packets of the interface.
+    /// @param snap_length Max length of a packet of the interface.
+    /// @return Id of the new interface, or `nullopt` if the sink has failed.
+    ///
+    CETL_NODISCARD cetl::optional<std::uint32_t> addInterface(const LinkType link_type, const std::uint32_t snap_length)
+    {
+        if (!writeSectionHeader())
+        {
+            return cetl::nullopt;
+        }
+
+        std::array<cetl::byte, InterfaceBlockSize> block{};
+        store32(&block[0], InterfaceBlockType);
+        store32(&block[4], InterfaceBlockSize);
+        store16(&block[8], static_cast<std::uint16_t>(link_type));
+        store32(&block[12], snap_length);
+        store16(&block[16], TsResolOptionCode);
+        store16(&block[18], 1);
+        block[20] = static_cast<cetl::byte>(NanosecondsTsResol);
+        store32(&block[InterfaceBlockSize - 4], InterfaceBlockSize);
+        if (!writeBlock(block))
+        {
+            return cetl::nullopt;
+        }
+        return interfaces_count_++;
+    }
+
+    /// @brief Writes a new packet (gathered from the given fragments) of the given interface.
+    ///
+    /// @param interface_id Id of the interface (as it was returned by `addInterface`).
+    /// @param timestamp Time of the packet since an arbitrary epoch.
+    /// @param direction Direction of the packet; `Unknown` direction omits the `epb_flags` option.
+    /// @param fragments Fragments of the packet data.
+    /// @return `true` if the packet has been written; otherwise `false`.
+    ///
+    bool writePacket(const std::uint32_t            interface_id,
+                     const std::chrono::nanoseconds timestamp,
+                     const Direction                direction,
+                     const PayloadFragments         fragments)
+    {
+        return writePacket(interface_id, timestamp, direction, {}, fragments);
+    }
+
+    /// @brief Writes a new packet (the link layer header followed by the given fragments) of the given interface.
+    ///
+    /// Useful when the link layer header is synthesized by the caller (f.e. IPv4/UDP headers of a datagram),
+    /// so that payload fragments are written as is - without gathering them together with the header.
+    ///
+    bool writePacket(const std::uint32_t                interface_id,
+                     const std::chrono::nanoseconds     timestamp,
+                     const Direction                    direction,
+                     const cetl::span<const cetl::byte> link_header,
+                     const PayloadFragments             fragments)
+    {
+        std::size_t data_size = link_header.size();
+        for (const auto& fragment : fragments)
+        {
+            data_size += fragment.size();
+        }
+        const std::size_t padding_size = (4U - (data_size % 4U)) % 4U;
+        const std::size_t options_size = (direction == Direction::Unknown) ? 0 : FlagsOptionSize;
+        const auto        block_size   = static_cast<std::uint32_t>(PacketBlockHeaderSize + data_size + padding_size +
+                                                               options_size + BlockTrailerSize);
+
+        const auto ts = static_cast<std::uint64_t>(std::max(timestamp.count(), std::chrono::nanoseconds::rep{0}));
+
+        std::array<cetl::byte, PacketBlockHeaderSize> header{};
+        store32(&header[0], PacketBlockType);
+        store32(&header[4], block_size);
+        store32(&header[8], interface_id);
+        store32(&header[12], static_cast<std::uint32_t>(ts >> 32U));
+        store32(&header[16], static_cast<std::uint32_t>(ts));
+        store32(&header[20], static_cast<std::uint32_t>(data_size));
+        store32(&header[24], static_cast<std::uint32_t>(data_size));
+
+        std::array<cetl::byte, 3 + FlagsOptionSize + BlockTrailerSize> trailer{};
+        cetl::byte* options = &trailer[padding_size];
+        if (direction != Direction::Unknown)
+        {
+            store16(&options[0], FlagsOptionCode);
+            store16(&options[2], 4);
+            store32(&options[4], static_cast<std::uint32_t>(direction));
+            options += FlagsOptionSize;  // The end of options (zeros) is already there.
+        }
+        store32(options, block_size);
+
+        bool is_written = writeSectionHeader() && sink_.write(header);
+        is_written      = is_written && (link_header.empty() || sink_.write(link_header));
+        for (const auto& fragment : fragments)
+        {
+            is_written = is_written && sink_.write(fragment);
+        }
+        is_written = is_written && sink_.write({trailer.data(), padding_size + options_size + BlockTrailerSize});
+        if (!is_written)
+        {
+            ++failures_count_;
+            return false;
+        }
+        ++packets_count_;
+        return true;
+    }
+
+    /// @brief Gets total number of successfully written packets.
+    ///
+    CETL_NODISCARD std::uint64_t getPacketsCount() const noexcept
+    {
+        return packets_count_;
+    }
+
+    /// @brief Gets total number of blocks (including packets) which have failed to be written.
+    ///
+    CETL_NODISCARD std::uint64_t getFailuresCount() const noexcept
+    {
+        return failures_count_;
+    }
+
+private:
+    static constexpr std::uint32_t SectionBlockType      = 0x0A0D0D0AU;
+    static constexpr std::uint32_t InterfaceBlockType    = 0x00000001U;
+    static constexpr std::uint32_t PacketBlockType       = 0x00000006U;
+    static constexpr std::uint32_t ByteOrderMagic        = 0x1A2B3C4DU;
+    static constexpr std::size_t   SectionBlockSize      = 28;
+    static constexpr std::size_t   InterfaceBlockSize    = 32;
+    static constexpr std::size_t   PacketBlockHeaderSize = 28;
+    static constexpr std::size_t   BlockTrailerSize      = 4;
+    static constexpr std::size_t   FlagsOptionSize       = 12;  // incl. the end of options
+    static constexpr std::uint16_t TsResolOptionCode     = 9;
+    static constexpr std::uint16_t FlagsOptionCode       = 2;
+    static constexpr std::uint8_t  NanosecondsTsResol    = 9;
+
+    static void store16(cetl::byte* const dst, const std::uint16_t value)
+    {
+        dst[0] = static_cast<cetl::byte>(value & 0xFFU);
+        dst[1] = static_cast<cetl::byte>(value >> 8U);
+    }
+
+    static void store32(cetl::byte* const dst, const std::uint32_t value)
+    {
+        store16(dst, static_cast<std::uint16_t>(value & 0xFFFFU));
+        store16(dst + 2, static_cast<std::uint16_t>(value >> 16U));
+    }
+
+    bool writeSectionHeader()
+    {
+        if (is_section_written_)
+        {
+            return true;
+        }
+
+        std::array<cetl::byte, SectionBlockSize> block{};
+        store32(&block[0], SectionBlockType);
+        store32(&block[4], SectionBlockSize);
+        store32(&block[8], ByteOrderMagic);
+        store16(&block[12], 1);  // major version
+        store16(&block[14], 0);  // minor version
+        std::fill_n(&block[16], 8, static_cast<cetl::byte>(0xFF));  // section length is not specified
+        store32(&block[SectionBlockSize - 4], SectionBlockSize);
+        is_section_written_ = writeBlock(block);
+        return is_section_written_;
+    }
+
+    bool writeBlock(const cetl::span<const cetl::byte> block)
+    {
+        if (!sink_.write(block))
+        {
+            ++failures_count_;
+            return false;
+        }
+        return true;
+    }
+
+    // MARK: Data members:
+
+    ISink&        sink_;
+    std::uint32_t interfaces_count_;
+    bool          is_section_written_;
+    std::uint64_t packets_count_;
+    std::uint64_t failures_count_;
+
+};  // Writer
+
+/// @brief Implements reader of the pcapng format over a capture which is completely in memory.
+///
+/// Returned packets refer to the capture memory (without copying), so the capture must outlive them.
+/// Packets of interfaces beyond the `Pcapng_MaxInterfaces` limit are skipped.
+///
+class Reader final
+{
+public:
+    struct Packet
+    {
+        LinkType                     link_type;
+        std::uint32_t                interface_id;
+        std::chrono::nanoseconds     timestamp;
+        Direction                    direction;
+        cetl::span<const cetl::byte> data;
+    };
+
+    explicit Reader(const cetl::span<const cetl::byte> capture)
+        : capture_{capture}
+        , offset_{0}
+        , interfaces_{}
+        , interfaces_count_{0}
+        , is_swapped_{false}
+        , has_section_{false}
+        , is_malformed_{false}
+    {
+    }
+
+    /// @brief Starts reading the capture from its very beginning.
+    ///
+    void rewind() noexcept
+    {
+        offset_           = 0;
+        interfaces_count_ = 0;
+        is_swapped_       = false;
+        has_section_      = false;
+        is_malformed_     = false;
+    }
+
+    /// @brief Gets whether the reader has stopped b/c of malformed (or truncated) capture data.
+    ///
+    CETL_NODISCARD bool isMalformed() const noexcept
+    {
+        return is_malformed_;
+    }
+
+    /// @brief Reads the next packet of the capture.
+    ///
+    /// @return The next packet, or `nullopt` if there are no more packets (or the capture is malformed).
+    ///
+    CETL_NODISCARD cetl::optional<Packet> next() noexcept
+    {
+        while (!is_malformed_ && ((capture_.size() - offset_) >= MinBlockSize))
+        {
+            const cetl::span<const cetl::byte> block = capture_.subspan(offset_);
+            if (load32(block, 0) == SectionBlockType)
+            {
+                parseSectionHeader(block);
+            }
+            const std::uint32_t block_size = load32(block, 4);
+            if (!has_section_ || (block_size < MinBlockSize) || ((block_size % 4U) != 0) ||
+                (block_size > block.size()))
+            {
+                is_malformed_ = true;
+                break;
+            }
+            offset_ += block_size;
+
+            const auto block_type = load32(block, 0);
+            if (block_type == InterfaceBlockType)
+            {
+                parseInterface(block.first(block_size));
+            }
+            else if (block_type == PacketBlockType)
+            {
+                if (auto packet = parsePacket(block.first(block_size)))
+                {
+                    return packet;
+                }
+            }
+        }
+        return cetl::nullopt;
+    }
+
+private:
+    struct Interface
+    {
+        LinkType     link_type;
+        std::uint8_t ts_resol;
+    };
+
+    static constexpr std::size_t MaxInterfaces = config::Transport::Pcapng_MaxInterfaces();
+
+    static constexpr std::uint32_t SectionBlockType      = 0x0A0D0D0AU;
+    static constexpr std::uint32_t InterfaceBlockType    = 0x00000001U;
+    static constexpr std::uint32_t PacketBlockType       = 0x00000006U;
+    static constexpr std::uint32_t ByteOrderMagic        = 0x1A2B3C4DU;
+    static constexpr std::uint32_t SwappedByteOrderMagic = 0x4D3C2B1AU;
+    static constexpr std::size_t   MinBlockSize          = 12;
+    static constexpr std::size_t   InterfaceHeaderSize   = 16;
+    static constexpr std::size_t   PacketHeaderSize      = 28;
+    static constexpr std::uint16_t TsResolOptionCode     = 9;
+    static constexpr std::uint16_t FlagsOptionCode       = 2;
+    static constexpr std::uint8_t  DefaultTsResol        = 6;  // microseconds
+
+    /// Converts a raw timestamp of the given resolution (as it's encoded by the `if_tsresol` option) to nanoseconds.
+    ///
+    static std::chrono::nanoseconds toNanoseconds(const std::uint64_t ts, const std::uint8_t ts_resol) noexcept
+    {
+        constexpr std::uint64_t NanosecondsPerSecond = 1000000000ULL;
+
+        std::uint64_t result = ts;
+        if ((ts_resol & 0x80U) == 0)
+        {
+            // Negative power of 10.
+            for (std::uint8_t exponent = ts_resol; exponent < 9; ++exponent)
+            {
+                result *= 10U;
+            }
+            for (std::uint8_t exponent = ts_resol; exponent > 9; --exponent)
+            {
+                result /= 10U;
+            }
+        }
+        else
+        {
+            // Negative power of 2 - split into whole seconds and fraction to avoid overflow.
+            const std::uint8_t  shift    = std::min<std::uint8_t>(ts_resol & 0x7FU, 63U);
+            const std::uint8_t  extra    = (shift > 34U) ? static_cast<std::uint8_t>(shift - 34U) : 0U;
+            const std::uint64_t fraction = (ts & ((1ULL << shift) - 1U)) >> extra;
+            result = ((ts >> shift) * NanosecondsPerSecond) + ((fraction * NanosecondsPerSecond) >> (shift - extra));
+        }
+        return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(result)};
+    }
+
+    std::uint16_t load16(const cetl::span<const cetl::byte> block, const std::size_t offset) const noexcept
+    {
+        const auto b0 = static_cast<std::uint16_t>(block[offset]);
+        const auto b1 = static_cast<std::uint16_t>(block[offset + 1]);
+        return is_swapped_ ? static_cast<std::uint16_t>((b0 << 8U) | b1) : static_cast<std::uint16_t>((b1 << 8U) | b0);
+    }
+
+    std::uint32_t load32(const cetl::span<const cetl::byte> block, const std::size_t offset) const noexcept
+    {
+        const std::uint32_t lo = load16(block, offset);
+        const std::uint32_t hi = load16(block, offset + 2);
+        return is_swapped_ ? ((lo << 16U) | hi) : ((hi << 16U) | lo);
+    }
+
+    void parseSectionHeader(const cetl::span<const cetl::byte> block) noexcept
+    {
+        // Byte order of the new section is not known yet, so the magic is read as little-endian first.
+        is_swapped_       = false;
+        interfaces_count_ = 0;
+        has_section_      = false;
+        if (block.size() >= (MinBlockSize + 4))
+        {
+            const auto magic = load32(block, 8);
+            is_swapped_      = (magic == SwappedByteOrderMagic);
+            has_section_     = (magic == ByteOrderMagic) || is_swapped_;
+        }
+    }
+
+    void parseInterface(const cetl::span<const cetl::byte> block) noexcept
+    {
+        if (block.size() < (InterfaceHeaderSize + 4))
+        {
+            is_malformed_ = true;
+            return;
+        }
+        if (interfaces_count_ >= MaxInterfaces)
+        {
+            return;
+        }
+
+        Interface& interface = interfaces_[interfaces_count_++];
+        interface.link_type  = static_cast<LinkType>(load16(block, 8));
+        interface.ts_resol   = DefaultTsResol;
+        forEachOption(block, InterfaceHeaderSize, [&interface](const std::uint16_t code, const auto value) {
+            //
+            if ((code == TsResolOptionCode) && !value.empty())
+            {
+                interface.ts_resol = static_cast<std::uint8_t>(value[0]);
+            }
+        });
+    }
+
+    cetl::optional<Packet> parsePacket(const cetl::span<const cetl::byte> block) noexcept
+    {
+        if (block.size() < (PacketHeaderSize + 4))
+        {
+            is_malformed_ = true;
+            return cetl::nullopt;
+        }
+        const std::uint32_t captured_size = load32(block, 20);
+        if (captured_size > (block.size() - PacketHeaderSize - 4))
+        {
+            is_malformed_ = true;
+            return cetl::nullopt;
+        }
+        const std::uint32_t interface_id = load32(block, 8);
+        if (interface_id >= interfaces_count_)
+        {
+            return cetl::nullopt;
+        }
+
+        const Interface&    interface = interfaces_[interface_id];
+        const std::uint64_t ts        = (static_cast<std::uint64_t>(load32(block, 12)) << 32U) | load32(block, 16);
+
+        Packet packet{interface.link_type,
+                      interface_id,
+                      toNanoseconds(ts, interface.ts_resol),
+                      Direction::Unknown,
+                      block.subspan(PacketHeaderSize, captured_size)};
+
+        const std::size_t options_offset = PacketHeaderSize + ((captured_size + 3U) & ~std::size_t{3U});
+        forEachOption(block, options_offset, [this, &packet](const std::uint16_t code, const auto value) {
+            //
+            if ((code == FlagsOptionCode) && (value.size() >= 4))
+            {
+                packet.direction = static_cast<Direction>(load32(value, 0) & 0x3U);
+            }
+        });
+        return packet;
+    }
+
+    template <typename Action>
+    void forEachOption(const cetl::span<const cetl::byte> block, std::size_t offset, Action&& action) const noexcept
+    {
+        const std::size_t end = block.size() - 4;  // excluding the trailing block length
+        while ((offset + 4) <= end)
+        {
+            const std::uint16_t code  = load16(block, offset);
+            const std::uint16_t size  = load16(block, offset + 2);
+            const std::size_t   start = offset + 4;
+            if ((code == 0) || ((start + size) > end))
+            {
+                break;
+            }
+            action(code, block.subspan(start, size));
+            offset = start + ((size + 3U) & ~std::size_t{3U});
+        }
+    }
+
+    // MARK: Data members:
+
+    cetl::span<const cetl::byte>         capture_;
+    std::size_t                          offset_;
+    std::array<Interface, MaxInterfaces> interfaces_;
+    std::size_t                          interfaces_count_;
+    bool                                 is_swapped_;
+    bool                                 has_section_;
+    bool                                 is_malformed_;
+
+};  // Reader
+
+/// @brief Defines SocketCAN (`LINKTYPE_CAN_SOCKETCAN`) encoding of CAN frames.
+///
+/// Frames are padded to the full `CAN_MTU` (or `CANFD_MTU`) size - the same way as Linux captures them.
+///
+struct SocketCan final
+{
+    static constexpr std::size_t   HeaderSize         = 8;
+    static constexpr std::size_t   ClassicPayloadSize = 8;
+    static constexpr std::size_t   FdPayloadSize      = 64;
+    static constexpr std::uint32_t ExtendedFrameFlag  = 0x80000000UL;
+    static constexpr std::uint32_t RemoteFrameFlag    = 0x40000000UL;
+    static constexpr std::uint32_t ErrorFrameFlag     = 0x20000000UL;
+    static constexpr std::uint32_t ExtendedIdMask     = 0x1FFFFFFFUL;
+    static constexpr std::uint8_t  FdFrameFlag        = 0x04U;
+
+    struct Frame
+    {
+        std::uint32_t                can_id;
+        cetl::span<const cetl::byte> payload;
+    };
+
+    /// Makes header of an extended frame (in the network byte order as `LINKTYPE_CAN_SOCKETCAN` requires).
+    ///
+    static std::array<cetl::byte, HeaderSize> makeHeader(const std::uint32_t can_id,
+                                                         const std::size_t   payload_size,
+                                                         const bool          is_fd) noexcept
+    {
+        const std::uint32_t id = (can_id & ExtendedIdMask) | ExtendedFrameFlag;
+
+        std::array<cetl::byte, HeaderSize> header{};
+        header[0] = static_cast<cetl::byte>(id >> 24U);
+        header[1] = static_cast<cetl::byte>((id >> 16U) & 0xFFU);
+        header[2] = static_cast<cetl::byte>((id >> 8U) & 0xFFU);
+        header[3] = static_cast<cetl::byte>(id & 0xFFU);
+        header[4] = static_cast<cetl::byte>(payload_size);
+        header[5] = static_cast<cetl::byte>(is_fd ? FdFrameFlag : 0U);
+        return header;
+    }
+
+    /// Gets size of the (zero) padding which follows the payload.
+    ///
+    static std::size_t getPaddingSize(const std::size_t payload_size, const bool is_fd) noexcept
+    {
+        const std::size_t full_size = is_fd ? FdPayloadSize : ClassicPayloadSize;
+        return (payload_size < full_size) ? (full_size - payload_size) : 0;
+    }
+
+    /// Parses an extended data frame. Standard, remote and error frames are not in use by Cyphal, so they are ignored.
+    ///
+    static cetl::optional<Frame> parse(const cetl::span<const cetl::byte> data) noexcept
+    {
+        if (data.size() < HeaderSize)
+        {
+            return cetl::nullopt;
+        }
+        const std::uint32_t id = (static_cast<std::uint32_t>(data[0]) << 24U) |
+                                 (static_cast<std::uint32_t>(data[1]) << 16U) |
+                                 (static_cast<std::uint32_t>(data[2]) << 8U) | static_cast<std::uint32_t>(data[3]);
+        const auto payload_size = static_cast<std::size_t>(data[4]);
+        if (((id & ExtendedFrameFlag) == 0) || ((id & (RemoteFrameFlag | ErrorFrameFlag)) != 0) ||
+            (payload_size > FdPayloadSize) || ((HeaderSize + payload_size) > data.size()))
+        {
+            return cetl::nullopt;
+        }
+        return Frame{id & ExtendedIdMask, data.subspan(HeaderSize, payload_size)};
+    }
+
+};  // SocketCan
+
+/// @brief Defines encoding of UDP datagrams as raw IPv4 packets (`LINKTYPE_IPV4`).
+///
+/// Source address and port of captured datagrams are not known to media, so they are left zeroed.
+/// Besides raw IPv4, datagrams could be parsed from Ethernet and Linux "cooked" (`tcpdump -i any`) captures.
+///
+struct Ipv4Udp final
+{
+    static constexpr std::size_t  Ipv4HeaderSize = 20;
+    static constexpr std::size_t  UdpHeaderSize  = 8;
+    static constexpr std::size_t  HeadersSize    = Ipv4HeaderSize + UdpHeaderSize;
+    static constexpr std::uint8_t DefaultTtl     = 16;  // as recommended by the Cyphal/UDP specification
+
+    struct Datagram
+    {
+        std::uint32_t                ip_address;
+        std::uint16_t                udp_port;
+        cetl::span<const cetl::byte> payload;
+    };
+
+    /// Makes IPv4 and UDP headers of a datagram to the given endpoint.
+    ///
+    static std::array<cetl::byte, HeadersSize> makeHeaders(const std::uint32_t ip_address,
+                                                           const std::uint16_t udp_port,
+                                                           const std::uint8_t  dscp,
+                                                           const std::size_t   payload_size) noexcept
+    {
+        const auto total_size = static_cast<std::uint16_t>(HeadersSize + payload_size);
+        const auto udp_size   = static_cast<std::uint16_t>(UdpHeaderSize + payload_size);
+
+        std::array<cetl::byte, HeadersSize> headers{};
+        headers[0] = static_cast<cetl::byte>(0x45U);  // version 4, 5 words of header
+        headers[1] = static_cast<cetl::byte>(static_cast<std::uint8_t>(dscp << 2U));
+        storeBe16(&headers[2], total_size);
+        storeBe16(&headers[6], 0x4000U);  // don't fragment
+        headers[8] = static_cast<cetl::byte>(DefaultTtl);
+        headers[9] = static_cast<cetl::byte>(UdpProtocol);
+        storeBe16(&headers[16], static_cast<std::uint16_t>(ip_address >> 16U));
+        storeBe16(&headers[18], static_cast<std::uint16_t>(ip_address & 0xFFFFU));
+
+        std::uint32_t checksum = 0;
+        for (std::size_t offset = 0; offset < Ipv4HeaderSize; offset += 2)
+        {
+            checksum += loadBe16(&headers[offset]);
+        }
+        checksum = (checksum & 0xFFFFU) + (checksum >> 16U);
+        checksum = (checksum & 0xFFFFU) + (checksum >> 16U);
+        storeBe16(&headers[10], static_cast<std::uint16_t>(~checksum & 0xFFFFU));
+
+        storeBe16(&headers[Ipv4HeaderSize + 2], udp_port);
+        storeBe16(&headers[Ipv4HeaderSize + 4], udp_size);
+        return headers;
+    }
+
+    /// Parses a non-fragmented UDP/IPv4 datagram of the given link type.
+    ///
+    static cetl::optional<Datagram> parse(const LinkType link_type, cetl::span<const cetl::byte> data) noexcept
+    {
+        if (!skipLinkHeader(link_type, data) || (data.size() < HeadersSize))
+        {
+            return cetl::nullopt;
+        }
+        const auto        version_ihl = static_cast<std::uint8_t>(data[0]);
+        const std::size_t ip_size     = (version_ihl & 0x0FU) * 4U;
+        const std::size_t total_size  = loadBe16(&data[2]);
+        if (((version_ihl >> 4U) != 4U) || (ip_size < Ipv4HeaderSize) || (total_size > data.size()) ||
+            (static_cast<std::uint8_t>(data[9]) != UdpProtocol) || ((loadBe16(&data[6]) & 0x3FFFU) != 0) ||
+            ((ip_size + UdpHeaderSize) > total_size))
+        {
+            return cetl::nullopt;
+        }
+        const std::size_t udp_size = loadBe16(&data[ip_size + 4]);
+        if ((udp_size < UdpHeaderSize) || ((ip_size + udp_size) > total_size))
+        {
+            return cetl::nullopt;
+        }
+        const std::uint32_t ip_address = (static_cast<std::uint32_t>(loadBe16(&data[16])) << 16U) | loadBe16(&data[18]);
+        return Datagram{ip_address,
+                        loadBe16(&data[ip_size + 2]),
+                        data.subspan(ip_size + UdpHeaderSize, udp_size - UdpHeaderSize)};
+    }
+
+private:
+    static constexpr std::uint8_t  UdpProtocol   = 17;
+    static constexpr std::uint16_t Ipv4EtherType = 0x0800U;
+    static constexpr std::uint16_t VlanEtherType = 0x8100U;
+    static constexpr std::size_t   EthernetSize  = 14;
+    static constexpr std::size_t   LinuxSllSize  = 16;
+    static constexpr std::size_t   VlanTagSize   = 4;
+
+    static void storeBe16(cetl::byte* const dst, const std::uint16_t value) noexcept
+    {
+        dst[0] = static_cast<cetl::byte>(value >> 8U);
+        dst[1] = static_cast<cetl::byte>(value & 0xFFU);
+    }
+
+    static std::uint16_t loadBe16(const cetl::byte* const src) noexcept
+    {
+        const auto hi = static_cast<std::uint16_t>(src[0]);
+        const auto lo = static_cast<std::uint16_t>(src[1]);
+        return static_cast<std::uint16_t>((hi << 8U) | lo);
+    }
+
+    static bool skipLinkHeader(const LinkType link_type, cetl::span<const cetl::byte>& data) noexcept
+    {
+        std::size_t ether_type_offset = 0;
+        switch (link_type)
+        {
+        case LinkType::Raw:
+        case LinkType::Ipv4:
+            return true;
+        case LinkType::Ethernet:
+            ether_type_offset = EthernetSize - 2;
+            break;
+        case LinkType::LinuxSll:
+            ether_type_offset = LinuxSllSize - 2;
+            break;
+        default:
+            return false;
+        }
+
+        if ((data.size() >= (ether_type_offset + 2 + VlanTagSize)) &&
+            (loadBe16(&data[ether_type_offset]) == VlanEtherType))
+        {
+            ether_type_offset += VlanTagSize;
+        }
+        if ((data.size() < (ether_type_offset + 2)) || (loadBe16(&data[ether_type_offset]) != Ipv4EtherType))
+        {
+            return false;
+        }
+        data = data.subspan(ether_type_offset + 2);
+        return true;
+    }
+
+};  // Ipv4Udp
+
+/// Internal implementation details.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Maps recorded timestamps of a capture to due times of replay.
+///
+class ReplayTimeline final
+{
+public:
+    explicit ReplayTimeline(const ReplayMode mode)
+        : mode_{mode}
+        , is_started_{false}
+        , start_time_{}
+        , origin_{}
+    {
+    }
+
+    /// @brief Starts the timeline (unless already started), so that packets recorded at the `origin`
+    ///        are due at the given `now` time point.
+    ///
+    void start(const TimePoint now, const std::chrono::nanoseconds origin) noexcept
+    {
+        if (!is_started_)
+        {
+            is_started_ = true;
+            start_time_ = now;
+            origin_     = origin;
+        }
+    }
+
+    /// @brief Stops the timeline, so that the next `start` call restarts it.
+    ///
+    void stop() noexcept
+    {
+        is_started_ = false;
+    }
+
+    /// @brief Gets time when a packet with the given recorded timestamp is due.
+    ///
+    /// In the "as fast as possible" mode every packet is immediately due.
+    ///
+    CETL_NODISCARD TimePoint getDueTime(const std::chrono::nanoseconds timestamp, const TimePoint now) const noexcept
+    {
+        if ((mode_ == ReplayMode::AsFastAsPossible) || !is_started_)
+        {
+            return now;
+        }
+        const auto offset = std::max(timestamp - origin_, std::chrono::nanoseconds::zero());
+        return start_time_ + std::chrono::duration_cast<Duration>(offset);
+    }
+
+private:
+    // MARK: Data members:
+
+    const ReplayMode         mode_;
+    bool                     is_started_;
+    TimePoint                start_time_;
+    std::chrono::nanoseconds origin_;
+
+};  // ReplayTimeline
+
+}  // namespace detail
+}  // namespace pcapng
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_PCAPNG_HPP_INCLUDED
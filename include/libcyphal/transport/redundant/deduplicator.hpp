@@ -0,0 +1,315 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_DEDUPLICATOR_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_DEDUPLICATOR_HPP_INCLUDED
+
+#include "delegate.hpp"
+
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+namespace detail
+{
+
+/// @brief Implements "first wins" deduplication of transfers received via several inferior transports.
+///
+/// State is kept per source node, and it consists of the newest accepted transfer ID, and a sliding window
+/// (of `WindowSize` transfer IDs back from the newest one) of bits - whether a transfer was accepted,
+/// and whether it was seen via a particular inferior. So, a transfer is accepted if it's either newer
+/// than the newest one, or it's within the window but not yet accepted (out of order delivery).
+/// Any other copy is a duplicate. The whole state of a source is reset if there was no accepted
+/// transfers from it during the transfer ID timeout (f.e. b/c the source node has been restarted).
+///
+/// As a byproduct, the seen bits provide per inferior statistics: when a transfer ID slides out of the window,
+/// it's counted as lost for each (attached) inferior which hasn't seen it. Lag of late copies is measured
+/// relative to the earliest copy of the newest transfer - lag of late copies of older transfers is unknown.
+///
+/// Transfer IDs are tracked modulo the current transfer ID modulo of the attached inferiors, so the whole state
+/// (of all sources) is reset whenever the modulo changes (f.e. when an inferior is attached or detached).
+///
+/// Memory is allocated only when a new source node is seen for the first time.
+///
+class Deduplicator final
+{
+public:
+    static constexpr std::size_t WindowSize = 64;
+
+    explicit Deduplicator(TransportDelegate& delegate)
+        : delegate_{delegate}
+        , sources_{&delegate.memory()}
+        , transfer_id_timeout_{std::chrono::seconds{2}}
+        , transfer_id_modulo_{delegate.getTransferIdModulo()}
+    {
+    }
+
+    ~Deduplicator() = default;
+
+    Deduplicator(const Deduplicator&)                = delete;
+    Deduplicator(Deduplicator&&) noexcept            = delete;
+    Deduplicator& operator=(const Deduplicator&)     = delete;
+    Deduplicator& operator=(Deduplicator&&) noexcept = delete;
+
+    void setTransferIdTimeout(const Duration timeout) noexcept
+    {
+        if (timeout > Duration::zero())
+        {
+            transfer_id_timeout_ = timeout;
+        }
+    }
+
+    /// @brief Marks whole window of all sources as seen by the given inferior.
+    ///
+    /// In use when a new inferior is attached - so that transfers received before that
+    /// are not counted as lost by this new inferior.
+    ///
+    void resetInferior(const std::uint8_t inferior_index) noexcept
+    {
+        for (auto& source : sources_)
+        {
+            source.seen[inferior_index] = ~Window{0};
+        }
+    }
+
+    /// @brief Decides whether a transfer copy should be delivered.
+    ///
+    /// @param inferior_index Index of the inferior transport which has received the copy.
+    /// @param source_node_id Node ID of the transfer source. Anonymous transfers can't be deduplicated,
+    ///                       so they should not be passed here at all (and just delivered as is).
+    /// @param rx_meta Metadata of the received copy.
+    /// @return `true` if this copy is the earliest one (and so it should be delivered).
+    ///
+    CETL_NODISCARD bool accept(const std::uint8_t        inferior_index,
+                               const NodeId              source_node_id,
+                               const TransferRxMetadata& rx_meta)
+    {
+        const TransferId modulo = delegate_.getTransferIdModulo();
+        if (modulo != transfer_id_modulo_)
+        {
+            resetSources();
+            transfer_id_modulo_ = modulo;
+        }
+        const TransferId transfer_id = reduce(rx_meta.base.transfer_id, modulo);
+        auto&            counters    = delegate_.inferiorCounters(inferior_index);
+
+        Source* const source = findOrInsertSource(source_node_id);
+        if (source == nullptr)
+        {
+            // Out of memory - we can't track this source, so just deliver (possibly duplicated) copy.
+            counters.onFirst();
+            return true;
+        }
+
+        // Fresh (or expired) source state - start the new window.
+        //
+        if ((source->accepted == 0) || (rx_meta.timestamp - source->timestamp > transfer_id_timeout_))
+        {
+            flushLosses(*source, WindowSize);
+            restart(*source, inferior_index, transfer_id, rx_meta.timestamp);
+            counters.onFirst();
+            return true;
+        }
+
+        const TransferId distance = forwardDistance(source->transfer_id, transfer_id, modulo);
+        if (distance == 0)
+        {
+            // A copy of the newest accepted transfer.
+            return onDuplicate(*source, inferior_index, 0, rx_meta.timestamp - source->timestamp);
+        }
+        if (distance <= (modulo / 2))
+        {
+            // A newer transfer - slide the window forward.
+            if (distance >= WindowSize)
+            {
+                flushLosses(*source, WindowSize);
+                restart(*source, inferior_index, transfer_id, rx_meta.timestamp);
+            }
+            else
+            {
+                const auto shift = static_cast<std::size_t>(distance);
+                flushLosses(*source, shift);
+                source->accepted = (source->accepted << shift) | 1U;
+                for (auto& seen : source->seen)
+                {
+                    seen <<= shift;
+                }
+                source->seen[inferior_index] |= 1U;
+                source->transfer_id = transfer_id;
+                source->timestamp   = rx_meta.timestamp;
+            }
+            counters.onFirst();
+            return true;
+        }
+
+        // An older transfer - either a late copy, or the earliest copy of an out of order transfer.
+        const TransferId back = forwardDistance(transfer_id, source->transfer_id, modulo);
+        if (back >= WindowSize)
+        {
+            // Too old to be tracked - can't tell whether it's a duplicate, so drop it to be on the safe side.
+            return false;
+        }
+        const auto   bit_index = static_cast<std::size_t>(back);
+        const Window bit       = Window{1} << bit_index;
+        if ((source->accepted & bit) != 0)
+        {
+            return onDuplicate(*source, inferior_index, bit_index, cetl::nullopt);
+        }
+        source->accepted |= bit;
+        source->seen[inferior_index] |= bit;
+        counters.onFirst();
+        return true;
+    }
+
+private:
+    using Window = std::uint64_t;
+    static_assert(WindowSize == std::numeric_limits<Window>::digits, "");
+
+    struct Source final
+    {
+        NodeId                                                node_id;
+        TransferId                                            transfer_id;
+        TimePoint                                             timestamp;
+        Window                                                accepted;
+        std::array<Window, IRedundantTransport::MaxInferiors> seen;
+    };
+
+    static TransferId reduce(const TransferId transfer_id, const TransferId modulo) noexcept
+    {
+        return (modulo == std::numeric_limits<TransferId>::max()) ? transfer_id : (transfer_id % modulo);
+    }
+
+    /// Distance (modulo) from `from` transfer ID forward to `to` transfer ID.
+    /// The "max" modulo is treated as 2^64 - so the natural unsigned wraparound is used.
+    ///
+    static TransferId forwardDistance(const TransferId from, const TransferId to, const TransferId modulo) noexcept
+    {
+        return (modulo == std::numeric_limits<TransferId>::max()) ? (to - from) : ((to + modulo - from) % modulo);
+    }
+
+    CETL_NODISCARD Source* findOrInsertSource(const NodeId node_id)
+    {
+        auto* const end = sources_.data() + sources_.size();
+        auto* const it  = std::lower_bound(sources_.data(), end, node_id, [](const Source& source, const NodeId id) {
+            return source.node_id < id;
+        });
+        if ((it != end) && (it->node_id == node_id))
+        {
+            return it;
+        }
+
+        const auto position = static_cast<std::size_t>(it - sources_.data());
+        if (sources_.size() == sources_.capacity())
+        {
+            sources_.reserve(std::max<std::size_t>(sources_.capacity() * 2, 4));
+            if (sources_.size() == sources_.capacity())
+            {
+                return nullptr;
+            }
+        }
+
+        // Keep the array sorted by node ID - move the new (last) source to its position.
+        sources_.push_back(Source{node_id, 0, TimePoint{}, 0, {}});
+        auto* const first = sources_.data();
+        std::rotate(first + position, first + sources_.size() - 1, first + sources_.size());
+        return first + position;
+    }
+
+    /// Drops state of all sources (but not their memory) - transfer IDs tracked so far are meaningless
+    /// with the new modulo. Accepted transfers which haven't been seen by some inferior are still counted as lost.
+    ///
+    void resetSources() noexcept
+    {
+        for (const auto& source : sources_)
+        {
+            flushLosses(source, WindowSize);
+        }
+        sources_.clear();
+    }
+
+    static void restart(Source&            source,
+                        const std::uint8_t inferior_index,
+                        const TransferId   transfer_id,
+                        const TimePoint    timestamp) noexcept
+    {
+        source.transfer_id = transfer_id;
+        source.timestamp   = timestamp;
+        source.accepted    = 1U;
+        source.seen.fill(0);
+        source.seen[inferior_index] = 1U;
+    }
+
+    bool onDuplicate(Source&                        source,
+                     const std::uint8_t             inferior_index,
+                     const std::size_t              bit_index,
+                     const cetl::optional<Duration> lag) noexcept
+    {
+        const Window bit = Window{1} << bit_index;
+        if ((source.seen[inferior_index] & bit) == 0)
+        {
+            source.seen[inferior_index] |= bit;
+            delegate_.inferiorCounters(inferior_index).onLate(lag);
+        }
+        return false;
+    }
+
+    /// Counts losses of the oldest `count` transfer IDs which are about to slide out of the window.
+    ///
+    void flushLosses(const Source& source, const std::size_t count) noexcept
+    {
+        const Window outgoing = (count >= WindowSize) ? ~Window{0} : ~(~Window{0} >> count);
+        for (std::size_t index = 0; index < IRedundantTransport::MaxInferiors; ++index)
+        {
+            if (nullptr != delegate_.getInferior(index))
+            {
+                const Window lost = source.accepted & ~source.seen[index] & outgoing;
+                if (lost != 0)
+                {
+                    delegate_.inferiorCounters(index).onLost(popCount(lost));
+                }
+            }
+        }
+    }
+
+    static std::size_t popCount(Window window) noexcept
+    {
+        std::size_t count = 0;
+        for (; window != 0; window &= (window - 1))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                  delegate_;
+    libcyphal::detail::VarArray<Source> sources_;
+    Duration                            transfer_id_timeout_;
+    TransferId                          transfer_id_modulo_;
+
+};  // Deduplicator
+
+}  // namespace detail
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_DEDUPLICATOR_HPP_INCLUDED
@@ -0,0 +1,360 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_DELEGATE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_DELEGATE_HPP_INCLUDED
+
+#include "redundant_transport.hpp"
+
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+
+/// Internal implementation details of the redundant transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines internal interface of a redundant session.
+///
+/// The transport keeps all its alive sessions in an intrusive list, so that it could
+/// attach (or detach) inferior sessions to all of them when an inferior transport is attached (or detached).
+///
+class ISessionDelegate
+{
+public:
+    ISessionDelegate(const ISessionDelegate&)                = delete;
+    ISessionDelegate(ISessionDelegate&&) noexcept            = delete;
+    ISessionDelegate& operator=(const ISessionDelegate&)     = delete;
+    ISessionDelegate& operator=(ISessionDelegate&&) noexcept = delete;
+
+    /// @brief Makes inferior session at the given index using the given inferior transport.
+    ///
+    virtual cetl::optional<AnyFailure> attachInferior(const std::uint8_t index, ITransport& inferior) = 0;
+
+    /// @brief Destroys inferior session (if any) at the given index.
+    ///
+    virtual void detachInferior(const std::uint8_t index) noexcept = 0;
+
+protected:
+    ISessionDelegate()  = default;
+    ~ISessionDelegate() = default;
+
+private:
+    friend class TransportDelegate;
+
+    // MARK: Data members:
+
+    ISessionDelegate* prev_{nullptr};
+    ISessionDelegate* next_{nullptr};
+
+};  // ISessionDelegate
+
+/// @brief Defines lock-free deduplication counters of an inferior transport.
+///
+/// Counters are updated in the executor context, and could be read (see `snapshot`) from any other thread.
+///
+class InferiorCounters final
+{
+public:
+    using Statistics = IRedundantTransport::InferiorStatistics;
+
+    void onFirst() noexcept
+    {
+        increment(num_first_);
+    }
+
+    /// Counts a late copy - its lag is sampled only if known.
+    ///
+    void onLate(const cetl::optional<Duration> lag) noexcept
+    {
+        increment(num_late_);
+        if (!lag)
+        {
+            return;
+        }
+        increment(num_lag_samples_);
+
+        const auto lag_us = std::chrono::duration_cast<std::chrono::microseconds>(*lag).count();
+        if (lag_us > 0)
+        {
+            const auto lag_us_counter = (lag_us < std::numeric_limits<Statistics::Counter>::max())
+                                            ? static_cast<Statistics::Counter>(lag_us)
+                                            : std::numeric_limits<Statistics::Counter>::max();
+            (void) total_lag_us_.fetch_add(lag_us_counter, std::memory_order_relaxed);
+
+            // There is a single writer (the executor), so plain load and store are enough here.
+            if (lag_us_counter > max_lag_us_.load(std::memory_order_relaxed))
+            {
+                max_lag_us_.store(lag_us_counter, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void onLost(const std::size_t count) noexcept
+    {
+        (void) num_lost_.fetch_add(static_cast<Statistics::Counter>(count), std::memory_order_relaxed);
+    }
+
+    CETL_NODISCARD Statistics snapshot() const noexcept
+    {
+        Statistics stats{};
+        stats.num_first       = num_first_.load(std::memory_order_relaxed);
+        stats.num_late        = num_late_.load(std::memory_order_relaxed);
+        stats.num_lost        = num_lost_.load(std::memory_order_relaxed);
+        stats.num_lag_samples = num_lag_samples_.load(std::memory_order_relaxed);
+        stats.total_lag_us    = total_lag_us_.load(std::memory_order_relaxed);
+        stats.max_lag_us      = max_lag_us_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    CETL_NODISCARD transport::detail::IoCounters& io() noexcept
+    {
+        return io_counters_;
+    }
+
+    CETL_NODISCARD const transport::detail::IoCounters& io() const noexcept
+    {
+        return io_counters_;
+    }
+
+private:
+    using Counter = std::atomic<Statistics::Counter>;
+
+    static void increment(Counter& counter) noexcept
+    {
+        (void) counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // MARK: Data members:
+
+    transport::detail::IoCounters io_counters_;
+    Counter                       num_first_{0};
+    Counter                       num_late_{0};
+    Counter                       num_lost_{0};
+    Counter                       num_lag_samples_{0};
+    Counter                       total_lag_us_{0};
+    Counter                       max_lag_us_{0};
+
+};  // InferiorCounters
+
+/// This internal transport delegate class serves the following purposes:
+/// 1. It keeps the set of attached inferior transports (and their counters).
+/// 2. It keeps the list of alive sessions, so that inferior sessions could be (de)attached on the fly.
+/// 3. It provides an interface to access the transport from various session classes.
+///
+class TransportDelegate
+{
+public:
+    TransportDelegate(const TransportDelegate&)                = delete;
+    TransportDelegate(TransportDelegate&&) noexcept            = delete;
+    TransportDelegate& operator=(const TransportDelegate&)     = delete;
+    TransportDelegate& operator=(TransportDelegate&&) noexcept = delete;
+
+    CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
+    {
+        return memory_;
+    }
+
+    /// @brief Gets the inferior transport at the given index (or `nullptr` if the slot is free).
+    ///
+    CETL_NODISCARD ITransport* getInferior(const std::size_t index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(index < IRedundantTransport::MaxInferiors, "");
+        return inferiors_[index];
+    }
+
+    CETL_NODISCARD InferiorCounters& inferiorCounters(const std::size_t index) noexcept
+    {
+        CETL_DEBUG_ASSERT(index < IRedundantTransport::MaxInferiors, "");
+        return inferior_counters_[index];
+    }
+
+    CETL_NODISCARD transport::detail::IoCounters& transferCounters() noexcept
+    {
+        return transfer_counters_;
+    }
+
+    /// @brief Gets the smallest transfer ID modulo among all attached inferior transports.
+    ///
+    /// Transfer IDs of all inferior copies are compared modulo this value - this way copies of the same transfer
+    /// received via transports with different modulo (f.e. 32 for CAN, and "infinite" for UDP) are still matched.
+    ///
+    CETL_NODISCARD TransferId getTransferIdModulo() const noexcept
+    {
+        return transfer_id_modulo_;
+    }
+
+    /// @brief Attaches inferior sessions to the given (newly made) session - one per each attached inferior.
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> attachInferiorsTo(ISessionDelegate& session) const
+    {
+        for (std::size_t index = 0; index < IRedundantTransport::MaxInferiors; ++index)
+        {
+            if (auto* const inferior = inferiors_[index])
+            {
+                if (auto failure = session.attachInferior(static_cast<std::uint8_t>(index), *inferior))
+                {
+                    return failure;
+                }
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void registerSession(ISessionDelegate& session) noexcept
+    {
+        CETL_DEBUG_ASSERT((session.prev_ == nullptr) && (session.next_ == nullptr), "");
+
+        session.next_ = sessions_head_;
+        if (nullptr != sessions_head_)
+        {
+            sessions_head_->prev_ = &session;
+        }
+        sessions_head_ = &session;
+    }
+
+    void unregisterSession(ISessionDelegate& session) noexcept
+    {
+        if (nullptr != session.prev_)
+        {
+            session.prev_->next_ = session.next_;
+        }
+        else
+        {
+            CETL_DEBUG_ASSERT(sessions_head_ == &session, "");
+            sessions_head_ = session.next_;
+        }
+        if (nullptr != session.next_)
+        {
+            session.next_->prev_ = session.prev_;
+        }
+        session.prev_ = nullptr;
+        session.next_ = nullptr;
+    }
+
+protected:
+    explicit TransportDelegate(cetl::pmr::memory_resource& memory)
+        : memory_{memory}
+        , inferiors_{}
+        , sessions_head_{nullptr}
+        , transfer_id_modulo_{std::numeric_limits<TransferId>::max()}
+    {
+    }
+
+    ~TransportDelegate() = default;
+
+    CETL_NODISCARD const InferiorCounters& inferiorCounters(const std::size_t index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(index < IRedundantTransport::MaxInferiors, "");
+        return inferior_counters_[index];
+    }
+
+    CETL_NODISCARD const transport::detail::IoCounters& transferCounters() const noexcept
+    {
+        return transfer_counters_;
+    }
+
+    /// @brief Attaches inferior transport at the given (free) slot to all alive sessions.
+    ///
+    /// On failure all already made inferior sessions are destroyed, and the slot stays free.
+    ///
+    CETL_NODISCARD cetl::optional<AnyFailure> attachInferiorAt(const std::size_t index, ITransport& inferior)
+    {
+        CETL_DEBUG_ASSERT(inferiors_[index] == nullptr, "");
+
+        const auto index_u8 = static_cast<std::uint8_t>(index);
+        for (auto* session = sessions_head_; session != nullptr; session = session->next_)
+        {
+            if (auto failure = session->attachInferior(index_u8, inferior))
+            {
+                // Roll back to the previous consistent state.
+                for (auto* other = sessions_head_; other != session; other = other->next_)
+                {
+                    other->detachInferior(index_u8);
+                }
+                session->detachInferior(index_u8);
+                return failure;
+            }
+        }
+
+        inferiors_[index] = &inferior;
+        updateTransferIdModulo();
+        return cetl::nullopt;
+    }
+
+    void detachInferiorAt(const std::size_t index) noexcept
+    {
+        const auto index_u8 = static_cast<std::uint8_t>(index);
+        for (auto* session = sessions_head_; session != nullptr; session = session->next_)
+        {
+            session->detachInferior(index_u8);
+        }
+
+        inferiors_[index] = nullptr;
+        updateTransferIdModulo();
+    }
+
+    CETL_NODISCARD bool hasSessions() const noexcept
+    {
+        return sessions_head_ != nullptr;
+    }
+
+private:
+    void updateTransferIdModulo() noexcept
+    {
+        transfer_id_modulo_ = std::numeric_limits<TransferId>::max();
+        for (const auto* const inferior : inferiors_)
+        {
+            if (nullptr != inferior)
+            {
+                const auto modulo = inferior->getProtocolParams().transfer_id_modulo;
+                if ((modulo > 0) && (modulo < transfer_id_modulo_))
+                {
+                    transfer_id_modulo_ = modulo;
+                }
+            }
+        }
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&                                     memory_;
+    std::array<ITransport*, IRedundantTransport::MaxInferiors>      inferiors_;
+    std::array<InferiorCounters, IRedundantTransport::MaxInferiors> inferior_counters_;
+    transport::detail::IoCounters                                   transfer_counters_;
+    ISessionDelegate*                                               sessions_head_;
+    TransferId                                                      transfer_id_modulo_;
+
+};  // TransportDelegate
+
+}  // namespace detail
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_DELEGATE_HPP_INCLUDED
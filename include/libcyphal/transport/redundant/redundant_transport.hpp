@@ -0,0 +1,130 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_HPP_INCLUDED
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/transport/transport.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+
+/// @brief Defines interface of redundant transport layer.
+///
+/// The redundant transport aggregates a set of "inferior" transports (f.e. CAN and UDP),
+/// and provides transfer-level (heterogeneous) redundancy transparently for the users of `ITransport`:
+/// - Every TX session fans out each transfer to all inferior transports. Transmission is considered successful
+///   if at least one inferior transport was able to accept the transfer.
+/// - Every RX session merges transfers received by all inferior transports, and deduplicates them
+///   per source node (by transfer ID), so that only the earliest copy of each transfer is delivered.
+///   The payload of the earliest copy is delivered as is (without any extra copying).
+///
+/// Inferior transports could be attached and detached at any time - existing redundant sessions
+/// retain their validity across such changes (inferior sessions are created or destroyed on the fly).
+///
+/// The `media_index` of the `ITransport::getMediaStatistics` method is the index of an inferior transport
+/// (see `attachInferior`), and its statistics are counted per each inferior transfer copy.
+///
+class IRedundantTransport : public ITransport
+{
+public:
+    /// @brief Defines max number of inferior transports.
+    ///
+    static constexpr std::size_t MaxInferiors = config::Transport::Redundant::IRedundantTransport_MaxInferiors();
+
+    /// @brief Defines a snapshot of the deduplication statistics of an inferior transport.
+    ///
+    /// All counters are monotonically increasing, and they wrap around on overflow.
+    ///
+    struct InferiorStatistics final
+    {
+        using Counter = IoStatistics::Counter;
+
+        /// Number of received transfers which were delivered by this inferior first (aka "won" the race).
+        Counter num_first{0};
+
+        /// Number of received transfers which were delivered by this inferior later than by some other one.
+        Counter num_late{0};
+
+        /// Number of transfers which were delivered by some other inferior, but were never seen by this one.
+        Counter num_lost{0};
+
+        /// Number of late copies with known lag (and so accounted in `total_lag_us` and `max_lag_us`).
+        /// Lag is known only for late copies of the newest transfer (of the same source) - use this counter
+        /// (rather than `num_late`) to get the mean lag.
+        Counter num_lag_samples{0};
+
+        /// Total lag (in microseconds) of the late copies (relative to the earliest copy of the same transfer).
+        Counter total_lag_us{0};
+
+        /// Max lag (in microseconds) of a late copy (relative to the earliest copy of the same transfer).
+        Counter max_lag_us{0};
+
+    };  // InferiorStatistics
+
+    IRedundantTransport(const IRedundantTransport&)                = delete;
+    IRedundantTransport(IRedundantTransport&&) noexcept            = delete;
+    IRedundantTransport& operator=(const IRedundantTransport&)     = delete;
+    IRedundantTransport& operator=(IRedundantTransport&&) noexcept = delete;
+
+    /// @brief Attaches a new inferior transport.
+    ///
+    /// Inferior sessions are made for all existing redundant sessions. If any of them fails,
+    /// all already made inferior sessions are destroyed, and the transport stays as it was before the call.
+    ///
+    /// The inferior must not be anonymous if the redundant transport has its local node ID already set
+    /// (the same node ID is assigned to the inferior), and vice versa - the inferior must be anonymous
+    /// if the redundant transport is anonymous.
+    ///
+    /// @param inferior The inferior transport to attach. Must outlive the redundant transport (or get detached).
+    /// @return Index of the inferior (in range `[0, MaxInferiors)`) - the same as the `media_index` of statistics.
+    ///         Otherwise, an `ArgumentError` if the inferior is already attached, there is no free slot for it,
+    ///         or the local node ID can't be assigned. Any other failure of an inferior session factory.
+    ///
+    virtual Expected<std::uint8_t, AnyFailure> attachInferior(ITransport& inferior) = 0;
+
+    /// @brief Detaches previously attached inferior transport.
+    ///
+    /// All inferior sessions of this inferior transport are destroyed.
+    ///
+    /// @return `nullopt` on success, or `ArgumentError` if the inferior is not attached.
+    ///
+    virtual cetl::optional<ArgumentError> detachInferior(ITransport& inferior) = 0;
+
+    /// @brief Gets a snapshot of the deduplication statistics of an inferior transport.
+    ///
+    /// Note that counters are kept per inferior index, so they are not reset if an inferior is
+    /// detached, and a different one is attached later at the same index.
+    /// The method is safe to call from any thread.
+    ///
+    /// @param inferior_index Index of the inferior (see `attachInferior`).
+    /// @return Statistics of the inferior, or `nullopt` if the index is out of range.
+    ///
+    virtual cetl::optional<InferiorStatistics> getInferiorStatistics(
+        const std::uint8_t inferior_index) const noexcept = 0;
+
+protected:
+    IRedundantTransport()  = default;
+    ~IRedundantTransport() = default;
+
+};  // IRedundantTransport
+
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_HPP_INCLUDED
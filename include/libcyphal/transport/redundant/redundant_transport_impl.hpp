@@ -0,0 +1,351 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_IMPL_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_IMPL_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "redundant_transport.hpp"
+#include "rx_sessions.hpp"
+#include "tx_sessions.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+
+/// Internal implementation details of the redundant transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Represents final implementation class of the redundant transport.
+///
+/// Note that the redundant transport doesn't need an executor of its own - all the work is done
+/// either synchronously (TX fan out), or in the context of inferior RX session callbacks.
+///
+class TransportImpl final : private TransportDelegate, public IRedundantTransport
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IRedundantTransport, TransportImpl>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IRedundantTransport>, FactoryFailure> make(
+        cetl::pmr::memory_resource&   memory,
+        const cetl::span<ITransport*> inferiors)
+    {
+        // Verify input arguments:
+        // - Zero inferiors is fine (they could be attached later), but no more than the maximum allowed.
+        //
+        const auto inferiors_count = static_cast<std::size_t>(
+            std::count_if(inferiors.begin(), inferiors.end(), [](const ITransport* const inferior) -> bool {
+                return inferior != nullptr;
+            }));
+        if (inferiors_count > MaxInferiors)
+        {
+            return ArgumentError{};
+        }
+
+        auto transport = libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, memory);
+        if (transport == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        for (ITransport* const inferior : inferiors)
+        {
+            // There are no sessions yet, so the only possible failures here are about inconsistent arguments
+            // (like duplicate inferiors or conflicting local node IDs).
+            if (inferior != nullptr)
+            {
+                const auto result = transport->attachInferior(*inferior);
+                if (nullptr != cetl::get_if<AnyFailure>(&result))
+                {
+                    return ArgumentError{};
+                }
+            }
+        }
+
+        return transport;
+    }
+
+    TransportImpl(const Spec, cetl::pmr::memory_resource& memory)
+        : TransportDelegate{memory}
+    {
+    }
+
+    TransportImpl(const TransportImpl&)                = delete;
+    TransportImpl(TransportImpl&&) noexcept            = delete;
+    TransportImpl& operator=(const TransportImpl&)     = delete;
+    TransportImpl& operator=(TransportImpl&&) noexcept = delete;
+
+    ~TransportImpl()
+    {
+        CETL_DEBUG_ASSERT(!hasSessions(), "Sessions must be destroyed before transport.");
+    }
+
+private:
+    // MARK: IRedundantTransport
+
+    CETL_NODISCARD Expected<std::uint8_t, AnyFailure> attachInferior(ITransport& inferior) override
+    {
+        if ((&inferior == this) || findInferior(inferior))
+        {
+            return ArgumentError{};
+        }
+
+        std::size_t index = 0;
+        while ((index < MaxInferiors) && (nullptr != getInferior(index)))
+        {
+            ++index;
+        }
+        if (index == MaxInferiors)
+        {
+            return ArgumentError{};
+        }
+
+        // The inferior should have the same node ID as the redundant transport (or be anonymous as well).
+        const auto inferior_node_id = inferior.getLocalNodeId();
+        if (local_node_id_)
+        {
+            if (inferior_node_id ? (*inferior_node_id != *local_node_id_)
+                                 : inferior.setLocalNodeId(*local_node_id_).has_value())
+            {
+                return ArgumentError{};
+            }
+        }
+        else if (inferior_node_id)
+        {
+            return ArgumentError{};
+        }
+
+        if (auto failure = attachInferiorAt(index, inferior))
+        {
+            return std::move(*failure);
+        }
+        return static_cast<std::uint8_t>(index);
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> detachInferior(ITransport& inferior) override
+    {
+        const auto index = findInferior(inferior);
+        if (!index)
+        {
+            return ArgumentError{};
+        }
+
+        detachInferiorAt(*index);
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD cetl::optional<InferiorStatistics> getInferiorStatistics(
+        const std::uint8_t inferior_index) const noexcept override
+    {
+        if (inferior_index >= MaxInferiors)
+        {
+            return cetl::nullopt;
+        }
+
+        return inferiorCounters(inferior_index).snapshot();
+    }
+
+    // MARK: ITransport
+
+    CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
+    {
+        return local_node_id_;
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> setLocalNodeId(const NodeId new_node_id) noexcept override
+    {
+        // Allow setting the same node ID multiple times, but only once otherwise.
+        //
+        if (local_node_id_)
+        {
+            return (*local_node_id_ == new_node_id) ? cetl::nullopt : cetl::optional<ArgumentError>{ArgumentError{}};
+        }
+
+        // Validate against all inferiors first - so that the node ID is either assigned to all of them, or to none.
+        //
+        for (std::size_t index = 0; index < MaxInferiors; ++index)
+        {
+            if (const auto* const inferior = getInferior(index))
+            {
+                const auto inferior_node_id = inferior->getLocalNodeId();
+                if ((new_node_id >= inferior->getProtocolParams().max_nodes) ||
+                    (inferior_node_id && (*inferior_node_id != new_node_id)))
+                {
+                    return ArgumentError{};
+                }
+            }
+        }
+        for (std::size_t index = 0; index < MaxInferiors; ++index)
+        {
+            if (auto* const inferior = getInferior(index))
+            {
+                if (auto failure = inferior->setLocalNodeId(new_node_id))
+                {
+                    return failure;
+                }
+            }
+        }
+
+        local_node_id_ = new_node_id;
+        return cetl::nullopt;
+    }
+
+    /// Protocol parameters are the most restrictive ones among all attached inferiors.
+    ///
+    CETL_NODISCARD ProtocolParams getProtocolParams() const noexcept override
+    {
+        bool           has_inferiors = false;
+        ProtocolParams params{getTransferIdModulo(),
+                              std::numeric_limits<std::size_t>::max(),
+                              std::numeric_limits<NodeId>::max()};
+        for (std::size_t index = 0; index < MaxInferiors; ++index)
+        {
+            if (const auto* const inferior = getInferior(index))
+            {
+                const auto inferior_params = inferior->getProtocolParams();
+                params.mtu_bytes           = std::min(params.mtu_bytes, inferior_params.mtu_bytes);
+                params.max_nodes           = std::min(params.max_nodes, inferior_params.max_nodes);
+                has_inferiors              = true;
+            }
+        }
+        if (!has_inferiors)
+        {
+            params.mtu_bytes = 0;
+            params.max_nodes = 0;
+        }
+        return params;
+    }
+
+    CETL_NODISCARD IoStatistics getTransferStatistics() const noexcept override
+    {
+        return transferCounters().snapshot();
+    }
+
+    CETL_NODISCARD cetl::optional<IoStatistics> getMediaStatistics(
+        const std::uint8_t media_index) const noexcept override
+    {
+        if (media_index >= MaxInferiors)
+        {
+            return cetl::nullopt;
+        }
+
+        return inferiorCounters(media_index).io().snapshot();
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
+        const MessageRxParams& params) override
+    {
+        return MessageRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeMessageTxSession(
+        const MessageTxParams& params) override
+    {
+        return MessageTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestRxSession>, AnyFailure> makeRequestRxSession(
+        const RequestRxParams& params) override
+    {
+        return SvcRequestRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestTxSession>, AnyFailure> makeRequestTxSession(
+        const RequestTxParams& params) override
+    {
+        return SvcRequestTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseRxSession>, AnyFailure> makeResponseRxSession(
+        const ResponseRxParams& params) override
+    {
+        return SvcResponseRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeResponseTxSession(
+        const ResponseTxParams& params) override
+    {
+        return SvcResponseTxSession::make(asDelegate(), params);
+    }
+
+    // MARK: Privates:
+
+    CETL_NODISCARD TransportDelegate& asDelegate() noexcept
+    {
+        return *this;
+    }
+
+    CETL_NODISCARD cetl::optional<std::size_t> findInferior(const ITransport& inferior) const noexcept
+    {
+        for (std::size_t index = 0; index < MaxInferiors; ++index)
+        {
+            if (getInferior(index) == &inferior)
+            {
+                return index;
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    // MARK: Data members:
+
+    cetl::optional<NodeId> local_node_id_;
+
+};  // TransportImpl
+
+}  // namespace detail
+
+/// @brief Makes a new redundant transport instance.
+///
+/// NB! Lifetime of the transport instance must never outlive `memory` and `inferiors` instances.
+///
+/// @param memory Reference to a polymorphic memory resource to use for all allocations.
+/// @param inferiors Collection of initial inferior transports (`nullptr`-s are skipped). Could be empty -
+///                  inferiors could be attached later (see `IRedundantTransport::attachInferior`).
+/// @return Unique pointer to the new redundant transport instance or an error.
+///
+inline Expected<UniquePtr<IRedundantTransport>, FactoryFailure> makeTransport(cetl::pmr::memory_resource&   memory,
+                                                                              const cetl::span<ITransport*> inferiors)
+{
+    return detail::TransportImpl::make(memory, inferiors);
+}
+
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_TRANSPORT_IMPL_HPP_INCLUDED
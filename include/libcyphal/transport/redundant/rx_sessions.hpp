@@ -0,0 +1,249 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_RX_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_RX_SESSIONS_HPP_INCLUDED
+
+#include "deduplicator.hpp"
+#include "delegate.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+namespace detail
+{
+
+inline Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeInferiorSession(ITransport&            inferior,
+                                                                             const MessageRxParams& params)
+{
+    return inferior.makeMessageRxSession(params);
+}
+
+inline Expected<UniquePtr<IRequestRxSession>, AnyFailure> makeInferiorSession(ITransport&            inferior,
+                                                                             const RequestRxParams& params)
+{
+    return inferior.makeRequestRxSession(params);
+}
+
+inline Expected<UniquePtr<IResponseRxSession>, AnyFailure> makeInferiorSession(ITransport&             inferior,
+                                                                              const ResponseRxParams& params)
+{
+    return inferior.makeResponseRxSession(params);
+}
+
+inline cetl::optional<NodeId> getSourceNodeId(const MessageRxTransfer& transfer) noexcept
+{
+    return transfer.metadata.publisher_node_id;
+}
+
+inline cetl::optional<NodeId> getSourceNodeId(const ServiceRxTransfer& transfer) noexcept
+{
+    return transfer.metadata.remote_node_id;
+}
+
+/// @brief A template class to represent a redundant RX session (message subscriber, service request or response).
+///
+/// Holds one inferior session per each attached inferior transport. Transfers received by inferior sessions
+/// are deduplicated (see `Deduplicator`), and only the earliest copy is delivered - by reference to the very same
+/// transfer object the inferior session has provided, so the payload is never copied. Anonymous transfers
+/// can't be deduplicated, so all their copies are delivered.
+///
+/// @tparam Interface_ Type of the session interface.
+///                    Could be either `IMessageRxSession`, `IRequestRxSession` or `IResponseRxSession`.
+/// @tparam Params Type of the session parameters.
+///                Could be either `MessageRxParams`, `RequestRxParams` or `ResponseRxParams`.
+/// @tparam Transfer Type of the received transfer.
+///                  Could be either `MessageRxTransfer` or `ServiceRxTransfer`.
+///
+template <typename Interface_, typename Params, typename Transfer>
+class RxSession final : private ISessionDelegate, public Interface_
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<Interface_, RxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+    using OnReceiveCallback = typename Interface_::OnReceiveCallback;
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<Interface_>, AnyFailure> make(TransportDelegate& delegate,
+                                                                           const Params&      params)
+    {
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        // Make inferior sessions for all currently attached inferior transports.
+        // Any failure here destroys the session (together with its already made inferior sessions).
+        auto& session_delegate = static_cast<ISessionDelegate&>(static_cast<RxSession&>(*session));
+        if (auto failure = delegate.attachInferiorsTo(session_delegate))
+        {
+            return std::move(*failure);
+        }
+
+        return session;
+    }
+
+    RxSession(const Spec, TransportDelegate& delegate, const Params& params)
+        : delegate_{delegate}
+        , params_{params}
+        , deduplicator_{delegate}
+    {
+        delegate_.registerSession(*this);
+    }
+
+    RxSession(const RxSession&)                = delete;
+    RxSession(RxSession&&) noexcept            = delete;
+    RxSession& operator=(const RxSession&)     = delete;
+    RxSession& operator=(RxSession&&) noexcept = delete;
+
+    ~RxSession()
+    {
+        delegate_.unregisterSession(*this);
+    }
+
+private:
+    // MARK: Interface
+
+    CETL_NODISCARD Params getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<Transfer> receive() override
+    {
+        if (last_rx_transfer_)
+        {
+            auto transfer = std::move(*last_rx_transfer_);
+            last_rx_transfer_.reset();
+            return transfer;
+        }
+        return cetl::nullopt;
+    }
+
+    void setOnReceiveCallback(typename OnReceiveCallback::Function&& function) override
+    {
+        on_receive_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration timeout) override
+    {
+        if (timeout > Duration::zero())
+        {
+            transfer_id_timeout_ = timeout;
+            deduplicator_.setTransferIdTimeout(timeout);
+            for (auto& inferior : inferiors_)
+            {
+                if (inferior)
+                {
+                    inferior->setTransferIdTimeout(timeout);
+                }
+            }
+        }
+    }
+
+    // MARK: ISessionDelegate
+
+    cetl::optional<AnyFailure> attachInferior(const std::uint8_t index, ITransport& inferior) override
+    {
+        auto maybe_session = makeInferiorSession(inferior, params_);
+        if (auto* const failure = cetl::get_if<AnyFailure>(&maybe_session))
+        {
+            return std::move(*failure);
+        }
+        auto session = cetl::get<UniquePtr<Interface_>>(std::move(maybe_session));
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        if (transfer_id_timeout_)
+        {
+            session->setTransferIdTimeout(*transfer_id_timeout_);
+        }
+        session->setOnReceiveCallback([this, index](const typename OnReceiveCallback::Arg& arg) {
+            //
+            acceptInferiorTransfer(index, arg.transfer);
+        });
+
+        deduplicator_.resetInferior(index);
+        inferiors_[index] = std::move(session);
+        return cetl::nullopt;
+    }
+
+    void detachInferior(const std::uint8_t index) noexcept override
+    {
+        inferiors_[index].reset();
+    }
+
+    // MARK: Privates:
+
+    void acceptInferiorTransfer(const std::uint8_t index, Transfer& transfer)
+    {
+        delegate_.inferiorCounters(index).io().onReceived();
+
+        const auto source_node_id = getSourceNodeId(transfer);
+        if (source_node_id && !deduplicator_.accept(index, *source_node_id, transfer.metadata.rx_meta))
+        {
+            return;
+        }
+        delegate_.transferCounters().onReceived();
+
+        if (on_receive_cb_fn_)
+        {
+            on_receive_cb_fn_(typename OnReceiveCallback::Arg{transfer});
+            return;
+        }
+        (void) last_rx_transfer_.emplace(std::move(transfer));
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                                                   delegate_;
+    const Params                                                         params_;
+    Deduplicator                                                         deduplicator_;
+    cetl::optional<Duration>                                             transfer_id_timeout_;
+    cetl::optional<Transfer>                                             last_rx_transfer_;
+    typename OnReceiveCallback::Function                                 on_receive_cb_fn_;
+    std::array<UniquePtr<Interface_>, IRedundantTransport::MaxInferiors> inferiors_;
+
+};  // RxSession
+
+using MessageRxSession     = RxSession<IMessageRxSession, MessageRxParams, MessageRxTransfer>;
+using SvcRequestRxSession  = RxSession<IRequestRxSession, RequestRxParams, ServiceRxTransfer>;
+using SvcResponseRxSession = RxSession<IResponseRxSession, ResponseRxParams, ServiceRxTransfer>;
+
+}  // namespace detail
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_RX_SESSIONS_HPP_INCLUDED
@@ -0,0 +1,203 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_REDUNDANT_TX_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_REDUNDANT_TX_SESSIONS_HPP_INCLUDED
+
+#include "delegate.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/transport.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace redundant
+{
+namespace detail
+{
+
+inline Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeInferiorSession(ITransport&            inferior,
+                                                                             const MessageTxParams& params)
+{
+    return inferior.makeMessageTxSession(params);
+}
+
+inline Expected<UniquePtr<IRequestTxSession>, AnyFailure> makeInferiorSession(ITransport&            inferior,
+                                                                             const RequestTxParams& params)
+{
+    return inferior.makeRequestTxSession(params);
+}
+
+inline Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeInferiorSession(ITransport&             inferior,
+                                                                              const ResponseTxParams& params)
+{
+    return inferior.makeResponseTxSession(params);
+}
+
+/// @brief A template class to represent a redundant TX session (message publisher, service request or response).
+///
+/// Holds one inferior session per each attached inferior transport, and fans out every transfer to all of them.
+/// The payload fragments are passed to inferior sessions as is (without any extra copying).
+/// Transmission is considered successful if at least one inferior session has accepted the transfer;
+/// otherwise the failure of the first inferior is returned. Without any inferior transport attached
+/// there is nothing to do, and so the transfer is silently discarded.
+///
+/// @tparam Interface_ Type of the session interface.
+///                    Could be either `IMessageTxSession`, `IRequestTxSession` or `IResponseTxSession`.
+/// @tparam Params Type of the session parameters.
+///                Could be either `MessageTxParams`, `RequestTxParams` or `ResponseTxParams`.
+/// @tparam Metadata Type of the transfer metadata.
+///                  Could be either `TransferTxMetadata` or `ServiceTxMetadata`.
+///
+template <typename Interface_, typename Params, typename Metadata>
+class TxSession final : private ISessionDelegate, public Interface_
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<Interface_, TxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<Interface_>, AnyFailure> make(TransportDelegate& delegate,
+                                                                           const Params&      params)
+    {
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        // Make inferior sessions for all currently attached inferior transports.
+        // Any failure here destroys the session (together with its already made inferior sessions).
+        auto& session_delegate = static_cast<ISessionDelegate&>(static_cast<TxSession&>(*session));
+        if (auto failure = delegate.attachInferiorsTo(session_delegate))
+        {
+            return std::move(*failure);
+        }
+
+        return session;
+    }
+
+    TxSession(const Spec, TransportDelegate& delegate, const Params& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+        delegate_.registerSession(*this);
+    }
+
+    TxSession(const TxSession&)                = delete;
+    TxSession(TxSession&&) noexcept            = delete;
+    TxSession& operator=(const TxSession&)     = delete;
+    TxSession& operator=(TxSession&&) noexcept = delete;
+
+    ~TxSession()
+    {
+        delegate_.unregisterSession(*this);
+    }
+
+private:
+    // MARK: Interface
+
+    CETL_NODISCARD Params getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> send(const Metadata&        metadata,
+                                                   const PayloadFragments payload_fragments) override
+    {
+        bool                       is_sent = false;
+        cetl::optional<AnyFailure> first_failure;
+        for (std::size_t index = 0; index < inferiors_.size(); ++index)
+        {
+            if (auto& inferior = inferiors_[index])
+            {
+                auto& counters = delegate_.inferiorCounters(index).io();
+                if (auto failure = inferior->send(metadata, payload_fragments))
+                {
+                    counters.onFailure(*failure);
+                    if (!first_failure)
+                    {
+                        first_failure = std::move(failure);
+                    }
+                    continue;
+                }
+                counters.onEmitted();
+                is_sent = true;
+            }
+        }
+
+        if (is_sent)
+        {
+            delegate_.transferCounters().onEmitted();
+            return cetl::nullopt;
+        }
+        if (first_failure)
+        {
+            delegate_.transferCounters().onFailure(*first_failure);
+        }
+        return first_failure;
+    }
+
+    // MARK: ISessionDelegate
+
+    cetl::optional<AnyFailure> attachInferior(const std::uint8_t index, ITransport& inferior) override
+    {
+        auto maybe_session = makeInferiorSession(inferior, params_);
+        if (auto* const failure = cetl::get_if<AnyFailure>(&maybe_session))
+        {
+            return std::move(*failure);
+        }
+        auto session = cetl::get<UniquePtr<Interface_>>(std::move(maybe_session));
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        inferiors_[index] = std::move(session);
+        return cetl::nullopt;
+    }
+
+    void detachInferior(const std::uint8_t index) noexcept override
+    {
+        inferiors_[index].reset();
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                                                   delegate_;
+    const Params                                                         params_;
+    std::array<UniquePtr<Interface_>, IRedundantTransport::MaxInferiors> inferiors_;
+
+};  // TxSession
+
+using MessageTxSession     = TxSession<IMessageTxSession, MessageTxParams, TransferTxMetadata>;
+using SvcRequestTxSession  = TxSession<IRequestTxSession, RequestTxParams, TransferTxMetadata>;
+using SvcResponseTxSession = TxSession<IResponseTxSession, ResponseTxParams, ServiceTxMetadata>;
+
+}  // namespace detail
+}  // namespace redundant
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_REDUNDANT_TX_SESSIONS_HPP_INCLUDED
@@ -9,6 +9,7 @@
 #include "libcyphal/config.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 #include <cetl/rtti.hpp>
 #include <cetl/unbounded_variant.hpp>
 
@@ -33,6 +34,31 @@ public:
     ///
     static constexpr std::size_t StorageVariantFootprint = config::Transport::ScatteredBuffer_StorageVariantFootprint();
 
+    /// @brief Defines interface of an observer of the buffer fragments.
+    ///
+    /// @see ScatteredBuffer::observeFragments
+    ///
+    class IFragmentsObserver
+    {
+    public:
+        IFragmentsObserver(const IFragmentsObserver&)                = delete;
+        IFragmentsObserver(IFragmentsObserver&&) noexcept            = delete;
+        IFragmentsObserver& operator=(const IFragmentsObserver&)     = delete;
+        IFragmentsObserver& operator=(IFragmentsObserver&&) noexcept = delete;
+
+        /// @brief Notifies the observer about the next fragment of the buffer.
+        ///
+        /// @param fragment The fragment memory, which is owned by the storage. It stays valid (and unchanged)
+        ///                 for as long as the buffer is neither moved away nor reset.
+        ///
+        virtual void onNext(const cetl::span<const cetl::byte> fragment) = 0;
+
+    protected:
+        IFragmentsObserver()  = default;
+        ~IFragmentsObserver() = default;
+
+    };  // IFragmentsObserver
+
     /// @brief Defines storage interface for the scattered buffer.
     ///
     /// @see ScatteredBuffer::ScatteredBuffer(AnyStorage&& any_storage)
@@ -72,6 +98,20 @@ public:
                                  cetl::byte* const destination,
                                  const std::size_t length_bytes) const = 0;
 
+        /// @brief Passes all non-empty fragments of the storage (in their order) to the observer, without copying.
+        ///
+        /// The default implementation is for storages which can't expose their fragments - it reports so
+        /// (without touching the observer), and the user should fall back to `copy` then.
+        ///
+        /// @return `true` if all fragments have been passed to the observer (possibly none - for empty storage);
+        ///         `false` if the storage doesn't support observation of its fragments.
+        ///
+        virtual bool observeFragments(IFragmentsObserver& observer) const
+        {
+            (void) observer;
+            return false;
+        }
+
         // MARK: RTTI
 
         static constexpr cetl::type_id _get_type_id_() noexcept
@@ -201,6 +241,24 @@ public:
         return storage_->copy(offset_bytes, static_cast<cetl::byte*>(destination), length_bytes);
     }
 
+    /// @brief Passes all non-empty fragments of the buffer (in their order) to the observer, without copying.
+    ///
+    /// Allows to forward the buffer contents (f.e. to a TX session) without gathering them into a contiguous memory.
+    ///
+    /// @return `true` if all fragments have been passed to the observer. `false` if the storage doesn't support
+    ///         observation of its fragments (see `IStorage::observeFragments`), or the instance has been moved away -
+    ///         use `copy` then.
+    ///
+    CETL_NODISCARD bool observeFragments(IFragmentsObserver& observer) const
+    {
+        if (storage_ == nullptr)
+        {
+            return false;
+        }
+
+        return storage_->observeFragments(observer);
+    }
+
 private:
     cetl::unbounded_variant<StorageVariantFootprint, false, true> storage_variant_;
     const IStorage*                                               storage_;
@@ -0,0 +1,406 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_DELEGATE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_DELEGATE_HPP_INCLUDED
+
+#include "frame.hpp"
+
+#include "libcyphal/common/crc.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// This internal session delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access RX session from transport (when a frame for the session port has been received).
+///
+class IRxSessionDelegate
+{
+public:
+    IRxSessionDelegate(const IRxSessionDelegate&)                = delete;
+    IRxSessionDelegate(IRxSessionDelegate&&) noexcept            = delete;
+    IRxSessionDelegate& operator=(const IRxSessionDelegate&)     = delete;
+    IRxSessionDelegate& operator=(IRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Accepts a received frame dedicated to this RX session.
+    ///
+    /// A single-frame transfer is already validated (including its transfer CRC). A frame of a multi-frame
+    /// transfer is passed as is - the session reassembles and validates the transfer (see `TransferReassembler`).
+    ///
+    /// @param header The frame header.
+    /// @param timestamp The time point when the frame has been received.
+    /// @param frame The whole decoded frame (including header and CRC). The session may take ownership of it.
+    /// @param payload_size Size of the frame payload (which follows the header). For a single-frame transfer
+    ///                     it excludes the transfer CRC; otherwise it's the rest of the frame.
+    /// @return `true` if a complete transfer has been accepted; `false` if it was dropped (f.e. as a duplicate),
+    ///         or it's not complete yet.
+    ///
+    virtual bool acceptRxFrame(const FrameHeader& header,
+                               const TimePoint    timestamp,
+                               MediaPayload&      frame,
+                               const std::size_t  payload_size) = 0;
+
+protected:
+    IRxSessionDelegate()  = default;
+    ~IRxSessionDelegate() = default;
+
+};  // IRxSessionDelegate
+
+// MARK: -
+
+/// This internal transport delegate class serves the following purposes:
+/// 1. It provides memory resource and local node ID to the session classes.
+/// 2. It provides an interface to access the transport from various session classes.
+///
+class TransportDelegate
+{
+public:
+    /// @brief Defines kind of an RX session port.
+    ///
+    enum class RxKind : std::uint8_t
+    {
+        Message,
+        Request,
+        Response,
+    };
+
+    /// @brief Makes a key of an RX session port, which is unique per kind and port ID.
+    ///
+    CETL_NODISCARD static std::uint32_t makeRxKey(const RxKind kind, const PortId port_id) noexcept
+    {
+        return (static_cast<std::uint32_t>(kind) << 16U) | port_id;
+    }
+
+    TransportDelegate(const TransportDelegate&)                = delete;
+    TransportDelegate(TransportDelegate&&) noexcept            = delete;
+    TransportDelegate& operator=(const TransportDelegate&)     = delete;
+    TransportDelegate& operator=(TransportDelegate&&) noexcept = delete;
+
+    CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
+    {
+        return memory_;
+    }
+
+    /// Gets local node ID, or `FrameHeader::NodeIdUnset` if the node is anonymous.
+    ///
+    CETL_NODISCARD NodeId getNodeId() const noexcept
+    {
+        return node_id_;
+    }
+
+    /// @brief Sends transfer (as one or more frames) to the media.
+    ///
+    /// Internal method which is in use by TX session implementations to delegate actual sending to transport.
+    /// Source node ID and frame index of the header are filled by the transport.
+    ///
+    CETL_NODISCARD virtual cetl::optional<AnyFailure> sendTransfer(const TimePoint        deadline,
+                                                                   FrameHeader&           header,
+                                                                   const PayloadFragments payload_fragments) = 0;
+
+    /// @brief Prepares registration of an RX session for the given port key (see `makeRxKey`).
+    ///
+    /// Should be called before construction of the session, so that the following `registerRxSession`
+    /// (called from the session constructor) is guaranteed to succeed.
+    ///
+    /// @return `AlreadyExistsError` if there is already a session for the same port,
+    ///         or `MemoryError` if there is no memory to register one more session.
+    ///
+    CETL_NODISCARD virtual cetl::optional<AnyFailure> prepareRxSession(const std::uint32_t rx_key) = 0;
+
+    /// @brief Registers an RX session for the given port key (see `prepareRxSession`).
+    ///
+    virtual void registerRxSession(const std::uint32_t rx_key, IRxSessionDelegate& session) noexcept = 0;
+
+    /// @brief Unregisters previously registered (see `registerRxSession`) RX session.
+    ///
+    virtual void unregisterRxSession(const std::uint32_t rx_key, const IRxSessionDelegate& session) noexcept = 0;
+
+protected:
+    explicit TransportDelegate(cetl::pmr::memory_resource& memory)
+        : memory_{memory}
+        , node_id_{FrameHeader::NodeIdUnset}
+    {
+    }
+
+    ~TransportDelegate() = default;
+
+    void setNodeId(const NodeId node_id) noexcept
+    {
+        node_id_ = node_id;
+    }
+
+private:
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    NodeId                      node_id_;
+
+};  // TransportDelegate
+
+// MARK: -
+
+/// @brief Filters out duplicate transfers (per source node) based on their transfer IDs.
+///
+/// Cyphal/serial transfer IDs are monotonic (never overflow), so a transfer is accepted if its transfer ID
+/// is greater than the last accepted one from the same source, or if the transfer ID timeout has expired
+/// since then (f.e. when the source node has been restarted). Anonymous transfers are not filtered.
+///
+class TransferIdFilter final
+{
+public:
+    explicit TransferIdFilter(cetl::pmr::memory_resource& memory)
+        : sources_{&memory}
+    {
+    }
+
+    void setTransferIdTimeout(const Duration timeout) noexcept
+    {
+        timeout_ = timeout;
+    }
+
+    /// @brief Decides whether the transfer should be accepted.
+    ///
+    /// If there is no memory to track a new source, its transfers are accepted without filtering.
+    ///
+    CETL_NODISCARD bool accept(const NodeId source_node_id, const TransferId transfer_id, const TimePoint timestamp)
+    {
+        Source* const source = ensureSource(source_node_id);
+        if (source == nullptr)
+        {
+            return true;
+        }
+
+        if ((!source->is_initialized) || (transfer_id > source->transfer_id) ||
+            ((timestamp - source->timestamp) > timeout_))
+        {
+            source->is_initialized = true;
+            source->transfer_id    = transfer_id;
+            source->timestamp      = timestamp;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct Source
+    {
+        NodeId     node_id;
+        bool       is_initialized;
+        TransferId transfer_id;
+        TimePoint  timestamp;
+    };
+
+    CETL_NODISCARD Source* ensureSource(const NodeId node_id)
+    {
+        // Next nolint is unavoidable: we need pointer to the end of the sorted array of sources.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* const end = sources_.data() + sources_.size();
+        auto* const it  = std::lower_bound(sources_.data(), end, node_id, [](const Source& source, const NodeId id) {
+            return source.node_id < id;
+        });
+        if ((it != end) && (it->node_id == node_id))
+        {
+            return it;
+        }
+
+        const auto position = static_cast<std::size_t>(it - sources_.data());
+        if (sources_.size() == sources_.capacity())
+        {
+            sources_.reserve(std::max<std::size_t>(sources_.capacity() * 2, 4));
+            if (sources_.size() == sources_.capacity())
+            {
+                return nullptr;
+            }
+        }
+
+        // Keep the array sorted by node ID - move the new (last) source to its position.
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        sources_.push_back(Source{node_id, false, 0, TimePoint{}});
+        auto* const first = sources_.data();
+        std::rotate(first + position, first + sources_.size() - 1, first + sources_.size());
+        return first + position;
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // MARK: Data members:
+
+    Duration                            timeout_{std::chrono::seconds{2}};
+    libcyphal::detail::VarArray<Source> sources_;
+
+};  // TransferIdFilter
+
+// MARK: -
+
+/// @brief Reassembles multi-frame transfers of an RX session.
+///
+/// Frames of a transfer are expected in order - the serial link preserves order, and the sender queues
+/// all frames of a transfer back to back. A frame which doesn't continue the transfer in progress (different source,
+/// transfer ID or frame index) drops it, and only the first frame (index zero) starts a new transfer.
+/// Payload is copied (up to the extent) into a buffer which is then handed over together with the transfer,
+/// while the transfer CRC is verified over the whole payload (including bytes beyond the extent).
+///
+class TransferReassembler final
+{
+public:
+    /// @brief Defines a complete reassembled transfer.
+    ///
+    struct Transfer
+    {
+        /// The time point when the first frame of the transfer has been received.
+        TimePoint timestamp;
+
+        /// Transfer payload truncated to the extent.
+        MediaPayload payload;
+    };
+
+    TransferReassembler(cetl::pmr::memory_resource& memory, const std::size_t extent_bytes)
+        : memory_{memory}
+        , extent_bytes_{extent_bytes}
+    {
+    }
+
+    TransferReassembler(const TransferReassembler&)                = delete;
+    TransferReassembler(TransferReassembler&&) noexcept            = delete;
+    TransferReassembler& operator=(const TransferReassembler&)     = delete;
+    TransferReassembler& operator=(TransferReassembler&&) noexcept = delete;
+
+    ~TransferReassembler()
+    {
+        if (buffer_ != nullptr)
+        {
+            // No Sonar `cpp:S5356` b/c we integrate here PMR.
+            memory_.deallocate(buffer_, extent_bytes_);  // NOSONAR cpp:S5356
+        }
+    }
+
+    /// @brief Accepts the next frame of a multi-frame transfer.
+    ///
+    /// @param header The frame header.
+    /// @param timestamp The time point when the frame has been received.
+    /// @param frame_payload The frame bytes which follow the header.
+    /// @return The complete transfer (on its last frame) if it's valid, otherwise `nullopt`.
+    ///
+    CETL_NODISCARD cetl::optional<Transfer> accept(const FrameHeader&                 header,
+                                                   const TimePoint                    timestamp,
+                                                   const cetl::span<const cetl::byte> frame_payload)
+    {
+        const std::uint32_t frame_index = header.getFrameIndex();
+        if (frame_index == 0)
+        {
+            is_active_        = true;
+            source_node_id_   = header.source_node_id;
+            transfer_id_      = header.transfer_id;
+            timestamp_        = timestamp;
+            next_frame_index_ = 0;
+            size_             = 0;
+            crc_              = common::CRC32C{};
+        }
+        else if ((!is_active_) || (header.source_node_id != source_node_id_) ||
+                 (header.transfer_id != transfer_id_) || (frame_index != next_frame_index_))
+        {
+            is_active_ = false;
+            return cetl::nullopt;
+        }
+
+        if (!append(frame_payload))
+        {
+            is_active_ = false;
+            return cetl::nullopt;
+        }
+        ++next_frame_index_;
+        if (!header.isEndOfTransfer())
+        {
+            return cetl::nullopt;
+        }
+
+        // CRC-32C over the payload and its (appended) CRC yields the constant residue.
+        is_active_ = false;
+        if ((size_ < TransferCrcSize) || (crc_.get() != common::CRC32C::Residue))
+        {
+            return cetl::nullopt;
+        }
+        const std::size_t payload_size = std::min(size_ - TransferCrcSize, extent_bytes_);
+        if (payload_size == 0)
+        {
+            return Transfer{timestamp_, MediaPayload{}};
+        }
+        Transfer transfer{timestamp_, MediaPayload{payload_size, buffer_, extent_bytes_, &memory_}};
+        buffer_ = nullptr;
+        return transfer;
+    }
+
+private:
+    CETL_NODISCARD bool append(const cetl::span<const cetl::byte> bytes)
+    {
+        // Next nolint is unavoidable: we need pointer to the end of the bytes.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        crc_.add(bytes.data(), bytes.data() + bytes.size());
+
+        const std::size_t stored   = std::min(size_, extent_bytes_);
+        const std::size_t to_store = std::min(bytes.size(), extent_bytes_ - stored);
+        if (to_store > 0)
+        {
+            if (buffer_ == nullptr)
+            {
+                // No Sonar `cpp:S5356` b/c we integrate here PMR.
+                buffer_ = static_cast<cetl::byte*>(memory_.allocate(extent_bytes_));  // NOSONAR cpp:S5356
+                if (buffer_ == nullptr)
+                {
+                    return false;
+                }
+            }
+            // Next nolint is unavoidable: we need offset from the beginning of the buffer.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            (void) std::memcpy(buffer_ + stored, bytes.data(), to_store);
+        }
+        size_ += bytes.size();
+        return true;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    const std::size_t           extent_bytes_;
+    cetl::byte*                 buffer_{nullptr};
+    bool                        is_active_{false};
+    NodeId                      source_node_id_{FrameHeader::NodeIdUnset};
+    TransferId                  transfer_id_{0};
+    TimePoint                   timestamp_{};
+    std::uint32_t               next_frame_index_{0};
+    std::size_t                 size_{0};
+    common::CRC32C              crc_{};
+
+};  // TransferReassembler
+
+}  // namespace detail
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_DELEGATE_HPP_INCLUDED
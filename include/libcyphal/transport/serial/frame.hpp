@@ -0,0 +1,576 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_FRAME_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_FRAME_HPP_INCLUDED
+
+#include "libcyphal/common/crc.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines header of a Cyphal/serial frame.
+///
+/// The header has the same layout as the Cyphal/UDP one - 24 bytes (little-endian), with the last two bytes
+/// holding big-endian CRC-16/CCITT-FALSE of the preceding 22 bytes. Header is followed by the payload,
+/// which in turn is followed by little-endian CRC-32C of the whole transfer payload. A transfer which doesn't fit
+/// into a single frame is split (together with its CRC) into several frames - so the CRC might span the last two.
+/// The complete frame (header, payload and CRC) is COBS-encoded, and delimited by zero bytes on the wire.
+///
+struct FrameHeader final
+{
+    static constexpr std::size_t   Size             = 24;
+    static constexpr std::uint8_t  Version          = 1;
+    static constexpr NodeId        NodeIdUnset      = 0xFFFF;
+    static constexpr NodeId        NodeIdMax        = 0xFFFE;
+    static constexpr PortId        SubjectIdMax     = 8191;
+    static constexpr PortId        ServiceIdMax     = 511;
+    static constexpr std::uint16_t ServiceBit       = 0x8000U;
+    static constexpr std::uint16_t RequestBit       = 0x4000U;
+    static constexpr std::uint16_t ServiceIdMask    = 0x3FFFU;
+    static constexpr std::uint32_t EndOfTransferBit = 0x80000000UL;
+    static constexpr std::uint32_t FrameIndexMask   = 0x7FFFFFFFUL;
+
+    using Bytes = std::array<cetl::byte, Size>;
+
+    Priority      priority{Priority::Nominal};
+    NodeId        source_node_id{NodeIdUnset};
+    NodeId        destination_node_id{NodeIdUnset};
+    std::uint16_t data_specifier{};
+    TransferId    transfer_id{};
+    std::uint32_t frame_index_eot{EndOfTransferBit};
+
+    CETL_NODISCARD bool isService() const noexcept
+    {
+        return 0U != (data_specifier & ServiceBit);
+    }
+
+    CETL_NODISCARD bool isRequest() const noexcept
+    {
+        return isService() && (0U != (data_specifier & RequestBit));
+    }
+
+    /// Gets either subject ID (for messages) or service ID (for services).
+    ///
+    CETL_NODISCARD PortId portId() const noexcept
+    {
+        return isService() ? static_cast<PortId>(data_specifier & ServiceIdMask) : data_specifier;
+    }
+
+    /// Whether the frame is the only one of its transfer.
+    ///
+    CETL_NODISCARD bool isSingleFrame() const noexcept
+    {
+        return frame_index_eot == EndOfTransferBit;
+    }
+
+    /// Whether the frame is the last one of its transfer.
+    ///
+    CETL_NODISCARD bool isEndOfTransfer() const noexcept
+    {
+        return 0U != (frame_index_eot & EndOfTransferBit);
+    }
+
+    /// Gets zero-based index of the frame within its transfer.
+    ///
+    CETL_NODISCARD std::uint32_t getFrameIndex() const noexcept
+    {
+        return frame_index_eot & FrameIndexMask;
+    }
+
+    CETL_NODISCARD Bytes serialize() const noexcept
+    {
+        Bytes bytes{};
+        bytes[0] = static_cast<cetl::byte>(Version);
+        bytes[1] = static_cast<cetl::byte>(priority);
+        storeLe(bytes, 2, source_node_id, sizeof(source_node_id));
+        storeLe(bytes, 4, destination_node_id, sizeof(destination_node_id));
+        storeLe(bytes, 6, data_specifier, sizeof(data_specifier));
+        storeLe(bytes, 8, transfer_id, sizeof(transfer_id));
+        storeLe(bytes, 16, frame_index_eot, sizeof(frame_index_eot));
+        // Bytes 20-21 are "user data" - always zero.
+
+        const common::CRC16CCITTFalse crc{bytes.data(), bytes.data() + CrcOffset};
+        bytes[CrcOffset]     = static_cast<cetl::byte>(crc.get() >> 8U);
+        bytes[CrcOffset + 1] = static_cast<cetl::byte>(crc.get() & 0xFFU);
+        return bytes;
+    }
+
+    /// Deserializes header from the given bytes.
+    ///
+    /// @return The header, or `nullopt` if there are not enough bytes, or the version or CRC are not valid.
+    ///
+    CETL_NODISCARD static cetl::optional<FrameHeader> deserialize(const cetl::span<const cetl::byte> bytes) noexcept
+    {
+        if ((bytes.size() < Size) || (bytes[0] != static_cast<cetl::byte>(Version)))
+        {
+            return cetl::nullopt;
+        }
+        const common::CRC16CCITTFalse crc{bytes.data(), bytes.data() + Size};
+        if (crc.get() != 0)
+        {
+            return cetl::nullopt;
+        }
+        const auto priority = static_cast<std::uint8_t>(bytes[1]);
+        if (priority > static_cast<std::uint8_t>(Priority::Optional))
+        {
+            return cetl::nullopt;
+        }
+
+        FrameHeader header{};
+        header.priority            = static_cast<Priority>(priority);
+        header.source_node_id      = static_cast<NodeId>(loadLe(bytes, 2, sizeof(NodeId)));
+        header.destination_node_id = static_cast<NodeId>(loadLe(bytes, 4, sizeof(NodeId)));
+        header.data_specifier      = static_cast<std::uint16_t>(loadLe(bytes, 6, sizeof(std::uint16_t)));
+        header.transfer_id         = loadLe(bytes, 8, sizeof(TransferId));
+        header.frame_index_eot     = static_cast<std::uint32_t>(loadLe(bytes, 16, sizeof(std::uint32_t)));
+        return header;
+    }
+
+private:
+    static constexpr std::size_t CrcOffset = Size - 2;
+
+    static void storeLe(Bytes& bytes, const std::size_t offset, std::uint64_t value, const std::size_t size) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            bytes[offset + i] = static_cast<cetl::byte>(value & 0xFFU);
+            value >>= 8U;
+        }
+    }
+
+    CETL_NODISCARD static std::uint64_t loadLe(const cetl::span<const cetl::byte> bytes,
+                                               const std::size_t                  offset,
+                                               const std::size_t                  size) noexcept
+    {
+        std::uint64_t value = 0;
+        for (std::size_t i = size; i > 0; --i)
+        {
+            value = (value << 8U) | static_cast<std::uint8_t>(bytes[offset + i - 1]);
+        }
+        return value;
+    }
+
+};  // FrameHeader
+
+// MARK: -
+
+/// @brief Defines size (in bytes) of the transfer CRC (CRC-32C) which follows payload of the last frame.
+///
+constexpr std::size_t TransferCrcSize = 4;
+
+/// @brief Makes little-endian bytes of the transfer CRC-32C.
+///
+inline std::array<cetl::byte, TransferCrcSize> makeTransferCrcBytes(const std::uint32_t crc) noexcept
+{
+    return {static_cast<cetl::byte>(crc & 0xFFU),
+            static_cast<cetl::byte>((crc >> 8U) & 0xFFU),
+            static_cast<cetl::byte>((crc >> 16U) & 0xFFU),
+            static_cast<cetl::byte>((crc >> 24U) & 0xFFU)};
+}
+
+// MARK: -
+
+/// @brief Splits transfer payload fragments (followed by the transfer CRC) into consecutive frame payloads.
+///
+class TransferSplitter final
+{
+public:
+    TransferSplitter(const PayloadFragments fragments, const cetl::span<const cetl::byte> crc_bytes) noexcept
+        : fragments_{fragments}
+        , crc_bytes_{crc_bytes}
+    {
+    }
+
+    /// Passes the next `size` bytes (as one or more spans) to the given consumer.
+    ///
+    template <typename Consumer>
+    void next(std::size_t size, Consumer&& consumer)
+    {
+        while (size > 0)
+        {
+            const bool is_crc = fragment_index_ == fragments_.size();
+            const auto bytes  = is_crc ? crc_bytes_ : fragments_[fragment_index_];
+
+            const std::size_t chunk = std::min(size, bytes.size() - offset_);
+            if (chunk > 0)
+            {
+                consumer(bytes.subspan(offset_, chunk));
+                offset_ += chunk;
+                size -= chunk;
+            }
+            if (offset_ == bytes.size())
+            {
+                if (is_crc)
+                {
+                    CETL_DEBUG_ASSERT(size == 0, "There is nothing left to split.");
+                    break;
+                }
+                ++fragment_index_;
+                offset_ = 0;
+            }
+        }
+    }
+
+private:
+    // MARK: Data members:
+
+    PayloadFragments             fragments_;
+    cetl::span<const cetl::byte> crc_bytes_;
+    std::size_t                  fragment_index_{0};
+    std::size_t                  offset_{0};
+
+};  // TransferSplitter
+
+// MARK: -
+
+/// @brief Implements Consistent Overhead Byte Stuffing (COBS) encoding of a frame.
+///
+/// The encoder is incremental - input could be provided piece by piece (f.e. header, payload fragments and CRC),
+/// so that there is no need to concatenate them first. The output doesn't include frame delimiters.
+///
+class CobsEncoder final
+{
+public:
+    /// Gets max possible size of the encoded output for the given size of input.
+    ///
+    static constexpr std::size_t getMaxEncodedSize(const std::size_t size) noexcept
+    {
+        return size + (size / (MaxCode - 1U)) + 1;
+    }
+
+    /// Constructs a new encoder.
+    ///
+    /// @param output The output buffer. Must be at least `getMaxEncodedSize` bytes long for the total input.
+    ///
+    explicit CobsEncoder(const cetl::span<cetl::byte> output) noexcept
+        : output_{output}
+    {
+        CETL_DEBUG_ASSERT(!output_.empty(), "");
+    }
+
+    void encode(const cetl::span<const cetl::byte> bytes) noexcept
+    {
+        for (const cetl::byte byte : bytes)
+        {
+            if (byte != cetl::byte{0})
+            {
+                CETL_DEBUG_ASSERT(index_ < output_.size(), "Output buffer is too small.");
+                output_[index_++] = byte;
+                ++code_;
+                if (code_ < MaxCode)
+                {
+                    continue;
+                }
+            }
+            closeBlock();
+        }
+    }
+
+    /// Finishes encoding, and returns the total number of encoded bytes.
+    ///
+    CETL_NODISCARD std::size_t finish() noexcept
+    {
+        output_[code_index_] = static_cast<cetl::byte>(code_);
+        return index_;
+    }
+
+private:
+    static constexpr std::uint8_t MaxCode = 0xFF;
+
+    void closeBlock() noexcept
+    {
+        CETL_DEBUG_ASSERT(index_ < output_.size(), "Output buffer is too small.");
+        output_[code_index_] = static_cast<cetl::byte>(code_);
+        code_index_          = index_++;
+        code_                = 1;
+    }
+
+    // MARK: Data members:
+
+    cetl::span<cetl::byte> output_;
+    std::size_t            code_index_{0};
+    std::size_t            index_{1};
+    std::uint8_t           code_{1};
+
+};  // CobsEncoder
+
+// MARK: -
+
+/// @brief Reassembles COBS-encoded frames from a stream of raw byte chunks.
+///
+/// Frames are decoded in place - straight into a frame buffer (allocated from the given memory resource),
+/// which is then handed over to the user as a `MediaPayload`. If the user takes ownership of the payload,
+/// the next frame will be decoded into a newly allocated buffer; otherwise the same buffer is reused.
+/// Runs of data bytes are copied in bulk, so that cost per byte is low even for big chunks.
+///
+class FrameReader final
+{
+public:
+    /// Constructs a new reader.
+    ///
+    /// @param memory The memory resource to allocate frame buffers from.
+    /// @param max_frame_size Max size of a decoded frame; bigger frames are dropped.
+    ///
+    FrameReader(cetl::pmr::memory_resource& memory, const std::size_t max_frame_size)
+        : memory_{memory}
+        , max_frame_size_{max_frame_size}
+    {
+    }
+
+    FrameReader(const FrameReader&)                = delete;
+    FrameReader(FrameReader&&) noexcept            = delete;
+    FrameReader& operator=(const FrameReader&)     = delete;
+    FrameReader& operator=(FrameReader&&) noexcept = delete;
+
+    ~FrameReader()
+    {
+        if (buffer_ != nullptr)
+        {
+            // No Sonar `cpp:S5356` b/c we integrate here PMR.
+            memory_.deallocate(buffer_, max_frame_size_);  // NOSONAR cpp:S5356
+        }
+    }
+
+    /// Consumes next chunk of raw bytes.
+    ///
+    /// @param chunk The chunk of raw bytes. Might contain any number of complete or partial frames.
+    /// @param on_frame Called per each complete (non-empty) frame with a `MediaPayload&` argument.
+    ///                 The payload could be moved away to take ownership of the frame buffer.
+    /// @param on_drop Called with an `AnyFailure` argument per each frame which was dropped
+    ///                (due to malformed encoding, excessive size, or lack of memory).
+    ///
+    template <typename OnFrame, typename OnDrop>
+    void read(const cetl::span<const cetl::byte> chunk, OnFrame&& on_frame, OnDrop&& on_drop)
+    {
+        std::size_t index = 0;
+        while (index < chunk.size())
+        {
+            if (remaining_ == 0)
+            {
+                // We are at the code byte (or at the frame delimiter).
+                //
+                const auto code = static_cast<std::uint8_t>(chunk[index++]);
+                if (code == 0)
+                {
+                    finishFrame(on_frame, on_drop);
+                    continue;
+                }
+                if (pending_zero_)
+                {
+                    constexpr cetl::byte Zero{0};
+                    append(&Zero, 1);
+                }
+                remaining_    = static_cast<std::uint8_t>(code - 1U);
+                pending_zero_ = (code != MaxCode);
+                continue;
+            }
+
+            // Copy in bulk the run of data bytes of the current block (which is available in this chunk).
+            // A zero byte inside of the block means a premature frame delimiter (aka malformed frame).
+            //
+            // Next nolint is unavoidable: we need pointers to the run of bytes inside of the chunk.
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const std::size_t run     = std::min<std::size_t>(remaining_, chunk.size() - index);
+            const auto* const begin   = chunk.data() + index;
+            const auto* const run_end = begin + run;
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto* const zero_ptr = std::find(begin, run_end, cetl::byte{0});
+            const auto        count    = static_cast<std::size_t>(zero_ptr - begin);
+            append(begin, count);
+            remaining_ = static_cast<std::uint8_t>(remaining_ - count);
+            index += count;
+            if (zero_ptr != run_end)
+            {
+                ++index;
+                on_drop(AnyFailure{ArgumentError{}});
+                resetFrame();
+            }
+        }
+    }
+
+private:
+    static constexpr std::uint8_t MaxCode = 0xFF;
+
+    void append(const cetl::byte* const data, const std::size_t size)
+    {
+        if (is_dropped_ || (size == 0))
+        {
+            return;
+        }
+        if ((size_ + size) > max_frame_size_)
+        {
+            drop_failure_ = ArgumentError{};
+            is_dropped_   = true;
+            return;
+        }
+        if (buffer_ == nullptr)
+        {
+            // No Sonar `cpp:S5356` b/c we integrate here PMR.
+            buffer_ = static_cast<cetl::byte*>(memory_.allocate(max_frame_size_));  // NOSONAR cpp:S5356
+            if (buffer_ == nullptr)
+            {
+                drop_failure_ = MemoryError{};
+                is_dropped_   = true;
+                return;
+            }
+        }
+        // Next nolint is unavoidable: we need offset from the beginning of the buffer.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        (void) std::memcpy(buffer_ + size_, data, size);
+        size_ += size;
+    }
+
+    template <typename OnFrame, typename OnDrop>
+    void finishFrame(OnFrame& on_frame, OnDrop& on_drop)
+    {
+        if (is_dropped_)
+        {
+            on_drop(AnyFailure{drop_failure_});
+        }
+        else if (size_ > 0)
+        {
+            MediaPayload payload{size_, buffer_, max_frame_size_, &memory_};
+            on_frame(payload);
+
+            // Reuse the buffer if the frame handler has not taken ownership of it.
+            buffer_ = payload.release().data;
+        }
+        else
+        {
+            // Empty frame (f.e. between two adjacent delimiters) - nothing to do.
+        }
+        resetFrame();
+    }
+
+    void resetFrame() noexcept
+    {
+        size_         = 0;
+        remaining_    = 0;
+        pending_zero_ = false;
+        is_dropped_   = false;
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    const std::size_t           max_frame_size_;
+    cetl::byte*                 buffer_{nullptr};
+    std::size_t                 size_{0};
+    std::uint8_t                remaining_{0};
+    bool                        pending_zero_{false};
+    bool                        is_dropped_{false};
+    AnyFailure                  drop_failure_{ArgumentError{}};
+
+};  // FrameReader
+
+// MARK: -
+
+/// @brief Defines scattered buffer storage of a received frame payload.
+///
+/// Owns the whole (decoded) frame buffer, but exposes only its payload part - so that
+/// the payload is delivered to the user without any extra copying.
+///
+class FrameStorage final : public ScatteredBuffer::IStorage
+{
+public:
+    FrameStorage(MediaPayload&& frame, const std::size_t offset, const std::size_t size)
+        : frame_{std::move(frame)}
+        , offset_{offset}
+        , size_{size}
+    {
+        CETL_DEBUG_ASSERT((offset_ + size_) <= frame_.getSpan().size(), "");
+    }
+    FrameStorage(FrameStorage&& other) noexcept
+        : frame_{std::move(other.frame_)}
+        , offset_{std::exchange(other.offset_, 0)}
+        , size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    FrameStorage(const FrameStorage&)                = delete;
+    FrameStorage& operator=(const FrameStorage&)     = delete;
+    FrameStorage& operator=(FrameStorage&&) noexcept = delete;
+
+    ~FrameStorage() = default;
+
+    // MARK: ScatteredBuffer::IStorage
+
+    CETL_NODISCARD std::size_t size() const noexcept override
+    {
+        return size_;
+    }
+
+    CETL_NODISCARD std::size_t copy(const std::size_t offset_bytes,
+                                    cetl::byte* const destination,
+                                    const std::size_t length_bytes) const override
+    {
+        CETL_DEBUG_ASSERT((destination != nullptr) || (length_bytes == 0),
+                          "Destination could be null only with zero bytes ask.");
+
+        const auto frame = frame_.getSpan();
+        if ((destination == nullptr) || (frame.data() == nullptr) || (size_ <= offset_bytes))
+        {
+            return 0;
+        }
+
+        const std::size_t bytes_to_copy = std::min(length_bytes, size_ - offset_bytes);
+        // Next nolint is unavoidable: we need offset from the beginning of the buffer.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        (void) std::memmove(destination, frame.data() + offset_ + offset_bytes, bytes_to_copy);
+        return bytes_to_copy;
+    }
+
+    bool observeFragments(ScatteredBuffer::IFragmentsObserver& observer) const override
+    {
+        const auto frame = frame_.getSpan();
+        if ((frame.data() != nullptr) && (size_ > 0))
+        {
+            observer.onNext(frame.subspan(offset_, size_));
+        }
+        return true;
+    }
+
+private:
+    // MARK: Data members:
+
+    MediaPayload frame_;
+    std::size_t  offset_;
+    std::size_t  size_;
+
+};  // FrameStorage
+
+}  // namespace detail
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_FRAME_HPP_INCLUDED
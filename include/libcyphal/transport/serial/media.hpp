@@ -0,0 +1,127 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <cstddef>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// @brief Defines interface to a custom serial (byte stream) media implementation.
+///
+/// The media is a plain bidirectional stream of bytes - f.e. a UART, a pseudo-terminal,
+/// a UNIX domain socket or a TCP connection. Framing is done entirely by the transport layer,
+/// so the media is free to read and write as many bytes at once as it can (the bigger chunks the better).
+///
+/// Implementation is supposed to be provided by an user of the library.
+///
+class IMedia
+{
+public:
+    IMedia(const IMedia&)                = delete;
+    IMedia(IMedia&&) noexcept            = delete;
+    IMedia& operator=(const IMedia&)     = delete;
+    IMedia& operator=(IMedia&&) noexcept = delete;
+
+    /// @brief Reads next chunk of raw bytes from the stream unless there is nothing to read.
+    ///
+    /// A single chunk may contain any number of frames (including partial ones) -
+    /// the transport layer will reassemble them across multiple reads.
+    ///
+    /// @param buffer The chunk bytes will be written into the mutable `buffer` (aka span).
+    /// @return Description of the chunk if available; otherwise an empty optional is returned immediately.
+    ///@{
+    struct ReadResult
+    {
+        struct Metadata
+        {
+            /// Holds time point when the chunk was received by the media.
+            TimePoint timestamp;
+
+            /// Holds number of bytes written into the buffer. Never zero.
+            std::size_t size{};
+        };
+        using Success = cetl::optional<Metadata>;
+        using Failure = MediaFailure;
+
+        using Type = Expected<Success, Failure>;
+    };
+    CETL_NODISCARD virtual ReadResult::Type read(const cetl::span<cetl::byte> buffer) noexcept = 0;
+    ///@}
+
+    /// @brief Writes raw bytes of the fragments (in order) to the stream.
+    ///
+    /// The fragments are usually several complete (already encoded) frames, so that the media could write them
+    /// all at once (f.e. with vectorized `::writev` POSIX api). Partial writes are fine - the transport layer
+    /// will try to write the rest later (see `registerWriteCallback`).
+    ///
+    /// @param fragments Fragments of raw bytes to write.
+    /// @return Number of bytes (from the very beginning of the fragments) which were accepted by the media.
+    ///         Zero if the media is not ready for writing.
+    ///@{
+    struct WriteResult
+    {
+        struct Success
+        {
+            std::size_t bytes_written;
+        };
+        using Failure = MediaFailure;
+
+        using Type = Expected<Success, Failure>;
+    };
+    virtual WriteResult::Type write(const PayloadFragments fragments) noexcept = 0;
+    ///@}
+
+    /// @brief Registers "ready to write" callback function at a given executor.
+    ///
+    /// The callback will be called by an executor when this media will be ready to accept more data.
+    ///
+    /// For example, POSIX implementation may pass its file descriptor to the executor implementation,
+    /// and executor will use `::poll` POSIX api & `POLLOUT` event to schedule this callback for execution.
+    ///
+    /// @param function The function to be called when the media became "ready to write".
+    /// @return Type-erased instance of the registered callback.
+    ///         Instance must not outlive the executor; otherwise undefined behavior.
+    ///
+    CETL_NODISCARD virtual IExecutor::Callback::Any registerWriteCallback(IExecutor::Callback::Function&& function) = 0;
+
+    /// @brief Registers "ready to read" callback function at a given executor.
+    ///
+    /// The callback will be called by an executor when this media will have some data to read.
+    ///
+    /// For example, POSIX implementation may pass its file descriptor to the executor implementation,
+    /// and executor will use `::poll` POSIX api & `POLLIN` event to schedule this callback for execution.
+    ///
+    /// @param function The function to be called when the media became "ready to read".
+    /// @return Type-erased instance of the registered callback.
+    ///         Instance must not outlive the executor; otherwise undefined behavior.
+    ///
+    CETL_NODISCARD virtual IExecutor::Callback::Any registerReadCallback(IExecutor::Callback::Function&& function) = 0;
+
+protected:
+    IMedia()  = default;
+    ~IMedia() = default;
+
+};  // IMedia
+
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_HPP_INCLUDED
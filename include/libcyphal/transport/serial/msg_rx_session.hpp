@@ -0,0 +1,203 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_MSG_RX_SESSION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_MSG_RX_SESSION_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A class to represent a message subscriber RX session.
+///
+class MessageRxSession final : private IRxSessionDelegate, public IMessageRxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IMessageRxSession, MessageRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IMessageRxSession>, AnyFailure> make(TransportDelegate&     delegate,
+                                                                                  const MessageRxParams& params)
+    {
+        if (params.subject_id > FrameHeader::SubjectIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        if (auto failure = delegate.prepareRxSession(makeRxKey(params)))
+        {
+            return std::move(*failure);
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    MessageRxSession(const Spec, TransportDelegate& delegate, const MessageRxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+        , tid_filter_{delegate.memory()}
+        , reassembler_{delegate.memory(), params.extent_bytes}
+    {
+        delegate.registerRxSession(makeRxKey(params), *this);
+    }
+
+    MessageRxSession(const MessageRxSession&)                = delete;
+    MessageRxSession(MessageRxSession&&) noexcept            = delete;
+    MessageRxSession& operator=(const MessageRxSession&)     = delete;
+    MessageRxSession& operator=(MessageRxSession&&) noexcept = delete;
+
+    ~MessageRxSession()
+    {
+        delegate_.unregisterRxSession(makeRxKey(params_), *this);
+    }
+
+private:
+    // MARK: IMessageRxSession
+
+    CETL_NODISCARD MessageRxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<MessageRxTransfer> receive() override
+    {
+        if (last_rx_transfer_)
+        {
+            auto transfer = std::move(*last_rx_transfer_);
+            last_rx_transfer_.reset();
+            return transfer;
+        }
+        return cetl::nullopt;
+    }
+
+    void setOnReceiveCallback(OnReceiveCallback::Function&& function) override
+    {
+        on_receive_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration timeout) override
+    {
+        if (timeout >= Duration::zero())
+        {
+            tid_filter_.setTransferIdTimeout(timeout);
+        }
+    }
+
+    // MARK: IRxSessionDelegate
+
+    bool acceptRxFrame(const FrameHeader& header,
+                       const TimePoint    timestamp,
+                       MediaPayload&      frame,
+                       const std::size_t  payload_size) override
+    {
+        if (!header.isSingleFrame())
+        {
+            // Multi-frame transfers are never anonymous (the transport has already dropped such frames).
+            auto transfer =
+                reassembler_.accept(header, timestamp, frame.getSpan().subspan(FrameHeader::Size, payload_size));
+            if ((!transfer) || (!tid_filter_.accept(header.source_node_id, header.transfer_id, transfer->timestamp)))
+            {
+                return false;
+            }
+            const std::size_t size = transfer->payload.getSpan().size();
+            acceptTransfer(header, transfer->timestamp, FrameStorage{std::move(transfer->payload), 0, size});
+            return true;
+        }
+
+        const bool is_anonymous = header.source_node_id == FrameHeader::NodeIdUnset;
+        if ((!is_anonymous) && (!tid_filter_.accept(header.source_node_id, header.transfer_id, timestamp)))
+        {
+            return false;
+        }
+
+        // Payload beyond the extent is implicitly truncated (but the frame buffer is kept as is - no copying).
+        acceptTransfer(header,
+                       timestamp,
+                       FrameStorage{std::move(frame), FrameHeader::Size, std::min(payload_size, params_.extent_bytes)});
+        return true;
+    }
+
+    // MARK: Privates:
+
+    void acceptTransfer(const FrameHeader& header, const TimePoint timestamp, FrameStorage&& storage)
+    {
+        const cetl::optional<NodeId> publisher_node_id =
+            (header.source_node_id == FrameHeader::NodeIdUnset) ? cetl::nullopt
+                                                                : cetl::make_optional<NodeId>(header.source_node_id);
+
+        const MessageRxMetadata meta{{{header.transfer_id, header.priority}, timestamp}, publisher_node_id};
+        MessageRxTransfer       msg_rx_transfer{meta, ScatteredBuffer{std::move(storage)}};
+        if (on_receive_cb_fn_)
+        {
+            on_receive_cb_fn_(OnReceiveCallback::Arg{msg_rx_transfer});
+            return;
+        }
+        (void) last_rx_transfer_.emplace(std::move(msg_rx_transfer));
+    }
+
+    CETL_NODISCARD static std::uint32_t makeRxKey(const MessageRxParams& params) noexcept
+    {
+        return TransportDelegate::makeRxKey(TransportDelegate::RxKind::Message, params.subject_id);
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                delegate_;
+    const MessageRxParams             params_;
+    TransferIdFilter                  tid_filter_;
+    TransferReassembler               reassembler_;
+    cetl::optional<MessageRxTransfer> last_rx_transfer_;
+    OnReceiveCallback::Function       on_receive_cb_fn_;
+
+};  // MessageRxSession
+
+}  // namespace detail
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_MSG_RX_SESSION_HPP_INCLUDED
@@ -0,0 +1,107 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/transport.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pmr/function.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// @brief Defines interface of serial transport layer.
+///
+/// The transport runs Cyphal/serial protocol over a byte stream media (see `IMedia`): every transfer is sent
+/// as a single COBS-encoded frame, which is protected by CRC-16 (header) and CRC-32C (payload) checksums.
+/// Unlike CAN and UDP transports, there is only one media - redundancy (if needed) could be achieved
+/// by aggregating several serial transports with the `redundant` transport.
+///
+class ISerialTransport : public ITransport
+{
+public:
+    /// Defines structure for reporting transient transport errors to the user's handler.
+    ///
+    struct TransientErrorReport
+    {
+        /// @brief Error report about reading raw bytes from the media interface.
+        struct MediaRead
+        {
+            AnyFailure failure;
+            IMedia&    culprit;
+        };
+
+        /// @brief Error report about writing raw bytes to the media interface.
+        struct MediaWrite
+        {
+            AnyFailure failure;
+            IMedia&    culprit;
+        };
+
+        /// Defines variant of all possible transient error reports.
+        ///
+        using Variant = cetl::variant<MediaRead, MediaWrite>;
+
+    };  // TransientErrorReport
+
+    /// @brief Defines signature of a transient error handler.
+    ///
+    /// If set, this handler is called by the transport layer when a transient media related error occurs during
+    /// transport's reception or transmission of data.
+    ///
+    /// Note that there is a limited set of things that can be done within this handler, f.e.:
+    /// - it's not allowed to call a TX session `send` or RX session `receive` methods from within this handler;
+    /// - main purpose of the handler is to log/report/stat the error, and potentially modify state of the media.
+    ///
+    /// @param report The error report to be handled.
+    /// @return An optional (maybe different) error back to the transport. Currently the result is only
+    ///         in use for media write failures which happen synchronously during TX session `send` -
+    ///         `cetl::nullopt` means that the error is considered as handled and insignificant,
+    ///         otherwise the returned failure is propagated to the user (as result of the `send`).
+    ///
+    using TransientErrorHandler =
+        cetl::pmr::function<cetl::optional<AnyFailure>(TransientErrorReport::Variant& report_var),
+                            config::Transport::Serial::ISerialTransport_TransientErrorHandlerMaxSize()>;
+
+    /// @brief Defines max payload size (in bytes) of a single frame.
+    ///
+    /// Bigger transfers are split into multiple frames.
+    ///
+    static constexpr std::size_t Mtu = config::Transport::Serial::ISerialTransport_Mtu();
+
+    ISerialTransport(const ISerialTransport&)                = delete;
+    ISerialTransport(ISerialTransport&&) noexcept            = delete;
+    ISerialTransport& operator=(const ISerialTransport&)     = delete;
+    ISerialTransport& operator=(ISerialTransport&&) noexcept = delete;
+
+    /// Sets new transient error handler.
+    ///
+    /// - If the handler is set, it will be called by the transport layer when a transient media related error occurs.
+    /// - If the handler is not set (default mode), media write failures are propagated to the user as is,
+    ///   and media read failures are only counted (see `getMediaStatistics`).
+    ///
+    virtual void setTransientErrorHandler(TransientErrorHandler handler) = 0;
+
+protected:
+    ISerialTransport()  = default;
+    ~ISerialTransport() = default;
+
+};  // ISerialTransport
+
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_HPP_INCLUDED
@@ -0,0 +1,720 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_IMPL_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_IMPL_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame.hpp"
+#include "media.hpp"
+#include "msg_rx_session.hpp"
+#include "msg_tx_session.hpp"
+#include "serial_transport.hpp"
+#include "svc_rx_sessions.hpp"
+#include "svc_tx_sessions.hpp"
+
+#include "libcyphal/common/crc.hpp"
+#include "libcyphal/config.hpp"
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Represents final implementation class of the serial transport.
+///
+/// TX transfers are split into frames (of up to `Mtu` payload bytes each), which are encoded (COBS) right away,
+/// and queued (all frames of a transfer back to back) into a fixed capacity ring. The queue is flushed by writing
+/// several frames at once (see `ISerialTransport_WriteMaxFrames`). RX bytes are read by big chunks
+/// (see `ISerialTransport_ReadChunkSize`), and decoded directly into frame buffers. A single-frame transfer
+/// buffer is then handed over (without copying) to the RX session as the transfer payload, while frames
+/// of a multi-frame transfer are reassembled by the RX session (see `TransferReassembler`).
+///
+class TransportImpl final : private TransportDelegate, public ISerialTransport
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<ISerialTransport, TransportImpl>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+    /// @brief Defines an encoded frame (including both delimiters) which is waiting for transmission.
+    ///
+    struct TxItem
+    {
+        TimePoint    deadline;
+        MediaPayload frame;
+
+        /// Number of frame bytes already written to the media.
+        std::size_t offset;
+    };
+    using TxQueue = libcyphal::detail::VarArray<cetl::optional<TxItem>>;
+
+    /// @brief Defines a registered RX session (kept sorted by the port key).
+    ///
+    struct RxPort
+    {
+        std::uint32_t       key;
+        IRxSessionDelegate* delegate;
+    };
+
+    static constexpr std::size_t ReadChunkSize  = config::Transport::Serial::ISerialTransport_ReadChunkSize();
+    static constexpr std::size_t WriteMaxFrames = config::Transport::Serial::ISerialTransport_WriteMaxFrames();
+    static constexpr std::size_t MaxFrameSize   = FrameHeader::Size + Mtu + TransferCrcSize;
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<ISerialTransport>, FactoryFailure> make(
+        cetl::pmr::memory_resource& memory,
+        IExecutor&                  executor,
+        IMedia&                     media,
+        const std::size_t           tx_capacity)
+    {
+        // Verify input arguments:
+        // - At least one frame should fit into the TX queue.
+        //
+        if (tx_capacity == 0)
+        {
+            return ArgumentError{};
+        }
+
+        TxQueue tx_queue{&memory};
+        tx_queue.reserve(tx_capacity);
+        if (tx_queue.capacity() < tx_capacity)
+        {
+            return MemoryError{};
+        }
+        for (std::size_t index = 0; index < tx_capacity; ++index)
+        {
+            tx_queue.emplace_back();
+        }
+
+        auto transport =
+            libcyphal::detail::makeUniquePtr<Spec>(memory, Spec{}, memory, executor, media, std::move(tx_queue));
+        if (transport == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return transport;
+    }
+
+    TransportImpl(const Spec,
+                  cetl::pmr::memory_resource& memory,
+                  IExecutor&                  executor,
+                  IMedia&                     media,
+                  TxQueue&&                   tx_queue)
+        : TransportDelegate{memory}
+        , executor_{executor}
+        , media_{media}
+        , tx_queue_{std::move(tx_queue)}
+        , tx_head_{0}
+        , tx_count_{0}
+        , rx_ports_{&memory}
+        , frame_reader_{memory, MaxFrameSize}
+        , rx_chunk_{}
+    {
+    }
+
+    TransportImpl(const TransportImpl&)                = delete;
+    TransportImpl(TransportImpl&&) noexcept            = delete;
+    TransportImpl& operator=(const TransportImpl&)     = delete;
+    TransportImpl& operator=(TransportImpl&&) noexcept = delete;
+
+    ~TransportImpl()
+    {
+        rx_callback_.reset();
+        tx_callback_.reset();
+
+        CETL_DEBUG_ASSERT(rx_ports_.empty(), "RX sessions must be destroyed before transport.");
+    }
+
+    // In use (public) for unit tests only.
+    CETL_NODISCARD TransportDelegate& asDelegate()
+    {
+        return *this;
+    }
+
+private:
+    using Callback = IExecutor::Callback;
+
+    // MARK: ISerialTransport
+
+    void setTransientErrorHandler(TransientErrorHandler handler) override
+    {
+        transient_error_handler_ = std::move(handler);
+    }
+
+    // MARK: ITransport
+
+    CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
+    {
+        if (getNodeId() > FrameHeader::NodeIdMax)
+        {
+            return cetl::nullopt;
+        }
+
+        return cetl::make_optional(getNodeId());
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> setLocalNodeId(const NodeId new_node_id) noexcept override
+    {
+        if (new_node_id > FrameHeader::NodeIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        // Allow setting the same node ID multiple times, but only once otherwise.
+        //
+        if (getNodeId() == new_node_id)
+        {
+            return cetl::nullopt;
+        }
+        if (getNodeId() != FrameHeader::NodeIdUnset)
+        {
+            return ArgumentError{};
+        }
+        setNodeId(new_node_id);
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD ProtocolParams getProtocolParams() const noexcept override
+    {
+        return ProtocolParams{std::numeric_limits<TransferId>::max(), Mtu, FrameHeader::NodeIdMax + 1U};
+    }
+
+    CETL_NODISCARD IoStatistics getTransferStatistics() const noexcept override
+    {
+        return transfer_counters_.snapshot();
+    }
+
+    CETL_NODISCARD cetl::optional<IoStatistics> getMediaStatistics(
+        const std::uint8_t media_index) const noexcept override
+    {
+        if (media_index > 0)
+        {
+            return cetl::nullopt;
+        }
+
+        return media_counters_.snapshot();
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
+        const MessageRxParams& params) override
+    {
+        return MessageRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeMessageTxSession(
+        const MessageTxParams& params) override
+    {
+        return MessageTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestRxSession>, AnyFailure> makeRequestRxSession(
+        const RequestRxParams& params) override
+    {
+        return SvcRequestRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestTxSession>, AnyFailure> makeRequestTxSession(
+        const RequestTxParams& params) override
+    {
+        return SvcRequestTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseRxSession>, AnyFailure> makeResponseRxSession(
+        const ResponseRxParams& params) override
+    {
+        return SvcResponseRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeResponseTxSession(
+        const ResponseTxParams& params) override
+    {
+        return SvcResponseTxSession::make(asDelegate(), params);
+    }
+
+    // MARK: TransportDelegate
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendTransfer(const TimePoint        deadline,
+                                                           FrameHeader&           header,
+                                                           const PayloadFragments payload_fragments) override
+    {
+        std::size_t    payload_size = 0;
+        common::CRC32C transfer_crc{};
+        for (const auto fragment : payload_fragments)
+        {
+            payload_size += fragment.size();
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            transfer_crc.add(fragment.data(), fragment.data() + fragment.size());
+        }
+
+        // A single frame carries up to `Mtu` bytes of payload (plus the transfer CRC).
+        // Otherwise, the payload together with its CRC is split into frames of `Mtu` bytes each.
+        //
+        const std::size_t total_size   = payload_size + TransferCrcSize;
+        const std::size_t frames_count = (payload_size <= Mtu) ? 1 : ((total_size + Mtu - 1) / Mtu);
+        if (frames_count > (tx_queue_.size() - tx_count_))
+        {
+            transfer_counters_.onFailure(CapacityError{});
+            return CapacityError{};
+        }
+
+        const auto       crc_bytes = makeTransferCrcBytes(transfer_crc.get());
+        TransferSplitter splitter{payload_fragments, crc_bytes};
+        header.source_node_id = getNodeId();
+        for (std::size_t frame_index = 0; frame_index < frames_count; ++frame_index)
+        {
+            const bool        is_last = (frame_index + 1) == frames_count;
+            const std::size_t frame_payload_size =
+                (frames_count == 1) ? total_size : std::min(std::size_t{Mtu}, total_size - (frame_index * Mtu));
+            header.frame_index_eot =
+                static_cast<std::uint32_t>(frame_index) | (is_last ? FrameHeader::EndOfTransferBit : 0U);
+
+            auto frame = encodeFrame(header, splitter, frame_payload_size);
+            if (frame.getSpan().empty())
+            {
+                // Drop already queued frames of this transfer - partial transfer is useless for the receiver.
+                dropTxTail(frame_index);
+                transfer_counters_.onFailure(MemoryError{});
+                return MemoryError{};
+            }
+            (void) tx_queue_[(tx_head_ + tx_count_) % tx_queue_.size()].emplace(
+                TxItem{deadline, std::move(frame), 0});
+            ++tx_count_;
+        }
+        transfer_counters_.onEmitted();
+
+        // No need to try to write right away when previous frames haven't been written yet -
+        // the new frame will be written (most likely together with others) when the media is ready.
+        //
+        if (!tx_callback_)
+        {
+            if (auto failure = flushTxQueue())
+            {
+                // The handler (if any) just said that it's NOT fine to ignore the failure.
+                return failure;
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> prepareRxSession(const std::uint32_t rx_key) override
+    {
+        const RxPort* const it = findRxPort(rx_key);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if ((it != (rx_ports_.data() + rx_ports_.size())) && (it->key == rx_key))
+        {
+            return AlreadyExistsError{};
+        }
+
+        // Make sure that there is room for one more port, so that the following registration can't fail.
+        if (rx_ports_.size() == rx_ports_.capacity())
+        {
+            rx_ports_.reserve(std::max<std::size_t>(rx_ports_.capacity() * 2, 4));
+            if (rx_ports_.size() == rx_ports_.capacity())
+            {
+                return MemoryError{};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void registerRxSession(const std::uint32_t rx_key, IRxSessionDelegate& session) noexcept override
+    {
+        CETL_DEBUG_ASSERT(rx_ports_.size() < rx_ports_.capacity(), "`prepareRxSession` is expected to be called.");
+
+        // Keep the array sorted by the key - move the new (last) port to its position.
+        const auto position = static_cast<std::size_t>(findRxPort(rx_key) - rx_ports_.data());
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        rx_ports_.push_back(RxPort{rx_key, &session});
+        auto* const first = rx_ports_.data();
+        std::rotate(first + position, first + rx_ports_.size() - 1, first + rx_ports_.size());
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if (!rx_callback_)
+        {
+            rx_callback_ = media_.registerReadCallback([this](const auto&) {
+                //
+                receiveNextChunk();
+            });
+        }
+    }
+
+    void unregisterRxSession(const std::uint32_t rx_key, const IRxSessionDelegate& session) noexcept override
+    {
+        RxPort* const it = findRxPort(rx_key);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* const end = rx_ports_.data() + rx_ports_.size();
+        if ((it != end) && (it->key == rx_key) && (it->delegate == &session))
+        {
+            std::rotate(it, it + 1, end);
+            rx_ports_.pop_back();
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if (rx_ports_.empty())
+        {
+            rx_callback_.reset();
+        }
+    }
+
+    // MARK: Privates:
+
+    CETL_NODISCARD RxPort* findRxPort(const std::uint32_t rx_key) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return std::lower_bound(rx_ports_.data(),
+                                rx_ports_.data() + rx_ports_.size(),
+                                rx_key,
+                                [](const RxPort& port, const std::uint32_t key) { return port.key < key; });
+    }
+
+    template <typename Report>
+    cetl::optional<AnyFailure> tryHandleTransientMediaFailure(MediaFailure&& media_failure)
+    {
+        auto failure = libcyphal::detail::upcastVariant<AnyFailure>(std::move(media_failure));
+        media_counters_.onFailure(failure);
+
+        if (transient_error_handler_)
+        {
+            TransientErrorReport::Variant report_var{Report{std::move(failure), media_}};
+            return transient_error_handler_(report_var);
+        }
+
+        return std::move(failure);
+    }
+
+    /// @brief Encodes the next frame of a transfer (including leading and trailing delimiters).
+    ///
+    /// @param header The frame header.
+    /// @param splitter The splitter to take the next `frame_payload_size` bytes of the frame payload from.
+    /// @param frame_payload_size Size of the frame payload (which might include the transfer CRC or its part).
+    /// @return The frame payload, or an empty payload if there is no memory for it.
+    ///
+    CETL_NODISCARD MediaPayload encodeFrame(const FrameHeader& header,
+                                            TransferSplitter&  splitter,
+                                            const std::size_t  frame_payload_size)
+    {
+        const std::size_t max_size = 2U + CobsEncoder::getMaxEncodedSize(FrameHeader::Size + frame_payload_size);
+
+        // No Sonar `cpp:S5356` b/c we integrate here PMR.
+        auto* const buffer = static_cast<cetl::byte*>(memory().allocate(max_size));  // NOSONAR cpp:S5356
+        if (buffer == nullptr)
+        {
+            return {};
+        }
+
+        // Next nolint is unavoidable: we need offsets from the beginning of the buffer.
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        CobsEncoder encoder{{buffer + 1, max_size - 2U}};
+        const auto  header_bytes = header.serialize();
+        encoder.encode(header_bytes);
+        splitter.next(frame_payload_size, [&encoder](const cetl::span<const cetl::byte> bytes) {
+            //
+            encoder.encode(bytes);
+        });
+
+        const std::size_t size = encoder.finish() + 2U;
+        buffer[0]              = cetl::byte{0};
+        buffer[size - 1]       = cetl::byte{0};
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return MediaPayload{size, buffer, max_size, &memory()};
+    }
+
+    CETL_NODISCARD TxItem& txItemAt(const std::size_t index) noexcept
+    {
+        auto& item = tx_queue_[(tx_head_ + index) % tx_queue_.size()];
+        CETL_DEBUG_ASSERT(item.has_value(), "");
+        return *item;
+    }
+
+    /// Drops the given number of the most recently queued items.
+    ///
+    void dropTxTail(std::size_t count) noexcept
+    {
+        CETL_DEBUG_ASSERT(count <= tx_count_, "");
+        for (; count > 0; --count)
+        {
+            --tx_count_;
+            tx_queue_[(tx_head_ + tx_count_) % tx_queue_.size()].reset();
+        }
+    }
+
+    void popTxItem() noexcept
+    {
+        CETL_DEBUG_ASSERT(tx_count_ > 0, "");
+        tx_queue_[tx_head_].reset();
+        tx_head_ = (tx_head_ + 1) % tx_queue_.size();
+        --tx_count_;
+    }
+
+    /// @brief Writes as many queued frames as the media accepts.
+    ///
+    /// Expired frames are dropped (unless they were already partially written - the rest of the frame
+    /// should be written anyway to keep the stream consistent). Up to `WriteMaxFrames` frames
+    /// are written by a single media `write` call.
+    ///
+    /// @return Failure from the transient error handler (if any) in case of a media write failure.
+    ///
+    cetl::optional<AnyFailure> flushTxQueue()
+    {
+        cetl::optional<AnyFailure> result;
+
+        const TimePoint now = executor_.now();
+        while (tx_count_ > 0)
+        {
+            std::array<cetl::span<const cetl::byte>, WriteMaxFrames> fragments{};
+            std::size_t                                               frames_count = 0;
+            std::size_t                                               total_size   = 0;
+            while ((frames_count < tx_count_) && (frames_count < WriteMaxFrames))
+            {
+                // We are dropping any TX item that has expired.
+                // We use strictly `<` (instead of `<=`) to give this frame a chance (one extra 1us) at the media.
+                //
+                TxItem& item = txItemAt(frames_count);
+                if ((item.offset == 0) && !(now < item.deadline))
+                {
+                    if (frames_count > 0)
+                    {
+                        break;  // The expired item will be dropped on the next iteration (as the head one).
+                    }
+                    popTxItem();
+                    continue;
+                }
+                const auto frame = item.frame.getSpan().subspan(item.offset);
+                total_size += frame.size();
+                fragments[frames_count++] = frame;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+            if (frames_count == 0)
+            {
+                break;
+            }
+
+            auto write_result = media_.write({fragments.data(), frames_count});
+            if (auto* const failure = cetl::get_if<IMedia::WriteResult::Failure>(&write_result))
+            {
+                // Release the problematic frame from the TX queue, so that other frames have their chance.
+                // Otherwise, we would be stuck in an execution loop trying to write the same frame.
+                popTxItem();
+
+                using Report = TransientErrorReport::MediaWrite;
+                result       = tryHandleTransientMediaFailure<Report>(std::move(*failure));
+                break;
+            }
+
+            std::size_t written = cetl::get<IMedia::WriteResult::Success>(write_result).bytes_written;
+            CETL_DEBUG_ASSERT(written <= total_size, "");
+            while ((written > 0) && (tx_count_ > 0))
+            {
+                TxItem&           item      = txItemAt(0);
+                const std::size_t remaining = item.frame.getSpan().size() - item.offset;
+                if (written < remaining)
+                {
+                    item.offset += written;
+                    break;
+                }
+                written -= remaining;
+                popTxItem();
+                media_counters_.onEmitted();
+            }
+
+            // The media is not ready to accept more - the rest will be written on the next "ready to write" event.
+            if (written < total_size)
+            {
+                break;
+            }
+        }
+
+        // If needed schedule (recursively!) next write of the queue.
+        // Already existing callback will be called by executor when media is ready to accept more.
+        //
+        if (tx_count_ == 0)
+        {
+            tx_callback_.reset();
+        }
+        else if (!tx_callback_)
+        {
+            tx_callback_ = media_.registerWriteCallback([this](const auto&) {
+                //
+                (void) flushTxQueue();
+            });
+        }
+        return result;
+    }
+
+    void receiveNextChunk()
+    {
+        IMedia::ReadResult::Type read_result = media_.read(rx_chunk_);
+        if (auto* const failure = cetl::get_if<IMedia::ReadResult::Failure>(&read_result))
+        {
+            using Report = TransientErrorReport::MediaRead;
+            (void) tryHandleTransientMediaFailure<Report>(std::move(*failure));
+            return;
+        }
+        const auto& read_success = cetl::get<IMedia::ReadResult::Success>(read_result);
+        if (!read_success.has_value())
+        {
+            return;
+        }
+
+        const IMedia::ReadResult::Metadata& read_meta = read_success.value();
+        CETL_DEBUG_ASSERT(read_meta.size <= rx_chunk_.size(), "");
+
+        frame_reader_.read(
+            {rx_chunk_.data(), read_meta.size},
+            [this, &read_meta](MediaPayload& frame) { acceptRxFrame(read_meta.timestamp, frame); },
+            [this](const AnyFailure& failure) { media_counters_.onFailure(failure); });
+    }
+
+    void acceptRxFrame(const TimePoint timestamp, MediaPayload& frame)
+    {
+        media_counters_.onReceived();
+
+        const auto                        frame_span = frame.getSpan();
+        const cetl::optional<FrameHeader> header     = FrameHeader::deserialize(frame_span);
+        if (!header)
+        {
+            media_counters_.onFailure(ArgumentError{});
+            return;
+        }
+
+        // Frames of a multi-frame transfer are validated (as a whole transfer) by the RX session on reassembly.
+        std::size_t payload_size = frame_span.size() - FrameHeader::Size;
+        if (header->isSingleFrame())
+        {
+            if (payload_size < TransferCrcSize)
+            {
+                media_counters_.onFailure(ArgumentError{});
+                return;
+            }
+            payload_size -= TransferCrcSize;
+
+            // CRC-32C over the payload and its (appended) CRC yields the constant residue.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const common::CRC32C transfer_crc{frame_span.data() + FrameHeader::Size,
+                                              frame_span.data() + frame_span.size()};
+            if (transfer_crc.get() != common::CRC32C::Residue)
+            {
+                transfer_counters_.onFailure(ArgumentError{});
+                return;
+            }
+        }
+        else if (header->source_node_id == FrameHeader::NodeIdUnset)
+        {
+            // Anonymous transfers can't be multi-frame.
+            media_counters_.onFailure(ArgumentError{});
+            return;
+        }
+
+        using RxKind = TransportDelegate::RxKind;
+
+        RxKind kind = RxKind::Message;
+        if (header->isService())
+        {
+            // Service transfers are for us only if we are not anonymous, and they are not anonymous either.
+            if ((getNodeId() == FrameHeader::NodeIdUnset) || (header->destination_node_id != getNodeId()) ||
+                (header->source_node_id == FrameHeader::NodeIdUnset))
+            {
+                return;
+            }
+            kind = header->isRequest() ? RxKind::Request : RxKind::Response;
+        }
+        else if (header->destination_node_id != FrameHeader::NodeIdUnset)
+        {
+            // Messages are always broadcast.
+            return;
+        }
+
+        const std::uint32_t rx_key = makeRxKey(kind, header->portId());
+        RxPort* const       it     = findRxPort(rx_key);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if ((it == (rx_ports_.data() + rx_ports_.size())) || (it->key != rx_key))
+        {
+            return;
+        }
+
+        if (it->delegate->acceptRxFrame(*header, timestamp, frame, payload_size))
+        {
+            transfer_counters_.onReceived();
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                            executor_;
+    IMedia&                               media_;
+    TxQueue                               tx_queue_;
+    std::size_t                           tx_head_;
+    std::size_t                           tx_count_;
+    libcyphal::detail::VarArray<RxPort>   rx_ports_;
+    FrameReader                           frame_reader_;
+    std::array<cetl::byte, ReadChunkSize> rx_chunk_;
+    TransientErrorHandler                 transient_error_handler_;
+    Callback::Any                         rx_callback_;
+    Callback::Any                         tx_callback_;
+    transport::detail::IoCounters         transfer_counters_;
+    transport::detail::IoCounters         media_counters_;
+
+};  // TransportImpl
+
+}  // namespace detail
+
+/// @brief Makes a new serial transport instance.
+///
+/// NB! Lifetime of the transport instance must never outlive `memory`, `executor` and `media` instances.
+///
+/// @param memory Reference to a polymorphic memory resource to use for all allocations.
+/// @param executor Interface of the executor to use.
+/// @param media The byte stream media interface to use.
+/// @param tx_capacity Total number of frames that can be queued for transmission.
+/// @return Unique pointer to the new serial transport instance or an error.
+///
+inline Expected<UniquePtr<ISerialTransport>, FactoryFailure> makeTransport(cetl::pmr::memory_resource& memory,
+                                                                           IExecutor&                  executor,
+                                                                           IMedia&                     media,
+                                                                           const std::size_t           tx_capacity)
+{
+    return detail::TransportImpl::make(memory, executor, media, tx_capacity);
+}
+
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_TRANSPORT_IMPL_HPP_INCLUDED
@@ -0,0 +1,239 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_SVC_RX_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_SVC_RX_SESSIONS_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/media_payload.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A template class to represent a service request/response RX session (both for server and client sides).
+///
+/// @tparam Interface_ Type of the session interface.
+///                    Could be either `IRequestRxSession` or `IResponseRxSession`.
+/// @tparam Params Type of the session parameters.
+///                Could be either `RequestRxParams` or `ResponseRxParams`.
+///
+template <typename Interface_, typename Params, bool IsRequest>
+class SvcRxSession final : private IRxSessionDelegate, public Interface_
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<Interface_, SvcRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<Interface_>, AnyFailure> make(TransportDelegate& delegate,
+                                                                           const Params&      params)
+    {
+        if (params.service_id > FrameHeader::ServiceIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        if (auto failure = delegate.prepareRxSession(makeRxKey(params)))
+        {
+            return std::move(*failure);
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    SvcRxSession(const Spec, TransportDelegate& delegate, const Params& params)
+        : delegate_{delegate}
+        , params_{params}
+        , tid_filter_{delegate.memory()}
+        , reassembler_{delegate.memory(), params.extent_bytes}
+    {
+        delegate.registerRxSession(makeRxKey(params), *this);
+    }
+
+    SvcRxSession(const SvcRxSession&)                = delete;
+    SvcRxSession(SvcRxSession&&) noexcept            = delete;
+    SvcRxSession& operator=(const SvcRxSession&)     = delete;
+    SvcRxSession& operator=(SvcRxSession&&) noexcept = delete;
+
+    ~SvcRxSession()
+    {
+        delegate_.unregisterRxSession(makeRxKey(params_), *this);
+    }
+
+private:
+    // MARK: Interface
+
+    CETL_NODISCARD Params getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<ServiceRxTransfer> receive() override
+    {
+        if (last_rx_transfer_)
+        {
+            auto transfer = std::move(*last_rx_transfer_);
+            last_rx_transfer_.reset();
+            return transfer;
+        }
+        return cetl::nullopt;
+    }
+
+    void setOnReceiveCallback(ISvcRxSession::OnReceiveCallback::Function&& function) override
+    {
+        on_receive_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration timeout) override
+    {
+        if (timeout >= Duration::zero())
+        {
+            tid_filter_.setTransferIdTimeout(timeout);
+        }
+    }
+
+    // MARK: IRxSessionDelegate
+
+    bool acceptRxFrame(const FrameHeader& header,
+                       const TimePoint    timestamp,
+                       MediaPayload&      frame,
+                       const std::size_t  payload_size) override
+    {
+        // Service transfers are never anonymous (the transport has already dropped such frames).
+        if (!isExpectedSource(header.source_node_id))
+        {
+            return false;
+        }
+
+        if (!header.isSingleFrame())
+        {
+            auto transfer =
+                reassembler_.accept(header, timestamp, frame.getSpan().subspan(FrameHeader::Size, payload_size));
+            if ((!transfer) || (!tid_filter_.accept(header.source_node_id, header.transfer_id, transfer->timestamp)))
+            {
+                return false;
+            }
+            const std::size_t size = transfer->payload.getSpan().size();
+            acceptTransfer(header, transfer->timestamp, FrameStorage{std::move(transfer->payload), 0, size});
+            return true;
+        }
+
+        if (!tid_filter_.accept(header.source_node_id, header.transfer_id, timestamp))
+        {
+            return false;
+        }
+
+        // Payload beyond the extent is implicitly truncated (but the frame buffer is kept as is - no copying).
+        acceptTransfer(header,
+                       timestamp,
+                       FrameStorage{std::move(frame), FrameHeader::Size, std::min(payload_size, params_.extent_bytes)});
+        return true;
+    }
+
+    // MARK: Privates:
+
+    void acceptTransfer(const FrameHeader& header, const TimePoint timestamp, FrameStorage&& storage)
+    {
+        const ServiceRxMetadata meta{{{header.transfer_id, header.priority}, timestamp}, header.source_node_id};
+        ServiceRxTransfer       svc_rx_transfer{meta, ScatteredBuffer{std::move(storage)}};
+        if (on_receive_cb_fn_)
+        {
+            on_receive_cb_fn_(ISvcRxSession::OnReceiveCallback::Arg{svc_rx_transfer});
+            return;
+        }
+        (void) last_rx_transfer_.emplace(std::move(svc_rx_transfer));
+    }
+
+    CETL_NODISCARD static std::uint32_t makeRxKey(const Params& params) noexcept
+    {
+        using RxKind = TransportDelegate::RxKind;
+        return TransportDelegate::makeRxKey(IsRequest ? RxKind::Request : RxKind::Response, params.service_id);
+    }
+
+    /// Requests are accepted from any client.
+    ///
+    CETL_NODISCARD static bool isExpectedSource(const RequestRxParams&, const NodeId) noexcept
+    {
+        return true;
+    }
+
+    /// Responses are accepted only from the server node.
+    ///
+    CETL_NODISCARD static bool isExpectedSource(const ResponseRxParams& params, const NodeId source_node_id) noexcept
+    {
+        return params.server_node_id == source_node_id;
+    }
+
+    CETL_NODISCARD bool isExpectedSource(const NodeId source_node_id) const noexcept
+    {
+        return isExpectedSource(params_, source_node_id);
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                         delegate_;
+    const Params                               params_;
+    TransferIdFilter                           tid_filter_;
+    TransferReassembler                        reassembler_;
+    cetl::optional<ServiceRxTransfer>          last_rx_transfer_;
+    ISvcRxSession::OnReceiveCallback::Function on_receive_cb_fn_;
+
+};  // SvcRxSession
+
+// MARK: -
+
+/// @brief A concrete class to represent a service request RX session (aka server side).
+///
+using SvcRequestRxSession = SvcRxSession<IRequestRxSession, RequestRxParams, true /*IsRequest*/>;
+
+/// @brief A concrete class to represent a service response RX session (aka client side).
+///
+using SvcResponseRxSession = SvcRxSession<IResponseRxSession, ResponseRxParams, false /*IsRequest*/>;
+
+}  // namespace detail
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_SVC_RX_SESSIONS_HPP_INCLUDED
@@ -0,0 +1,188 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_SVC_TX_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_SVC_TX_SESSIONS_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "frame.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+/// Internal implementation details of the serial transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A class to represent a service request TX session (aka client side).
+///
+class SvcRequestTxSession final : public IRequestTxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IRequestTxSession, SvcRequestTxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IRequestTxSession>, AnyFailure> make(TransportDelegate&     delegate,
+                                                                                  const RequestTxParams& params)
+    {
+        if ((params.service_id > FrameHeader::ServiceIdMax) || (params.server_node_id > FrameHeader::NodeIdMax))
+        {
+            return ArgumentError{};
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    SvcRequestTxSession(const Spec, TransportDelegate& delegate, const RequestTxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+    }
+
+private:
+    // MARK: IRequestTxSession
+
+    CETL_NODISCARD RequestTxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> send(const TransferTxMetadata& metadata,
+                                                   const PayloadFragments    payload_fragments) override
+    {
+        // Anonymous nodes can't send service transfers.
+        if (delegate_.getNodeId() > FrameHeader::NodeIdMax)
+        {
+            return AnonymousError{};
+        }
+
+        FrameHeader header{};
+        header.priority            = metadata.base.priority;
+        header.destination_node_id = params_.server_node_id;
+        header.data_specifier      = static_cast<std::uint16_t>(FrameHeader::ServiceBit | FrameHeader::RequestBit |
+                                                           params_.service_id);
+        header.transfer_id         = metadata.base.transfer_id;
+
+        return delegate_.sendTransfer(metadata.deadline, header, payload_fragments);
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&    delegate_;
+    const RequestTxParams params_;
+
+};  // SvcRequestTxSession
+
+// MARK: -
+
+/// @brief A class to represent a service response TX session (aka server side).
+///
+class SvcResponseTxSession final : public IResponseTxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IResponseTxSession, SvcResponseTxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IResponseTxSession>, AnyFailure> make(TransportDelegate&      delegate,
+                                                                                   const ResponseTxParams& params)
+    {
+        if (params.service_id > FrameHeader::ServiceIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    SvcResponseTxSession(const Spec, TransportDelegate& delegate, const ResponseTxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+    }
+
+private:
+    // MARK: IResponseTxSession
+
+    CETL_NODISCARD ResponseTxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> send(const ServiceTxMetadata& metadata,
+                                                   const PayloadFragments   payload_fragments) override
+    {
+        // Anonymous nodes can't send service transfers.
+        if (delegate_.getNodeId() > FrameHeader::NodeIdMax)
+        {
+            return AnonymousError{};
+        }
+        if (metadata.remote_node_id > FrameHeader::NodeIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        FrameHeader header{};
+        header.priority            = metadata.tx_meta.base.priority;
+        header.destination_node_id = metadata.remote_node_id;
+        header.data_specifier      = static_cast<std::uint16_t>(FrameHeader::ServiceBit | params_.service_id);
+        header.transfer_id         = metadata.tx_meta.base.transfer_id;
+
+        return delegate_.sendTransfer(metadata.tx_meta.deadline, header, payload_fragments);
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&     delegate_;
+    const ResponseTxParams params_;
+
+};  // SvcResponseTxSession
+
+}  // namespace detail
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_SVC_TX_SESSIONS_HPP_INCLUDED
@@ -0,0 +1,190 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_DELEGATE_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_DELEGATE_HPP_INCLUDED
+
+#include "segment.hpp"
+
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines max node ID (the same as for Cyphal/UDP). The next value stands for the anonymous node.
+///
+constexpr NodeId NodeIdMax = 0xFFFE;
+
+/// @brief Defines "unset" node ID - in use for anonymous nodes and broadcast destinations.
+///
+constexpr NodeId NodeIdUnset = 0xFFFF;
+
+/// @brief Defines max subject ID.
+///
+constexpr PortId SubjectIdMax = 8191;
+
+/// @brief Defines max service ID.
+///
+constexpr PortId ServiceIdMax = 511;
+
+/// @brief Defines kind of a port.
+///
+enum class PortKind : std::uint8_t
+{
+    Message,
+    Request,
+    Response,
+};
+
+/// @brief Makes a key of a port, which is unique per kind and port ID. Never zero.
+///
+CETL_NODISCARD inline std::uint32_t makePortKey(const PortKind kind, const PortId port_id) noexcept
+{
+    return ((static_cast<std::uint32_t>(kind) + 1U) << 16U) | port_id;
+}
+
+/// @brief Makes a key of a ring - unique per port and its publishing node. Never zero.
+///
+CETL_NODISCARD inline std::uint64_t makeRingKey(const std::uint32_t port_key, const NodeId node_id) noexcept
+{
+    return (static_cast<std::uint64_t>(port_key) << 16U) | node_id;
+}
+
+/// @brief Defines header of a transfer to send (see `TransportDelegate::sendTransfer`).
+///
+struct TxTransferHeader
+{
+    PortKind   kind;
+    PortId     port_id;
+    TransferId transfer_id;
+    Priority   priority;
+    NodeId     destination_node_id;
+};
+
+// MARK: -
+
+/// This internal session delegate class serves the following purpose: it provides an interface (aka gateway)
+/// to access RX session from transport (when a transfer for the session port has been read from the segment).
+///
+class IRxSessionDelegate
+{
+public:
+    IRxSessionDelegate(const IRxSessionDelegate&)                = delete;
+    IRxSessionDelegate(IRxSessionDelegate&&) noexcept            = delete;
+    IRxSessionDelegate& operator=(const IRxSessionDelegate&)     = delete;
+    IRxSessionDelegate& operator=(IRxSessionDelegate&&) noexcept = delete;
+
+    /// @brief Accepts a received transfer dedicated to this RX session.
+    ///
+    /// @param rx_metadata The transfer metadata.
+    /// @param source_node_id The node ID of the publisher.
+    /// @param storage The (shared) transfer payload. The session takes ownership of it.
+    ///
+    virtual void acceptRxTransfer(const TransferRxMetadata& rx_metadata,
+                                  const NodeId              source_node_id,
+                                  SlotStorage&&             storage) = 0;
+
+protected:
+    IRxSessionDelegate()  = default;
+    ~IRxSessionDelegate() = default;
+
+};  // IRxSessionDelegate
+
+// MARK: -
+
+/// This internal transport delegate class serves the following purposes:
+/// 1. It provides memory resource and local node ID to the session classes.
+/// 2. It provides an interface to access the transport from various session classes.
+///
+class TransportDelegate
+{
+public:
+    TransportDelegate(const TransportDelegate&)                = delete;
+    TransportDelegate(TransportDelegate&&) noexcept            = delete;
+    TransportDelegate& operator=(const TransportDelegate&)     = delete;
+    TransportDelegate& operator=(TransportDelegate&&) noexcept = delete;
+
+    CETL_NODISCARD cetl::pmr::memory_resource& memory() const noexcept
+    {
+        return memory_;
+    }
+
+    /// Gets local node ID, or `NodeIdUnset` if the node is anonymous.
+    ///
+    CETL_NODISCARD NodeId getNodeId() const noexcept
+    {
+        return node_id_;
+    }
+
+    /// @brief Publishes transfer to the shared memory segment.
+    ///
+    /// Internal method which is in use by TX session implementations to delegate actual sending to transport.
+    ///
+    CETL_NODISCARD virtual cetl::optional<AnyFailure> sendTransfer(const TxTransferHeader& header,
+                                                                   const PayloadFragments  payload_fragments) = 0;
+
+    /// @brief Prepares registration of an RX session for the given port key (see `makePortKey`).
+    ///
+    /// Should be called before construction of the session, so that the following `registerRxSession`
+    /// (called from the session constructor) is guaranteed to succeed.
+    ///
+    /// @return `AlreadyExistsError` if there is already a session for the same port,
+    ///         or `MemoryError` if there is no memory to register one more session.
+    ///
+    CETL_NODISCARD virtual cetl::optional<AnyFailure> prepareRxSession(const std::uint32_t port_key) = 0;
+
+    /// @brief Registers an RX session for the given port key (see `prepareRxSession`).
+    ///
+    virtual void registerRxSession(const std::uint32_t port_key, IRxSessionDelegate& session) noexcept = 0;
+
+    /// @brief Unregisters previously registered (see `registerRxSession`) RX session.
+    ///
+    virtual void unregisterRxSession(const std::uint32_t port_key, const IRxSessionDelegate& session) noexcept = 0;
+
+protected:
+    explicit TransportDelegate(cetl::pmr::memory_resource& memory)
+        : memory_{memory}
+        , node_id_{NodeIdUnset}
+    {
+    }
+
+    ~TransportDelegate() = default;
+
+    void setNodeId(const NodeId node_id) noexcept
+    {
+        node_id_ = node_id;
+    }
+
+private:
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    NodeId                      node_id_;
+
+};  // TransportDelegate
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_DELEGATE_HPP_INCLUDED
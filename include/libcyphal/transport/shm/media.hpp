@@ -0,0 +1,84 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_MEDIA_HPP_INCLUDED
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// @brief Defines interface to a custom shared memory media implementation.
+///
+/// The media provides two things to the transport:
+/// - the shared memory segment itself (already mapped into the process, and formatted - see `formatSegment`);
+/// - a "doorbell" - a way to wake up other nodes (attached to the same segment) when something has been published,
+///   and to be woken up by them in its turn.
+///
+/// Implementation is supposed to be provided by an user of the library.
+///
+class IMedia
+{
+public:
+    IMedia(const IMedia&)                = delete;
+    IMedia(IMedia&&) noexcept            = delete;
+    IMedia& operator=(const IMedia&)     = delete;
+    IMedia& operator=(IMedia&&) noexcept = delete;
+
+    /// @brief Gets the whole memory of the shared segment.
+    ///
+    /// The memory must stay mapped (at the same address) for the whole lifetime of the transport.
+    ///
+    CETL_NODISCARD virtual cetl::span<cetl::byte> getSegment() noexcept = 0;
+
+    /// @brief Notifies (wakes up) other nodes attached to the segment.
+    ///
+    /// Called by the transport right after a transfer has been published into the segment.
+    ///
+    /// @return An optional failure of the notification. Note that the transfer itself is already published.
+    ///
+    CETL_NODISCARD virtual cetl::optional<MediaFailure> notify() noexcept = 0;
+
+    /// @brief Clears all pending notifications of this media.
+    ///
+    /// Called by the transport (from within the notification callback) right before scanning the segment.
+    ///
+    virtual void clearNotifications() noexcept = 0;
+
+    /// @brief Registers "notified" callback function at a given executor.
+    ///
+    /// The callback will be called by an executor when this media has been notified by some other node.
+    ///
+    /// For example, POSIX implementation may pass its `eventfd` file descriptor to the executor implementation,
+    /// and executor will use `::poll` POSIX api & `POLLIN` event to schedule this callback for execution.
+    ///
+    /// @param function The function to be called when the media has been notified.
+    /// @return Type-erased instance of the registered callback.
+    ///         Instance must not outlive the executor; otherwise undefined behavior.
+    ///
+    CETL_NODISCARD virtual IExecutor::Callback::Any registerNotificationCallback(
+        IExecutor::Callback::Function&& function) = 0;
+
+protected:
+    IMedia()  = default;
+    ~IMedia() = default;
+
+};  // IMedia
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_MEDIA_HPP_INCLUDED
@@ -0,0 +1,156 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_MSG_RX_SESSION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_MSG_RX_SESSION_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "segment.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A class to represent a message subscriber RX session.
+///
+class MessageRxSession final : private IRxSessionDelegate, public IMessageRxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IMessageRxSession, MessageRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IMessageRxSession>, AnyFailure> make(TransportDelegate&     delegate,
+                                                                                  const MessageRxParams& params)
+    {
+        if (params.subject_id > SubjectIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        if (auto failure = delegate.prepareRxSession(makePortKey(PortKind::Message, params.subject_id)))
+        {
+            return std::move(*failure);
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    MessageRxSession(const Spec, TransportDelegate& delegate, const MessageRxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+        delegate.registerRxSession(makePortKey(PortKind::Message, params.subject_id), *this);
+    }
+
+    MessageRxSession(const MessageRxSession&)                = delete;
+    MessageRxSession(MessageRxSession&&) noexcept            = delete;
+    MessageRxSession& operator=(const MessageRxSession&)     = delete;
+    MessageRxSession& operator=(MessageRxSession&&) noexcept = delete;
+
+    ~MessageRxSession()
+    {
+        delegate_.unregisterRxSession(makePortKey(PortKind::Message, params_.subject_id), *this);
+    }
+
+private:
+    // MARK: IMessageRxSession
+
+    CETL_NODISCARD MessageRxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<MessageRxTransfer> receive() override
+    {
+        if (last_rx_transfer_)
+        {
+            auto transfer = std::move(*last_rx_transfer_);
+            last_rx_transfer_.reset();
+            return transfer;
+        }
+        return cetl::nullopt;
+    }
+
+    void setOnReceiveCallback(OnReceiveCallback::Function&& function) override
+    {
+        on_receive_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration) override
+    {
+        // Every publisher owns its ring in the segment, and every ring entry is read exactly once -
+        // so there are no duplicates to filter out, and hence the timeout is not in use.
+    }
+
+    // MARK: IRxSessionDelegate
+
+    void acceptRxTransfer(const TransferRxMetadata& rx_metadata,
+                          const NodeId              source_node_id,
+                          SlotStorage&&             storage) override
+    {
+        // Payload beyond the extent is implicitly truncated (but the slot is kept as is - no copying).
+        storage.truncate(params_.extent_bytes);
+
+        const MessageRxMetadata meta{rx_metadata, source_node_id};
+        MessageRxTransfer       msg_rx_transfer{meta, ScatteredBuffer{std::move(storage)}};
+        if (on_receive_cb_fn_)
+        {
+            on_receive_cb_fn_(OnReceiveCallback::Arg{msg_rx_transfer});
+            return;
+        }
+        (void) last_rx_transfer_.emplace(std::move(msg_rx_transfer));
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                delegate_;
+    const MessageRxParams             params_;
+    cetl::optional<MessageRxTransfer> last_rx_transfer_;
+    OnReceiveCallback::Function       on_receive_cb_fn_;
+
+};  // MessageRxSession
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_MSG_RX_SESSION_HPP_INCLUDED
@@ -0,0 +1,101 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_MSG_TX_SESSION_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_MSG_TX_SESSION_HPP_INCLUDED
+
+#include "delegate.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+class MessageTxSession final : public IMessageTxSession
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IMessageTxSession, MessageTxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IMessageTxSession>, AnyFailure> make(TransportDelegate&     delegate,
+                                                                                  const MessageTxParams& params)
+    {
+        if (params.subject_id > SubjectIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    MessageTxSession(const Spec, TransportDelegate& delegate, const MessageTxParams& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+    }
+
+private:
+    // MARK: IMessageTxSession
+
+    CETL_NODISCARD MessageTxParams getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> send(const TransferTxMetadata& metadata,
+                                                   const PayloadFragments    payload_fragments) override
+    {
+        // Transfers are published immediately, so the deadline is never reached.
+        const TxTransferHeader header{PortKind::Message,
+                                      params_.subject_id,
+                                      metadata.base.transfer_id,
+                                      metadata.base.priority,
+                                      NodeIdUnset};
+
+        return delegate_.sendTransfer(header, payload_fragments);
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&    delegate_;
+    const MessageTxParams params_;
+
+};  // MessageTxSession
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_MSG_TX_SESSION_HPP_INCLUDED
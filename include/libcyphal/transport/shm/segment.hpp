@@ -0,0 +1,641 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_SEGMENT_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_SEGMENT_HPP_INCLUDED
+
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// @brief Defines layout of a shared memory segment.
+///
+/// The layout is chosen by whoever creates (formats) the segment, and is then read from the segment itself
+/// by all other attached transports.
+///
+struct SegmentLayout
+{
+    /// Total number of payload slots - max number of transfers which could be "in flight" at the same time
+    /// (published but not yet released by all their subscribers).
+    ///
+    /// Note that a ring entry keeps its slot until the entry is overwritten, so up to `ring_count * ring_capacity`
+    /// slots could be retained by the rings alone - the count should be bigger to never run out of slots.
+    std::uint32_t slot_count;
+
+    /// Max payload size (in bytes) of a single slot, and so of a single transfer (aka MTU).
+    std::uint32_t slot_size;
+
+    /// Total number of rings. Every (port, node) pair which publishes transfers claims its own ring.
+    std::uint32_t ring_count;
+
+    /// Number of entries in a single ring. Must be a power of two.
+    std::uint32_t ring_capacity;
+
+};  // SegmentLayout
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+// The segment is shared between processes, so its atomics must be address-free (lock-free).
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory transport requires lock-free 32-bit atomics.");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory transport requires lock-free 64-bit atomics.");
+
+/// @brief Represents a (process local) view of a shared memory segment.
+///
+/// The segment consists of a header, a set of single-producer-multi-consumer (SPMC) rings,
+/// and a pool of reference-counted payload slots:
+/// - Free slots are kept in a lock-free (Treiber) stack, which head is tagged against ABA problem.
+/// - A slot is allocated by a publisher, filled with the transfer payload, and published as a ring entry.
+///   The ring entry holds one reference to the slot until the entry is overwritten (on the next lap of the ring).
+/// - Subscribers read the ring entries by their own cursors (nothing is written to the ring by subscribers),
+///   and retain an extra reference to the slot for as long as they need its payload - no copying involved.
+/// - Entries are read like a sequence lock: entry sequence number is checked before and after reading,
+///   so that an entry overwritten in the middle of reading is detected (and counted as lost).
+///
+/// The segment contains only offsets and indices (but no pointers), so it could be mapped by different processes
+/// at different addresses. Note that references held by a crashed process are never released.
+///
+class Segment final
+{
+public:
+    /// @brief Defines a (decoded) ring entry.
+    ///
+    struct Entry
+    {
+        TransferId    transfer_id;
+        std::uint32_t slot_index;
+        Priority      priority;
+        NodeId        destination_node_id;
+    };
+
+    static constexpr std::uint32_t NoSlot = 0xFFFFFFFFU;
+
+    /// @brief Gets total size (in bytes) of a segment with the given layout.
+    ///
+    CETL_NODISCARD static std::size_t getRequiredSize(const SegmentLayout& layout) noexcept
+    {
+        const Offsets offsets{layout};
+        return offsets.slots + (static_cast<std::size_t>(layout.slot_count) * offsets.slot_stride);
+    }
+
+    /// @brief Formats (aka initializes) a new segment in the given memory.
+    ///
+    /// Formatting is supposed to be done only once - by the segment creator, before any transport attaches to it.
+    ///
+    CETL_NODISCARD static cetl::optional<ArgumentError> format(const cetl::span<cetl::byte> memory,
+                                                               const SegmentLayout&         layout) noexcept
+    {
+        if (!isValidLayout(layout) || !isValidMemory(memory) || (memory.size() < getRequiredSize(layout)))
+        {
+            return ArgumentError{};
+        }
+
+        const Segment segment{memory.data(), layout};
+
+        auto* const header = new (memory.data()) Header{};  // NOLINT(cppcoreguidelines-owning-memory)
+        header->version    = Version;
+        header->layout     = layout;
+
+        for (std::uint32_t index = 0; index < layout.ring_count; ++index)
+        {
+            (void) new (&segment.ringHeader(index)) RingHeader{};  // NOLINT(cppcoreguidelines-owning-memory)
+            for (std::uint32_t entry = 0; entry < layout.ring_capacity; ++entry)
+            {
+                (void) new (&segment.ringEntry(index, entry)) RingEntry{};  // NOLINT(cppcoreguidelines-owning-memory)
+            }
+        }
+
+        // Initially all slots are free, and linked into the free stack in the index order.
+        for (std::uint32_t index = 0; index < layout.slot_count; ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            auto* const slot = new (&segment.slotHeader(index)) SlotHeader{};
+            slot->next_free.store(((index + 1U) < layout.slot_count) ? (index + 2U) : 0U, std::memory_order_relaxed);
+        }
+        header->free_slots.store(1U, std::memory_order_relaxed);
+
+        // Publish the formatted segment to the others.
+        header->magic.store(Magic, std::memory_order_release);
+        return cetl::nullopt;
+    }
+
+    /// @brief Attaches to an already formatted segment.
+    ///
+    /// @return The segment view, or an empty optional if the memory doesn't contain a valid (formatted) segment.
+    ///
+    CETL_NODISCARD static cetl::optional<Segment> attach(const cetl::span<cetl::byte> memory) noexcept
+    {
+        if (!isValidMemory(memory) || (memory.size() < sizeof(Header)))
+        {
+            return cetl::nullopt;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto& header = *reinterpret_cast<const Header*>(memory.data());
+        if ((header.magic.load(std::memory_order_acquire) != Magic) || (header.version != Version))
+        {
+            return cetl::nullopt;
+        }
+        const SegmentLayout layout = header.layout;
+        if (!isValidLayout(layout) || (memory.size() < getRequiredSize(layout)))
+        {
+            return cetl::nullopt;
+        }
+
+        return Segment{memory.data(), layout};
+    }
+
+    CETL_NODISCARD const SegmentLayout& getLayout() const noexcept
+    {
+        return layout_;
+    }
+
+    // MARK: Slots
+
+    /// @brief Allocates a free slot (with its reference count set to one).
+    ///
+    /// @return Index of the slot, or `NoSlot` if all slots are in use.
+    ///
+    CETL_NODISCARD std::uint32_t allocateSlot() const noexcept
+    {
+        auto&         free_slots = header().free_slots;
+        std::uint64_t head       = free_slots.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const auto top = static_cast<std::uint32_t>(head & LowMask);
+            if (top == 0)
+            {
+                return NoSlot;
+            }
+
+            SlotHeader&         slot = slotHeader(top - 1U);
+            const std::uint64_t next = nextTag(head) | slot.next_free.load(std::memory_order_relaxed);
+            if (free_slots.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                slot.ref_count.store(1U, std::memory_order_release);
+                return top - 1U;
+            }
+        }
+    }
+
+    /// @brief Retains one more reference to the slot, but only if the slot is still alive (referenced).
+    ///
+    CETL_NODISCARD bool tryRetainSlot(const std::uint32_t slot_index) const noexcept
+    {
+        auto&         ref_count = slotHeader(slot_index).ref_count;
+        std::uint32_t count     = ref_count.load(std::memory_order_relaxed);
+        do
+        {
+            if (count == 0)
+            {
+                return false;
+            }
+        } while (!ref_count.compare_exchange_weak(count,
+                                                  count + 1U,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+        return true;
+    }
+
+    /// @brief Releases one reference to the slot. The last reference returns the slot to the free stack.
+    ///
+    void releaseSlot(const std::uint32_t slot_index) const noexcept
+    {
+        SlotHeader& slot = slotHeader(slot_index);
+        if (slot.ref_count.fetch_sub(1U, std::memory_order_acq_rel) != 1U)
+        {
+            return;
+        }
+
+        auto&         free_slots = header().free_slots;
+        std::uint64_t head       = free_slots.load(std::memory_order_relaxed);
+        std::uint64_t next       = 0;
+        do
+        {
+            slot.next_free.store(static_cast<std::uint32_t>(head & LowMask), std::memory_order_relaxed);
+            next = nextTag(head) | (slot_index + 1U);
+        } while (!free_slots.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /// @brief Gets the whole (`slot_size` bytes) payload buffer of the slot.
+    ///
+    CETL_NODISCARD cetl::span<cetl::byte> getSlotBuffer(const std::uint32_t slot_index) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return {base_ + offsets_.slots + (slot_index * offsets_.slot_stride) + sizeof(SlotHeader), layout_.slot_size};
+    }
+
+    CETL_NODISCARD std::size_t getSlotPayloadSize(const std::uint32_t slot_index) const noexcept
+    {
+        return std::min<std::size_t>(slotHeader(slot_index).payload_size.load(std::memory_order_relaxed),
+                                     layout_.slot_size);
+    }
+
+    void setSlotPayloadSize(const std::uint32_t slot_index, const std::size_t size) const noexcept
+    {
+        slotHeader(slot_index).payload_size.store(static_cast<std::uint32_t>(size), std::memory_order_relaxed);
+    }
+
+    // MARK: Rings
+
+    /// @brief Gets key of the ring owner, or zero if the ring is not claimed yet.
+    ///
+    CETL_NODISCARD std::uint64_t getRingKey(const std::uint32_t ring_index) const noexcept
+    {
+        return ringHeader(ring_index).key.load(std::memory_order_acquire);
+    }
+
+    /// @brief Gets total number of entries ever published to the ring.
+    ///
+    CETL_NODISCARD std::uint64_t getRingHead(const std::uint32_t ring_index) const noexcept
+    {
+        return ringHeader(ring_index).head.load(std::memory_order_acquire);
+    }
+
+    /// @brief Claims a ring for the given (non-zero) owner key.
+    ///
+    /// A ring already claimed with the same key (f.e. by a previous incarnation of the same node) is reused.
+    /// Rings are never unclaimed.
+    ///
+    /// @return Index of the ring, or an empty optional if all rings are already claimed.
+    ///
+    CETL_NODISCARD cetl::optional<std::uint32_t> claimRing(const std::uint64_t key) const noexcept
+    {
+        CETL_DEBUG_ASSERT(key != 0, "");
+
+        for (std::uint32_t index = 0; index < layout_.ring_count; ++index)
+        {
+            if (getRingKey(index) == key)
+            {
+                return index;
+            }
+        }
+        for (std::uint32_t index = 0; index < layout_.ring_count; ++index)
+        {
+            std::uint64_t expected = 0;
+            if (ringHeader(index).key.compare_exchange_strong(expected, key, std::memory_order_acq_rel) ||
+                (expected == key))
+            {
+                return index;
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    /// @brief Publishes a new entry to the ring.
+    ///
+    /// Must be called only by the single producer (owner) of the ring. The ring entry takes over
+    /// the (already retained) slot reference, and releases reference to the slot of the overwritten entry (if any).
+    ///
+    void publish(const std::uint32_t ring_index, const Entry& entry) const noexcept
+    {
+        RingHeader&         ring     = ringHeader(ring_index);
+        const std::uint64_t sequence = ring.head.load(std::memory_order_relaxed);
+        RingEntry&          target   = ringEntry(ring_index, sequence & (layout_.ring_capacity - 1U));
+
+        const bool          is_overwrite = sequence >= layout_.ring_capacity;
+        const std::uint32_t old_slot     = target.slot_index.load(std::memory_order_relaxed);
+
+        // Invalidate the entry first, so that readers (of the previous lap) could detect that it's being rewritten.
+        target.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        target.transfer_id.store(entry.transfer_id, std::memory_order_relaxed);
+        target.slot_index.store(entry.slot_index, std::memory_order_relaxed);
+        target.attributes.store(static_cast<std::uint32_t>(entry.priority) |
+                                    (static_cast<std::uint32_t>(entry.destination_node_id) << 8U),
+                                std::memory_order_relaxed);
+        target.sequence.store(sequence + 1U, std::memory_order_release);
+        ring.head.store(sequence + 1U, std::memory_order_release);
+
+        if (is_overwrite)
+        {
+            releaseSlot(old_slot);
+        }
+    }
+
+    /// @brief Reads next entry of the ring at the given cursor (which is advanced).
+    ///
+    /// Entries which were overwritten before (or while) they have been read are skipped and counted as lost.
+    ///
+    /// @param ring_index Index of the ring to read.
+    /// @param cursor Sequence number of the next entry to read. Updated accordingly.
+    /// @param entry The read entry. Its slot is retained - the caller must release it eventually.
+    /// @param lost_count Incremented by number of the skipped (lost) entries.
+    /// @return `true` if an entry has been read; `false` if there is nothing to read (yet).
+    ///
+    CETL_NODISCARD bool read(const std::uint32_t ring_index,
+                             std::uint64_t&      cursor,
+                             Entry&              entry,
+                             std::size_t&        lost_count) const noexcept
+    {
+        const std::uint64_t capacity = layout_.ring_capacity;
+        const std::uint64_t head     = getRingHead(ring_index);
+        if (cursor >= head)
+        {
+            cursor = head;
+            return false;
+        }
+        if ((head - cursor) > capacity)
+        {
+            lost_count += static_cast<std::size_t>(head - cursor - capacity);
+            cursor = head - capacity;
+        }
+
+        for (; cursor < head; ++cursor)
+        {
+            const RingEntry&    source   = ringEntry(ring_index, cursor & (capacity - 1U));
+            const std::uint64_t sequence = source.sequence.load(std::memory_order_acquire);
+            if (sequence == (cursor + 1U))
+            {
+                const TransferId    transfer_id = source.transfer_id.load(std::memory_order_relaxed);
+                const std::uint32_t slot_index  = source.slot_index.load(std::memory_order_relaxed);
+                const std::uint32_t attributes  = source.attributes.load(std::memory_order_relaxed);
+                if ((slot_index < layout_.slot_count) && tryRetainSlot(slot_index))
+                {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (source.sequence.load(std::memory_order_relaxed) == sequence)
+                    {
+                        ++cursor;
+                        entry.transfer_id         = transfer_id;
+                        entry.slot_index          = slot_index;
+                        entry.priority            = static_cast<Priority>(attributes & PriorityMask);
+                        entry.destination_node_id = static_cast<NodeId>(attributes >> 8U);
+                        return true;
+                    }
+                    releaseSlot(slot_index);
+                }
+            }
+
+            // The entry has been overwritten (by the next lap of the ring) - we were too slow.
+            ++lost_count;
+        }
+        return false;
+    }
+
+private:
+    static constexpr std::uint32_t Magic        = 0x4D485343U;  // "CSHM"
+    static constexpr std::uint32_t Version      = 1;
+    static constexpr std::size_t   CacheLine    = 64;
+    static constexpr std::uint64_t LowMask      = 0xFFFFFFFFULL;
+    static constexpr std::uint32_t PriorityMask = 0x7U;
+
+    struct Header
+    {
+        std::atomic<std::uint32_t> magic{0};
+        std::uint32_t              version{0};
+        SegmentLayout              layout{};
+
+        /// Head of the free slots stack: ABA tag in the upper half, and `index + 1` (or zero) in the lower one.
+        std::atomic<std::uint64_t> free_slots{0};
+    };
+
+    struct SlotHeader
+    {
+        std::atomic<std::uint32_t> ref_count{0};
+        std::atomic<std::uint32_t> next_free{0};
+        std::atomic<std::uint32_t> payload_size{0};
+    };
+
+    struct RingHeader
+    {
+        std::atomic<std::uint64_t> key{0};
+        std::atomic<std::uint64_t> head{0};
+    };
+
+    struct RingEntry
+    {
+        /// `sequence + 1` of the published entry; zero while the entry is (re)written.
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint64_t> transfer_id{0};
+        std::atomic<std::uint32_t> slot_index{0};
+        std::atomic<std::uint32_t> attributes{0};
+    };
+
+    struct Offsets
+    {
+        explicit Offsets(const SegmentLayout& layout) noexcept
+            : rings{alignUp(sizeof(Header))}
+            , ring_stride{alignUp(sizeof(RingHeader) + (layout.ring_capacity * sizeof(RingEntry)))}
+            , slots{rings + (static_cast<std::size_t>(layout.ring_count) * ring_stride)}
+            , slot_stride{alignUp(sizeof(SlotHeader) + layout.slot_size)}
+        {
+        }
+
+        std::size_t rings;
+        std::size_t ring_stride;
+        std::size_t slots;
+        std::size_t slot_stride;
+    };
+
+    Segment(cetl::byte* const base, const SegmentLayout& layout) noexcept
+        : base_{base}
+        , layout_{layout}
+        , offsets_{layout}
+    {
+    }
+
+    CETL_NODISCARD static constexpr std::size_t alignUp(const std::size_t size) noexcept
+    {
+        return (size + CacheLine - 1U) & ~(CacheLine - 1U);
+    }
+
+    CETL_NODISCARD static std::uint64_t nextTag(const std::uint64_t head) noexcept
+    {
+        return ((head >> 32U) + 1U) << 32U;
+    }
+
+    CETL_NODISCARD static bool isValidLayout(const SegmentLayout& layout) noexcept
+    {
+        return (layout.slot_count > 0) && (layout.slot_count < NoSlot) && (layout.slot_size > 0) &&
+               (layout.ring_count > 0) && (layout.ring_capacity > 0) &&
+               ((layout.ring_capacity & (layout.ring_capacity - 1U)) == 0);
+    }
+
+    CETL_NODISCARD static bool isValidMemory(const cetl::span<cetl::byte> memory) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto address = reinterpret_cast<std::uintptr_t>(memory.data());
+        return (memory.data() != nullptr) && ((address % alignof(std::atomic<std::uint64_t>)) == 0);
+    }
+
+    // Next nolint-s are unavoidable: the segment is a raw shared memory, so we need offsets & casts.
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    CETL_NODISCARD Header& header() const noexcept
+    {
+        return *reinterpret_cast<Header*>(base_);
+    }
+
+    CETL_NODISCARD SlotHeader& slotHeader(const std::uint32_t slot_index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(slot_index < layout_.slot_count, "");
+        return *reinterpret_cast<SlotHeader*>(base_ + offsets_.slots + (slot_index * offsets_.slot_stride));
+    }
+
+    CETL_NODISCARD RingHeader& ringHeader(const std::uint32_t ring_index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(ring_index < layout_.ring_count, "");
+        return *reinterpret_cast<RingHeader*>(base_ + offsets_.rings + (ring_index * offsets_.ring_stride));
+    }
+
+    CETL_NODISCARD RingEntry& ringEntry(const std::uint32_t ring_index, const std::uint64_t entry_index) const noexcept
+    {
+        CETL_DEBUG_ASSERT(entry_index < layout_.ring_capacity, "");
+        return *reinterpret_cast<RingEntry*>(base_ + offsets_.rings + (ring_index * offsets_.ring_stride) +
+                                             sizeof(RingHeader) + (entry_index * sizeof(RingEntry)));
+    }
+
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // MARK: Data members:
+
+    cetl::byte*   base_;
+    SegmentLayout layout_;
+    Offsets       offsets_;
+
+};  // Segment
+
+// MARK: -
+
+/// @brief Defines scattered buffer storage over a payload slot of a shared memory segment.
+///
+/// The storage owns one reference to the slot, which is released on destruction - so the payload is shared
+/// (without copying) between the publisher and all its subscribers for as long as any of them needs it.
+///
+/// NB! The storage refers to the segment view of its transport, so it must not outlive the transport.
+///
+class SlotStorage final : public ScatteredBuffer::IStorage
+{
+public:
+    SlotStorage(const Segment& segment, const std::uint32_t slot_index, const std::size_t size) noexcept
+        : segment_{&segment}
+        , slot_index_{slot_index}
+        , size_{size}
+    {
+    }
+    SlotStorage(SlotStorage&& other) noexcept
+        : segment_{std::exchange(other.segment_, nullptr)}
+        , slot_index_{other.slot_index_}
+        , size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    SlotStorage(const SlotStorage&)                = delete;
+    SlotStorage& operator=(const SlotStorage&)     = delete;
+    SlotStorage& operator=(SlotStorage&&) noexcept = delete;
+
+    ~SlotStorage()
+    {
+        if (segment_ != nullptr)
+        {
+            segment_->releaseSlot(slot_index_);
+        }
+    }
+
+    /// @brief Truncates the payload to the given size (f.e. to the extent of a subscriber).
+    ///
+    void truncate(const std::size_t max_size) noexcept
+    {
+        size_ = std::min(size_, max_size);
+    }
+
+    // MARK: ScatteredBuffer::IStorage
+
+    CETL_NODISCARD std::size_t size() const noexcept override
+    {
+        return size_;
+    }
+
+    CETL_NODISCARD std::size_t copy(const std::size_t offset_bytes,
+                                    cetl::byte* const destination,
+                                    const std::size_t length_bytes) const override
+    {
+        CETL_DEBUG_ASSERT((destination != nullptr) || (length_bytes == 0),
+                          "Destination could be null only with zero bytes ask.");
+
+        if ((destination == nullptr) || (segment_ == nullptr) || (size_ <= offset_bytes))
+        {
+            return 0;
+        }
+
+        const std::size_t bytes_to_copy = std::min(length_bytes, size_ - offset_bytes);
+        // Next nolint is unavoidable: we need offset from the beginning of the buffer.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        (void) std::memmove(destination, segment_->getSlotBuffer(slot_index_).data() + offset_bytes, bytes_to_copy);
+        return bytes_to_copy;
+    }
+
+    bool observeFragments(ScatteredBuffer::IFragmentsObserver& observer) const override
+    {
+        if ((segment_ != nullptr) && (size_ > 0))
+        {
+            observer.onNext({segment_->getSlotBuffer(slot_index_).data(), size_});
+        }
+        return true;
+    }
+
+private:
+    // MARK: Data members:
+
+    const Segment* segment_;
+    std::uint32_t  slot_index_;
+    std::size_t    size_;
+
+};  // SlotStorage
+
+}  // namespace detail
+
+/// @brief Gets total size (in bytes) of a shared memory segment with the given layout.
+///
+inline std::size_t getSegmentSize(const SegmentLayout& layout) noexcept
+{
+    return detail::Segment::getRequiredSize(layout);
+}
+
+/// @brief Formats (aka initializes) a new shared memory segment.
+///
+/// Supposed to be called only once by the segment creator (f.e. right after `::shm_open` & `::mmap`),
+/// before any shared memory transport is attached to the segment.
+///
+/// @param memory The whole segment memory. Should be at least `getSegmentSize(layout)` bytes,
+///               and aligned at least as `std::uint64_t`.
+/// @param layout The segment layout.
+/// @return `ArgumentError` if the layout is invalid, or the memory is too small (or misaligned).
+///
+inline cetl::optional<ArgumentError> formatSegment(const cetl::span<cetl::byte> memory,
+                                                   const SegmentLayout&         layout) noexcept
+{
+    return detail::Segment::format(memory, layout);
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_SEGMENT_HPP_INCLUDED
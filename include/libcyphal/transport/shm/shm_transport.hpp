@@ -0,0 +1,93 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_HPP_INCLUDED
+
+#include "media.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/transport.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// @brief Defines interface of shared memory transport layer.
+///
+/// The transport connects nodes which are co-located on the same host (f.e. different processes) through
+/// a shared memory segment (see `IMedia`). Payload of a transfer is copied only once - into a shared slot
+/// at the publisher side; subscribers get their transfer payloads directly from the shared slots.
+///
+/// Note that nodes must be non-anonymous to send transfers (including messages) - every published port
+/// is owned by its node, and the local node doesn't receive its own transfers.
+///
+class IShmTransport : public ITransport
+{
+public:
+    /// Defines structure for reporting transient transport errors to the user's handler.
+    ///
+    struct TransientErrorReport
+    {
+        /// @brief Error report about notifying other nodes via the media interface.
+        struct MediaNotify
+        {
+            AnyFailure failure;
+            IMedia&    culprit;
+        };
+
+        /// Defines variant of all possible transient error reports.
+        ///
+        using Variant = cetl::variant<MediaNotify>;
+
+    };  // TransientErrorReport
+
+    /// @brief Defines signature of a transient error handler.
+    ///
+    /// If set, this handler is called by the transport layer when a transient media related error occurs during
+    /// transport's transmission of data.
+    ///
+    /// Note that there is a limited set of things that can be done within this handler, f.e.:
+    /// - it's not allowed to call a TX session `send` or RX session `receive` methods from within this handler;
+    /// - main purpose of the handler is to log/report/stat the error, and potentially modify state of the media.
+    ///
+    /// @param report The error report to be handled.
+    /// @return An optional (maybe different) error back to the transport. The result is propagated to the user
+    ///         (as result of the TX session `send`); `cetl::nullopt` means that the error is considered as handled
+    ///         and insignificant (the transfer is published anyway - only the wake-up of other nodes has failed).
+    ///
+    using TransientErrorHandler =
+        cetl::pmr::function<cetl::optional<AnyFailure>(TransientErrorReport::Variant& report_var),
+                            config::Transport::Shm::IShmTransport_TransientErrorHandlerMaxSize()>;
+
+    IShmTransport(const IShmTransport&)                = delete;
+    IShmTransport(IShmTransport&&) noexcept            = delete;
+    IShmTransport& operator=(const IShmTransport&)     = delete;
+    IShmTransport& operator=(IShmTransport&&) noexcept = delete;
+
+    /// Sets new transient error handler.
+    ///
+    /// - If the handler is set, it will be called by the transport layer when a transient media related error occurs.
+    /// - If the handler is not set (default mode), media failures are propagated to the user as is.
+    ///
+    virtual void setTransientErrorHandler(TransientErrorHandler handler) = 0;
+
+protected:
+    IShmTransport()  = default;
+    ~IShmTransport() = default;
+
+};  // IShmTransport
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_HPP_INCLUDED
@@ -0,0 +1,565 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_IMPL_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_IMPL_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "media.hpp"
+#include "msg_rx_session.hpp"
+#include "msg_tx_session.hpp"
+#include "segment.hpp"
+#include "shm_transport.hpp"
+#include "svc_rx_sessions.hpp"
+#include "svc_tx_sessions.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Represents final implementation class of the shared memory transport.
+///
+/// TX transfers are copied into a free slot of the segment, and published right away to the ring
+/// of their (port, local node) pair; then other nodes are notified via the media "doorbell".
+/// On notification, all rings of the locally subscribed ports are scanned from the per ring cursors,
+/// and read transfers are handed over to the RX sessions with their payloads still in the shared slots.
+///
+class TransportImpl final : private TransportDelegate, public IShmTransport
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<IShmTransport, TransportImpl>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+    /// @brief Defines a registered RX session (kept sorted by the port key).
+    ///
+    struct RxPort
+    {
+        std::uint32_t       key;
+        IRxSessionDelegate* delegate;
+    };
+
+    /// @brief Defines a ring claimed by this transport for publishing (kept sorted by the ring key).
+    ///
+    struct TxRing
+    {
+        std::uint64_t key;
+        std::uint32_t index;
+    };
+
+    using Cursors = libcyphal::detail::VarArray<std::uint64_t>;
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<IShmTransport>, FactoryFailure> make(cetl::pmr::memory_resource& memory,
+                                                                                  IExecutor& executor,
+                                                                                  IMedia&    media)
+    {
+        // Verify input arguments:
+        // - The media segment should be already formatted.
+        //
+        auto segment = Segment::attach(media.getSegment());
+        if (!segment)
+        {
+            return ArgumentError{};
+        }
+
+        // Every ring has its own read cursor.
+        //
+        const std::size_t ring_count = segment->getLayout().ring_count;
+        Cursors           cursors{&memory};
+        cursors.reserve(ring_count);
+        if (cursors.capacity() < ring_count)
+        {
+            return MemoryError{};
+        }
+        for (std::uint32_t index = 0; index < ring_count; ++index)
+        {
+            cursors.push_back(segment->getRingHead(index));
+        }
+
+        auto transport = libcyphal::detail::makeUniquePtr<Spec>(memory,
+                                                                Spec{},
+                                                                memory,
+                                                                executor,
+                                                                media,
+                                                                *segment,
+                                                                std::move(cursors));
+        if (transport == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return transport;
+    }
+
+    TransportImpl(const Spec,
+                  cetl::pmr::memory_resource& memory,
+                  IExecutor&                  executor,
+                  IMedia&                     media,
+                  const Segment&              segment,
+                  Cursors&&                   cursors)
+        : TransportDelegate{memory}
+        , executor_{executor}
+        , media_{media}
+        , segment_{segment}
+        , cursors_{std::move(cursors)}
+        , rx_ports_{&memory}
+        , tx_rings_{&memory}
+    {
+    }
+
+    TransportImpl(const TransportImpl&)                = delete;
+    TransportImpl(TransportImpl&&) noexcept            = delete;
+    TransportImpl& operator=(const TransportImpl&)     = delete;
+    TransportImpl& operator=(TransportImpl&&) noexcept = delete;
+
+    ~TransportImpl()
+    {
+        notification_callback_.reset();
+
+        CETL_DEBUG_ASSERT(rx_ports_.empty(), "RX sessions must be destroyed before transport.");
+    }
+
+    // In use (public) for unit tests only.
+    CETL_NODISCARD TransportDelegate& asDelegate()
+    {
+        return *this;
+    }
+
+private:
+    using Callback = IExecutor::Callback;
+
+    // MARK: IShmTransport
+
+    void setTransientErrorHandler(TransientErrorHandler handler) override
+    {
+        transient_error_handler_ = std::move(handler);
+    }
+
+    // MARK: ITransport
+
+    CETL_NODISCARD cetl::optional<NodeId> getLocalNodeId() const noexcept override
+    {
+        if (getNodeId() > NodeIdMax)
+        {
+            return cetl::nullopt;
+        }
+
+        return cetl::make_optional(getNodeId());
+    }
+
+    CETL_NODISCARD cetl::optional<ArgumentError> setLocalNodeId(const NodeId new_node_id) noexcept override
+    {
+        if (new_node_id > NodeIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        // Allow setting the same node ID multiple times, but only once otherwise.
+        //
+        if (getNodeId() == new_node_id)
+        {
+            return cetl::nullopt;
+        }
+        if (getNodeId() != NodeIdUnset)
+        {
+            return ArgumentError{};
+        }
+        setNodeId(new_node_id);
+
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD ProtocolParams getProtocolParams() const noexcept override
+    {
+        return ProtocolParams{std::numeric_limits<TransferId>::max(),
+                              segment_.getLayout().slot_size,
+                              static_cast<NodeId>(NodeIdMax + 1U)};
+    }
+
+    CETL_NODISCARD IoStatistics getTransferStatistics() const noexcept override
+    {
+        return transfer_counters_.snapshot();
+    }
+
+    CETL_NODISCARD cetl::optional<IoStatistics> getMediaStatistics(
+        const std::uint8_t media_index) const noexcept override
+    {
+        if (media_index > 0)
+        {
+            return cetl::nullopt;
+        }
+
+        return media_counters_.snapshot();
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
+        const MessageRxParams& params) override
+    {
+        return MessageRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IMessageTxSession>, AnyFailure> makeMessageTxSession(
+        const MessageTxParams& params) override
+    {
+        return MessageTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestRxSession>, AnyFailure> makeRequestRxSession(
+        const RequestRxParams& params) override
+    {
+        return SvcRequestRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IRequestTxSession>, AnyFailure> makeRequestTxSession(
+        const RequestTxParams& params) override
+    {
+        return SvcRequestTxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseRxSession>, AnyFailure> makeResponseRxSession(
+        const ResponseRxParams& params) override
+    {
+        return SvcResponseRxSession::make(asDelegate(), params);
+    }
+
+    CETL_NODISCARD Expected<UniquePtr<IResponseTxSession>, AnyFailure> makeResponseTxSession(
+        const ResponseTxParams& params) override
+    {
+        return SvcResponseTxSession::make(asDelegate(), params);
+    }
+
+    // MARK: TransportDelegate
+
+    CETL_NODISCARD cetl::optional<AnyFailure> sendTransfer(const TxTransferHeader& header,
+                                                           const PayloadFragments  payload_fragments) override
+    {
+        // Rings are owned by their publishing nodes, so anonymous nodes can't publish anything.
+        if (getNodeId() > NodeIdMax)
+        {
+            transfer_counters_.onFailure(AnonymousError{});
+            return AnonymousError{};
+        }
+
+        std::size_t payload_size = 0;
+        for (const auto fragment : payload_fragments)
+        {
+            payload_size += fragment.size();
+        }
+        if (payload_size > segment_.getLayout().slot_size)
+        {
+            transfer_counters_.onFailure(ArgumentError{});
+            return ArgumentError{};
+        }
+
+        auto maybe_ring_index = ensureTxRing(makeRingKey(makePortKey(header.kind, header.port_id), getNodeId()));
+        if (auto* const failure = cetl::get_if<AnyFailure>(&maybe_ring_index))
+        {
+            transfer_counters_.onFailure(*failure);
+            return std::move(*failure);
+        }
+        const auto ring_index = cetl::get<std::uint32_t>(maybe_ring_index);
+
+        // All slots are in use - most probably some subscribers are too slow to release their transfers.
+        const std::uint32_t slot_index = segment_.allocateSlot();
+        if (slot_index == Segment::NoSlot)
+        {
+            transfer_counters_.onFailure(CapacityError{});
+            return CapacityError{};
+        }
+
+        // This is the only copy of the payload - subscribers will read it right from the slot.
+        const auto  slot_buffer = segment_.getSlotBuffer(slot_index);
+        std::size_t offset      = 0;
+        for (const auto fragment : payload_fragments)
+        {
+            if (!fragment.empty())
+            {
+                // Next nolint is unavoidable: we need offset from the beginning of the buffer.
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                (void) std::memmove(slot_buffer.data() + offset, fragment.data(), fragment.size());
+                offset += fragment.size();
+            }
+        }
+        segment_.setSlotPayloadSize(slot_index, payload_size);
+
+        segment_.publish(ring_index,
+                         Segment::Entry{header.transfer_id, slot_index, header.priority, header.destination_node_id});
+        transfer_counters_.onEmitted();
+        media_counters_.onEmitted();
+
+        if (auto media_failure = media_.notify())
+        {
+            return tryHandleTransientMediaFailure<TransientErrorReport::MediaNotify>(std::move(*media_failure));
+        }
+        return cetl::nullopt;
+    }
+
+    CETL_NODISCARD cetl::optional<AnyFailure> prepareRxSession(const std::uint32_t port_key) override
+    {
+        const RxPort* const it = findRxPort(port_key);
+        if (isFoundRxPort(it, port_key))
+        {
+            return AlreadyExistsError{};
+        }
+
+        // Make sure that there is room for one more port, so that the following registration can't fail.
+        if (rx_ports_.size() == rx_ports_.capacity())
+        {
+            rx_ports_.reserve(std::max<std::size_t>(rx_ports_.capacity() * 2, 4));
+            if (rx_ports_.size() == rx_ports_.capacity())
+            {
+                return MemoryError{};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    void registerRxSession(const std::uint32_t port_key, IRxSessionDelegate& session) noexcept override
+    {
+        CETL_DEBUG_ASSERT(rx_ports_.size() < rx_ports_.capacity(), "`prepareRxSession` is expected to be called.");
+
+        // Keep the array sorted by the key - move the new (last) port to its position.
+        const auto position = static_cast<std::size_t>(findRxPort(port_key) - rx_ports_.data());
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        rx_ports_.push_back(RxPort{port_key, &session});
+        auto* const first = rx_ports_.data();
+        std::rotate(first + position, first + rx_ports_.size() - 1, first + rx_ports_.size());
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // The new session is interested only in transfers which will be published from now on.
+        for (std::uint32_t ring_index = 0; ring_index < cursors_.size(); ++ring_index)
+        {
+            if (static_cast<std::uint32_t>(segment_.getRingKey(ring_index) >> 16U) == port_key)
+            {
+                cursors_[ring_index] = segment_.getRingHead(ring_index);
+            }
+        }
+
+        if (!notification_callback_)
+        {
+            notification_callback_ = media_.registerNotificationCallback([this](const auto&) {
+                //
+                media_.clearNotifications();
+                receiveTransfers();
+            });
+        }
+    }
+
+    void unregisterRxSession(const std::uint32_t port_key, const IRxSessionDelegate& session) noexcept override
+    {
+        RxPort* const it = findRxPort(port_key);
+        if (isFoundRxPort(it, port_key) && (it->delegate == &session))
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::rotate(it, it + 1, rx_ports_.data() + rx_ports_.size());
+            rx_ports_.pop_back();
+        }
+
+        if (rx_ports_.empty())
+        {
+            notification_callback_.reset();
+        }
+    }
+
+    // MARK: Privates:
+
+    CETL_NODISCARD RxPort* findRxPort(const std::uint32_t port_key) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return std::lower_bound(rx_ports_.data(),
+                                rx_ports_.data() + rx_ports_.size(),
+                                port_key,
+                                [](const RxPort& port, const std::uint32_t key) { return port.key < key; });
+    }
+
+    CETL_NODISCARD bool isFoundRxPort(const RxPort* const it, const std::uint32_t port_key) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return (it != (rx_ports_.data() + rx_ports_.size())) && (it->key == port_key);
+    }
+
+    /// @brief Finds (or claims) the segment ring for publishing transfers of the given ring key.
+    ///
+    CETL_NODISCARD Expected<std::uint32_t, AnyFailure> ensureTxRing(const std::uint64_t ring_key)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* const end = tx_rings_.data() + tx_rings_.size();
+        auto* const it  = std::lower_bound(tx_rings_.data(), end, ring_key, [](const TxRing& ring, std::uint64_t key) {
+            return ring.key < key;
+        });
+        if ((it != end) && (it->key == ring_key))
+        {
+            return it->index;
+        }
+
+        const auto position = static_cast<std::size_t>(it - tx_rings_.data());
+        if (tx_rings_.size() == tx_rings_.capacity())
+        {
+            tx_rings_.reserve(std::max<std::size_t>(tx_rings_.capacity() * 2, 4));
+            if (tx_rings_.size() == tx_rings_.capacity())
+            {
+                return MemoryError{};
+            }
+        }
+
+        const auto ring_index = segment_.claimRing(ring_key);
+        if (!ring_index)
+        {
+            return CapacityError{};
+        }
+
+        // Keep the array sorted by the key - move the new (last) ring to its position.
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        tx_rings_.push_back(TxRing{ring_key, *ring_index});
+        auto* const first = tx_rings_.data();
+        std::rotate(first + position, first + tx_rings_.size() - 1, first + tx_rings_.size());
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return *ring_index;
+    }
+
+    template <typename Report>
+    cetl::optional<AnyFailure> tryHandleTransientMediaFailure(MediaFailure&& media_failure)
+    {
+        auto failure = libcyphal::detail::upcastVariant<AnyFailure>(std::move(media_failure));
+        media_counters_.onFailure(failure);
+
+        if (transient_error_handler_)
+        {
+            TransientErrorReport::Variant report_var{Report{std::move(failure), media_}};
+            return transient_error_handler_(report_var);
+        }
+
+        return std::move(failure);
+    }
+
+    /// @brief Reads all new transfers (of the locally subscribed ports) from the segment rings.
+    ///
+    /// Reading of a single ring is limited by the ring capacity, so that a fast publisher
+    /// can't starve the executor (the rest will be read on the next notification).
+    ///
+    void receiveTransfers()
+    {
+        const TimePoint now = executor_.now();
+        for (std::uint32_t ring_index = 0; ring_index < cursors_.size(); ++ring_index)
+        {
+            const std::uint64_t ring_key = segment_.getRingKey(ring_index);
+            const auto          source   = static_cast<NodeId>(ring_key & 0xFFFFU);
+            const auto          port_key = static_cast<std::uint32_t>(ring_key >> 16U);
+            if ((ring_key == 0) || (source == getNodeId()) || !isFoundRxPort(findRxPort(port_key), port_key))
+            {
+                continue;
+            }
+
+            // Services are point-to-point: only transfers destined to us are accepted.
+            const bool is_service = port_key >= makePortKey(PortKind::Request, 0);
+
+            std::size_t    lost_count = 0;
+            Segment::Entry entry{};
+            for (std::size_t count = 0; count < segment_.getLayout().ring_capacity; ++count)
+            {
+                if (!segment_.read(ring_index, cursors_[ring_index], entry, lost_count))
+                {
+                    break;
+                }
+                media_counters_.onReceived();
+
+                SlotStorage storage{segment_, entry.slot_index, segment_.getSlotPayloadSize(entry.slot_index)};
+                if (is_service && (entry.destination_node_id != getNodeId()))
+                {
+                    continue;
+                }
+
+                // Session might be destroyed (or new one created) by a previous transfer callback - so find it again.
+                RxPort* const it = findRxPort(port_key);
+                if (isFoundRxPort(it, port_key))
+                {
+                    const TransferRxMetadata rx_metadata{{entry.transfer_id, entry.priority}, now};
+                    it->delegate->acceptRxTransfer(rx_metadata, source, std::move(storage));
+                    transfer_counters_.onReceived();
+                }
+            }
+
+            // Entries overwritten before we have read them are lost (the subscriber was too slow).
+            for (; lost_count > 0; --lost_count)
+            {
+                media_counters_.onFailure(CapacityError{});
+            }
+        }
+    }
+
+    // MARK: Data members:
+
+    IExecutor&                          executor_;
+    IMedia&                             media_;
+    const Segment                       segment_;
+    Cursors                             cursors_;
+    libcyphal::detail::VarArray<RxPort> rx_ports_;
+    libcyphal::detail::VarArray<TxRing> tx_rings_;
+    TransientErrorHandler               transient_error_handler_;
+    Callback::Any                       notification_callback_;
+    transport::detail::IoCounters       transfer_counters_;
+    transport::detail::IoCounters       media_counters_;
+
+};  // TransportImpl
+
+}  // namespace detail
+
+/// @brief Makes a new shared memory transport instance.
+///
+/// NB! Lifetime of the transport instance must never outlive `memory`, `executor` and `media` instances.
+/// Also, received transfer payloads refer to the shared segment (via the transport), so they must be released
+/// before the transport is destroyed.
+///
+/// @param memory Reference to a polymorphic memory resource to use for all allocations.
+/// @param executor Interface of the executor to use.
+/// @param media The shared memory media interface to use. Its segment must be already formatted.
+/// @return Unique pointer to the new shared memory transport instance or an error.
+///
+inline Expected<UniquePtr<IShmTransport>, FactoryFailure> makeTransport(cetl::pmr::memory_resource& memory,
+                                                                        IExecutor&                  executor,
+                                                                        IMedia&                     media)
+{
+    return detail::TransportImpl::make(memory, executor, media);
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_TRANSPORT_IMPL_HPP_INCLUDED
@@ -0,0 +1,194 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_SVC_RX_SESSIONS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_SVC_RX_SESSIONS_HPP_INCLUDED
+
+#include "delegate.hpp"
+#include "segment.hpp"
+
+#include "libcyphal/errors.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/scattered_buffer.hpp"
+#include "libcyphal/transport/svc_sessions.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+/// Internal implementation details of the shared memory transport.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief A template class to represent a service request/response RX session (both for server and client sides).
+///
+/// @tparam Interface_ Type of the session interface.
+///                    Could be either `IRequestRxSession` or `IResponseRxSession`.
+/// @tparam Params Type of the session parameters.
+///                Could be either `RequestRxParams` or `ResponseRxParams`.
+///
+template <typename Interface_, typename Params, bool IsRequest>
+class SvcRxSession final : private IRxSessionDelegate, public Interface_
+{
+    /// @brief Defines private specification for making interface unique ptr.
+    ///
+    struct Spec : libcyphal::detail::UniquePtrSpec<Interface_, SvcRxSession>
+    {
+        // `explicit` here is in use to disable public construction of derived private `Spec` structs.
+        // See https://seanmiddleditch.github.io/enabling-make-unique-with-private-constructors/
+        explicit Spec() = default;
+    };
+
+public:
+    CETL_NODISCARD static Expected<UniquePtr<Interface_>, AnyFailure> make(TransportDelegate& delegate,
+                                                                           const Params&      params)
+    {
+        if (params.service_id > ServiceIdMax)
+        {
+            return ArgumentError{};
+        }
+
+        if (auto failure = delegate.prepareRxSession(makePortKey(Kind, params.service_id)))
+        {
+            return std::move(*failure);
+        }
+
+        auto session = libcyphal::detail::makeUniquePtr<Spec>(delegate.memory(), Spec{}, delegate, params);
+        if (session == nullptr)
+        {
+            return MemoryError{};
+        }
+
+        return session;
+    }
+
+    SvcRxSession(const Spec, TransportDelegate& delegate, const Params& params)
+        : delegate_{delegate}
+        , params_{params}
+    {
+        delegate.registerRxSession(makePortKey(Kind, params.service_id), *this);
+    }
+
+    SvcRxSession(const SvcRxSession&)                = delete;
+    SvcRxSession(SvcRxSession&&) noexcept            = delete;
+    SvcRxSession& operator=(const SvcRxSession&)     = delete;
+    SvcRxSession& operator=(SvcRxSession&&) noexcept = delete;
+
+    ~SvcRxSession()
+    {
+        delegate_.unregisterRxSession(makePortKey(Kind, params_.service_id), *this);
+    }
+
+private:
+    static constexpr PortKind Kind = IsRequest ? PortKind::Request : PortKind::Response;
+
+    // MARK: Interface
+
+    CETL_NODISCARD Params getParams() const noexcept override
+    {
+        return params_;
+    }
+
+    CETL_NODISCARD cetl::optional<ServiceRxTransfer> receive() override
+    {
+        if (last_rx_transfer_)
+        {
+            auto transfer = std::move(*last_rx_transfer_);
+            last_rx_transfer_.reset();
+            return transfer;
+        }
+        return cetl::nullopt;
+    }
+
+    void setOnReceiveCallback(ISvcRxSession::OnReceiveCallback::Function&& function) override
+    {
+        on_receive_cb_fn_ = std::move(function);
+    }
+
+    // MARK: IRxSession
+
+    void setTransferIdTimeout(const Duration) override
+    {
+        // Every ring entry is read exactly once - there are no duplicates, and hence the timeout is not in use.
+    }
+
+    // MARK: IRxSessionDelegate
+
+    void acceptRxTransfer(const TransferRxMetadata& rx_metadata,
+                          const NodeId              source_node_id,
+                          SlotStorage&&             storage) override
+    {
+        if (!isExpectedSource(params_, source_node_id))
+        {
+            return;
+        }
+
+        // Payload beyond the extent is implicitly truncated (but the slot is kept as is - no copying).
+        storage.truncate(params_.extent_bytes);
+
+        const ServiceRxMetadata meta{rx_metadata, source_node_id};
+        ServiceRxTransfer       svc_rx_transfer{meta, ScatteredBuffer{std::move(storage)}};
+        if (on_receive_cb_fn_)
+        {
+            on_receive_cb_fn_(ISvcRxSession::OnReceiveCallback::Arg{svc_rx_transfer});
+            return;
+        }
+        (void) last_rx_transfer_.emplace(std::move(svc_rx_transfer));
+    }
+
+    // MARK: Privates:
+
+    /// Requests are accepted from any client.
+    ///
+    CETL_NODISCARD static bool isExpectedSource(const RequestRxParams&, const NodeId) noexcept
+    {
+        return true;
+    }
+
+    /// Responses are accepted only from the server node.
+    ///
+    CETL_NODISCARD static bool isExpectedSource(const ResponseRxParams& params, const NodeId source_node_id) noexcept
+    {
+        return params.server_node_id == source_node_id;
+    }
+
+    // MARK: Data members:
+
+    TransportDelegate&                         delegate_;
+    const Params                               params_;
+    cetl::optional<ServiceRxTransfer>          last_rx_transfer_;
+    ISvcRxSession::OnReceiveCallback::Function on_receive_cb_fn_;
+
+};  // SvcRxSession
+
+// MARK: -
+
+/// @brief A concrete class to represent a service request RX session (aka server side).
+///
+using SvcRequestRxSession = SvcRxSession<IRequestRxSession, RequestRxParams, true /*IsRequest*/>;
+
+/// @brief A concrete class to represent a service response RX session (aka client side).
+///
+using SvcResponseRxSession = SvcRxSession<IResponseRxSession, ResponseRxParams, false /*IsRequest*/>;
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_SVC_RX_SESSIONS_HPP_INCLUDED
@@ -0,0 +1,142 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_STATISTICS_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_STATISTICS_HPP_INCLUDED
+
+#include "errors.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace libcyphal
+{
+namespace transport
+{
+
+/// @brief Defines a snapshot of input/output statistics counters.
+///
+/// Depending on the context, the counters are either of whole transfers (transport level),
+/// or of individual frames/datagrams (media level).
+/// All counters are monotonically increasing, and they wrap around on overflow.
+///
+struct IoStatistics final
+{
+    /// Defines type of a single counter.
+    ///
+    /// 32-bit is the widest type which is guaranteed to be lock-free on all supported (including 32-bit MCU) targets.
+    ///
+    using Counter = std::uint32_t;
+
+    /// Number of successfully emitted transfers (or frames).
+    Counter num_emitted{0};
+
+    /// Number of successfully received transfers (or frames).
+    Counter num_received{0};
+
+    /// Number of failures (of any kind, including overruns).
+    Counter num_errored{0};
+
+    /// Number of failures caused by exhausted capacity or memory (f.e. full TX queue).
+    /// These are a subset of `num_errored`.
+    Counter num_overruns{0};
+
+};  // IoStatistics
+
+/// Internal implementation details of the transport layer.
+/// Not supposed to be used directly by the users of the library.
+///
+namespace detail
+{
+
+/// @brief Defines lock-free input/output statistics counters.
+///
+/// Counters are updated by the transport (in the executor context) using plain relaxed atomic increments,
+/// so it's cheap to maintain them, and it's safe to read them (see `snapshot`) from any other thread.
+/// Note that the snapshot is not atomic as a whole - each counter is read individually.
+///
+class IoCounters final
+{
+public:
+    IoCounters() = default;
+
+    /// Copying is supported for the sake of storing counters in movable containers (like `VarArray`).
+    /// The copy is initialized with the current values of the counters.
+    ///
+    IoCounters(const IoCounters& other) noexcept
+        : num_emitted_{load(other.num_emitted_)}
+        , num_received_{load(other.num_received_)}
+        , num_errored_{load(other.num_errored_)}
+        , num_overruns_{load(other.num_overruns_)}
+    {
+    }
+
+    ~IoCounters() = default;
+
+    // Intentionally no move constructor - moving falls back to the above copying.
+    IoCounters& operator=(const IoCounters&)     = delete;
+    IoCounters& operator=(IoCounters&&) noexcept = delete;
+
+    void onEmitted() noexcept
+    {
+        increment(num_emitted_);
+    }
+
+    void onReceived() noexcept
+    {
+        increment(num_received_);
+    }
+
+    /// Counts the failure as an error, and (if applicable) also as an overrun.
+    ///
+    void onFailure(const AnyFailure& failure) noexcept
+    {
+        increment(num_errored_);
+        if ((nullptr != cetl::get_if<CapacityError>(&failure)) || (nullptr != cetl::get_if<MemoryError>(&failure)))
+        {
+            increment(num_overruns_);
+        }
+    }
+
+    CETL_NODISCARD IoStatistics snapshot() const noexcept
+    {
+        IoStatistics stats{};
+        stats.num_emitted  = load(num_emitted_);
+        stats.num_received = load(num_received_);
+        stats.num_errored  = load(num_errored_);
+        stats.num_overruns = load(num_overruns_);
+        return stats;
+    }
+
+private:
+    using Counter = std::atomic<IoStatistics::Counter>;
+
+    static void increment(Counter& counter) noexcept
+    {
+        (void) counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CETL_NODISCARD static IoStatistics::Counter load(const Counter& counter) noexcept
+    {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    // MARK: Data members:
+
+    Counter num_emitted_{0};
+    Counter num_received_{0};
+    Counter num_errored_{0};
+    Counter num_overruns_{0};
+
+};  // IoCounters
+
+}  // namespace detail
+
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_STATISTICS_HPP_INCLUDED
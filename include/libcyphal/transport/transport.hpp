@@ -8,6 +8,7 @@
 
 #include "errors.hpp"
 #include "msg_sessions.hpp"
+#include "statistics.hpp"
 #include "svc_sessions.hpp"
 #include "types.hpp"
 
@@ -16,6 +17,8 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 
+#include <cstdint>
+
 namespace libcyphal
 {
 namespace transport
@@ -42,6 +45,34 @@ public:
     ///
     virtual ProtocolParams getProtocolParams() const noexcept = 0;
 
+    /// @brief Gets a snapshot of the transfer level statistics.
+    ///
+    /// Counts whole transfers which were successfully sent (to all redundant media) or received,
+    /// as well as failures to send or receive a transfer. The method is safe to call from any thread.
+    ///
+    /// The default implementation is for transports which don't collect statistics - all counters are zeros.
+    ///
+    virtual IoStatistics getTransferStatistics() const noexcept
+    {
+        return {};
+    }
+
+    /// @brief Gets a snapshot of the frame level statistics of a media interface.
+    ///
+    /// Counts frames (CAN) or datagrams (UDP) which were successfully pushed to or popped from the media,
+    /// as well as any media specific failures. The method is safe to call from any thread.
+    ///
+    /// The default implementation is for transports which don't collect statistics - there is no media to report.
+    ///
+    /// @param media_index Index of the media interface (the same as in the `TransientErrorReport`).
+    /// @return Statistics of the media, or `nullopt` if the index is out of range (or statistics are not supported).
+    ///
+    virtual cetl::optional<IoStatistics> getMediaStatistics(const std::uint8_t media_index) const noexcept
+    {
+        (void) media_index;
+        return cetl::nullopt;
+    }
+
     /// @brief Gets the local node ID (if any).
     ///
     /// It's optional to have a local node ID set (see anonymous nodes in the Cyphal spec).
@@ -0,0 +1,255 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_CAPTURE_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_CAPTURE_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/pcapng.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines UDP media decorator which captures all datagrams passing through its sockets into pcapng.
+///
+/// Datagrams accepted by `ITxSocket::send` are captured as outbound ones (timestamped by the current executor
+/// time), and datagrams returned by `IRxSocket::receive` - as inbound ones (with their reception timestamps).
+/// Datagrams are written as raw IPv4 packets with synthesized IPv4 and UDP headers (source address and port are
+/// not known to media, so they are zeroed), so captures could be inspected by Wireshark, and replayed by
+/// `ReplayMedia`. Timestamps are the executor time points (since its epoch) in nanoseconds.
+///
+/// The capture interface is added to the writer on the very first captured datagram.
+/// The writer must outlive the decorator, and the inner media must outlive the decorator.
+/// Sockets made by the decorator must not outlive it.
+///
+class CaptureMedia final : public IMedia
+{
+public:
+    CaptureMedia(cetl::pmr::memory_resource& memory, IExecutor& executor, IMedia& inner, pcapng::Writer& writer)
+        : memory_{memory}
+        , executor_{executor}
+        , inner_{inner}
+        , writer_{writer}
+    {
+    }
+
+    ~CaptureMedia()                                  = default;
+    CaptureMedia(const CaptureMedia&)                = delete;
+    CaptureMedia(CaptureMedia&&) noexcept            = delete;
+    CaptureMedia& operator=(const CaptureMedia&)     = delete;
+    CaptureMedia& operator=(CaptureMedia&&) noexcept = delete;
+
+    // MARK: IMedia
+
+    MakeTxSocketResult::Type makeTxSocket() override
+    {
+        auto        inner_result = inner_.makeTxSocket();
+        auto* const inner_socket = cetl::get_if<MakeTxSocketResult::Success>(&inner_result);
+        if (inner_socket == nullptr)
+        {
+            return inner_result;
+        }
+
+        auto tx_socket = makeUniquePtr<ITxSocket, TxSocket>(memory_, *this, std::move(*inner_socket));
+        if (tx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return tx_socket;
+    }
+
+    MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) override
+    {
+        auto        inner_result = inner_.makeRxSocket(multicast_endpoint);
+        auto* const inner_socket = cetl::get_if<MakeRxSocketResult::Success>(&inner_result);
+        if (inner_socket == nullptr)
+        {
+            return inner_result;
+        }
+
+        auto rx_socket =
+            makeUniquePtr<IRxSocket, RxSocket>(memory_, *this, std::move(*inner_socket), multicast_endpoint);
+        if (rx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return rx_socket;
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return inner_.getTxMemoryResource();
+    }
+
+private:
+    static constexpr std::uint32_t SnapLength = 0xFFFFU;
+
+    class TxSocket final : public ITxSocket
+    {
+    public:
+        TxSocket(CaptureMedia& media, UniquePtr<ITxSocket>&& inner)
+            : media_{media}
+            , inner_{std::move(inner)}
+        {
+        }
+
+        ~TxSocket()                              = default;
+        TxSocket(const TxSocket&)                = delete;
+        TxSocket(TxSocket&&) noexcept            = delete;
+        TxSocket& operator=(const TxSocket&)     = delete;
+        TxSocket& operator=(TxSocket&&) noexcept = delete;
+
+        // MARK: ITxSocket
+
+        std::size_t getMtu() const noexcept override
+        {
+            return inner_->getMtu();
+        }
+
+        SendResult::Type send(const TimePoint        deadline,
+                              const IpEndpoint       multicast_endpoint,
+                              const std::uint8_t     dscp,
+                              const PayloadFragments payload_fragments) override
+        {
+            auto result = inner_->send(deadline, multicast_endpoint, dscp, payload_fragments);
+            if (const auto* const success = cetl::get_if<SendResult::Success>(&result))
+            {
+                if (success->is_accepted)
+                {
+                    media_.capture(media_.executor_.now(),
+                                   pcapng::Direction::Outbound,
+                                   multicast_endpoint,
+                                   dscp,
+                                   payload_fragments);
+                }
+            }
+            return result;
+        }
+
+        CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+        {
+            return inner_->registerCallback(std::move(function));
+        }
+
+    private:
+        // MARK: Data members:
+
+        CaptureMedia&        media_;
+        UniquePtr<ITxSocket> inner_;
+
+    };  // TxSocket
+
+    class RxSocket final : public IRxSocket
+    {
+    public:
+        RxSocket(CaptureMedia& media, UniquePtr<IRxSocket>&& inner, const IpEndpoint& multicast_endpoint)
+            : media_{media}
+            , inner_{std::move(inner)}
+            , multicast_endpoint_{multicast_endpoint}
+        {
+        }
+
+        ~RxSocket()                              = default;
+        RxSocket(const RxSocket&)                = delete;
+        RxSocket(RxSocket&&) noexcept            = delete;
+        RxSocket& operator=(const RxSocket&)     = delete;
+        RxSocket& operator=(RxSocket&&) noexcept = delete;
+
+        // MARK: IRxSocket
+
+        CETL_NODISCARD ReceiveResult::Type receive() override
+        {
+            auto result = inner_->receive();
+            if (const auto* const success = cetl::get_if<ReceiveResult::Success>(&result))
+            {
+                if (success->has_value())
+                {
+                    const auto&                                       datagram = **success;
+                    const std::array<cetl::span<const cetl::byte>, 1> fragments{
+                        {{datagram.payload_ptr.get(), datagram.payload_ptr.get_deleter().size()}}};
+                    media_.capture(datagram.timestamp, pcapng::Direction::Inbound, multicast_endpoint_, 0, fragments);
+                }
+            }
+            return result;
+        }
+
+        CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+        {
+            return inner_->registerCallback(std::move(function));
+        }
+
+    private:
+        // MARK: Data members:
+
+        CaptureMedia&        media_;
+        UniquePtr<IRxSocket> inner_;
+        const IpEndpoint     multicast_endpoint_;
+
+    };  // RxSocket
+
+    void capture(const TimePoint         timestamp,
+                 const pcapng::Direction direction,
+                 const IpEndpoint&       endpoint,
+                 const std::uint8_t      dscp,
+                 const PayloadFragments  payload_fragments)
+    {
+        if (!interface_id_.has_value())
+        {
+            interface_id_ = writer_.addInterface(pcapng::LinkType::Ipv4, SnapLength);
+            if (!interface_id_.has_value())
+            {
+                return;
+            }
+        }
+
+        std::size_t payload_size = 0;
+        for (const auto& fragment : payload_fragments)
+        {
+            payload_size += fragment.size();
+        }
+        const auto headers = pcapng::Ipv4Udp::makeHeaders(endpoint.ip_address, endpoint.udp_port, dscp, payload_size);
+
+        (void) writer_.writePacket(*interface_id_,
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()),
+                                   direction,
+                                   headers,
+                                   payload_fragments);
+    }
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&   memory_;
+    IExecutor&                    executor_;
+    IMedia&                       inner_;
+    pcapng::Writer&               writer_;
+    cetl::optional<std::uint32_t> interface_id_;
+
+};  // CaptureMedia
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_CAPTURE_MEDIA_HPP_INCLUDED
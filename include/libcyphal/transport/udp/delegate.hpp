@@ -166,6 +166,22 @@ public:
             return total_bytes_copied;
         }
 
+        bool observeFragments(ScatteredBuffer::IFragmentsObserver& observer) const override
+        {
+            std::size_t remaining = payload_size_;
+            for (const UdpardFragment* frag = &payload_; (nullptr != frag) && (remaining > 0); frag = frag->next)
+            {
+                const std::size_t frag_size = std::min(frag->view.size, remaining);
+                if ((nullptr != frag->view.data) && (frag_size > 0))
+                {
+                    // No Sonar `cpp:S5356` b/c we integrate here with libudpard raw C buffers.
+                    observer.onNext({static_cast<const cetl::byte*>(frag->view.data), frag_size});  // NOSONAR cpp:S5356
+                    remaining -= frag_size;
+                }
+            }
+            return true;
+        }
+
     private:
         // MARK: Data members:
 
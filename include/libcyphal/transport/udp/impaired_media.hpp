@@ -0,0 +1,252 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_IMPAIRED_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_IMPAIRED_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/config.hpp"
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/impairment.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines UDP media decorator which applies network impairments to datagrams received by the inner media.
+///
+/// Every RX socket made by the decorator wraps the corresponding inner RX socket, and applies drop, delay
+/// (fixed and jittered), reorder and duplication models to its datagrams. Each RX socket has its own
+/// pseudo-random sequence (derived from the seed and the order of the socket creation), while counters
+/// are shared by all sockets of the media. TX sockets are made by the inner media as is.
+///
+/// If impairments are disabled, the decorator returns inner RX sockets directly (without any wrapping).
+/// The decorator must outlive the transport which uses it, and the inner media must outlive the decorator.
+///
+class ImpairedMedia final : public IMedia
+{
+public:
+    ImpairedMedia(cetl::pmr::memory_resource& memory,
+                  IExecutor&                  executor,
+                  IMedia&                     inner,
+                  const Impairments&          impairments)
+        : memory_{memory}
+        , executor_{executor}
+        , inner_{inner}
+        , impairments_{impairments}
+        , rx_sockets_count_{0}
+    {
+    }
+
+    ~ImpairedMedia()                                   = default;
+    ImpairedMedia(const ImpairedMedia&)                = delete;
+    ImpairedMedia(ImpairedMedia&&) noexcept            = delete;
+    ImpairedMedia& operator=(const ImpairedMedia&)     = delete;
+    ImpairedMedia& operator=(ImpairedMedia&&) noexcept = delete;
+
+    /// @brief Gets counters of what impairments have been applied so far (by all RX sockets of the media).
+    ///
+    CETL_NODISCARD const ImpairmentCounters& getCounters() const noexcept
+    {
+        return counters_;
+    }
+
+    // MARK: IMedia
+
+    MakeTxSocketResult::Type makeTxSocket() override
+    {
+        return inner_.makeTxSocket();
+    }
+
+    MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) override
+    {
+        auto inner_result = inner_.makeRxSocket(multicast_endpoint);
+        if (!impairments_.isEnabled())
+        {
+            return inner_result;
+        }
+        auto* const inner_socket = cetl::get_if<MakeRxSocketResult::Success>(&inner_result);
+        if (inner_socket == nullptr)
+        {
+            return inner_result;
+        }
+
+        Impairments socket_impairments{impairments_};
+        socket_impairments.seed += rx_sockets_count_++;
+
+        auto rx_socket = makeUniquePtr<IRxSocket, RxSocket>(memory_,
+                                                            executor_,
+                                                            std::move(*inner_socket),
+                                                            socket_impairments,
+                                                            counters_);
+        if (rx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return rx_socket;
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return inner_.getTxMemoryResource();
+    }
+
+private:
+    using Datagram = IRxSocket::ReceiveResult::Metadata;
+
+    /// Implements RX socket decorator which keeps received datagrams in the impairment queue.
+    ///
+    class RxSocket final : public IRxSocket
+    {
+    public:
+        RxSocket(IExecutor&             executor,
+                 UniquePtr<IRxSocket>&& inner,
+                 const Impairments&     impairments,
+                 ImpairmentCounters&    counters)
+            : executor_{executor}
+            , inner_{std::move(inner)}
+            , queue_{impairments, counters}
+            , callback_{executor}
+        {
+        }
+
+        ~RxSocket()                              = default;
+        RxSocket(const RxSocket&)                = delete;
+        RxSocket(RxSocket&&) noexcept            = delete;
+        RxSocket& operator=(const RxSocket&)     = delete;
+        RxSocket& operator=(RxSocket&&) noexcept = delete;
+
+        // MARK: IRxSocket
+
+        CETL_NODISCARD ReceiveResult::Type receive() override
+        {
+            if (pending_failure_.has_value())
+            {
+                ReceiveResult::Failure failure = std::move(*pending_failure_);
+                pending_failure_.reset();
+                return failure;
+            }
+
+            const auto now      = executor_.now();
+            auto       datagram = queue_.popDue(now);
+            scheduleDueDatagrams(now);
+            if (!datagram.has_value())
+            {
+                return cetl::nullopt;
+            }
+            return std::move(*datagram);
+        }
+
+        CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+        {
+            auto inner_registration = inner_->registerCallback([this](const auto&) {
+                //
+                receiveInnerDatagrams();
+            });
+            return callback_.registerCallback(std::move(function), std::move(inner_registration));
+        }
+
+    private:
+        static constexpr std::size_t MaxDelayedDatagrams =
+            config::Transport::Udp::ImpairedMedia_MaxDelayedDatagrams();
+
+        /// Makes a copy of the datagram (for duplication) - using the same memory resource as the original.
+        ///
+        static cetl::optional<Datagram> copyDatagram(const Datagram& original)
+        {
+            const auto&       deleter = original.payload_ptr.get_deleter();
+            const std::size_t size    = deleter.size();
+            if ((deleter.resource() == nullptr) || (original.payload_ptr == nullptr))
+            {
+                return cetl::nullopt;
+            }
+
+            auto* const buffer = static_cast<cetl::byte*>(deleter.resource()->allocate(size));
+            if (buffer == nullptr)
+            {
+                return cetl::nullopt;
+            }
+            (void) std::memmove(buffer, original.payload_ptr.get(), size);
+            return Datagram{original.timestamp, {buffer, deleter}};
+        }
+
+        /// Moves all datagrams which are currently available at the inner socket into the impairment queue.
+        ///
+        void receiveInnerDatagrams()
+        {
+            const auto now = executor_.now();
+            while (!pending_failure_.has_value())
+            {
+                auto result = inner_->receive();
+                if (auto* const failure = cetl::get_if<ReceiveResult::Failure>(&result))
+                {
+                    // Failure will be reported to the transport on its next receive attempt.
+                    pending_failure_.emplace(std::move(*failure));
+                    callback_.scheduleAt(now);
+                    return;
+                }
+
+                auto& success = cetl::get<ReceiveResult::Success>(result);
+                if (!success.has_value())
+                {
+                    break;
+                }
+                queue_.admit(std::move(*success), now, copyDatagram);
+            }
+            scheduleDueDatagrams(now);
+        }
+
+        /// Schedules the transport's callback at the time when the next delayed datagram becomes due.
+        ///
+        void scheduleDueDatagrams(const TimePoint now)
+        {
+            if (const auto due_time = queue_.getNextDueTime())
+            {
+                callback_.scheduleAt(std::max(*due_time, now));
+            }
+        }
+
+        // MARK: Data members:
+
+        IExecutor&                                                        executor_;
+        UniquePtr<IRxSocket>                                              inner_;
+        transport::detail::ImpairmentQueue<Datagram, MaxDelayedDatagrams> queue_;
+        transport::detail::ImpairmentCallback                             callback_;
+        cetl::optional<ReceiveResult::Failure>                            pending_failure_;
+
+    };  // RxSocket
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource& memory_;
+    IExecutor&                  executor_;
+    IMedia&                     inner_;
+    const Impairments           impairments_;
+    std::uint64_t               rx_sockets_count_;
+    ImpairmentCounters          counters_;
+
+};  // ImpairedMedia
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_IMPAIRED_MEDIA_HPP_INCLUDED
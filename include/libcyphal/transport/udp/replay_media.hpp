@@ -0,0 +1,272 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_UDP_REPLAY_MEDIA_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_UDP_REPLAY_MEDIA_HPP_INCLUDED
+
+#include "media.hpp"
+#include "tx_rx_sockets.hpp"
+
+#include "libcyphal/executor.hpp"
+#include "libcyphal/transport/errors.hpp"
+#include "libcyphal/transport/impairment.hpp"
+#include "libcyphal/transport/pcapng.hpp"
+#include "libcyphal/transport/types.hpp"
+#include "libcyphal/types.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace udp
+{
+
+/// @brief Defines UDP media which feeds datagrams of a pcapng capture back into a transport.
+///
+/// Every RX socket delivers inbound (and direction-less) UDP/IPv4 datagrams of the capture which are addressed
+/// to its multicast endpoint - either at their recorded time (relative to the very first datagram of the capture,
+/// and starting from the moment the very first RX socket is made), or as fast as the transport consumes them.
+/// The latter is handy as a benchmark of the RX path on real traffic. Raw IPv4, Ethernet and Linux "cooked"
+/// captures are supported; outbound datagrams (f.e. made by `CaptureMedia`) are skipped.
+///
+/// Payload of every delivered datagram is copied to a buffer allocated from the media memory resource
+/// (the same way as real sockets do). TX sockets accept and discard all datagrams.
+///
+/// The capture memory must outlive the media, and sockets made by the media must not outlive it.
+///
+class ReplayMedia final : public IMedia
+{
+public:
+    ReplayMedia(cetl::pmr::memory_resource&        memory,
+                IExecutor&                         executor,
+                const cetl::span<const cetl::byte> capture,
+                const pcapng::ReplayMode           mode)
+        : memory_{memory}
+        , executor_{executor}
+        , capture_{capture}
+        , timeline_{mode}
+        , datagrams_count_{0}
+    {
+    }
+
+    ~ReplayMedia()                                 = default;
+    ReplayMedia(const ReplayMedia&)                = delete;
+    ReplayMedia(ReplayMedia&&) noexcept            = delete;
+    ReplayMedia& operator=(const ReplayMedia&)     = delete;
+    ReplayMedia& operator=(ReplayMedia&&) noexcept = delete;
+
+    /// @brief Gets total number of datagrams delivered so far (by all RX sockets of the media).
+    ///
+    CETL_NODISCARD std::uint64_t getDatagramsCount() const noexcept
+    {
+        return datagrams_count_;
+    }
+
+    // MARK: IMedia
+
+    MakeTxSocketResult::Type makeTxSocket() override
+    {
+        auto tx_socket = makeUniquePtr<ITxSocket, TxSocket>(memory_, executor_);
+        if (tx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return tx_socket;
+    }
+
+    MakeRxSocketResult::Type makeRxSocket(const IpEndpoint& multicast_endpoint) override
+    {
+        auto rx_socket = makeUniquePtr<IRxSocket, RxSocket>(memory_, *this, multicast_endpoint);
+        if (rx_socket == nullptr)
+        {
+            return MemoryError{};
+        }
+        return rx_socket;
+    }
+
+    cetl::pmr::memory_resource& getTxMemoryResource() override
+    {
+        return memory_;
+    }
+
+private:
+    struct Datagram
+    {
+        std::chrono::nanoseconds     timestamp;
+        cetl::span<const cetl::byte> payload;
+    };
+
+    /// Reads the next inbound datagram of the capture which is addressed to the given endpoint
+    /// (or any endpoint if there is no one).
+    ///
+    static cetl::optional<Datagram> readNextDatagram(pcapng::Reader& reader, const IpEndpoint* const endpoint)
+    {
+        while (const auto packet = reader.next())
+        {
+            if (packet->direction == pcapng::Direction::Outbound)
+            {
+                continue;
+            }
+            const auto datagram = pcapng::Ipv4Udp::parse(packet->link_type, packet->data);
+            if (datagram.has_value() &&
+                ((endpoint == nullptr) ||
+                 ((datagram->ip_address == endpoint->ip_address) && (datagram->udp_port == endpoint->udp_port))))
+            {
+                return Datagram{packet->timestamp, datagram->payload};
+            }
+        }
+        return cetl::nullopt;
+    }
+
+    /// Starts the timeline (unless already started) at the recorded time of the very first datagram.
+    ///
+    void startTimeline()
+    {
+        pcapng::Reader reader{capture_};
+        if (const auto first_datagram = readNextDatagram(reader, nullptr))
+        {
+            timeline_.start(executor_.now(), first_datagram->timestamp);
+        }
+    }
+
+    class TxSocket final : public ITxSocket
+    {
+    public:
+        explicit TxSocket(IExecutor& executor)
+            : executor_{executor}
+        {
+        }
+
+        ~TxSocket()                              = default;
+        TxSocket(const TxSocket&)                = delete;
+        TxSocket(TxSocket&&) noexcept            = delete;
+        TxSocket& operator=(const TxSocket&)     = delete;
+        TxSocket& operator=(TxSocket&&) noexcept = delete;
+
+        // MARK: ITxSocket
+
+        SendResult::Type send(const TimePoint, const IpEndpoint, const std::uint8_t, const PayloadFragments) override
+        {
+            return SendResult::Success{true};
+        }
+
+        CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+        {
+            // Datagrams are always accepted, so there is no need to ever notify the transport.
+            return executor_.registerCallback(std::move(function));
+        }
+
+    private:
+        // MARK: Data members:
+
+        IExecutor& executor_;
+
+    };  // TxSocket
+
+    class RxSocket final : public IRxSocket
+    {
+    public:
+        RxSocket(ReplayMedia& media, const IpEndpoint& multicast_endpoint)
+            : media_{media}
+            , multicast_endpoint_{multicast_endpoint}
+            , reader_{media.capture_}
+            , callback_{media.executor_}
+            , next_datagram_{readNextDatagram(reader_, &multicast_endpoint_)}
+        {
+            media.startTimeline();
+        }
+
+        ~RxSocket()                              = default;
+        RxSocket(const RxSocket&)                = delete;
+        RxSocket(RxSocket&&) noexcept            = delete;
+        RxSocket& operator=(const RxSocket&)     = delete;
+        RxSocket& operator=(RxSocket&&) noexcept = delete;
+
+        // MARK: IRxSocket
+
+        CETL_NODISCARD ReceiveResult::Type receive() override
+        {
+            if (!next_datagram_.has_value())
+            {
+                return cetl::nullopt;
+            }
+
+            const auto now      = media_.executor_.now();
+            const auto due_time = media_.timeline_.getDueTime(next_datagram_->timestamp, now);
+            if (due_time > now)
+            {
+                callback_.scheduleAt(due_time);
+                return cetl::nullopt;
+            }
+
+            // The datagram is consumed even if there is no memory for it (like real sockets drop datagrams).
+            const auto datagram = *next_datagram_;
+            next_datagram_      = readNextDatagram(reader_, &multicast_endpoint_);
+            scheduleNextDatagram(now);
+
+            const std::size_t payload_size = datagram.payload.size();
+            auto* const       buffer       = static_cast<cetl::byte*>(media_.memory_.allocate(payload_size));
+            if (buffer == nullptr)
+            {
+                return MemoryError{};
+            }
+            (void) std::memmove(buffer, datagram.payload.data(), payload_size);
+
+            ++media_.datagrams_count_;
+            return ReceiveResult::Metadata{due_time, {buffer, PmrRawBytesDeleter{payload_size, &media_.memory_}}};
+        }
+
+        CETL_NODISCARD IExecutor::Callback::Any registerCallback(IExecutor::Callback::Function&& function) override
+        {
+            auto callback = callback_.registerCallback(std::move(function), IExecutor::Callback::Any{});
+            scheduleNextDatagram(media_.executor_.now());
+            return callback;
+        }
+
+    private:
+        void scheduleNextDatagram(const TimePoint now)
+        {
+            if (next_datagram_.has_value())
+            {
+                callback_.scheduleAt(std::max(media_.timeline_.getDueTime(next_datagram_->timestamp, now), now));
+            }
+        }
+
+        // MARK: Data members:
+
+        ReplayMedia&                          media_;
+        const IpEndpoint                      multicast_endpoint_;
+        pcapng::Reader                        reader_;
+        transport::detail::ImpairmentCallback callback_;
+        cetl::optional<Datagram>              next_datagram_;
+
+    };  // RxSocket
+
+    // MARK: Data members:
+
+    cetl::pmr::memory_resource&    memory_;
+    IExecutor&                     executor_;
+    cetl::span<const cetl::byte>   capture_;
+    pcapng::detail::ReplayTimeline timeline_;
+    std::uint64_t                  datagrams_count_;
+
+};  // ReplayMedia
+
+}  // namespace udp
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_UDP_REPLAY_MEDIA_HPP_INCLUDED
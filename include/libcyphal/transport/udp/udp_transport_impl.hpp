@@ -21,6 +21,7 @@
 #include "libcyphal/transport/errors.hpp"
 #include "libcyphal/transport/lizard_helpers.hpp"
 #include "libcyphal/transport/msg_sessions.hpp"
+#include "libcyphal/transport/statistics.hpp"
 #include "libcyphal/transport/svc_sessions.hpp"
 #include "libcyphal/transport/types.hpp"
 #include "libcyphal/types.hpp"
@@ -65,7 +66,7 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
         explicit Spec() = default;
     };
 
-    /// @brief Defines private storage of a media index, its interface, TX queue and socket.
+    /// @brief Defines private storage of a media index, its interface, TX queue, sockets and statistics counters.
     ///
     struct Media final
     {
@@ -115,6 +116,13 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
             return tx_socket_state_.interface ? tx_socket_state_.interface->getMtu() : ITxSocket::DefaultMtu;
         }
 
+        /// Counters are not part of the logical state of the media, so they are mutable.
+        ///
+        transport::detail::IoCounters& counters() const noexcept
+        {
+            return counters_;
+        }
+
     private:
         CETL_NODISCARD static UdpardMemoryResource makeTxMemoryResource(IMedia& media_interface)
         {
@@ -128,11 +136,12 @@ class TransportImpl final : private TransportDelegate, public IUdpTransport
                 media_interface.getTxMemoryResource());
         }
 
-        const std::uint8_t     index_;
-        IMedia&                interface_;
-        UdpardTx               udpard_tx_;
-        SocketState<ITxSocket> tx_socket_state_;
-        SocketState<IRxSocket> svc_rx_socket_state_;
+        const std::uint8_t                    index_;
+        IMedia&                               interface_;
+        UdpardTx                              udpard_tx_;
+        SocketState<ITxSocket>                tx_socket_state_;
+        SocketState<IRxSocket>                svc_rx_socket_state_;
+        mutable transport::detail::IoCounters counters_;
 
     };  // Media
     using MediaArray = libcyphal::detail::VarArray<Media>;
@@ -272,6 +281,22 @@ private:
         return ProtocolParams{std::numeric_limits<TransferId>::max(), min_mtu, UDPARD_NODE_ID_MAX + 1};
     }
 
+    CETL_NODISCARD IoStatistics getTransferStatistics() const noexcept override
+    {
+        return transfer_counters_.snapshot();
+    }
+
+    CETL_NODISCARD cetl::optional<IoStatistics> getMediaStatistics(
+        const std::uint8_t media_index) const noexcept override
+    {
+        if (media_index >= media_array_.size())
+        {
+            return cetl::nullopt;
+        }
+
+        return media_array_[media_index].counters().snapshot();
+    }
+
     CETL_NODISCARD Expected<UniquePtr<IMessageRxSession>, AnyFailure> makeMessageRxSession(
         const MessageRxParams& params) override
     {
@@ -348,6 +373,7 @@ private:
         const ContiguousPayload payload{memoryResources().general, payload_fragments};
         if ((payload.data() == nullptr) && (payload.size() > 0))
         {
+            transfer_counters_.onFailure(MemoryError{});
             return MemoryError{};
         }
 
@@ -377,10 +403,12 @@ private:
             {
                 // The handler (if any) just said that it's NOT fine to continue with transferring to
                 // other media TX queues, and the error should not be ignored but propagated outside.
+                transfer_counters_.onFailure(*failure);
                 return failure;
             }
         }
 
+        transfer_counters_.onEmitted();
         return cetl::nullopt;
     }
 
@@ -566,6 +594,7 @@ private:
                                                             Culprit&&      culprit)
     {
         auto failure = libcyphal::detail::upcastVariant<AnyFailure>(std::forward<ErrorVariant>(error_var));
+        media.counters().onFailure(failure);
         if (!transient_error_handler_)
         {
             return failure;
@@ -583,6 +612,10 @@ private:
                                                                              Culprit&&          culprit) const
     {
         cetl::optional<AnyFailure> failure = optAnyFailureFromUdpard(result);
+        if (failure.has_value())
+        {
+            media.counters().onFailure(*failure);
+        }
         if (failure.has_value() && transient_error_handler_)
         {
             TransientErrorReport::Variant report_var{
@@ -708,6 +741,7 @@ private:
                 const auto sent = cetl::get<ITxSocket::SendResult::Success>(send_result);
                 if (sent.is_accepted)
                 {
+                    media.counters().onEmitted();
                     popAndFreeUdpardTxItem(&media.udpard_tx(), tx_item, false /* single frame */);
                 }
 
@@ -869,7 +903,12 @@ private:
             (void) tryHandleTransientMediaError<RxSocketReport>(media, std::move(*failure), rx_socket);
             return cetl::nullopt;
         }
-        return cetl::get<IRxSocket::ReceiveResult::Success>(std::move(receive_result));
+        auto rx_success = cetl::get<IRxSocket::ReceiveResult::Success>(std::move(receive_result));
+        if (rx_success)
+        {
+            media.counters().onReceived();
+        }
+        return rx_success;
     }
 
     void receiveNextServiceFrame(const Media& media, SocketState<IRxSocket>& socket_state)
@@ -913,6 +952,8 @@ private:
         // 3. We might have result RX transfer (built from fragments by libudpard).
         //    If so, we need to pass it to the session delegate for storing.
         //
+        countRxTransferResult(result);
+
         using DispatcherReport = TransientErrorReport::UdpardRxSvcReceive;
         const auto failure = tryHandleTransientUdpardResult<DispatcherReport>(media, result, getUdpardRpcDispatcher());
         if ((!failure.has_value()) && (result > 0))
@@ -969,6 +1010,8 @@ private:
         // 3. We might have result RX transfer (built from fragments by libudpard).
         //    If so, we need to pass it to the session delegate for storing.
         //
+        countRxTransferResult(result);
+
         using SubscriptionReport = TransientErrorReport::UdpardRxMsgReceive;
         const auto failure       = tryHandleTransientUdpardResult<SubscriptionReport>(media, result, subscription);
         if ((!failure.has_value()) && (result > 0))
@@ -977,6 +1020,22 @@ private:
         }
     }
 
+    /// @brief Counts result of libudpard RX reception at the transfer level.
+    ///
+    /// Positive result means that a new transfer has been fully received.
+    ///
+    void countRxTransferResult(const std::int8_t result)
+    {
+        if (result > 0)
+        {
+            transfer_counters_.onReceived();
+        }
+        else if (const auto failure = optAnyFailureFromUdpard(result))
+        {
+            transfer_counters_.onFailure(*failure);
+        }
+    }
+
     void cancelRxCallbacksIfNoSvcLeft()
     {
         if (svc_request_rx_session_nodes_.isEmpty() && svc_response_rx_session_nodes_.isEmpty())
@@ -997,6 +1056,7 @@ private:
     SessionTree<RxSessionTreeNode::Request>  svc_request_rx_session_nodes_;
     SessionTree<RxSessionTreeNode::Response> svc_response_rx_session_nodes_;
     cetl::optional<IpEndpoint>               svc_rx_sockets_endpoint_;
+    transport::detail::IoCounters            transfer_counters_;
 
 };  // TransportImpl
 
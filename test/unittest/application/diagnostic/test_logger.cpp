@@ -0,0 +1,297 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/diagnostic/logger.hpp>
+#include <libcyphal/application/diagnostic/record_ring.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/diagnostic/Record_1_1.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Ge;
+using testing::Le;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestLogger : public testing::Test
+{
+protected:
+    using Logger             = diagnostic::Logger;
+    using Message            = Logger::Message;
+    using Severity           = diagnostic::Severity;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+        EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+            .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectMessageTxSession(StrictMock<MessageTxSessionMock>& msg_tx_session_mock)
+    {
+        const MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+            }));
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+    }
+
+    /// Collects all published records as "<severity>:<text>" strings.
+    ///
+    void expectRecords(StrictMock<MessageTxSessionMock>& msg_tx_session_mock, std::vector<std::string>& records)
+    {
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillRepeatedly(Invoke([&](const auto& metadata, const auto payload_fragments) {
+                //
+                EXPECT_THAT(metadata.deadline, now() + 1s);
+                const auto message = deserializeMessage(payload_fragments);
+                records.emplace_back(std::to_string(message.severity.value) + ":" +
+                                     std::string{message.text.cbegin(), message.text.cend()});
+                return cetl::nullopt;
+            }));
+    }
+
+    Message deserializeMessage(const PayloadFragments payload_fragments)
+    {
+        std::vector<std::uint8_t> buffer;
+        for (const auto fragment : payload_fragments)
+        {
+            const auto* const data = reinterpret_cast<const std::uint8_t*>(fragment.data());  // NOLINT
+            buffer.insert(buffer.end(), data, data + fragment.size());
+        }
+
+        Message message{Message::allocator_type{&mr_}};
+        EXPECT_TRUE(deserialize(message, {buffer.data(), buffer.size()}));
+        return message;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<TransportMock>       transport_mock_;
+    diagnostic::RecordRing          ring_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestLogger, make)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock);
+
+    std::vector<std::string> records;
+    expectRecords(msg_tx_session_mock, records);
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_logger = Logger::make(presentation, ring_);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_TRUE(ring_.push(Severity::Info, "hello"));
+        EXPECT_TRUE(ring_.push(Severity::Alert, "world"));
+    });
+    scheduler_.scheduleAt(2s + 10ms, [&](const auto&) {
+        //
+        EXPECT_THAT(records, ElementsAre("2:hello", "7:world"));
+        records.clear();
+
+        // Move the logger - the moved-to instance should continue draining.
+        Logger moved{std::move(*logger)};
+        logger.reset();
+        logger.emplace(std::move(moved));
+
+        EXPECT_TRUE(ring_.push(Severity::Debug, "moved"));
+    });
+    scheduler_.scheduleAt(2s + 30ms, [&](const auto&) {
+        //
+        EXPECT_THAT(records, ElementsAre("1:moved"));
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(logger.has_value(), false);
+}
+
+TEST_F(TestLogger, burst_is_suppressed)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock);
+
+    std::vector<std::string> records;
+    expectRecords(msg_tx_session_mock, records);
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_logger = Logger::make(presentation, ring_);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+        logger->setDrainPeriod(100ms).setRateLimit(Severity::Warning, {2, 3});
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Only the burst of 3 warnings is published, but the notice is limited by its own (default) bucket.
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            EXPECT_TRUE(ring_.push(Severity::Warning, "w" + std::to_string(i)));
+        }
+        EXPECT_TRUE(ring_.push(Severity::Notice, "n"));
+    });
+    scheduler_.scheduleAt(2s + 100ms, [&](const auto&) {
+        //
+        EXPECT_THAT(records, ElementsAre("4:w0", "4:w1", "4:w2", "3:n"));
+        EXPECT_THAT(logger->getSuppressedCount(), 2);
+        records.clear();
+
+        // 100ms later the bucket doesn't have enough credit (500ms per record) yet.
+        EXPECT_TRUE(ring_.push(Severity::Warning, "w5"));
+    });
+    scheduler_.scheduleAt(2s + 200ms, [&](const auto&) {
+        //
+        EXPECT_THAT(records, IsEmpty());
+        EXPECT_THAT(logger->getSuppressedCount(), 3);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Credit is accumulated now, so the summary is published first - before the record itself.
+        EXPECT_TRUE(ring_.push(Severity::Warning, "w6"));
+    });
+    scheduler_.scheduleAt(3s + 100ms, [&](const auto&) {
+        //
+        EXPECT_THAT(records, ElementsAre("4:3 records suppressed", "4:w6"));
+        EXPECT_THAT(logger->getSuppressedCount(), 3);
+        records.clear();
+
+        // Zero rate suppresses everything.
+        logger->setRateLimit(Severity::Warning, {0, 10});
+        EXPECT_TRUE(ring_.push(Severity::Warning, "w7"));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(records, IsEmpty());
+        EXPECT_THAT(logger->getSuppressedCount(), 4);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestLogger, logging_at_1kHz)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock);
+
+    std::vector<std::string> records;
+    expectRecords(msg_tx_session_mock, records);
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<Logger> logger;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_logger = Logger::make(presentation, ring_);
+        ASSERT_THAT(maybe_logger, VariantWith<Logger>(_));
+        logger.emplace(cetl::get<Logger>(std::move(maybe_logger)));
+        logger->setRateLimit(Severity::Info, {100, 10});
+    });
+    // A tight loop logs a record each millisecond for 2 seconds.
+    for (std::size_t i = 1; i <= 2000; ++i)
+    {
+        scheduler_.scheduleAt(1s + std::chrono::milliseconds(i), [&](const auto&) {
+            //
+            EXPECT_TRUE(ring_.push(Severity::Info, "tick"));
+        });
+    }
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Only ~100 records per second (plus the initial burst) should be published, the rest are suppressed
+        // (and reported by the summary records). Nothing is dropped by the ring.
+        const auto ticks = static_cast<std::size_t>(std::count(records.cbegin(), records.cend(), "2:tick"));
+        EXPECT_THAT(ticks, Ge(200));
+        EXPECT_THAT(ticks, Le(211));
+        EXPECT_THAT(ticks + logger->getSuppressedCount(), 2000);
+        EXPECT_THAT(ring_.getDroppedCount(), 0);
+        logger.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,157 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/diagnostic/record_ring.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::application::diagnostic;  // NOLINT This our main concern here in the unit tests.
+
+using testing::ElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestRecordRing : public testing::Test
+{
+protected:
+    static std::vector<std::string> dumpTexts(RecordRing& ring)
+    {
+        std::vector<std::string> texts;
+        (void) ring.dump([&texts](const auto& record) {
+            //
+            const auto text = record.getText();
+            texts.emplace_back(text.data(), text.size());
+        });
+        return texts;
+    }
+};
+
+// MARK: - Tests:
+
+TEST_F(TestRecordRing, push_pop)
+{
+    RecordRing ring;
+
+    RecordRing::Record record;
+    EXPECT_FALSE(ring.pop(record));
+
+    EXPECT_TRUE(ring.push(Severity::Info, "first"));
+    EXPECT_TRUE(ring.push(Severity::Error, "second"));
+
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_THAT(record.severity, Severity::Info);
+    EXPECT_THAT(record.getText(), "first");
+
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_THAT(record.severity, Severity::Error);
+    EXPECT_THAT(record.getText(), "second");
+
+    EXPECT_FALSE(ring.pop(record));
+    EXPECT_THAT(ring.getDroppedCount(), 0);
+}
+
+TEST_F(TestRecordRing, truncation)
+{
+    RecordRing ring;
+
+    const std::string long_text(RecordRing::TextCapacity + 10, 'x');
+    EXPECT_TRUE(ring.push(Severity::Debug, long_text));
+    EXPECT_TRUE(ring.push(Severity::Debug, ""));
+
+    EXPECT_THAT(dumpTexts(ring), ElementsAre(std::string(RecordRing::TextCapacity, 'x'), ""));
+}
+
+TEST_F(TestRecordRing, full_ring_drops_new_records)
+{
+    RecordRing ring;
+
+    for (std::size_t i = 0; i < RecordRing::Capacity; ++i)
+    {
+        EXPECT_TRUE(ring.push(Severity::Trace, std::to_string(i)));
+    }
+    EXPECT_FALSE(ring.push(Severity::Trace, "dropped1"));
+    EXPECT_FALSE(ring.push(Severity::Trace, "dropped2"));
+    EXPECT_THAT(ring.getDroppedCount(), 2);
+
+    // The oldest records are kept, and the ring is usable again after draining (several laps).
+    for (std::size_t lap = 0; lap < 3; ++lap)
+    {
+        const auto texts = dumpTexts(ring);
+        ASSERT_THAT(texts.size(), RecordRing::Capacity);
+        EXPECT_THAT(texts.front(), (lap == 0) ? "0" : "lap");
+        for (std::size_t i = 0; i < RecordRing::Capacity; ++i)
+        {
+            EXPECT_TRUE(ring.push(Severity::Trace, "lap"));
+        }
+    }
+    EXPECT_THAT(ring.getDroppedCount(), 2);
+}
+
+TEST_F(TestRecordRing, concurrent_producers)
+{
+    constexpr std::size_t Producers          = 4;
+    constexpr std::size_t RecordsPerProducer = 5000;
+
+    RecordRing ring;
+
+    std::array<std::size_t, Producers> pushed{};
+    std::vector<std::thread>           threads;
+    for (std::size_t producer = 0; producer < Producers; ++producer)
+    {
+        threads.emplace_back([&ring, &pushed, producer] {
+            //
+            const std::string text(1, static_cast<char>('A' + producer));
+            for (std::size_t i = 0; i < RecordsPerProducer; ++i)
+            {
+                pushed[producer] += ring.push(Severity::Info, text) ? 1 : 0;
+            }
+        });
+    }
+
+    // Consume concurrently with the producers.
+    std::array<std::size_t, Producers> popped{};
+    std::size_t                        total_popped = 0;
+
+    const auto consume = [&] {
+        //
+        RecordRing::Record record;
+        while (ring.pop(record))
+        {
+            ASSERT_THAT(record.text_size, 1);
+            const auto producer = static_cast<std::size_t>(record.text[0] - 'A');
+            ASSERT_THAT(producer, testing::Lt(Producers));
+            ++popped[producer];
+            ++total_popped;
+        }
+    };
+    while (total_popped + ring.getDroppedCount() < Producers * RecordsPerProducer)
+    {
+        consume();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    consume();
+
+    EXPECT_THAT(popped, pushed);
+    EXPECT_THAT(total_popped + ring.getDroppedCount(), Producers * RecordsPerProducer);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,343 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/port_list_producer.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/node/port/List_0_1.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPortListProducer : public testing::Test
+{
+protected:
+    using Message            = node::PortListProducer::Message;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectMessageTxSession(StrictMock<MessageTxSessionMock>& msg_tx_session_mock, const PortId subject_id)
+    {
+        const MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                           //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+            }));
+    }
+
+    Message deserializeMessage(const PayloadFragments payload_fragments)
+    {
+        std::vector<std::uint8_t> buffer;
+        for (const auto fragment : payload_fragments)
+        {
+            const auto* const data = reinterpret_cast<const std::uint8_t*>(fragment.data());  // NOLINT
+            buffer.insert(buffer.end(), data, data + fragment.size());
+        }
+
+        Message message{Message::allocator_type{&mr_}};
+        EXPECT_TRUE(deserialize(message, {buffer.data(), buffer.size()}));
+        return message;
+    }
+
+    static std::vector<std::uint16_t> getSubjectIds(const uavcan::node::port::SubjectIDList_0_1& subject_id_list)
+    {
+        std::vector<std::uint16_t> subject_ids;
+        if (const auto* const sparse_list = subject_id_list.get_sparse_list_if())
+        {
+            for (const auto& subject_id : *sparse_list)
+            {
+                subject_ids.push_back(subject_id.value);
+            }
+        }
+        if (const auto* const mask = subject_id_list.get_mask_if())
+        {
+            for (std::uint16_t subject_id = 0; subject_id < mask->size(); ++subject_id)
+            {
+                if ((*mask)[subject_id])
+                {
+                    subject_ids.push_back(subject_id);
+                }
+            }
+        }
+        return subject_ids;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<TransportMock>       transport_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestPortListProducer, make)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock, Message::_traits_::FixedPortId);
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::nullopt));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    cetl::optional<node::PortListProducer> port_list_producer;
+    cetl::optional<Publisher<void>>        publisher;
+    std::size_t                            allocated_bytes = 0;
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock2;
+    expectMessageTxSession(msg_tx_session_mock2, 123);
+    EXPECT_CALL(msg_tx_session_mock2, deinit()).Times(1);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_port_list_producer = node::PortListProducer::make(presentation);
+        ASSERT_THAT(maybe_port_list_producer, VariantWith<node::PortListProducer>(_));
+        port_list_producer.emplace(cetl::get<node::PortListProducer>(std::move(maybe_port_list_producer)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+            .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+    });
+    scheduler_.scheduleAt(11s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock,
+                    send(TransferTxMetadataEq({{1, Priority::Optional}, now() + 10s}), _))  //
+            .WillOnce(Invoke([&](const auto&, const auto payload_fragments) {
+                //
+                const auto message = deserializeMessage(payload_fragments);
+                EXPECT_THAT(getSubjectIds(message.publishers), ElementsAre(Message::_traits_::FixedPortId));
+                EXPECT_THAT(getSubjectIds(message.subscribers), IsEmpty());
+                EXPECT_THAT(message.servers.mask.count(), 0);
+                EXPECT_THAT(message.clients.mask.count(), 0);
+                return cetl::nullopt;
+            }));
+    });
+    scheduler_.scheduleAt(11s + 1ms, [&](const auto&) {
+        //
+        allocated_bytes = mr_.total_allocated_bytes;
+    });
+    scheduler_.scheduleAt(21s, [&](const auto&) {
+        //
+        // Nothing has changed since the previous publication - so the cached payload is published as is.
+        EXPECT_CALL(msg_tx_session_mock, send(TransferTxMetadataEq({{2, Priority::Optional}, now() + 10s}), _))  //
+            .WillOnce(Return(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(21s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+
+        auto maybe_publisher = presentation.makePublisher<void>(123);
+        ASSERT_THAT(maybe_publisher, VariantWith<Publisher<void>>(_));
+        publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_publisher)));
+    });
+    scheduler_.scheduleAt(31s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(TransferTxMetadataEq({{3, Priority::Optional}, now() + 10s}), _))  //
+            .WillOnce(Invoke([&](const auto&, const auto payload_fragments) {
+                //
+                const auto message = deserializeMessage(payload_fragments);
+                EXPECT_THAT(getSubjectIds(message.publishers), ElementsAre(123, Message::_traits_::FixedPortId));
+                return cetl::nullopt;
+            }));
+    });
+    scheduler_.scheduleAt(31s + 1ms, [&](const auto&) {
+        //
+        publisher.reset();
+        port_list_producer.reset();
+    });
+    scheduler_.spinFor(40s);
+}
+
+TEST_F(TestPortListProducer, many_subjects)
+{
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock, Message::_traits_::FixedPortId);
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    // The sparse list can't hold that many subject ids - so the bit mask is expected to be published.
+    constexpr std::size_t             SubscribersCount = 300;
+    std::vector<MessageRxSessionMock> msg_rx_session_mocks(SubscribersCount);
+    std::vector<Subscriber<void>>     subscribers;
+    subscribers.reserve(SubscribersCount);
+
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(_))  //
+        .WillRepeatedly(Invoke([&](const MessageRxParams& params) {
+            //
+            auto& msg_rx_session_mock = msg_rx_session_mocks[params.subject_id];
+            EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(params));
+            EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_)).Times(1);
+            EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+            return libcyphal::detail::makeUniquePtr<MessageRxSessionMock::RefWrapper::Spec>(mr_, msg_rx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+    for (PortId subject_id = 0; subject_id < SubscribersCount; ++subject_id)
+    {
+        auto maybe_subscriber = presentation.makeSubscriber(subject_id, 8);
+        ASSERT_THAT(maybe_subscriber, VariantWith<Subscriber<void>>(_));
+        subscribers.emplace_back(cetl::get<Subscriber<void>>(std::move(maybe_subscriber)));
+    }
+
+    cetl::optional<node::PortListProducer> port_list_producer;
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&](const auto&, const auto payload_fragments) {
+                //
+                const auto message = deserializeMessage(payload_fragments);
+                EXPECT_THAT(message.subscribers.get_mask_if(), NotNull());
+                EXPECT_THAT(getSubjectIds(message.subscribers).size(), SubscribersCount);
+                EXPECT_THAT(message.publishers.get_sparse_list_if(), NotNull());
+                return cetl::nullopt;
+            }));
+
+        auto maybe_port_list_producer = node::PortListProducer::make(presentation);
+        ASSERT_THAT(maybe_port_list_producer, VariantWith<node::PortListProducer>(_));
+        port_list_producer.emplace(cetl::get<node::PortListProducer>(std::move(maybe_port_list_producer)));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        port_list_producer.reset();
+        subscribers.clear();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestPortListProducer, make_failure)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Return(libcyphal::ArgumentError{}));
+
+    EXPECT_THAT(node::PortListProducer::make(presentation),
+                VariantWith<Presentation::MakeFailure>(VariantWith<libcyphal::ArgumentError>(_)));
+}
+
+TEST_F(TestPortListProducer, move)
+{
+    static_assert(std::is_move_constructible<node::PortListProducer>::value, "Should be move constructible.");
+    static_assert(!std::is_copy_assignable<node::PortListProducer>::value, "Should not be copy assignable.");
+    static_assert(!std::is_move_assignable<node::PortListProducer>::value, "Should not be move assignable.");
+    static_assert(!std::is_copy_constructible<node::PortListProducer>::value, "Should not be copy constructible.");
+    static_assert(!std::is_default_constructible<node::PortListProducer>::value,
+                  "Should not be default constructible.");
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    expectMessageTxSession(msg_tx_session_mock, Message::_traits_::FixedPortId);
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+
+    EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+        .WillRepeatedly(Return(cetl::optional<NodeId>{NodeId{42U}}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    std::vector<TimePoint> calls;
+    EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+        .Times(3)
+        .WillRepeatedly(Invoke([&](const auto&, const auto) {
+            //
+            calls.push_back(now());
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<node::PortListProducer> port_list_producer1;
+    cetl::optional<node::PortListProducer> port_list_producer2;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_port_list_producer = node::PortListProducer::make(presentation);
+        ASSERT_THAT(maybe_port_list_producer, VariantWith<node::PortListProducer>(_));
+        port_list_producer1.emplace(cetl::get<node::PortListProducer>(std::move(maybe_port_list_producer)));
+    });
+    scheduler_.scheduleAt(15s, [&](const auto&) {
+        //
+        port_list_producer2.emplace(std::move(*port_list_producer1));
+        port_list_producer1.reset();
+    });
+    scheduler_.scheduleAt(25s, [&](const auto&) {
+        //
+        port_list_producer2.reset();
+    });
+    scheduler_.spinFor(40s);
+
+    EXPECT_THAT(calls, ElementsAre(TimePoint{1s}, TimePoint{11s}, TimePoint{21s}));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,200 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/node/transport_statistics_provider.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/statistics.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <uavcan/node/GetTransportStatistics_0_1.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTransportStatisticsProvider : public testing::Test
+{
+protected:
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(ProtocolParams{std::numeric_limits<TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    static IoStatistics makeIoStatistics(const IoStatistics::Counter num_emitted,
+                                         const IoStatistics::Counter num_received,
+                                         const IoStatistics::Counter num_errored)
+    {
+        IoStatistics stats{};
+        stats.num_emitted  = num_emitted;
+        stats.num_received = num_received;
+        stats.num_errored  = num_errored;
+        return stats;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<TransportMock>       transport_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestTransportStatisticsProvider, make)
+{
+    using Service = uavcan::node::GetTransportStatistics_0_1;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr RequestRxParams rx_params{Service::Request::_traits_::ExtentBytes,
+                                        Service::Request::_traits_::FixedPortId};
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams tx_params{Service::Response::_traits_::FixedPortId};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    cetl::optional<node::TransportStatisticsProvider> provider;
+
+    ServiceRxTransfer request{{{{123, Priority::Fast}, {}}, NodeId{0x31}}, {}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_provider = node::TransportStatisticsProvider::make(presentation);
+        ASSERT_THAT(maybe_provider, VariantWith<node::TransportStatisticsProvider>(_));
+        provider.emplace(cetl::get<node::TransportStatisticsProvider>(std::move(maybe_provider)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_CALL(transport_mock_, getTransferStatistics()).WillOnce(Return(makeIoStatistics(1, 2, 3)));
+        EXPECT_CALL(transport_mock_, getMediaStatistics(0)).WillOnce(Return(makeIoStatistics(4, 5, 6)));
+        EXPECT_CALL(transport_mock_, getMediaStatistics(1)).WillOnce(Return(makeIoStatistics(7, 8, 9)));
+        EXPECT_CALL(transport_mock_, getMediaStatistics(2)).WillOnce(Return(cetl::nullopt));
+
+        EXPECT_CALL(res_tx_session_mock,
+                    send(ServiceTxMetadataEq({{{123, Priority::Fast}, now() + 1s}, NodeId{0x31}}), _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                Service::Response response{Service::Response::allocator_type{&mr_}};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response.transfer_statistics.num_emitted, 1);
+                EXPECT_THAT(response.transfer_statistics.num_received, 2);
+                EXPECT_THAT(response.transfer_statistics.num_errored, 3);
+                EXPECT_THAT(response.network_interface_statistics, SizeIs(2));
+                EXPECT_THAT(response.network_interface_statistics[0].num_emitted, 4);
+                EXPECT_THAT(response.network_interface_statistics[1].num_errored, 9);
+                return cetl::nullopt;
+            }));
+
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn({request});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Max 3 network interfaces are reported (see `MAX_NETWORK_INTERFACES`).
+        EXPECT_CALL(transport_mock_, getTransferStatistics()).WillOnce(Return(makeIoStatistics(0, 0, 0)));
+        EXPECT_CALL(transport_mock_, getMediaStatistics(_)).Times(3).WillRepeatedly(Return(makeIoStatistics(1, 1, 1)));
+
+        EXPECT_CALL(res_tx_session_mock,
+                    send(ServiceTxMetadataEq({{{124, Priority::Nominal}, now() + 100ms}, NodeId{0x31}}), _))  //
+            .WillOnce(Invoke([this](const auto&, const auto fragments) {
+                //
+                Service::Response response{Service::Response::allocator_type{&mr_}};
+                EXPECT_TRUE(libcyphal::verification_utilities::tryDeserialize(response, fragments));
+                EXPECT_THAT(response.network_interface_statistics, SizeIs(3));
+                return cetl::nullopt;
+            }));
+
+        provider.value().setResponseTimeout(100ms);
+
+        request.metadata.rx_meta.base.transfer_id = 124;
+        request.metadata.rx_meta.base.priority    = Priority::Nominal;
+        request.metadata.rx_meta.timestamp        = now();
+        req_rx_cb_fn({request});
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+
+        provider.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
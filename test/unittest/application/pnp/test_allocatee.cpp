@@ -0,0 +1,414 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/pnp/allocatee.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_2_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Ge;
+using testing::Le;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestAllocatee : public testing::Test
+{
+protected:
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getLocalNodeId())  //
+            .WillRepeatedly(Invoke([this] { return local_node_id_; }));
+        EXPECT_CALL(transport_mock_, setLocalNodeId(_))  //
+            .WillRepeatedly(Invoke([this](const NodeId node_id) -> cetl::optional<libcyphal::ArgumentError> {
+                //
+                if (node_id >= max_nodes_)
+                {
+                    return libcyphal::ArgumentError{};
+                }
+                local_node_id_ = node_id;
+                return cetl::nullopt;
+            }));
+        EXPECT_CALL(transport_mock_, getProtocolParams())  //
+            .WillRepeatedly(Invoke([this] {
+                return ProtocolParams{std::numeric_limits<TransferId>::max(), 0, max_nodes_};
+            }));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Invoke([this] { return rx_payload_.size(); }));
+        EXPECT_CALL(storage_mock_, copy(_, _, _))  //
+            .WillRepeatedly(Invoke([this](auto offset, auto* const dst, auto len) {
+                //
+                const auto size = std::min(rx_payload_.size() - offset, len);
+                (void) std::memmove(dst, rx_payload_.data() + offset, size);
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    template <typename Message>
+    void expectSessions()
+    {
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillOnce(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto&& cb_fn) {           //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([this](const auto&) {                                        //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillOnce(Return(tx_params));
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([this](const auto&) {                                        //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+    }
+
+    void expectSessionsDeinit()
+    {
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+    }
+
+    template <typename Message>
+    Message deserializeMessage(const PayloadFragments payload_fragments)
+    {
+        std::vector<std::uint8_t> buffer;
+        for (const auto fragment : payload_fragments)
+        {
+            const auto* const data = reinterpret_cast<const std::uint8_t*>(fragment.data());  // NOLINT
+            buffer.insert(buffer.end(), data, data + fragment.size());
+        }
+
+        Message message{typename Message::allocator_type{&mr_}};
+        EXPECT_TRUE(deserialize(message, {buffer.data(), buffer.size()}));
+        return message;
+    }
+
+    /// Simulates reception of a message published by the given node (anonymous if `nullopt`).
+    ///
+    template <typename Message>
+    void receiveMessage(const Message& message, const cetl::optional<NodeId> publisher_node_id)
+    {
+        rx_payload_.resize(Message::_traits_::SerializationBufferSizeBytes);
+        const auto result = serialize(message, {rx_payload_.data(), rx_payload_.size()});
+        ASSERT_TRUE(result);
+        rx_payload_.resize(result.value());
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer transfer{{{{rx_transfer_id_++, Priority::Nominal}, now()}, publisher_node_id},
+                                   ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    static pnp::Allocatee::UniqueId makeUniqueId()
+    {
+        pnp::Allocatee::UniqueId unique_id{};
+        for (std::size_t i = 0; i < unique_id.size(); ++i)
+        {
+            unique_id[i] = static_cast<std::uint8_t>(0xA0 + i);
+        }
+        return unique_id;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                scheduler_{};
+    TrackingMemoryResource                         mr_;
+    StrictMock<TransportMock>                      transport_mock_;
+    StrictMock<MessageRxSessionMock>               msg_rx_session_mock_;
+    StrictMock<MessageTxSessionMock>               msg_tx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>           storage_mock_;
+    std::vector<std::uint8_t>                      rx_payload_;
+    TransferId                                     rx_transfer_id_{0};
+    std::size_t                                    max_nodes_{128};
+    cetl::optional<NodeId>                         local_node_id_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestAllocatee, makeUniqueIdHash)
+{
+    // 64-bit FNV-1a of all zeros (16 bytes), truncated to 48 bits.
+    EXPECT_THAT(pnp::Allocatee::makeUniqueIdHash({}), 0x1FB960FF6465ULL);
+
+    const auto hash = pnp::Allocatee::makeUniqueIdHash(makeUniqueId());
+    EXPECT_THAT(hash, Le((1ULL << 48U) - 1U));
+    EXPECT_THAT(hash, testing::Ne(pnp::Allocatee::makeUniqueIdHash({})));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestAllocatee, v1_time_to_id_on_simulated_bus)
+{
+    using Message = pnp::Allocatee::MessageV1;
+
+    // Allocator goes online a bit later than the allocatee,
+    // so that the very first (immediate) request is missed, and backoff is exercised.
+    constexpr auto AllocatorOnline = 1s + 250ms;
+    constexpr auto BusLatency      = 2ms;
+    constexpr auto AllocatedId     = NodeId{42};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+
+    std::vector<TimePoint>         request_times;
+    cetl::optional<TimePoint>      allocated_time;
+    cetl::optional<pnp::Allocatee> allocatee;
+    EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto fragments) {
+            //
+            request_times.push_back(now());
+            EXPECT_THAT(metadata.deadline, Ge(now()));
+
+            const auto request = deserializeMessage<Message>(fragments);
+            EXPECT_THAT(request.unique_id_hash, pnp::Allocatee::makeUniqueIdHash(makeUniqueId()));
+            EXPECT_THAT(request.allocated_node_id, IsEmpty());
+
+            if (now() >= TimePoint{AllocatorOnline})
+            {
+                scheduler_.scheduleAt(now() + BusLatency, [this, request](const auto&) {
+                    //
+                    // Our own request (as it's looped back by some transports) should be ignored.
+                    receiveMessage(request, cetl::nullopt);
+
+                    // Response for some other node.
+                    Message response{request, Message::allocator_type{&mr_}};
+                    response.unique_id_hash ^= 1;
+                    response.allocated_node_id.emplace_back();
+                    response.allocated_node_id.front().value = AllocatedId + 1;
+                    receiveMessage(response, NodeId{127});
+
+                    // Response for us.
+                    response.unique_id_hash = request.unique_id_hash;
+                    response.allocated_node_id.front().value = AllocatedId;
+                    receiveMessage(response, NodeId{127});
+                });
+            }
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocatee = pnp::Allocatee::make(presentation, makeUniqueId());
+        ASSERT_THAT(maybe_allocatee, VariantWith<pnp::Allocatee>(_));
+        allocatee.emplace(cetl::get<pnp::Allocatee>(std::move(maybe_allocatee)));
+        allocatee->setOnAllocatedCallback([&](const auto& arg) {
+            //
+            EXPECT_THAT(arg.node_id, AllocatedId);
+            EXPECT_THAT(arg.approx_now, now());
+            allocated_time = arg.approx_now;
+        });
+        EXPECT_THAT(allocatee->getAllocatedNodeId(), cetl::nullopt);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        expectSessionsDeinit();
+        allocatee.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    // The very first request is sent immediately.
+    ASSERT_THAT(request_times.size(), Ge(3));
+    EXPECT_THAT(request_times.front(), TimePoint{1s});
+
+    // Subsequent requests follow randomized exponential backoff: [period/2, period], period = 100ms, 200ms, ...
+    Duration period = 100ms;
+    for (std::size_t i = 1; i < request_times.size(); ++i)
+    {
+        const auto delay = request_times[i] - request_times[i - 1];
+        EXPECT_THAT(delay, Ge(period / 2)) << "i=" << i;
+        EXPECT_THAT(delay, Le(period)) << "i=" << i;
+        period = std::min<Duration>(period * 2, 1s);
+    }
+
+    // No more requests are sent after the allocation, and time-to-ID is bounded by the backoff period.
+    ASSERT_TRUE(allocated_time.has_value());
+    EXPECT_THAT(*allocated_time, request_times.back() + BusLatency);
+    EXPECT_THAT(*allocated_time - TimePoint{AllocatorOnline}, Le(period / 2 + BusLatency));
+    EXPECT_THAT(local_node_id_, Optional(AllocatedId));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestAllocatee, v2_with_preferred_node_id)
+{
+    using Message = pnp::Allocatee::MessageV2;
+
+    max_nodes_ = 65535;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+
+    cetl::optional<pnp::Allocatee> allocatee;
+    std::vector<NodeId>            requested_ids;
+    EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            const auto request = deserializeMessage<Message>(fragments);
+            EXPECT_TRUE(std::equal(request.unique_id.cbegin(), request.unique_id.cend(), makeUniqueId().cbegin()));
+            requested_ids.push_back(request.node_id.value);
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocatee = pnp::Allocatee::make(presentation, makeUniqueId(), NodeId{1234});
+        ASSERT_THAT(maybe_allocatee, VariantWith<pnp::Allocatee>(_));
+        allocatee.emplace(cetl::get<pnp::Allocatee>(std::move(maybe_allocatee)));
+        allocatee->setRequestPeriods(10ms, 20ms);
+    });
+    scheduler_.scheduleAt(1s + 500ms, [&](const auto&) {
+        //
+        Message response{Message::allocator_type{&mr_}};
+        response.unique_id = makeUniqueId();
+
+        // Out of range node ID is rejected by the transport - requests should continue.
+        response.node_id.value = 65535;
+        receiveMessage(response, NodeId{1});
+        EXPECT_THAT(allocatee->getAllocatedNodeId(), cetl::nullopt);
+
+        response.node_id.value = 1234;
+        receiveMessage(response, NodeId{1});
+        EXPECT_THAT(allocatee->getAllocatedNodeId(), Optional(NodeId{1234}));
+        EXPECT_THAT(local_node_id_, Optional(NodeId{1234}));
+
+        // Repeated response (f.e. from a redundant allocator) is ignored.
+        response.node_id.value = 1235;
+        receiveMessage(response, NodeId{2});
+        EXPECT_THAT(local_node_id_, Optional(NodeId{1234}));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        expectSessionsDeinit();
+        allocatee.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    // Within 500ms, with 10ms...20ms periods, there should be at least 25 requests.
+    EXPECT_THAT(requested_ids.size(), Ge(25));
+    EXPECT_THAT(requested_ids.size(), Le(51));
+    EXPECT_TRUE(std::all_of(requested_ids.cbegin(), requested_ids.cend(), [](auto id) { return id == 1234; }));
+}
+
+TEST_F(TestAllocatee, stops_on_externally_assigned_node_id)
+{
+    using Message = pnp::Allocatee::MessageV1;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+
+    cetl::optional<pnp::Allocatee> allocatee;
+    std::size_t                    requests_count = 0;
+    EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto&, const auto) {
+            //
+            ++requests_count;
+            return cetl::nullopt;
+        }));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocatee = pnp::Allocatee::make(presentation, makeUniqueId());
+        ASSERT_THAT(maybe_allocatee, VariantWith<pnp::Allocatee>(_));
+
+        // Moving should keep requesting (by the new instance).
+        allocatee.emplace(cetl::get<pnp::Allocatee>(std::move(maybe_allocatee)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(requests_count, Ge(2));
+        local_node_id_ = NodeId{7};
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        EXPECT_THAT(allocatee->getAllocatedNodeId(), Optional(NodeId{7}));
+        requests_count = 0;
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        EXPECT_THAT(requests_count, 0);
+        expectSessionsDeinit();
+        allocatee.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,502 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/pnp/allocatee.hpp>
+#include <libcyphal/application/pnp/allocator.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <nunavut/support/serialization.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_1_0.hpp>
+#include <uavcan/pnp/NodeIDAllocationData_2_0.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::application;   // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::presentation;  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::platform::storage::Error;
+
+using testing::_;
+using testing::Le;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Optional;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestAllocator : public testing::Test
+{
+protected:
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using KeyValueMock       = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(transport_mock_, getLocalNodeId()).WillRepeatedly(Return(NodeId{10}));
+        EXPECT_CALL(transport_mock_, getProtocolParams())  //
+            .WillRepeatedly(Invoke([this] {
+                return ProtocolParams{std::numeric_limits<TransferId>::max(), 0, max_nodes_};
+            }));
+
+        EXPECT_CALL(storage_mock_, size()).WillRepeatedly(Invoke([this] { return rx_payload_.size(); }));
+        EXPECT_CALL(storage_mock_, copy(_, _, _))  //
+            .WillRepeatedly(Invoke([this](auto offset, auto* const dst, auto len) {
+                //
+                const auto size = std::min(rx_payload_.size() - offset, len);
+                (void) std::memmove(dst, rx_payload_.data() + offset, size);
+                return size;
+            }));
+
+        // Simulated persistent storage of the allocation table.
+        EXPECT_CALL(key_value_mock_, get(cetl::string_view{pnp::Allocator::TableKey}, _))  //
+            .WillRepeatedly(Invoke([this](auto, auto data) -> libcyphal::Expected<std::size_t, Error> {
+                //
+                if (!stored_table_.has_value())
+                {
+                    return Error::Existence;
+                }
+                const auto size = std::min(stored_table_->size(), data.size());
+                std::copy_n(stored_table_->cbegin(), size, data.begin());
+                return size;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    template <typename Message>
+    void expectSessions()
+    {
+        constexpr MessageRxParams rx_params{Message::_traits_::ExtentBytes, Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_rx_session_mock_, getParams()).WillOnce(Return(rx_params));
+        EXPECT_CALL(msg_rx_session_mock_, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto&& cb_fn) {           //
+                msg_rx_cb_fn_ = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([this](const auto&) {                                        //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock_);
+            }));
+
+        constexpr MessageTxParams tx_params{Message::_traits_::FixedPortId};
+        EXPECT_CALL(msg_tx_session_mock_, getParams()).WillOnce(Return(tx_params));
+        EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([this](const auto&) {                                        //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock_);
+            }));
+    }
+
+    void expectSessionsDeinit()
+    {
+        EXPECT_CALL(msg_rx_session_mock_, deinit()).Times(1);
+        EXPECT_CALL(msg_tx_session_mock_, deinit()).Times(1);
+    }
+
+    void expectTablePut(const cetl::optional<Error> result = cetl::nullopt)
+    {
+        EXPECT_CALL(key_value_mock_, put(cetl::string_view{pnp::Allocator::TableKey}, _))  //
+            .WillOnce(Invoke([this, result](auto, auto data) {
+                //
+                if (!result.has_value())
+                {
+                    stored_table_.emplace(data.begin(), data.end());
+                }
+                return result;
+            }));
+    }
+
+    template <typename Message>
+    Message deserializeMessage(const PayloadFragments payload_fragments)
+    {
+        std::vector<std::uint8_t> buffer;
+        for (const auto fragment : payload_fragments)
+        {
+            const auto* const data = reinterpret_cast<const std::uint8_t*>(fragment.data());  // NOLINT
+            buffer.insert(buffer.end(), data, data + fragment.size());
+        }
+
+        Message message{typename Message::allocator_type{&mr_}};
+        EXPECT_TRUE(deserialize(message, {buffer.data(), buffer.size()}));
+        return message;
+    }
+
+    /// Simulates reception of a message published by the given node (anonymous if `nullopt`).
+    ///
+    template <typename Message>
+    void receiveMessage(const Message& message, const cetl::optional<NodeId> publisher_node_id = cetl::nullopt)
+    {
+        rx_payload_.resize(Message::_traits_::SerializationBufferSizeBytes);
+        const auto result = serialize(message, {rx_payload_.data(), rx_payload_.size()});
+        ASSERT_TRUE(result);
+        rx_payload_.resize(result.value());
+
+        ScatteredBufferStorageMock::Wrapper storage{&storage_mock_};
+        MessageRxTransfer transfer{{{{rx_transfer_id_++, Priority::Nominal}, now()}, publisher_node_id},
+                                   ScatteredBuffer{std::move(storage)}};
+        msg_rx_cb_fn_({transfer});
+    }
+
+    pnp::Allocator::MessageV1 makeRequestV1(const std::uint64_t unique_id_hash)
+    {
+        pnp::Allocator::MessageV1 request{pnp::Allocator::MessageV1::allocator_type{&mr_}};
+        request.unique_id_hash = unique_id_hash;
+        return request;
+    }
+
+    pnp::Allocator::MessageV2 makeRequestV2(const std::uint8_t unique_id_seed, const NodeId preferred_node_id)
+    {
+        pnp::Allocator::MessageV2 request{pnp::Allocator::MessageV2::allocator_type{&mr_}};
+        request.node_id.value = preferred_node_id;
+        std::fill(request.unique_id.begin(), request.unique_id.end(), unique_id_seed);
+        return request;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                  scheduler_{};
+    TrackingMemoryResource                           mr_;
+    StrictMock<TransportMock>                        transport_mock_;
+    StrictMock<MessageRxSessionMock>                 msg_rx_session_mock_;
+    StrictMock<MessageTxSessionMock>                 msg_tx_session_mock_;
+    IMessageRxSession::OnReceiveCallback::Function   msg_rx_cb_fn_;
+    NiceMock<ScatteredBufferStorageMock>             storage_mock_;
+    KeyValueMock                                     key_value_mock_;
+    cetl::optional<std::vector<std::uint8_t>>        stored_table_;
+    std::vector<std::uint8_t>                        rx_payload_;
+    TransferId                                       rx_transfer_id_{0};
+    std::size_t                                      max_nodes_{128};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestAllocator, make_with_zero_capacity)
+{
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    const auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 0);
+    EXPECT_THAT(maybe_allocator, VariantWith<pnp::Allocator::MakeFailure>(_));
+}
+
+TEST_F(TestAllocator, make_with_corrupted_table)
+{
+    using Message = pnp::Allocator::MessageV1;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+    expectSessionsDeinit();
+
+    // Not a whole number of records.
+    stored_table_.emplace(pnp::Allocator::RecordSize + 1, std::uint8_t{0});
+
+    const auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 16);
+    ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator::MakeFailure>(_));
+    EXPECT_THAT(cetl::get<pnp::Allocator::MakeFailure>(maybe_allocator), VariantWith<Error>(Error::Internal));
+}
+
+TEST_F(TestAllocator, make_with_too_big_table)
+{
+    using Message = pnp::Allocator::MessageV1;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+    expectSessionsDeinit();
+
+    // One record more than the capacity - the table should not be partially loaded.
+    stored_table_.emplace(pnp::Allocator::RecordSize * 5, std::uint8_t{0});
+
+    const auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 4);
+    ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator::MakeFailure>(_));
+    EXPECT_THAT(cetl::get<pnp::Allocator::MakeFailure>(maybe_allocator), VariantWith<Error>(Error::Capacity));
+}
+
+TEST_F(TestAllocator, make_with_occupied_records)
+{
+    using Message = pnp::Allocator::MessageV1;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+
+    // Records of node IDs 10 (the own one of the allocator), 20 and again 20 (but with another unique ID).
+    stored_table_.emplace();
+    for (const std::uint8_t node_id : {10, 20, 20})
+    {
+        stored_table_->push_back(node_id);
+        stored_table_->push_back(0);
+        const auto unique_id_seed = static_cast<std::uint8_t>(stored_table_->size());  // unique per record
+        stored_table_->insert(stored_table_->end(), sizeof(pnp::Allocator::UniqueId), unique_id_seed);
+    }
+
+    auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 4);
+    ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator>(_));
+    {
+        const auto allocator = cetl::get<pnp::Allocator>(std::move(maybe_allocator));
+        EXPECT_THAT(allocator.size(), 1);
+
+        expectSessionsDeinit();
+    }
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestAllocator, v1_allocation_storm)
+{
+    using Message = pnp::Allocator::MessageV1;
+
+    constexpr std::size_t Requests = 120;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    expectSessions<Message>();
+
+    std::map<std::uint64_t, NodeId> responses;
+    EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto& metadata, const auto fragments) {
+            //
+            EXPECT_THAT(metadata.deadline, now() + 1s);
+            const auto response = deserializeMessage<Message>(fragments);
+            EXPECT_THAT(response.allocated_node_id, SizeIs(1));
+            EXPECT_TRUE(responses.emplace(response.unique_id_hash, response.allocated_node_id.front().value).second)
+                << "Each allocatee should get exactly one response.";
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<pnp::Allocator> allocator;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 200);
+        ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator>(_));
+        allocator.emplace(cetl::get<pnp::Allocator>(std::move(maybe_allocator)));
+        EXPECT_THAT(allocator->size(), 0);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // The whole storm (including repeated requests) arrives within one executor spin.
+        // No allocation is expected in the reception path.
+        const auto allocations_before = mr_.total_allocated_bytes;
+        for (std::uint64_t i = 0; i < Requests; ++i)
+        {
+            receiveMessage(makeRequestV1(0x1000 + i));
+            if ((i % 3) == 0)
+            {
+                receiveMessage(makeRequestV1(0x1000 + i));
+            }
+        }
+        EXPECT_THAT(allocator->size(), Requests);
+        EXPECT_THAT(responses, IsEmpty()) << "Responses are published only after the table is saved.";
+        EXPECT_THAT(mr_.total_allocated_bytes, allocations_before);
+
+        // Just one storage write for the whole storm.
+        expectTablePut();
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        ASSERT_THAT(responses, SizeIs(Requests));
+        ASSERT_TRUE(stored_table_.has_value());
+        EXPECT_THAT(*stored_table_, SizeIs(Requests * pnp::Allocator::RecordSize));
+
+        std::set<NodeId> node_ids;
+        for (const auto& hash_and_node_id : responses)
+        {
+            const auto node_id = hash_and_node_id.second;
+            EXPECT_THAT(node_id, Le(127));
+            EXPECT_THAT(node_id, testing::Ne(10)) << "Own node ID is reserved.";
+            EXPECT_TRUE(node_ids.insert(node_id).second) << "Node IDs should be unique.";
+            EXPECT_THAT(allocator->findNodeId(pnp::Allocator::makeV1Key(hash_and_node_id.first)), Optional(node_id));
+        }
+        // Highest IDs are allocated first.
+        EXPECT_THAT(*node_ids.rbegin(), 127);
+
+        // Node which has missed its response repeats the request - the same ID, and no storage write.
+        const auto expected_node_id = responses[0x1000];
+        responses.clear();
+        receiveMessage(makeRequestV1(0x1000));
+
+        // Responses of this (or other) allocator are ignored, as well as non-anonymous messages.
+        auto response = makeRequestV1(0x2000);
+        response.allocated_node_id.emplace_back();
+        receiveMessage(response);
+        receiveMessage(makeRequestV1(0x3000), NodeId{1});
+
+        scheduler_.scheduleAt(now() + 1ms, [&, expected_node_id](const auto&) {
+            //
+            EXPECT_THAT(responses, SizeIs(1));
+            EXPECT_THAT(responses[0x1000], expected_node_id);
+            EXPECT_THAT(allocator->size(), Requests);
+        });
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        // Table is full (only 7 IDs are left: 128 - 120 - own ID) - no response.
+        responses.clear();
+        expectTablePut();
+        for (std::uint64_t i = 0; i < 10; ++i)
+        {
+            receiveMessage(makeRequestV1(0x5000 + i));
+        }
+        EXPECT_THAT(allocator->size(), Requests + 7);
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses, SizeIs(7));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        expectSessionsDeinit();
+        allocator.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestAllocator, v2_persistence_and_preferred_id)
+{
+    using Message = pnp::Allocator::MessageV2;
+
+    max_nodes_ = 65535;
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    std::map<std::uint8_t, NodeId> responses;
+    EXPECT_CALL(msg_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([&](const auto&, const auto fragments) {
+            //
+            const auto response              = deserializeMessage<Message>(fragments);
+            responses[response.unique_id[0]] = response.node_id.value;
+            return cetl::nullopt;
+        }));
+
+    cetl::optional<pnp::Allocator> allocator;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        expectSessions<Message>();
+        auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 8);
+        ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator>(_));
+        allocator.emplace(cetl::get<pnp::Allocator>(std::move(maybe_allocator)));
+
+        allocator->reserveNodeId(65534);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        expectTablePut();
+        receiveMessage(makeRequestV2(0xA1, 1000));
+        receiveMessage(makeRequestV2(0xA2, 1000));  // preferred is already taken
+        receiveMessage(makeRequestV2(0xA3, 10));    // preferred is reserved (own node ID)
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses[0xA1], 1000);
+        EXPECT_THAT(responses[0xA2], 65533);
+        EXPECT_THAT(responses[0xA3], 65532);
+
+        // Storage write failure - no responses.
+        responses.clear();
+        expectTablePut(Error::IO);
+        receiveMessage(makeRequestV2(0xA4, 2000));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses, IsEmpty());
+        EXPECT_THAT(allocator->getLastError(), Optional(Error::IO));
+
+        // Repeated request succeeds once the table is saved.
+        expectTablePut();
+        receiveMessage(makeRequestV2(0xA4, 2000));
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses[0xA4], 2000);
+
+        // Restart of the allocator - the table is loaded from the storage.
+        // Note that presentation layer reuses still alive transport sessions.
+        allocator.reset();
+        auto maybe_allocator = pnp::Allocator::make(presentation, key_value_mock_, 8);
+        ASSERT_THAT(maybe_allocator, VariantWith<pnp::Allocator>(_));
+        allocator.emplace(cetl::get<pnp::Allocator>(std::move(maybe_allocator)));
+        EXPECT_THAT(allocator->size(), 4);
+        allocator->reserveNodeId(65534);  // reservations are not persisted
+    });
+    scheduler_.scheduleAt(4s + 100ms, [&](const auto&) {
+        //
+        responses.clear();
+        receiveMessage(makeRequestV2(0xA2, 65534));
+        expectTablePut();
+        receiveMessage(makeRequestV2(0xA5, 65534));  // no preference (see `Allocatee`), but it is reserved
+    });
+    scheduler_.scheduleAt(5s, [&](const auto&) {
+        //
+        EXPECT_THAT(responses[0xA2], 65533);
+        EXPECT_THAT(responses[0xA5], 65531);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        expectSessionsDeinit();
+        allocator.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,169 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "platform/storage_key_value_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/application/registry/auto_save_registry.hpp>
+#include <libcyphal/application/registry/register.hpp>
+#include <libcyphal/application/registry/registry_impl.hpp>
+#include <libcyphal/platform/storage.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace
+{
+
+using libcyphal::VirtualTimeScheduler;
+using namespace libcyphal::application::registry;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::StrictMock;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+class TestAutoSaveRegistry : public testing::Test
+{
+protected:
+    using StorageError = libcyphal::platform::storage::Error;
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    IRegister::Value makeUInt8Value(const std::uint8_t value) const
+    {
+        IRegister::Value out{alloc_};
+        out.set_natural8().value.push_back(value);
+        return out;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    VirtualTimeScheduler             scheduler_{};
+    TrackingMemoryResource           mr_;
+    IRegister::Value::allocator_type alloc_{&mr_};
+    KeyValueMock                     key_value_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestAutoSaveRegistry, debounced_save)
+{
+    Registry         rgy{mr_};
+    AutoSaveRegistry auto_save_rgy{scheduler_, rgy, key_value_mock_, 100ms};
+
+    const auto getter = [this] { return makeUInt8Value(0x42); };
+    const auto setter = [](const IRegister::Value&) -> cetl::optional<SetError> { return cetl::nullopt; };
+
+    auto r_a = rgy.route("a", getter, setter, {true});
+    auto r_b = rgy.route("b", getter, setter, {true});
+    auto r_c = rgy.route("c", getter, setter, {true});
+    r_a.setDirty(false);
+    r_b.setDirty(false);
+    r_c.setDirty(false);
+    EXPECT_THAT(auto_save_rgy.size(), 3);
+    EXPECT_THAT(auto_save_rgy.index(0), rgy.index(0));
+    EXPECT_THAT(auto_save_rgy.get("a"), Optional(_));
+    EXPECT_FALSE(auto_save_rgy.isSavePending());
+
+    // A burst of changes is coalesced into a single save, which happens `debounce` time after the latest change.
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(auto_save_rgy.set("a", makeUInt8Value(1)), Eq(cetl::nullopt));
+        EXPECT_TRUE(auto_save_rgy.isSavePending());
+        EXPECT_TRUE(auto_save_rgy.isDirty("a"));
+    });
+    scheduler_.scheduleAt(1s + 50ms, [&](const auto&) {
+        //
+        EXPECT_THAT(auto_save_rgy.set("b", makeUInt8Value(2)), Eq(cetl::nullopt));
+        EXPECT_THAT(auto_save_rgy.set("unknown", makeUInt8Value(3)), Optional(SetError::Existence));
+    });
+    scheduler_.scheduleAt(1s + 149ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(auto_save_rgy.isSavePending());
+        EXPECT_CALL(key_value_mock_, put(IRegister::Name{"a"}, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_CALL(key_value_mock_, put(IRegister::Name{"b"}, _)).WillOnce(Return(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 151ms, [&](const auto&) {
+        //
+        EXPECT_FALSE(auto_save_rgy.isSavePending());
+        EXPECT_THAT(auto_save_rgy.getLastError(), Eq(cetl::nullopt));
+        EXPECT_FALSE(auto_save_rgy.isDirty("a"));
+        EXPECT_FALSE(auto_save_rgy.isDirty("b"));
+    });
+    // Failed save retains the error, and failed registers are retried on the next save.
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        EXPECT_THAT(rgy.set("c", makeUInt8Value(4)), Eq(cetl::nullopt));
+        EXPECT_FALSE(auto_save_rgy.isSavePending());
+        auto_save_rgy.requestSave();
+        EXPECT_CALL(key_value_mock_, put(IRegister::Name{"c"}, _)).WillOnce(Return(StorageError::IO));
+    });
+    scheduler_.scheduleAt(2s + 101ms, [&](const auto&) {
+        //
+        EXPECT_THAT(auto_save_rgy.getLastError(), Optional(StorageError::IO));
+        EXPECT_TRUE(auto_save_rgy.isDirty("c"));
+
+        EXPECT_CALL(key_value_mock_, put(IRegister::Name{"c"}, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(auto_save_rgy.flush(), Eq(cetl::nullopt));
+        EXPECT_THAT(auto_save_rgy.getLastError(), Eq(cetl::nullopt));
+        EXPECT_FALSE(auto_save_rgy.isDirty("c"));
+    });
+    // Explicit flush cancels the pending save.
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(auto_save_rgy.set("a", makeUInt8Value(5)), Eq(cetl::nullopt));
+        EXPECT_CALL(key_value_mock_, put(IRegister::Name{"a"}, _)).WillOnce(Return(cetl::nullopt));
+        EXPECT_THAT(auto_save_rgy.flush(), Eq(cetl::nullopt));
+        EXPECT_FALSE(auto_save_rgy.isSavePending());
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestAutoSaveRegistry, append)
+{
+    Registry         rgy{mr_};
+    AutoSaveRegistry auto_save_rgy{scheduler_, rgy, key_value_mock_, 100ms};
+
+    auto r_a = makeRegister(mr_, "a", [this] { return makeUInt8Value(0x42); });
+    EXPECT_TRUE(auto_save_rgy.append(r_a));
+    EXPECT_TRUE(r_a.isLinked());
+    EXPECT_THAT(rgy.size(), 1);
+
+    auto_save_rgy.clearDirty("a");
+    EXPECT_FALSE(r_a.isDirty());
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
+
+}  // namespace
@@ -13,10 +13,12 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 
 namespace
 {
@@ -79,6 +81,14 @@ protected:
         return value;
     }
 
+    IRegister::Value makeReal64Value(const std::initializer_list<double>& il) const
+    {
+        IRegister::Value value{alloc_};
+        auto&            real64 = value.set_real64();
+        std::copy(il.begin(), il.end(), std::back_inserter(real64.value));
+        return value;
+    }
+
     // MARK: Data members:
 
     // NOLINTBEGIN
@@ -168,6 +178,146 @@ TEST_F(TestRegister, makeRegister_set_failure)
     EXPECT_THAT(r_int32.set(makeInt32Value({13})), Optional(SetError::Semantics));
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegister, makeRegister_typed_scalar)
+{
+    float value = 1.5F;
+
+    auto r_real = makeRegister(
+        mr_,
+        "real",
+        [&value] { return value; },
+        [&value](const float& new_value) -> cetl::optional<SetError> {
+            //
+            value = new_value;
+            return cetl::nullopt;
+        });
+
+    // Typed accessors don't involve `Value` at all.
+    EXPECT_THAT(r_real.getTyped(), 1.5F);
+    r_real.setDirty(false);
+    EXPECT_THAT(r_real.setTyped(2.5F), Eq(cetl::nullopt));
+    EXPECT_THAT(value, 2.5F);
+    EXPECT_THAT(r_real.isDirty(), true);
+    EXPECT_THAT(mr_.total_allocated_bytes, 0);
+
+    // At the network boundary the value is converted to/from `Value`.
+    {
+        const auto result = r_real.get();
+        EXPECT_THAT(result.flags._mutable, true);
+        ASSERT_THAT(result.value.is_real32(), true);
+        EXPECT_THAT(result.value.get_real32().value, ElementsAre(2.5F));
+    }
+    EXPECT_THAT(r_real.set(makeInt32Value({-7})), Eq(cetl::nullopt));
+    EXPECT_THAT(value, -7.0F);
+    EXPECT_THAT(r_real.set(makeBitValue({true})), Eq(cetl::nullopt));
+    EXPECT_THAT(value, 1.0F);
+
+    // Size mismatch and non-numeric values are rejected.
+    EXPECT_THAT(r_real.set(makeInt32Value({1, 2})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_real.set(IRegister::Value{alloc_}), Optional(SetError::Semantics));
+    EXPECT_THAT(value, 1.0F);
+}
+
+TEST_F(TestRegister, makeRegister_typed_array)
+{
+    std::array<std::uint16_t, 3> values{1, 2, 3};
+
+    auto r_immutable = makeRegister(mr_, "arr_ro", [&values] { return values; });
+    EXPECT_THAT(r_immutable.getTyped(), ElementsAre(1, 2, 3));
+    EXPECT_THAT(r_immutable.set(makeInt32Value({4, 5, 6})), Optional(SetError::Mutability));
+    {
+        const auto result = r_immutable.get();
+        EXPECT_THAT(result.flags._mutable, false);
+        ASSERT_THAT(result.value.is_natural16(), true);
+        EXPECT_THAT(result.value.get_natural16().value, ElementsAre(1, 2, 3));
+    }
+
+    auto r_mutable = makeRegister(
+        mr_,
+        "arr_rw",
+        [&values] { return values; },
+        [&values](const std::array<std::uint16_t, 3>& new_values) -> cetl::optional<SetError> {
+            //
+            values = new_values;
+            return cetl::nullopt;
+        });
+    EXPECT_THAT(r_mutable.set(makeInt32Value({4, 5, 6})), Eq(cetl::nullopt));
+    EXPECT_THAT(values, ElementsAre(4, 5, 6));
+    EXPECT_THAT(r_mutable.setTyped({7, 8, 9}), Eq(cetl::nullopt));
+    EXPECT_THAT(r_mutable.getTyped(), ElementsAre(7, 8, 9));
+    EXPECT_THAT(r_mutable.set(makeInt32Value({1})), Optional(SetError::Semantics));
+    EXPECT_THAT(values, ElementsAre(7, 8, 9));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegister, makeRegister_typed_out_of_range)
+{
+    std::array<std::uint8_t, 2> naturals{1, 2};
+
+    auto r_naturals = makeRegister(
+        mr_,
+        "naturals",
+        [&naturals] { return naturals; },
+        [&naturals](const std::array<std::uint8_t, 2>& new_values) -> cetl::optional<SetError> {
+            //
+            naturals = new_values;
+            return cetl::nullopt;
+        });
+
+    // Integers which don't fit the type are rejected (instead of being wrapped around) - even a single element.
+    EXPECT_THAT(r_naturals.set(makeInt32Value({0, 255})), Eq(cetl::nullopt));
+    EXPECT_THAT(naturals, ElementsAre(0, 255));
+    EXPECT_THAT(r_naturals.set(makeInt32Value({3, 300})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_naturals.set(makeInt32Value({-1, 4})), Optional(SetError::Semantics));
+    EXPECT_THAT(naturals, ElementsAre(0, 255));
+
+    std::int16_t integer = 0;
+
+    auto r_integer = makeRegister(
+        mr_,
+        "integer",
+        [&integer] { return integer; },
+        [&integer](const std::int16_t& new_value) -> cetl::optional<SetError> {
+            //
+            integer = new_value;
+            return cetl::nullopt;
+        });
+
+    // Floating point values are truncated, but only if the result fits the integer type; NaN is never accepted.
+    EXPECT_THAT(r_integer.set(makeReal64Value({-2.9})), Eq(cetl::nullopt));
+    EXPECT_THAT(integer, -2);
+    EXPECT_THAT(r_integer.set(makeReal64Value({-32768.5})), Eq(cetl::nullopt));
+    EXPECT_THAT(integer, -32768);
+    EXPECT_THAT(r_integer.set(makeReal64Value({32767.9})), Eq(cetl::nullopt));
+    EXPECT_THAT(integer, 32767);
+    EXPECT_THAT(r_integer.set(makeReal64Value({32768.0})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_integer.set(makeReal64Value({-32769.0})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_integer.set(makeReal64Value({1e300})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_integer.set(makeReal64Value({std::numeric_limits<double>::quiet_NaN()})),
+                Optional(SetError::Semantics));
+    EXPECT_THAT(r_integer.set(makeReal64Value({std::numeric_limits<double>::infinity()})),
+                Optional(SetError::Semantics));
+    EXPECT_THAT(integer, 32767);
+
+    float real = 0.0F;
+
+    auto r_real = makeRegister(
+        mr_,
+        "real",
+        [&real] { return real; },
+        [&real](const float& new_value) -> cetl::optional<SetError> {
+            //
+            real = new_value;
+            return cetl::nullopt;
+        });
+
+    // Finite `double` values beyond the `float` range are rejected too.
+    EXPECT_THAT(r_real.set(makeReal64Value({1e300})), Optional(SetError::Semantics));
+    EXPECT_THAT(r_real.set(makeReal64Value({-std::numeric_limits<double>::infinity()})), Eq(cetl::nullopt));
+    EXPECT_THAT(real, -std::numeric_limits<float>::infinity());
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
 
 }  // namespace
@@ -3,6 +3,7 @@
 /// Copyright Amazon.com Inc. or its affiliates.
 /// SPDX-License-Identifier: MIT
 
+#include "memory_resource_mock.hpp"
 #include "platform/storage_key_value_mock.hpp"
 #include "registry_gtest_helpers.hpp"
 #include "registry_mock.hpp"
@@ -21,6 +22,9 @@
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -272,6 +276,159 @@ TEST_F(TestRegistry, route_immutable)
     EXPECT_THAT(same_reg_value.get_integer32().value, ElementsAre(147));
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegistry, freeze)
+{
+    Registry rgy{mr_};
+
+    std::int32_t v_a = 1;
+    std::int32_t v_b = 2;
+    std::int32_t v_c = 3;
+
+    const auto setter_of = [](std::int32_t& v) {
+        return [&v](const IRegister::Value& value) -> cetl::optional<SetError> {
+            //
+            v = value.get_integer32().value.front();
+            return cetl::nullopt;
+        };
+    };
+    const auto r_a = rgy.route("a", [this, &v_a] { return makeInt32Value({v_a}); }, setter_of(v_a));
+    const auto r_b = rgy.route("b", [this, &v_b] { return makeInt32Value({v_b}); }, setter_of(v_b));
+    EXPECT_FALSE(rgy.isFrozen());
+
+    EXPECT_TRUE(rgy.freeze());
+    EXPECT_TRUE(rgy.isFrozen());
+    EXPECT_THAT(mr_.allocations, testing::SizeIs(1));
+    EXPECT_THAT(rgy.size(), 2);
+    EXPECT_THAT(rgy.get("a"), Optional(_));
+    EXPECT_THAT(rgy.get("x"), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.set("b", makeInt32Value({22})), Eq(cetl::nullopt));
+    EXPECT_THAT(v_b, 22);
+    EXPECT_THAT(rgy.set("x", makeInt32Value({0})), Optional(SetError::Existence));
+    {
+        // Appending drops the index, but the registry is still functional.
+        const auto r_c = rgy.route("c", [this, &v_c] { return makeInt32Value({v_c}); }, setter_of(v_c));
+        EXPECT_FALSE(rgy.isFrozen());
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(rgy.set("c", makeInt32Value({33})), Eq(cetl::nullopt));
+        EXPECT_THAT(v_c, 33);
+
+        EXPECT_TRUE(rgy.freeze());
+        EXPECT_TRUE(rgy.isFrozen());
+        EXPECT_THAT(rgy.set("a", makeInt32Value({11})), Eq(cetl::nullopt));
+        EXPECT_THAT(v_a, 11);
+        EXPECT_THAT(rgy.set("c", makeInt32Value({333})), Eq(cetl::nullopt));
+        EXPECT_THAT(v_c, 333);
+    }
+    // Destruction of a register makes the index stale.
+    EXPECT_FALSE(rgy.isFrozen());
+    EXPECT_THAT(rgy.get("c"), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.set("a", makeInt32Value({111})), Eq(cetl::nullopt));
+    EXPECT_THAT(v_a, 111);
+
+    // Relocation (by move) of a register makes the index stale as well.
+    {
+        auto r_d = rgy.route("d", [this] { return makeInt32Value({4}); });
+        EXPECT_TRUE(rgy.freeze());
+        EXPECT_TRUE(rgy.isFrozen());
+
+        const auto r_d_moved = std::move(r_d);
+        EXPECT_FALSE(rgy.isFrozen());
+        EXPECT_THAT(rgy.get("d"), Optional(_));
+    }
+    EXPECT_FALSE(rgy.isFrozen());
+
+    // Not enough memory for the index.
+    {
+        StrictMock<MemoryResourceMock> mr_mock;
+        Registry                       rgy2{mr_mock};
+        const auto r_x = rgy2.route("x", [this] { return makeEmptyValue(); });
+
+        EXPECT_CALL(mr_mock, do_allocate(_, _)).WillOnce(Return(nullptr));
+        EXPECT_FALSE(rgy2.freeze());
+        EXPECT_FALSE(rgy2.isFrozen());
+    }
+
+    // Empty registry could be frozen as well - without any allocation.
+    Registry rgy3{mr_};
+    EXPECT_TRUE(rgy3.freeze());
+    EXPECT_TRUE(rgy3.isFrozen());
+    EXPECT_THAT(rgy3.get("a"), Eq(cetl::nullopt));
+}
+
+TEST_F(TestRegistry, freeze_many)
+{
+    constexpr std::size_t Count = 100;
+
+    Registry rgy{mr_};
+
+    std::vector<std::string> names;
+    names.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        names.push_back("reg." + std::to_string(i));
+    }
+    const auto make_getter = [this](const std::size_t i) {
+        return [this, i] { return makeInt32Value({static_cast<std::int32_t>(i)}); };
+    };
+    std::vector<decltype(rgy.route(names.front().c_str(), make_getter(0)))> registers;
+    registers.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        registers.emplace_back(rgy.route(names[i].c_str(), make_getter(i)));
+    }
+    EXPECT_THAT(rgy.size(), Count);
+
+    EXPECT_TRUE(rgy.freeze());
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        const auto result = rgy.get(names[i].c_str());
+        ASSERT_TRUE(result);
+        EXPECT_THAT(result->value.get_integer32().value, ElementsAre(static_cast<std::int32_t>(i)));
+    }
+}
+
+TEST_F(TestRegistry, handle)
+{
+    Registry rgy{mr_};
+
+    std::int32_t v_a = 1;
+
+    const auto r_a = rgy.route(
+        "a",
+        [this, &v_a] { return makeInt32Value({v_a}); },
+        [&v_a](const IRegister::Value& value) -> cetl::optional<SetError> {
+            //
+            v_a = value.get_integer32().value.front();
+            return cetl::nullopt;
+        });
+
+    const auto handle = rgy.getHandle("a");
+    EXPECT_TRUE(handle.isValid());
+    EXPECT_THAT(handle.getName(), "a");
+    EXPECT_THAT(handle.set(makeInt32Value({42})), Eq(cetl::nullopt));
+    EXPECT_THAT(v_a, 42);
+    const auto result = handle.get();
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->flags._mutable, true);
+    EXPECT_THAT(result->value.get_integer32().value, ElementsAre(42));
+
+    // The same handle is resolved from the frozen index.
+    EXPECT_TRUE(rgy.freeze());
+    const auto frozen_handle = rgy.getHandle("a");
+    EXPECT_TRUE(frozen_handle.isValid());
+    EXPECT_THAT(frozen_handle.getName(), "a");
+
+    const auto invalid_handle = rgy.getHandle("b");
+    EXPECT_FALSE(invalid_handle.isValid());
+    EXPECT_THAT(invalid_handle.getName(), IsEmpty());
+    EXPECT_THAT(invalid_handle.get(), Eq(cetl::nullopt));
+    EXPECT_THAT(invalid_handle.set(makeInt32Value({0})), Optional(SetError::Existence));
+
+    const RegisterHandle default_handle;
+    EXPECT_FALSE(default_handle.isValid());
+}
+
 TEST_F(TestRegistry, load)
 {
     using RegistryMock = StrictMock<IntrospectableRegistryMock>;
@@ -428,7 +585,7 @@ TEST_F(TestRegistry, load_failures)
 
 TEST_F(TestRegistry, save)
 {
-    using RegistryMock = const StrictMock<IntrospectableRegistryMock>;
+    using RegistryMock = StrictMock<IntrospectableRegistryMock>;
     using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
 
     // Empty registry.
@@ -511,7 +668,7 @@ TEST_F(TestRegistry, save)
 
 TEST_F(TestRegistry, save_failures)
 {
-    using RegistryMock = const StrictMock<IntrospectableRegistryMock>;
+    using RegistryMock = StrictMock<IntrospectableRegistryMock>;
     using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
 
     RegistryMock rgy_mock;
@@ -528,6 +685,81 @@ TEST_F(TestRegistry, save_failures)
     EXPECT_THAT(save(key_value_mock, rgy_mock), Optional(StorageError::IO));
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEST_F(TestRegistry, save_dirty_only)
+{
+    using KeyValueMock = StrictMock<libcyphal::platform::storage::KeyValueMock>;
+
+    Registry     rgy{mr_};
+    KeyValueMock key_value_mock;
+
+    const auto getter = [this] { return makeUInt8Value({0x42}); };
+    const auto setter = [](const IRegister::Value&) -> cetl::optional<SetError> { return cetl::nullopt; };
+
+    auto r_a = rgy.route("a", getter, setter, {true});
+    auto r_b = rgy.route("b", getter, setter, {true});
+    auto r_c = rgy.route("c", getter, setter, {true});
+
+    // New registers are dirty, so all of them are saved at least once.
+    EXPECT_TRUE(r_a.isDirty());
+    EXPECT_TRUE(rgy.isDirty("a"));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"a"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"b"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"c"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_FALSE(rgy.isDirty("a"));
+    EXPECT_FALSE(rgy.isDirty("unknown"));
+
+    // Nothing has changed - nothing to save.
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+
+    // Only changed registers are saved.
+    EXPECT_THAT(rgy.set("b", makeUInt8Value({0x13})), Eq(cetl::nullopt));
+    EXPECT_TRUE(r_b.isDirty());
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"b"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_b.isDirty());
+
+    // Registers changed directly (bypassing the registry) are not marked as dirty.
+    EXPECT_THAT(r_a.set(makeUInt8Value({0x13})), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+
+    // Failed to save registers stay dirty, and so are retried on the next save.
+    EXPECT_THAT(rgy.set("a", makeUInt8Value({0x13})), Eq(cetl::nullopt));
+    EXPECT_THAT(rgy.getHandle("c").set(makeUInt8Value({0x13})), Eq(cetl::nullopt));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"a"}, _)).WillOnce(Return(StorageError::IO));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Optional(StorageError::IO));
+    EXPECT_TRUE(r_a.isDirty());
+    EXPECT_TRUE(r_c.isDirty());
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"a"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_CALL(key_value_mock, put(IRegister::Name{"c"}, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(saveDirty(key_value_mock, rgy), Eq(cetl::nullopt));
+
+    // Successfully loaded registers are clean.
+    r_b.setDirty(true);
+    EXPECT_CALL(key_value_mock, get(_, _)).WillRepeatedly(Return(StorageError::Existence));
+    EXPECT_CALL(key_value_mock, get(IRegister::Name{"b"}, _))  //
+        .WillOnce(Invoke([](const auto, const auto s) {
+            s[0] = IRegister::Value::VariantType::IndexOf::natural8;
+            return 1UL;
+        }));
+    EXPECT_THAT(load(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_b.isDirty());
+
+    // Full save saves all registers (regardless of registry constness), and leaves their dirty flags untouched.
+    r_b.setDirty(true);
+    EXPECT_CALL(key_value_mock, put(_, _)).Times(3).WillRepeatedly(Return(cetl::nullopt));
+    EXPECT_THAT(save(key_value_mock, rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_TRUE(r_b.isDirty());
+    const Registry& const_rgy = rgy;
+    EXPECT_CALL(key_value_mock, put(_, _)).Times(3).WillRepeatedly(Return(cetl::nullopt));
+    EXPECT_THAT(save(key_value_mock, const_rgy), Eq(cetl::nullopt));
+    EXPECT_FALSE(r_a.isDirty());
+    EXPECT_TRUE(r_b.isDirty());
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, bugprone-unchecked-optional-access)
 
 }  // namespace
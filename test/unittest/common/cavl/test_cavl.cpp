@@ -85,6 +85,52 @@ using MyTree = cavl::Tree<My>;
 static_assert(std::is_same<My::TreeType, MyTree>::value, "");
 static_assert(std::is_same<cavl::Node<My>, MyTree::NodeType>::value, "");
 
+/// The same as `My` but with subtree size augmentation (aka order-statistic tree).
+class MySized : public cavl::Node<MySized, cavl::SubtreeSizeAugmentation>
+{
+public:
+    MySized() = default;
+    explicit MySized(const std::uint16_t v)
+        : value(v)
+    {
+    }
+    using Self = Node;
+    using Self::isLinked;
+    using Self::isRoot;
+    using Self::getChildNode;
+    using Self::getParentNode;
+    using Self::getNextInOrderNode;
+    using Self::getBalanceFactor;
+    using Self::getSubtreeSize;
+    using Self::getNodeAt;
+    using Self::search;
+    using Self::remove;
+    using Self::traverseInOrder;
+    using Self::traversePostOrder;
+    using Self::min;
+    using Self::max;
+
+    NODISCARD auto getValue() const -> std::uint16_t
+    {
+        return value;
+    }
+
+private:
+    std::uint16_t value = 0;
+
+    // See `My` for the purpose of these dummy fields.
+    using E = struct
+    {};
+    UNUSED E up;
+    UNUSED E lr;
+    UNUSED E bf;
+    UNUSED E subtree_size;
+};
+using MySizedTree = cavl::Tree<MySized, cavl::SubtreeSizeAugmentation>;
+static_assert(std::is_same<MySized::TreeType, MySizedTree>::value, "");
+static_assert(std::is_same<cavl::Node<MySized, cavl::SubtreeSizeAugmentation>, MySizedTree::NodeType>::value, "");
+static_assert(sizeof(cavl::Node<My>) == (sizeof(void*) * 4), "Default policy should not increase the node size.");
+
 template <typename T>
 using N = typename cavl::Node<T>::DerivedType;
 static_assert(std::is_same<My, N<My>>::value, "");
@@ -213,8 +259,44 @@ NODISCARD const N<T>* findBrokenBalanceFactor(const N<T>* const n)  // NOLINT(mi
     return nullptr;
 }
 
+/// Returns the node with inconsistent subtree size (if any).
+/// Always nullptr for trees without the subtree size augmentation.
+template <typename T>
+// NOLINTNEXTLINE(misc-no-recursion)
+NODISCARD const N<T>* findBrokenSubtreeSize(const N<T>* const n, std::true_type /*unused*/)
+{
+    if (n != nullptr)
+    {
+        const std::size_t expected_size = 1U + T::getSubtreeSize(n->getChildNode(false))  //
+                                          + T::getSubtreeSize(n->getChildNode(true));
+        if (T::getSubtreeSize(n) != expected_size)
+        {
+            return n;
+        }
+        for (const bool v : {true, false})
+        {
+            if (auto* const p = findBrokenSubtreeSize<T>(n->getChildNode(v), std::true_type{}))
+            {
+                return p;
+            }
+        }
+    }
+    return nullptr;
+}
+template <typename T>
+NODISCARD const N<T>* findBrokenSubtreeSize(const N<T>* const /*unused*/, std::false_type /*unused*/)
+{
+    return nullptr;
+}
 template <typename T>
-NODISCARD auto toGraphviz(const cavl::Tree<T>& tr) -> std::string
+NODISCARD const N<T>* findBrokenSubtreeSize(const N<T>* const n)
+{
+    using HasSubtreeSize = std::is_same<typename T::AugmentationType, cavl::SubtreeSizeAugmentation>;
+    return findBrokenSubtreeSize<T>(n, HasSubtreeSize{});
+}
+
+template <typename TreeT>
+NODISCARD auto toGraphviz(const TreeT& tr) -> std::string
 {
     std::ostringstream ss;
     ss << "// Feed the following text to Graphviz, or use an online UI like https://edotor.net/\n"
@@ -222,13 +304,13 @@ NODISCARD auto toGraphviz(const cavl::Tree<T>& tr) -> std::string
        << "node[style=filled,shape=circle,fontcolor=white,penwidth=0,fontname=\"monospace\",fixedsize=1,fontsize=18];\n"
        << "edge[arrowhead=none,penwidth=2];\n"
        << "nodesep=0.0;ranksep=0.3;splines=false;\n";
-    tr.traverseInOrder([&](const typename cavl::Tree<T>::DerivedType& x) {
+    tr.traverseInOrder([&](const typename TreeT::DerivedType& x) {
         const char* const fill_color =  // NOLINTNEXTLINE(*-avoid-nested-conditional-operator)
             (x.getBalanceFactor() == 0) ? "black" : ((x.getBalanceFactor() > 0) ? "orange" : "blue");
         ss << x.getValue() << "[fillcolor=" << fill_color << "];";
     });
     ss << "\n";
-    tr.traverseInOrder([&](const typename cavl::Tree<T>::DerivedType& x) {
+    tr.traverseInOrder([&](const typename TreeT::DerivedType& x) {
         if (const auto* const ch = x.getChildNode(false))
         {
             ss << x.getValue() << ":sw->" << ch->getValue() << ":n;";
@@ -285,6 +367,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
         EXPECT_TRUE(!tr.empty());
         EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
         EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+        EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
         EXPECT_TRUE(checkOrdering<N>(tr) < std::numeric_limits<std::size_t>::max());
     };
     // Insert out of order to cover more branches in the insertion method.
@@ -302,6 +385,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     std::cout << toGraphviz(tr) << std::endl;
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(31, checkOrdering<N>(tr));
     // Check composition -- ensure that every element is in the tree and it is there exactly once.
     {
@@ -374,6 +458,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[26], t[28], {Zzzzz, t[27]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(30, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[24]->isRoot());
@@ -399,6 +484,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[28], t[26], {t[27], t[30]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(29, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[25]->isRoot());
@@ -425,6 +511,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[28], t[30], {Zzzzz, t[29]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(28, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[26]->isRoot());
@@ -450,6 +537,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[22], t[21], {Zzzzz, t[23]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(27, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[20]->isRoot());
@@ -475,6 +563,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[30], t[28], {t[29], t[31]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(26, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[27]->isRoot());
@@ -500,6 +589,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[30], t[29], {Zzzzz, t[31]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(25, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[28]->isRoot());
@@ -539,6 +629,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[16], Zzzzz, {t[8], t[21]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(24, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[29]->isRoot());
@@ -563,6 +654,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[10], t[12], {Zzzz, t[11]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(23, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[8]->isRoot());
@@ -587,6 +679,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[12], t[10], {t[11], t[14]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(22, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[9]->isRoot());
@@ -610,6 +703,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[2], t[4], {Zzzz, t[3]}, +1));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(21, checkOrdering<N>(tr));
     EXPECT_TRUE(t[16]->isRoot());
     EXPECT_FALSE(t[1]->isRoot());
@@ -637,6 +731,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[10], t[21]}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(20, checkOrdering<N>(tr));
     EXPECT_TRUE(t[17]->isRoot());
     EXPECT_FALSE(t[16]->isRoot());
@@ -661,6 +756,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_TRUE(checkLinkage<N>(t[23], t[30], {Zzzzz, Zzzzz}, 00));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(19, checkOrdering<N>(tr));
     EXPECT_TRUE(t[17]->isRoot());
     EXPECT_FALSE(t[22]->isRoot());
@@ -705,6 +801,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(7, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[10], t[21]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[10], t[17], {t[+4], t[12]}, 00));
@@ -735,6 +832,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(5, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[12], t[30]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[12], t[17], {t[+4], Zzzzz}, -1));
@@ -765,6 +863,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[17], static_cast<N*>(tr));  // Same root.
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(3, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[17], Zzzzz, {t[+4], t[30]}, 00));
     EXPECT_TRUE(checkLinkage<N>(t[30], t[17], {Zzzzz, Zzzzz}, 00));
@@ -792,6 +891,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[30], static_cast<N*>(tr));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(2, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[30], Zzzzz, {t[+4], Zzzzz}, -1));
     EXPECT_TRUE(checkLinkage<N>(t[+4], t[30], {Zzzzz, Zzzzz}, 00));
@@ -814,6 +914,7 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     EXPECT_EQ(t[+4], static_cast<N*>(tr));
     EXPECT_EQ(nullptr, findBrokenBalanceFactor<N>(tr));
     EXPECT_EQ(nullptr, findBrokenAncestry<N>(tr));
+    EXPECT_EQ(nullptr, findBrokenSubtreeSize<N>(tr));
     EXPECT_EQ(1, checkOrdering<N>(tr));
     EXPECT_TRUE(checkLinkage<N>(t[+4], Zzzzz, {Zzzzz, Zzzzz}, 00));
     EXPECT_EQ(t.at(4), tr.min());
@@ -864,16 +965,17 @@ void testManual(const std::function<N*(std::uint8_t)>& factory, const std::funct
     }
 }
 
-TEST(TestCavl, randomized)
+template <typename T>
+void testRandomized()
 {
-    std::array<std::shared_ptr<My>, 256> t{};
+    std::array<std::shared_ptr<T>, 256> t{};
     for (std::uint8_t i = 0U; i < 255U; i++)
     {
-        t.at(i) = std::make_shared<My>(i);
+        t.at(i) = std::make_shared<T>(i);
     }
     std::array<bool, 256> mask{};
     std::size_t           size = 0;
-    typename My::TreeType root;
+    typename T::TreeType  root;
     std::uint64_t         cnt_addition = 0;
     std::uint64_t         cnt_removal  = 0;
 
@@ -881,22 +983,38 @@ TEST(TestCavl, randomized)
         EXPECT_EQ(size, std::accumulate(mask.begin(), mask.end(), 0U, [](const std::size_t a, const std::size_t b) {
                       return a + b;
                   }));
-        EXPECT_EQ(nullptr, findBrokenBalanceFactor<My>(root));
-        EXPECT_EQ(nullptr, findBrokenAncestry<My>(root));
-        EXPECT_EQ(size, checkOrdering<My>(root));
+        EXPECT_EQ(nullptr, findBrokenBalanceFactor<T>(root));
+        EXPECT_EQ(nullptr, findBrokenAncestry<T>(root));
+        EXPECT_EQ(nullptr, findBrokenSubtreeSize<T>(root));
+        EXPECT_EQ(size, checkOrdering<T>(root));
         std::array<bool, 256> new_mask{};
-        root.traverseInOrder([&](const My& node) { new_mask.at(node.getValue()) = true; });
+        root.traverseInOrder([&](const T& node) { new_mask.at(node.getValue()) = true; });
         EXPECT_EQ(mask, new_mask);  // Otherwise, the contents of the tree does not match our expectations.
+        EXPECT_EQ(size, root.size());
+        // Check that indexing (in the middle, and out of bounds) agrees with the mask.
+        const std::size_t index    = size / 2U;
+        std::size_t       counter  = 0;
+        const T*          expected = nullptr;
+        for (std::size_t value = 0; value < mask.size(); value++)
+        {
+            if (mask.at(value) && (counter++ == index))
+            {
+                expected = t.at(value).get();
+                break;
+            }
+        }
+        EXPECT_EQ(expected, root[index]);
+        EXPECT_EQ(nullptr, root[size]);
     };
     validate();
 
     const auto add = [&](const std::uint8_t x) {
-        const auto predicate = [&](const My& v) { return x - v.getValue(); };
-        if (My* const existing = root.search(predicate))
+        const auto predicate = [&](const T& v) { return x - v.getValue(); };
+        if (T* const existing = root.search(predicate))
         {
             EXPECT_TRUE(mask.at(x));
             EXPECT_EQ(x, existing->getValue());
-            auto result = root.search(predicate, []() -> My* {
+            auto result = root.search(predicate, []() -> T* {
                 EXPECT_FALSE(true) << "Attempted to create a new node when there is one already";
                 return nullptr;
             });
@@ -907,7 +1025,7 @@ TEST(TestCavl, randomized)
         {
             EXPECT_FALSE(mask.at(x));
             bool factory_called = false;
-            auto result         = root.search(predicate, [&]() -> My* {
+            auto result         = root.search(predicate, [&]() -> T* {
                 factory_called = true;
                 return t.at(x).get();
             });
@@ -921,8 +1039,8 @@ TEST(TestCavl, randomized)
     };
 
     const auto drop = [&](const std::uint8_t x) {
-        const auto predicate = [&](const My& v) { return x - v.getValue(); };
-        if (My* const existing = root.search(predicate))
+        const auto predicate = [&](const T& v) { return x - v.getValue(); };
+        if (T* const existing = root.search(predicate))
         {
             EXPECT_TRUE(mask.at(x));
             EXPECT_EQ(x, existing->getValue());
@@ -962,6 +1080,16 @@ TEST(TestCavl, randomized)
     validate();
 }
 
+TEST(TestCavl, randomized)
+{
+    testRandomized<My>();
+}
+
+TEST(TestCavl, randomizedSubtreeSize)
+{
+    testRandomized<MySized>();
+}
+
 TEST(TestCavl, manualMy)
 {
     static_assert(!std::is_copy_assignable<My>::value, "Should not be copy assignable.");
@@ -989,6 +1117,21 @@ TEST(TestCavl, manualMy)
         });
 }
 
+TEST(TestCavl, manualMySized)
+{
+    testManual<MySized>(
+        [](const std::uint16_t x) {
+            return new MySized(x);  // NOLINT
+        },
+        [](MySized* const old_node) {
+            const auto     value    = old_node->getValue();
+            MySized* const new_node = new MySized(std::move(*old_node));  // NOLINT(*-owning-memory)
+            EXPECT_EQ(value, new_node->getValue());
+            delete old_node;  // NOLINT(*-owning-memory)
+            return new_node;
+        });
+}
+
 /// Ensure that polymorphic types can be used with the tree. The tree node type itself is not polymorphic!
 class V : public cavl::Node<V>
 {
@@ -0,0 +1,186 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <libcyphal/common/pairing_heap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::common::PairingHeap;
+using libcyphal::common::PairingHeapNode;
+
+using testing::ElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class MyNode final : public PairingHeapNode<MyNode>
+{
+public:
+    explicit MyNode(const std::uint32_t value)
+        : value_{value}
+    {
+    }
+
+    MyNode(MyNode&& other) noexcept = default;
+
+    using PairingHeapNode::isLinked;
+
+    std::uint32_t getValue() const noexcept
+    {
+        return value_;
+    }
+
+    struct Less
+    {
+        bool operator()(const MyNode& lhs, const MyNode& rhs) const noexcept
+        {
+            return lhs.value_ < rhs.value_;
+        }
+    };
+
+private:
+    std::uint32_t value_;
+
+};  // MyNode
+
+using MyHeap = PairingHeap<MyNode, MyNode::Less>;
+
+std::vector<std::uint32_t> drain(MyHeap& heap)
+{
+    std::vector<std::uint32_t> values;
+    while (auto* const node = heap.min())
+    {
+        values.push_back(node->getValue());
+        heap.remove(*node);
+        EXPECT_FALSE(node->isLinked());
+    }
+    return values;
+}
+
+TEST(TestPairingHeap, empty)
+{
+    MyHeap heap;
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(nullptr, heap.min());
+
+    // Removal of unlinked node should have no effect.
+    MyNode node{13};
+    heap.remove(node);
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST(TestPairingHeap, insert_min_remove)
+{
+    MyNode n5{5};
+    MyNode n3{3};
+    MyNode n7{7};
+    MyNode n1{1};
+    MyNode n4{4};
+
+    MyHeap heap;
+    heap.insert(n5);
+    EXPECT_EQ(&n5, heap.min());
+    heap.insert(n3);
+    EXPECT_EQ(&n3, heap.min());
+    heap.insert(n7);
+    EXPECT_EQ(&n3, heap.min());
+    heap.insert(n1);
+    EXPECT_EQ(&n1, heap.min());
+    heap.insert(n4);
+    EXPECT_EQ(&n1, heap.min());
+    EXPECT_FALSE(heap.empty());
+
+    // Remove some non-min node.
+    heap.remove(n4);
+    EXPECT_FALSE(n4.isLinked());
+    EXPECT_EQ(&n1, heap.min());
+
+    // Re-insert it back.
+    heap.insert(n4);
+
+    EXPECT_THAT(drain(heap), ElementsAre(1, 3, 4, 5, 7));
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST(TestPairingHeap, move_linked_nodes)
+{
+    std::vector<MyNode> nodes;
+    nodes.reserve(3);
+    nodes.emplace_back(20);
+    nodes.emplace_back(10);
+    nodes.emplace_back(30);
+
+    MyHeap heap;
+    for (auto& node : nodes)
+    {
+        heap.insert(node);
+    }
+    EXPECT_EQ(&nodes[1], heap.min());
+
+    // Move the root node - the heap should follow it.
+    MyNode moved_root{std::move(nodes[1])};
+    EXPECT_FALSE(nodes[1].isLinked());
+    EXPECT_TRUE(moved_root.isLinked());
+    EXPECT_EQ(&moved_root, heap.min());
+
+    // Move a non-root node.
+    MyNode moved_child{std::move(nodes[2])};
+    EXPECT_FALSE(nodes[2].isLinked());
+    EXPECT_TRUE(moved_child.isLinked());
+
+    EXPECT_THAT(drain(heap), ElementsAre(10, 20, 30));
+}
+
+TEST(TestPairingHeap, randomized)
+{
+    constexpr std::size_t Count = 2000;
+
+    std::mt19937                                 rnd{42};  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+    std::uniform_int_distribution<std::uint32_t> dist{0, 500};
+
+    std::vector<MyNode> nodes;
+    nodes.reserve(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        nodes.emplace_back(dist(rnd));
+    }
+
+    MyHeap heap;
+    for (auto& node : nodes)
+    {
+        heap.insert(node);
+    }
+
+    // Remove every third node in some arbitrary order.
+    std::vector<std::uint32_t> expected;
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        if ((i % 3) == 0)
+        {
+            heap.remove(nodes[Count - i - 1]);
+        }
+        else
+        {
+            expected.push_back(nodes[Count - i - 1].getValue());
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_EQ(expected, drain(heap));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -19,6 +19,7 @@
 #include <libcyphal/config.hpp>
 #include <libcyphal/errors.hpp>
 #include <libcyphal/presentation/client.hpp>
+#include <libcyphal/presentation/client_statistics.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/response_promise.hpp>
 #include <libcyphal/transport/errors.hpp>
@@ -32,6 +33,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <string>
@@ -53,8 +56,10 @@ using testing::Eq;
 using testing::Invoke;
 using testing::Return;
 using testing::IsEmpty;
+using testing::Contains;
 using testing::NotNull;
 using testing::NiceMock;
+using testing::Field;
 using testing::Optional;
 using testing::FieldsAre;
 using testing::StrictMock;
@@ -63,8 +68,10 @@ using testing::VariantWith;
 
 // https://github.com/llvm/llvm-project/issues/53444
 // NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""h;
 using std::literals::chrono_literals::operator""s;
 using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
 // NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, *-function-cognitive-complexity)
@@ -264,6 +271,69 @@ TEST_F(TestClient, request_response_get_fetch_result)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestClient, request_with_attached_serialization_buffer)
+{
+    using Service       = uavcan::node::GetInfo_1_0;
+    using SvcResPromise = ResponsePromise<Service::Response>;
+
+    // Force serialization buffer to be bigger than "small" payload, so that normally it's PMR allocated.
+    constexpr auto BufferSize = libcyphal::config::Presentation::SmallPayloadSize() + 1;
+
+    constexpr ResponseRxParams rx_params{Service::Response::_traits_::ExtentBytes,
+                                         Service::Request::_traits_::FixedPortId,
+                                         0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient<Service>(rx_params.server_node_id);
+    ASSERT_THAT(maybe_client, VariantWith<ServiceClient<Service>>(_));
+    cetl::optional<ServiceClient<Service>> client = cetl::get<ServiceClient<Service>>(std::move(maybe_client));
+
+    std::array<cetl::byte, BufferSize> buffer{};
+    client->setSerializationBuffer(buffer);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(state.req_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), buffer.data());
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        const auto maybe_promise   = client->request<BufferSize>(now() + 100ms, Service::Request{mr_alloc_});
+        EXPECT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Too small buffer is ignored.
+        client->setSerializationBuffer(cetl::span<cetl::byte>{buffer.data(), BufferSize - 1});
+
+        EXPECT_CALL(state.req_tx_session_mock_, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), testing::Ne(buffer.data()));
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        const auto maybe_promise   = client->request<BufferSize>(now() + 100ms, Service::Request{mr_alloc_});
+        EXPECT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes + BufferSize);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        client.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
 TEST_F(TestClient, request_response_via_callabck)
 {
     using Service       = uavcan::node::GetInfo_1_0;
@@ -479,6 +549,7 @@ TEST_F(TestClient, request_response_failures)
     auto maybe_client = presentation.makeClient<Service>(rx_params.server_node_id, rx_params.service_id);
     ASSERT_THAT(maybe_client, VariantWith<ServiceClient<Service>>(_));
     cetl::optional<ServiceClient<Service>> client = cetl::get<ServiceClient<Service>>(std::move(maybe_client));
+    EXPECT_THAT(client->enableStatistics(), Eq(cetl::nullopt));
 
     constexpr TransferId          transfer_id = 0;
     cetl::optional<SvcResPromise> response_promise;
@@ -576,6 +647,13 @@ TEST_F(TestClient, request_response_failures)
     });
     scheduler_.scheduleAt(9s, [&](const auto&) {
         //
+        // Both memory and nunavut errors are counted as deserialization failures.
+        const auto statistics = client->getStatistics();
+        ASSERT_THAT(statistics, Optional(_));
+        EXPECT_THAT(statistics->responses, 2);
+        EXPECT_THAT(statistics->deserialization_failures, 2);
+        EXPECT_THAT(statistics->timeouts, 0);
+
         client.reset();
         response_promise.reset();
     });
@@ -829,6 +907,335 @@ TEST_F(TestClient, raw_request_response_failures)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestClient, raw_request_response_statistics)
+{
+    using SvcResPromise = ResponsePromise<void>;
+
+    constexpr ResponseRxParams rx_params{4, 147, 0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient(rx_params.server_node_id, rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    cetl::optional<RawServiceClient> client = cetl::get<RawServiceClient>(std::move(maybe_client));
+
+    EXPECT_THAT(client->getStatistics(), Eq(cetl::nullopt));
+    EXPECT_THAT(client->enableStatistics(), Eq(cetl::nullopt));
+    ASSERT_THAT(client->getStatistics(), Optional(_));
+    EXPECT_THAT(client->getStatistics()->responses, 0);
+
+    std::array<cetl::optional<SvcResPromise>, 3> response_promises;
+
+    EXPECT_CALL(state.req_tx_session_mock_, send(_, _)).WillRepeatedly(Return(cetl::nullopt));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        for (std::size_t i = 0; i < response_promises.size(); ++i)
+        {
+            auto maybe_promise = client->request(now() + 100ms, {}, now() + 500ms + static_cast<int>(i / 2) * 1s);
+            ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+            response_promises[i].emplace(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+        }
+    });
+    scheduler_.scheduleAt(1s + 3ms, [&](const auto&) {
+        //
+        ServiceRxTransfer transfer{{{{0, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // Duplicate of the 1st response.
+        ServiceRxTransfer transfer{{{{0, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+    });
+    scheduler_.scheduleAt(1s + 700ms, [&](const auto&) {
+        //
+        // Response to the 3rd request; the 2nd one has already expired.
+        ServiceRxTransfer transfer{{{{2, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+        EXPECT_THAT(response_promises[1]->getResult(), Optional(VariantWith<RawResponsePromiseFailure>(_)));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        const auto statistics = client->getStatistics();
+        ASSERT_THAT(statistics, Optional(_));
+        EXPECT_THAT(statistics->responses, 2);
+        EXPECT_THAT(statistics->timeouts, 1);
+        EXPECT_THAT(statistics->deserialization_failures, 0);
+        EXPECT_THAT(statistics->late_or_duplicate_responses, 1);
+        EXPECT_THAT(statistics->in_flight_high_water_mark, 3);
+        for (std::size_t i = 0; i < statistics->rtt_histogram.size(); ++i)
+        {
+            // 3ms (3000us) falls into [2^11, 2^12) bin, and 700ms (700000us) falls into [2^19, 2^20) one.
+            EXPECT_THAT(statistics->rtt_histogram[i], ((i == 12) || (i == 20)) ? 1 : 0) << "Bin #" << i;
+        }
+
+        client->disableStatistics();
+        EXPECT_THAT(client->getStatistics(), Eq(cetl::nullopt));
+
+        response_promises = {};
+        client.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestClient, statistics_rtt_histogram_bins)
+{
+    constexpr auto LastBinIndex = ClientStatistics::RttHistogramBinsCount - 1;
+
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(-1s), 0);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(0s), 0);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(1us), 1);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(2us), 2);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(3us), 2);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(4us), 3);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(1ms), 10);
+    EXPECT_THAT(ClientStatistics::getRttHistogramBinIndex(1h), LastBinIndex);
+}
+
+TEST_F(TestClient, raw_request_response_transfer_id_reuse)
+{
+    using SvcResPromise = ResponsePromise<void>;
+
+    constexpr ResponseRxParams rx_params{4, 147, 0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    // Emulate that transport supports only 2 concurrent transfers by having module equal to 2^1.
+    EXPECT_CALL(transport_mock_, getProtocolParams()).WillRepeatedly(Return(ProtocolParams{2, 0, 0}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient(rx_params.server_node_id, rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    cetl::optional<RawServiceClient> client = cetl::get<RawServiceClient>(std::move(maybe_client));
+
+    cetl::optional<SvcResPromise> response_promise1;
+    cetl::optional<SvcResPromise> response_promise2;
+    cetl::optional<SvcResPromise> response_promise3;
+
+    EXPECT_CALL(state.req_tx_session_mock_, send(_, _)).WillRepeatedly(Return(cetl::nullopt));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        auto maybe_promise1 = client->request(now() + 100ms, {});
+        ASSERT_THAT(maybe_promise1, VariantWith<SvcResPromise>(_));
+        response_promise1.emplace(cetl::get<SvcResPromise>(std::move(maybe_promise1)));
+
+        auto maybe_promise2 = client->request(now() + 100ms, {});
+        ASSERT_THAT(maybe_promise2, VariantWith<SvcResPromise>(_));
+        response_promise2.emplace(cetl::get<SvcResPromise>(std::move(maybe_promise2)));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Response to the first request releases its transfer id (#0)...
+        ServiceRxTransfer transfer{{{{0, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+        EXPECT_THAT(response_promise1->getResult(), Optional(VariantWith<SvcResPromise::Success>(_)));
+
+        // ... so that it could be reused by the next request.
+        auto maybe_promise3 = client->request(now() + 100ms, {});
+        ASSERT_THAT(maybe_promise3, VariantWith<SvcResPromise>(_));
+        response_promise3.emplace(cetl::get<SvcResPromise>(std::move(maybe_promise3)));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        // Destruction of the already fulfilled promise should not release transfer id #0 (now in use by the 3rd).
+        response_promise1.reset();
+
+        const auto maybe_promise4 = client->request(now() + 100ms, {});
+        EXPECT_THAT(maybe_promise4,
+                    VariantWith<RawServiceClient::Failure>(
+                        VariantWith<RawServiceClient::TooManyPendingRequestsError>(_)));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        response_promise2.reset();
+        response_promise3.reset();
+        client.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestClient, raw_request_response_queued)
+{
+    using SvcResPromise = ResponsePromise<void>;
+
+    constexpr ResponseRxParams rx_params{4, 147, 0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    // Emulate that transport supports only 2 concurrent transfers by having module equal to 2^1.
+    EXPECT_CALL(transport_mock_, getProtocolParams()).WillRepeatedly(Return(ProtocolParams{2, 0, 0}));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient(rx_params.server_node_id, rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    cetl::optional<RawServiceClient> client = cetl::get<RawServiceClient>(std::move(maybe_client));
+    EXPECT_THAT(client->getRequestQueueCapacity(), 0);
+    client->setRequestQueueCapacity(2);
+    EXPECT_THAT(client->getRequestQueueCapacity(), 2);
+
+    std::vector<std::tuple<TransferId, TimePoint, std::size_t>> requests;
+    EXPECT_CALL(state.req_tx_session_mock_, send(_, _))  //
+        .WillRepeatedly(Invoke([this, &requests](const auto& metadata, const auto fragments) {
+            //
+            std::size_t payload_size = 0;
+            for (const auto fragment : fragments)
+            {
+                payload_size += fragment.size();
+            }
+            requests.emplace_back(metadata.base.transfer_id, now(), payload_size);
+            return cetl::nullopt;
+        }));
+
+    std::array<cetl::optional<SvcResPromise>, 4>               response_promises;
+    std::vector<std::tuple<std::string, TimePoint, TimePoint>> responses;
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        const std::array<cetl::byte, 3>                         payload{};
+        const std::array<const cetl::span<const cetl::byte>, 1> fragments{payload};
+
+        for (std::size_t i = 0; i < response_promises.size(); ++i)
+        {
+            auto maybe_promise = client->request(now() + static_cast<int>(i + 1) * 100ms, fragments, now() + 1s);
+            ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+            response_promises[i].emplace(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+            response_promises[i]->setCallback([&responses, i](const auto& arg) {
+                //
+                if (nullptr != cetl::get_if<SvcResPromise::Success>(&arg.result))
+                {
+                    responses.emplace_back("success#" + std::to_string(i), TimePoint{}, arg.approx_now);
+                    return;
+                }
+                auto failure = cetl::get<RawResponsePromiseFailure>(std::move(arg.result));
+                auto expired = cetl::get<ResponsePromiseExpired>(std::move(failure));
+                responses.emplace_back("expired#" + std::to_string(i), expired.deadline, arg.approx_now);
+            });
+        }
+        // First two requests are sent immediately, the rest are queued.
+        EXPECT_THAT(requests, ElementsAre(FieldsAre(0, now(), 3), FieldsAre(1, now(), 3)));
+
+        // No more room in the queue.
+        const auto maybe_promise = client->request(now() + 100ms, fragments);
+        EXPECT_THAT(maybe_promise,
+                    VariantWith<RawServiceClient::Failure>(
+                        VariantWith<RawServiceClient::TooManyPendingRequestsError>(_)));
+    });
+    scheduler_.scheduleAt(1s + 200ms, [&](const auto&) {
+        //
+        // Response to the second request releases its transfer id, so the 3rd request could be sent.
+        ServiceRxTransfer transfer{{{{1, Priority::Nominal}, now()}, 0x31}, {}};
+        state.res_rx_cb_fn_({transfer});
+    });
+    scheduler_.scheduleAt(1s + 500ms, [&](const auto&) {
+        //
+        EXPECT_THAT(requests,
+                    ElementsAre(FieldsAre(0, TimePoint{1s}, 3),
+                                FieldsAre(1, TimePoint{1s}, 3),
+                                FieldsAre(1, TimePoint{1s + 200ms}, 3)));
+
+        // Cancel the 1st request - its transfer id is released as well, but the 4th request is already expired.
+        response_promises[0].reset();
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        response_promises = {};
+        client.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(requests, testing::SizeIs(3));
+    EXPECT_THAT(responses,
+                ElementsAre(FieldsAre("success#1", TimePoint{}, TimePoint{1s + 200ms}),
+                            FieldsAre("expired#3", TimePoint{1s + 400ms}, TimePoint{1s + 400ms}),
+                            FieldsAre("expired#2", TimePoint{2s}, TimePoint{2s})));
+}
+
+TEST_F(TestClient, raw_many_requests_responses_expired)
+{
+    using SvcResPromise = ResponsePromise<void>;
+
+    constexpr std::size_t      Count = 1024;
+    constexpr ResponseRxParams rx_params{4, 147, 0x31};
+
+    State state{mr_, transport_mock_, rx_params};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    auto maybe_client = presentation.makeClient(rx_params.server_node_id, rx_params.service_id, rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    cetl::optional<RawServiceClient> client = cetl::get<RawServiceClient>(std::move(maybe_client));
+
+    struct Outcome
+    {
+        std::vector<TransferId> succeeded;
+        std::vector<TimePoint>  expired;
+    };
+    Outcome outcome;
+
+    std::vector<SvcResPromise> response_promises;
+    response_promises.reserve(Count);
+
+    EXPECT_CALL(state.req_tx_session_mock_, send(_, _)).WillRepeatedly(Return(cetl::nullopt));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            // Deadlines are intentionally not monotonic.
+            const auto response_deadline = now() + 2s + static_cast<int>((i * 7) % 13) * 10ms;
+
+            auto maybe_promise = client->request(now() + 100ms, {}, response_deadline);
+            ASSERT_THAT(maybe_promise, VariantWith<SvcResPromise>(_));
+            response_promises.emplace_back(cetl::get<SvcResPromise>(std::move(maybe_promise)));
+            response_promises.back().setCallback([&outcome](const auto& arg) {
+                //
+                if (const auto* const success = cetl::get_if<SvcResPromise::Success>(&arg.result))
+                {
+                    outcome.succeeded.push_back(success->metadata.rx_meta.base.transfer_id);
+                    return;
+                }
+                ASSERT_THAT(arg.result, VariantWith<ResponsePromiseFailure>(VariantWith<ResponsePromiseExpired>(_)));
+                outcome.expired.push_back(arg.approx_now);
+            });
+        }
+
+        // Buckets of pending requests have grown (from PMR) to keep the lookup O(1).
+        EXPECT_THAT(mr_.allocations, Contains(Field(&TrackingMemoryResource::Allocation::size, Count * sizeof(void*))));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Respond (in reverse order) to every even request; the rest should expire.
+        for (std::size_t i = Count; i > 0; i -= 2)
+        {
+            const auto        transfer_id = static_cast<TransferId>(i - 2);
+            ServiceRxTransfer transfer{{{{transfer_id, Priority::Nominal}, now()}, 0x31}, {}};
+            state.res_rx_cb_fn_({transfer});
+        }
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        response_promises.clear();
+        client.reset();
+    });
+    scheduler_.spinFor(10s);
+
+    ASSERT_THAT(outcome.succeeded.size(), Count / 2);
+    for (std::size_t i = 0; i < outcome.succeeded.size(); ++i)
+    {
+        EXPECT_THAT(outcome.succeeded[i], Count - 2 * (i + 1));
+    }
+    ASSERT_THAT(outcome.expired.size(), Count / 2);
+    EXPECT_TRUE(std::is_sorted(outcome.expired.begin(), outcome.expired.end()));
+    EXPECT_THAT(outcome.expired.front(), TimePoint{3s});
+    EXPECT_THAT(outcome.expired.back(), TimePoint{3s + 120ms});
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, *-function-cognitive-complexity)
 
 }  // namespace
@@ -0,0 +1,159 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/presentation/deserialization_arena.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+using libcyphal::presentation::DeserializationArena;
+
+using testing::IsEmpty;
+using testing::SizeIs;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestDeserializationArena : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    bool isInBuffer(const void* const ptr) const
+    {
+        const auto* const byte_ptr = static_cast<const cetl::byte*>(ptr);
+        return (byte_ptr >= buffer_.data()) && (byte_ptr < buffer_.data() + buffer_.size());
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource                    mr_;
+    alignas(std::max_align_t) std::array<cetl::byte, 64> buffer_{};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestDeserializationArena, allocate_and_rewind)
+{
+    DeserializationArena arena{buffer_, mr_};
+    EXPECT_THAT(arena.getUsedBytes(), 0);
+    EXPECT_THAT(arena.getHighWaterMark(), 0);
+
+    void* const ptr1 = arena.allocate(10, 1);
+    void* const ptr2 = arena.allocate(8, 8);
+    EXPECT_TRUE(isInBuffer(ptr1));
+    EXPECT_TRUE(isInBuffer(ptr2));
+    EXPECT_THAT(reinterpret_cast<std::uintptr_t>(ptr2) % 8, 0);  // NOLINT
+    EXPECT_THAT(arena.getUsedBytes(), 16 + 8);
+    EXPECT_THAT(mr_.allocations, IsEmpty());
+
+    // Releasing not the last allocation doesn't rewind the arena...
+    arena.deallocate(ptr1, 10, 1);
+    EXPECT_THAT(arena.getUsedBytes(), 16 + 8);
+    void* const ptr3 = arena.allocate(4, 4);
+    EXPECT_TRUE(isInBuffer(ptr3));
+    EXPECT_THAT(arena.getUsedBytes(), 16 + 8 + 4);
+
+    // ... but releasing of all of them does.
+    arena.deallocate(ptr2, 8, 8);
+    arena.deallocate(ptr3, 4, 4);
+    EXPECT_THAT(arena.getUsedBytes(), 0);
+    EXPECT_THAT(arena.getHighWaterMark(), 16 + 8 + 4);
+    EXPECT_THAT(arena.getUpstreamAllocationsCount(), 0);
+
+    // The whole buffer is available again.
+    void* const ptr4 = arena.allocate(64, 1);
+    EXPECT_THAT(ptr4, buffer_.data());
+    arena.deallocate(ptr4, 64, 1);
+    EXPECT_THAT(arena.getHighWaterMark(), 64);
+}
+
+TEST_F(TestDeserializationArena, overflow_to_upstream)
+{
+    DeserializationArena arena{buffer_, mr_};
+
+    void* const ptr1 = arena.allocate(60, 1);
+    EXPECT_TRUE(isInBuffer(ptr1));
+
+    // Doesn't fit into the rest of the buffer.
+    void* const ptr2 = arena.allocate(8, 1);
+    EXPECT_FALSE(isInBuffer(ptr2));
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+    EXPECT_THAT(arena.getUpstreamAllocationsCount(), 1);
+
+    // Bigger than the whole buffer.
+    void* const ptr3 = arena.allocate(100, 1);
+    EXPECT_FALSE(isInBuffer(ptr3));
+    EXPECT_THAT(mr_.allocations, SizeIs(2));
+    EXPECT_THAT(arena.getUpstreamAllocationsCount(), 2);
+
+    // Upstream allocations don't prevent rewinding.
+    arena.deallocate(ptr1, 60, 1);
+    EXPECT_THAT(arena.getUsedBytes(), 0);
+
+    arena.deallocate(ptr2, 8, 1);
+    arena.deallocate(ptr3, 100, 1);
+    EXPECT_THAT(mr_.allocations, IsEmpty());
+}
+
+TEST_F(TestDeserializationArena, zero_sized)
+{
+    DeserializationArena arena{buffer_, mr_};
+
+    void* const ptr1 = arena.allocate(63, 1);
+    void* const ptr2 = arena.allocate(0, 1);
+    EXPECT_TRUE(isInBuffer(ptr2));
+    EXPECT_THAT(arena.getUsedBytes(), 64);
+
+    // No room left even for zero-sized allocation.
+    void* const ptr3 = arena.allocate(0, 1);
+    EXPECT_FALSE(isInBuffer(ptr3));
+
+    arena.deallocate(ptr3, 0, 1);
+    arena.deallocate(ptr2, 0, 1);
+    arena.deallocate(ptr1, 63, 1);
+    EXPECT_THAT(arena.getUsedBytes(), 0);
+}
+
+TEST_F(TestDeserializationArena, empty_buffer)
+{
+    DeserializationArena arena{{}, mr_};
+
+    void* const ptr = arena.allocate(1, 1);
+    EXPECT_THAT(ptr, testing::NotNull());
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+    EXPECT_THAT(arena.getUpstreamAllocationsCount(), 1);
+
+    arena.deallocate(ptr, 1, 1);
+}
+
+TEST_F(TestDeserializationArena, is_equal)
+{
+    DeserializationArena arena1{buffer_, mr_};
+    DeserializationArena arena2{buffer_, mr_};
+
+    EXPECT_TRUE(arena1.is_equal(arena1));
+    EXPECT_FALSE(arena1.is_equal(arena2));
+    EXPECT_FALSE(arena1.is_equal(mr_));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
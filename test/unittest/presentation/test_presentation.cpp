@@ -37,9 +37,12 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -53,6 +56,7 @@ using namespace libcyphal::transport;     // NOLINT This our main concern here i
 using testing::_;
 using testing::Eq;
 using testing::Invoke;
+using testing::ElementsAre;
 using testing::Return;
 using testing::IsEmpty;
 using testing::StrictMock;
@@ -798,6 +802,125 @@ TEST_F(TestPresentation, makeClient_with_failure)
     }
 }
 
+TEST_F(TestPresentation, forEachPort)
+{
+    StrictMock<MessageTxSessionMock>  msg_tx_session_mock;
+    StrictMock<MessageRxSessionMock>  msg_rx_session_mock;
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+    StrictMock<RequestRxSessionMock>  req_rx_session_mock;
+    StrictMock<ResponseRxSessionMock> res_rx_session_mock;
+    StrictMock<RequestTxSessionMock>  req_tx_session_mock;
+
+    constexpr MessageTxParams  msg_tx_params{147};
+    constexpr MessageRxParams  msg_rx_params{0, 148};
+    constexpr RequestRxParams  req_rx_params{16, 430};
+    constexpr ResponseRxParams res_rx_params{8, 431, 0x31};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(msg_tx_params));
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(msg_rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_)).Times(1);
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_)).WillRepeatedly(Return());
+    EXPECT_CALL(res_rx_session_mock, getParams()).WillOnce(Return(res_rx_params));
+    EXPECT_CALL(res_rx_session_mock, setTransferIdTimeout(_)).WillOnce(Return());
+    EXPECT_CALL(res_rx_session_mock, setOnReceiveCallback(_)).WillOnce(Return());
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                 //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeResponseRxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                 //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResRxSpec>(mr_, res_rx_session_mock);
+        }));
+    EXPECT_CALL(transport_mock_, makeRequestTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {                //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqTxSpec>(mr_, req_tx_session_mock);
+        }));
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    using Ports = std::vector<std::pair<PortKind, PortId>>;
+    const auto get_ports = [&presentation] {
+        Ports ports;
+        presentation.forEachPort([&ports](const PortKind kind, const PortId port_id) {  //
+            ports.emplace_back(kind, port_id);
+        });
+        return ports;
+    };
+    EXPECT_THAT(get_ports(), IsEmpty());
+    EXPECT_THAT(presentation.getPortsVersion(), 0);
+
+    cetl::optional<Publisher<void>> publisher;
+    {
+        auto maybe_pub = presentation.makePublisher<void>(msg_tx_params.subject_id);
+        ASSERT_THAT(maybe_pub, VariantWith<Publisher<void>>(_));
+        publisher.emplace(cetl::get<Publisher<void>>(std::move(maybe_pub)));
+    }
+    EXPECT_THAT(presentation.getPortsVersion(), 1);
+
+    // Another publisher to the same subject doesn't change the set of ports.
+    {
+        const auto publisher2 = *publisher;
+        EXPECT_THAT(presentation.getPortsVersion(), 1);
+    }
+
+    auto maybe_sub = presentation.makeSubscriber(msg_rx_params.subject_id, msg_rx_params.extent_bytes);
+    ASSERT_THAT(maybe_sub, VariantWith<Subscriber<void>>(_));
+    EXPECT_THAT(presentation.getPortsVersion(), 2);
+
+    cetl::optional<RawServiceServer> server;
+    {
+        auto maybe_server = presentation.makeServer(req_rx_params.service_id, req_rx_params.extent_bytes);
+        ASSERT_THAT(maybe_server, VariantWith<RawServiceServer>(_));
+        server.emplace(cetl::get<RawServiceServer>(std::move(maybe_server)));
+    }
+    EXPECT_THAT(presentation.getPortsVersion(), 3);
+
+    auto maybe_client = presentation.makeClient(  //
+        res_rx_params.server_node_id,
+        res_rx_params.service_id,
+        res_rx_params.extent_bytes);
+    ASSERT_THAT(maybe_client, VariantWith<RawServiceClient>(_));
+    EXPECT_THAT(presentation.getPortsVersion(), 4);
+
+    EXPECT_THAT(get_ports(),
+                ElementsAre(std::make_pair(PortKind::Publisher, PortId{147}),
+                            std::make_pair(PortKind::Subscriber, PortId{148}),
+                            std::make_pair(PortKind::Client, PortId{431}),
+                            std::make_pair(PortKind::Server, PortId{430})));
+
+    // Destruction of the server immediately removes its port.
+    EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+    server.reset();
+    EXPECT_THAT(presentation.getPortsVersion(), 5);
+
+    // Shared publisher is removed only after its deferred (via executor) destruction.
+    EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+    publisher.reset();
+    EXPECT_THAT(presentation.getPortsVersion(), 5);
+    scheduler_.spinFor(std::chrono::seconds{1});
+    EXPECT_THAT(presentation.getPortsVersion(), 6);
+    EXPECT_THAT(get_ports(),
+                ElementsAre(std::make_pair(PortKind::Subscriber, PortId{148}),
+                            std::make_pair(PortKind::Client, PortId{431})));
+
+    EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(req_tx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(res_rx_session_mock, deinit()).Times(1);
+}
+
 TEST_F(TestPresentation, tryDeserialize_coverage)
 {
     using namespace libcyphal::presentation::detail;  // NOLINT
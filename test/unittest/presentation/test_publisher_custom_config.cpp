@@ -13,6 +13,7 @@
 #include "virtual_time_scheduler.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 #include <libcyphal/config.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/publisher.hpp>
@@ -25,6 +26,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <utility>
 
 namespace
@@ -143,6 +145,73 @@ TEST_F(TestPublisherCustomConfig, publish_with_custom_buffer_size)
     scheduler_.spinFor(10s);
 }
 
+TEST_F(TestPublisherCustomConfig, publish_with_attached_serialization_buffer)
+{
+    using Message = uavcan::node::Heartbeat_1_0;
+
+    // Heartbeat message (7 bytes) is bigger than custom "small" payload (6 bytes), so normally it's PMR allocated.
+    constexpr auto BufferSize = Message::_traits_::SerializationBufferSizeBytes;
+    static_assert(BufferSize > libcyphal::config::Presentation::SmallPayloadSize(), "");
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    StrictMock<MessageTxSessionMock> msg_tx_session_mock;
+    constexpr MessageTxParams        tx_params{Message::_traits_::FixedPortId};
+    EXPECT_CALL(msg_tx_session_mock, getParams()).WillOnce(Return(tx_params));
+
+    EXPECT_CALL(transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, msg_tx_session_mock);
+        }));
+
+    auto maybe_pub = presentation.makePublisher<Message>(tx_params.subject_id);
+    ASSERT_THAT(maybe_pub, VariantWith<Publisher<Message>>(_));
+    cetl::optional<Publisher<Message>> publisher{cetl::get<Publisher<Message>>(std::move(maybe_pub))};
+
+    std::array<cetl::byte, BufferSize> buffer{};
+    publisher->setSerializationBuffer(buffer);
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), buffer.data());
+                EXPECT_THAT(fragments[0].size(), BufferSize);
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        EXPECT_THAT(publisher->publish(now() + 200ms, Message{&mr_}), Eq(cetl::nullopt));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Too small buffer is ignored.
+        publisher->setSerializationBuffer(cetl::span<cetl::byte>{buffer.data(), BufferSize - 1});
+
+        EXPECT_CALL(msg_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), testing::Ne(buffer.data()));
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        EXPECT_THAT(publisher->publish(now() + 200ms, Message{&mr_}), Eq(cetl::nullopt));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes + BufferSize);
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        publisher.reset();
+        testing::Mock::VerifyAndClearExpectations(&msg_tx_session_mock);
+        EXPECT_CALL(msg_tx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
@@ -30,6 +30,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <type_traits>
 #include <utility>
 
@@ -42,6 +43,7 @@ using namespace libcyphal::presentation;  // NOLINT This our main concern here i
 using namespace libcyphal::transport;     // NOLINT This our main concern here in the unit tests.
 
 using testing::_;
+using testing::Eq;
 using testing::Invoke;
 using testing::Return;
 using testing::IsEmpty;
@@ -220,6 +222,97 @@ TEST_F(TestServer, service_request_response)
     EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
 }
 
+TEST_F(TestServer, service_response_with_attached_serialization_buffer)
+{
+    using Service = uavcan::node::GetInfo_1_0;
+
+    // GetInfo response is bigger than "small" payload, so normally it's PMR allocated.
+    constexpr auto BufferSize = Service::Response::_traits_::SerializationBufferSizeBytes;
+    static_assert(BufferSize > libcyphal::config::Presentation::SmallPayloadSize(), "");
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+
+    IRequestRxSession::OnReceiveCallback::Function req_rx_cb_fn;
+    StrictMock<RequestRxSessionMock>               req_rx_session_mock;
+    EXPECT_CALL(req_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillRepeatedly(Invoke([&](auto&& cb_fn) {             //
+            req_rx_cb_fn = std::forward<IRequestRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    StrictMock<ResponseTxSessionMock> res_tx_session_mock;
+
+    constexpr RequestRxParams rx_params{Service::Request::_traits_::ExtentBytes,
+                                        Service::Request::_traits_::FixedPortId};
+    EXPECT_CALL(transport_mock_, makeRequestRxSession(RequestRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_session_mock);
+        }));
+    constexpr ResponseTxParams tx_params{Service::Request::_traits_::FixedPortId};
+    EXPECT_CALL(transport_mock_, makeResponseTxSession(ResponseTxParamsEq(tx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, res_tx_session_mock);
+        }));
+
+    auto maybe_server = presentation.makeServer<Service>();
+    ASSERT_THAT(maybe_server, VariantWith<ServiceServer<Service>>(_));
+    auto server = cetl::get<ServiceServer<Service>>(std::move(maybe_server));
+
+    std::array<cetl::byte, BufferSize> buffer{};
+    server.setSerializationBuffer(buffer);
+
+    ServiceServer<Service>::OnRequestCallback::Continuation req_continuation;
+    server.setOnRequestCallback([&req_continuation](const auto&, auto cont) {
+        //
+        req_continuation = std::move(cont);
+    });
+
+    ServiceRxTransfer request{{{{123, Priority::Fast}, {}}, NodeId{0x31}}, {}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn({request});
+        ASSERT_TRUE(req_continuation);
+
+        EXPECT_CALL(res_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), buffer.data());
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        EXPECT_THAT(req_continuation(now() + 200ms, Service::Response{mr_alloc_}), Eq(cetl::nullopt));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Too small buffer is ignored.
+        server.setSerializationBuffer(cetl::span<cetl::byte>{buffer.data(), BufferSize - 1});
+
+        request.metadata.rx_meta.timestamp = now();
+        req_rx_cb_fn({request});
+        ASSERT_TRUE(req_continuation);
+
+        EXPECT_CALL(res_tx_session_mock, send(_, _))  //
+            .WillOnce(Invoke([&buffer](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), testing::Ne(buffer.data()));
+                return cetl::nullopt;
+            }));
+
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        EXPECT_THAT(req_continuation(now() + 200ms, Service::Response{mr_alloc_}), Eq(cetl::nullopt));
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes + BufferSize);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_CALL(req_rx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(res_tx_session_mock, deinit()).Times(1);
+}
+
 TEST_F(TestServer, service_request_response_failures)
 {
     using Service = my_custom::baz_1_0;
@@ -16,6 +16,7 @@
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/config.hpp>
+#include <libcyphal/presentation/deserialization_arena.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/subscriber.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
@@ -30,6 +31,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -341,6 +343,112 @@ TEST_F(TestSubscriber, onReceive_deserialize_failure)
     EXPECT_THAT(messages, ElementsAre(std::make_tuple(TimePoint{3s}, 16)));
 }
 
+TEST_F(TestSubscriber, onReceive_with_deserialization_arena)
+{
+    using Message = my_custom::bar_1_0;
+
+    IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn;
+
+    StrictMock<MessageRxSessionMock> msg_rx_session_mock;
+    constexpr MessageRxParams        rx_params{Message::_traits_::ExtentBytes, 0x123};
+    EXPECT_CALL(msg_rx_session_mock, getParams()).WillOnce(Return(rx_params));
+    EXPECT_CALL(msg_rx_session_mock, setOnReceiveCallback(_))  //
+        .WillOnce(Invoke([&](auto&& cb_fn) {                   //
+            msg_rx_cb_fn = std::forward<IMessageRxSession::OnReceiveCallback::Function>(cb_fn);
+        }));
+
+    EXPECT_CALL(transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+        .WillOnce(Invoke([&](const auto&) {                                           //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, msg_rx_session_mock);
+        }));
+
+    std::array<cetl::byte, 64> arena_buffer{};
+    DeserializationArena       arena{arena_buffer, mr_};
+
+    Presentation presentation{mr_, scheduler_, transport_mock_};
+    presentation.setDeserializationArena(&arena);
+
+    auto maybe_sub1 = presentation.makeSubscriber<Message>(rx_params.subject_id);
+    ASSERT_THAT(maybe_sub1, VariantWith<Subscriber<Message>>(_));
+    cetl::optional<Subscriber<Message>> subscriber1 = cetl::get<Subscriber<Message>>(std::move(maybe_sub1));
+    auto maybe_sub2 = presentation.makeSubscriber<Message>(rx_params.subject_id);
+    ASSERT_THAT(maybe_sub2, VariantWith<Subscriber<Message>>(_));
+    cetl::optional<Subscriber<Message>> subscriber2 = cetl::get<Subscriber<Message>>(std::move(maybe_sub2));
+
+    ASSERT_TRUE(msg_rx_cb_fn);
+
+    Message test_message{mr_alloc_};
+    test_message.some_stuff.push_back(1);
+    test_message.some_stuff.push_back(2);
+    test_message.some_stuff.push_back(3);
+
+    NiceMock<ScatteredBufferStorageMock> storage_mock;
+    ScatteredBufferStorageMock::Wrapper  storage{&storage_mock};
+    EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(Message::_traits_::SerializationBufferSizeBytes));
+    EXPECT_CALL(storage_mock, copy(0, _, _))                           //
+        .WillRepeatedly(Invoke([&](auto, auto* const dst, auto len) {  //
+            //
+            std::array<std::uint8_t, Message::_traits_::SerializationBufferSizeBytes> buffer{};
+            const auto result = serialize(test_message, buffer);
+            const auto size   = std::min(result.value(), len);
+            (void) std::memmove(dst, buffer.data(), size);
+            return size;
+        }));
+
+    // Both subscribers should see the very same message (deserialized only once), allocated from the arena.
+    // General memory resource should not be involved at all.
+    std::vector<std::tuple<TimePoint, std::size_t>> messages;
+    std::size_t                                     total_allocated_bytes = 0;
+    const auto on_receive = [&](const auto& arg) {
+        //
+        messages.emplace_back(arg.approx_now, arg.message.some_stuff.size());
+        EXPECT_THAT(arena.getUsedBytes(), testing::Gt(0));
+        EXPECT_THAT(mr_.total_allocated_bytes, total_allocated_bytes);
+    };
+    subscriber1->setOnReceiveCallback(on_receive);
+    subscriber2->setOnReceiveCallback(on_receive);
+
+    MessageRxTransfer transfer{{{{13, Priority::Fast}, {}}, NodeId{0x31}}, ScatteredBuffer{std::move(storage)}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        total_allocated_bytes               = mr_.total_allocated_bytes;
+        transfer.metadata.rx_meta.timestamp = now();
+        msg_rx_cb_fn({transfer});
+        EXPECT_THAT(arena.getUsedBytes(), 0);
+        EXPECT_THAT(arena.getHighWaterMark(), testing::Gt(0));
+        EXPECT_THAT(mr_.total_allocated_bytes, total_allocated_bytes);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Detach the arena - the general memory resource should be in use again.
+        presentation.setDeserializationArena(nullptr);
+        subscriber1->setOnReceiveCallback([&](const auto& arg) {
+            //
+            messages.emplace_back(arg.approx_now, arg.message.some_stuff.size());
+            EXPECT_THAT(arena.getUsedBytes(), 0);
+        });
+        subscriber2.reset();
+        //
+        total_allocated_bytes               = mr_.total_allocated_bytes;
+        transfer.metadata.rx_meta.timestamp = now();
+        msg_rx_cb_fn({transfer});
+        EXPECT_THAT(mr_.total_allocated_bytes, testing::Gt(total_allocated_bytes));
+    });
+    scheduler_.scheduleAt(9s, [&](const auto&) {
+        //
+        subscriber1.reset();
+        EXPECT_CALL(msg_rx_session_mock, deinit()).Times(1);
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(messages,
+                ElementsAre(std::make_tuple(TimePoint{1s}, 3),
+                            std::make_tuple(TimePoint{1s}, 3),
+                            std::make_tuple(TimePoint{2s}, 3)));
+    EXPECT_THAT(arena.getUpstreamAllocationsCount(), 0);
+}
+
 TEST_F(TestSubscriber, onReceive_raw_message)
 {
     IMessageRxSession::OnReceiveCallback::Function msg_rx_cb_fn;
@@ -0,0 +1,200 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/impaired_media.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/can/virtual_bus.hpp>
+#include <libcyphal/transport/impairment.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::IsEmpty;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestCanImpairedMedia : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void push(IMedia& media, const CanId can_id)
+    {
+        auto* const data = static_cast<cetl::byte*>(tx_mr_.allocate(8));
+        std::fill_n(data, 8, b(0x42));
+        MediaPayload payload{8, data, 8, &tx_mr_};
+        EXPECT_THAT(media.push(now() + 1s, can_id, payload), VariantWith<IMedia::PushResult::Success>(_));
+    }
+
+    /// Registers "ready to pop" callback which pops one frame at a time (like the CAN transport does).
+    ///
+    IExecutor::Callback::Any registerReceiver(IMedia& media)
+    {
+        return media.registerPopCallback([this, &media](const auto&) {
+            //
+            std::array<cetl::byte, 64> buffer{};
+            const auto                 result  = media.pop(buffer);
+            const auto* const          success = cetl::get_if<IMedia::PopResult::Success>(&result);
+            if ((success != nullptr) && success->has_value())
+            {
+                received_.push_back(**success);
+            }
+        });
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler          scheduler_{};
+    TrackingMemoryResource                   tx_mr_;
+    VirtualBus                               bus_{scheduler_, {1000000, 1000000, true}};
+    std::vector<IMedia::PopResult::Metadata> received_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestCanImpairedMedia, disabled_forwards_as_is)
+{
+    VirtualBus::Media tx_media{bus_, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media rx_media{bus_, tx_mr_, {8, false, 3, 8}};
+    ImpairedMedia     impaired{scheduler_, rx_media, Impairments{}};
+
+    EXPECT_THAT(impaired.getMtu(), 8);
+    EXPECT_THAT(&impaired.getTxMemoryResource(), &tx_mr_);
+
+    auto callback = registerReceiver(impaired);
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        push(tx_media, 0x123);
+        push(tx_media, 0x124);
+    });
+    scheduler_.spinFor(10ms);
+
+    ASSERT_THAT(received_.size(), 2);
+    EXPECT_THAT(received_[0].can_id, 0x123);
+    EXPECT_THAT(received_[0].timestamp, TimePoint{1ms + 160us});
+    EXPECT_THAT(received_[1].timestamp, TimePoint{1ms + 320us});
+    EXPECT_THAT(impaired.getCounters().passed, 2);
+}
+
+TEST_F(TestCanImpairedMedia, delay)
+{
+    VirtualBus::Media tx_media{bus_, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media rx_media{bus_, tx_mr_, {8, false, 3, 8}};
+
+    Impairments impairments{};
+    impairments.delay = 5ms;
+    ImpairedMedia impaired{scheduler_, rx_media, impairments};
+
+    auto callback = registerReceiver(impaired);
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        push(tx_media, 0x123);
+        push(tx_media, 0x124);
+    });
+    scheduler_.scheduleAt(6ms, [&](const auto&) {
+        //
+        EXPECT_THAT(received_, IsEmpty());
+    });
+    scheduler_.spinFor(10ms);
+
+    ASSERT_THAT(received_.size(), 2);
+    EXPECT_THAT(received_[0].can_id, 0x123);
+    EXPECT_THAT(received_[0].timestamp, TimePoint{6ms + 160us});
+    EXPECT_THAT(received_[1].can_id, 0x124);
+    EXPECT_THAT(received_[1].timestamp, TimePoint{6ms + 320us});
+    EXPECT_THAT(impaired.getCounters().delayed, 2);
+    EXPECT_THAT(impaired.getCounters().passed, 2);
+}
+
+TEST_F(TestCanImpairedMedia, drop_duplicate_and_unregister)
+{
+    VirtualBus::Media tx_media{bus_, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media rx_media{bus_, tx_mr_, {8, false, 3, 8}};
+
+    Impairments impairments{};
+    impairments.duplicate_probability = 1.0F;
+    ImpairedMedia impaired{scheduler_, rx_media, impairments};
+
+    auto callback = registerReceiver(impaired);
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        push(tx_media, 0x123);
+    });
+    scheduler_.scheduleAt(2ms, [&](const auto&) {
+        //
+        // No more notifications after the transport has dropped its registration.
+        callback.reset();
+        push(tx_media, 0x124);
+    });
+    scheduler_.spinFor(10ms);
+
+    ASSERT_THAT(received_.size(), 2);
+    EXPECT_THAT(received_[0].can_id, 0x123);
+    EXPECT_THAT(received_[1].can_id, 0x123);
+    EXPECT_THAT(impaired.getCounters().duplicated, 1);
+
+    // Everything is dropped with probability 1.
+    Impairments drop_all{};
+    drop_all.drop_probability = 1.0F;
+    ImpairedMedia dropping{scheduler_, rx_media, drop_all};
+    received_.clear();
+
+    auto drop_callback = registerReceiver(dropping);
+    scheduler_.scheduleAt(11ms, [&](const auto&) {
+        //
+        push(tx_media, 0x125);
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(received_, IsEmpty());
+    EXPECT_THAT(dropping.getCounters().dropped, 2);  // 0x124 is still in the inner media FIFO.
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
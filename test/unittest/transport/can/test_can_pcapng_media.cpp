@@ -0,0 +1,252 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/capture_media.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/can/replay_media.hpp>
+#include <libcyphal/transport/can/virtual_bus.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/transport/pcapng.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::ArgumentError;
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::IsEmpty;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestCanPcapngMedia : public testing::Test
+{
+protected:
+    class MemorySink final : public pcapng::ISink
+    {
+    public:
+        MemorySink()                                 = default;
+        ~MemorySink()                                = default;
+        MemorySink(const MemorySink&)                = delete;
+        MemorySink(MemorySink&&) noexcept            = delete;
+        MemorySink& operator=(const MemorySink&)     = delete;
+        MemorySink& operator=(MemorySink&&) noexcept = delete;
+
+        bool write(const cetl::span<const cetl::byte> data) override
+        {
+            bytes.insert(bytes.end(), data.begin(), data.end());
+            return true;
+        }
+
+        // NOLINTBEGIN
+        std::vector<cetl::byte> bytes;
+        // NOLINTEND
+
+    };  // MemorySink
+
+    void TearDown() override
+    {
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    IMedia::PushResult::Type push(IMedia& media, const CanId can_id, const std::size_t size)
+    {
+        auto* const data = static_cast<cetl::byte*>(tx_mr_.allocate(size));
+        std::fill_n(data, size, b(static_cast<std::uint8_t>(can_id)));
+        MediaPayload payload{size, data, size, &tx_mr_};
+        return media.push(now() + 1s, can_id, payload);
+    }
+
+    /// Registers "ready to pop" callback which pops one frame at a time (like the CAN transport does).
+    ///
+    IExecutor::Callback::Any registerReceiver(IMedia& media)
+    {
+        return media.registerPopCallback([this, &media](const auto&) {
+            //
+            std::array<cetl::byte, 64> buffer{};
+            const auto                 result  = media.pop(buffer);
+            const auto* const          success = cetl::get_if<IMedia::PopResult::Success>(&result);
+            if ((success != nullptr) && success->has_value())
+            {
+                received_.push_back(**success);
+                received_payloads_.emplace_back(buffer.data(), buffer.data() + (*success)->payload_size);
+            }
+        });
+    }
+
+    /// Captures two frames (as seen by both the transmitting and the receiving node) over the virtual bus.
+    ///
+    void captureTraffic()
+    {
+        VirtualBus::Media tx_media{bus_, tx_mr_, {8, false, 3, 8}};
+        VirtualBus::Media rx_media{bus_, tx_mr_, {8, false, 3, 8}};
+        CaptureMedia      tx_capture{scheduler_, tx_media, writer_};
+        CaptureMedia      rx_capture{scheduler_, rx_media, writer_};
+
+        auto callback = registerReceiver(rx_capture);
+        scheduler_.scheduleAt(1ms, [&](const auto&) {
+            //
+            EXPECT_THAT(push(tx_capture, 0x123, 3), VariantWith<IMedia::PushResult::Success>(_));
+        });
+        scheduler_.scheduleAt(3ms, [&](const auto&) {
+            //
+            EXPECT_THAT(push(tx_capture, 0x1ABCDE, 8), VariantWith<IMedia::PushResult::Success>(_));
+        });
+        scheduler_.spinFor(10ms);
+        received_.clear();
+        received_payloads_.clear();
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler          scheduler_{};
+    TrackingMemoryResource                   tx_mr_;
+    VirtualBus                               bus_{scheduler_, {1000000, 1000000, true}};
+    MemorySink                               sink_;
+    pcapng::Writer                           writer_{sink_};
+    std::vector<IMedia::PopResult::Metadata> received_;
+    std::vector<std::vector<cetl::byte>>     received_payloads_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestCanPcapngMedia, capture)
+{
+    captureTraffic();
+    EXPECT_THAT(writer_.getPacketsCount(), 4);
+
+    pcapng::Reader reader{sink_.bytes};
+
+    std::vector<pcapng::Direction>        directions;
+    std::vector<std::chrono::nanoseconds> timestamps;
+    std::vector<CanId>                    can_ids;
+    while (const auto packet = reader.next())
+    {
+        EXPECT_THAT(packet->link_type, pcapng::LinkType::CanSocketCan);
+        EXPECT_THAT(packet->data.size(), 16);  // classic CAN_MTU
+
+        const auto frame = pcapng::SocketCan::parse(packet->data);
+        ASSERT_TRUE(frame.has_value());
+        directions.push_back(packet->direction);
+        timestamps.push_back(packet->timestamp);
+        can_ids.push_back(frame->can_id);  // NOLINT(bugprone-unchecked-optional-access)
+    }
+    EXPECT_FALSE(reader.isMalformed());
+
+    // Each frame is seen twice: pushed by the transmitter, and popped by the receiver (after its transmission time).
+    EXPECT_THAT(directions,
+                ElementsAre(pcapng::Direction::Outbound,
+                            pcapng::Direction::Inbound,
+                            pcapng::Direction::Outbound,
+                            pcapng::Direction::Inbound));
+    EXPECT_THAT(can_ids, ElementsAre(0x123, 0x123, 0x1ABCDE, 0x1ABCDE));
+    EXPECT_THAT(timestamps, ElementsAre(1ms, 1ms + 110us, 3ms, 3ms + 160us));
+}
+
+TEST_F(TestCanPcapngMedia, replay_recorded)
+{
+    captureTraffic();
+
+    ReplayMedia replay{scheduler_, tx_mr_, sink_.bytes, {pcapng::ReplayMode::Recorded, 8}};
+    EXPECT_THAT(replay.getMtu(), 8);
+    EXPECT_FALSE(replay.isFinished());
+
+    IExecutor::Callback::Any callback;
+    scheduler_.scheduleAt(20ms, [&](const auto&) {
+        //
+        callback = registerReceiver(replay);
+    });
+    scheduler_.spinFor(100ms);
+
+    // Only inbound frames are replayed - at their recorded intervals.
+    ASSERT_THAT(received_.size(), 2);
+    EXPECT_THAT(received_[0].can_id, 0x123);
+    EXPECT_THAT(received_[0].timestamp, TimePoint{20ms});
+    EXPECT_THAT(received_payloads_[0], ElementsAre(b(0x23), b(0x23), b(0x23)));
+    EXPECT_THAT(received_[1].can_id, 0x1ABCDE);
+    EXPECT_THAT(received_[1].timestamp, TimePoint{22ms + 50us});
+    EXPECT_THAT(received_payloads_[1].size(), 8);
+    EXPECT_TRUE(replay.isFinished());
+    EXPECT_THAT(replay.getFramesCount(), 2);
+
+    // Pushed frames are just discarded.
+    EXPECT_THAT(push(replay, 0x42, 8), VariantWith<IMedia::PushResult::Success>(_));
+    EXPECT_THAT(push(replay, 0x42, 12), VariantWith<MediaFailure>(VariantWith<ArgumentError>(_)));
+}
+
+TEST_F(TestCanPcapngMedia, replay_as_fast_as_possible)
+{
+    captureTraffic();
+
+    ReplayMedia replay{scheduler_, tx_mr_, sink_.bytes, {}};
+
+    IExecutor::Callback::Any callback;
+    scheduler_.scheduleAt(20ms, [&](const auto&) {
+        //
+        callback = registerReceiver(replay);
+    });
+    scheduler_.scheduleAt(30ms, [&](const auto&) {
+        //
+        replay.restart();
+    });
+    scheduler_.spinFor(100ms);
+
+    ASSERT_THAT(received_.size(), 4);
+    EXPECT_THAT(received_[0].timestamp, TimePoint{20ms});
+    EXPECT_THAT(received_[1].timestamp, TimePoint{20ms});
+    EXPECT_THAT(received_[2].timestamp, TimePoint{30ms});
+    EXPECT_THAT(received_[3].can_id, 0x1ABCDE);
+    EXPECT_THAT(replay.getFramesCount(), 4);
+
+    // No more notifications after the transport has dropped its registration.
+    callback.reset();
+    replay.restart();
+    scheduler_.spinFor(10ms);
+    EXPECT_THAT(received_.size(), 4);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -736,6 +736,27 @@ TEST_F(TestCanTransport, send_payload_to_redundant_fallible_media)
         EXPECT_THAT(session->send(metadata, makeSpansFrom(payload)), Eq(cetl::nullopt));
     });
     scheduler_.spinFor(10s);
+
+    // Both transfers were sent (to at least one media), and each media has failed once.
+    //
+    const auto transfer_stats = transport->getTransferStatistics();
+    EXPECT_THAT(transfer_stats.num_emitted, 2);
+    EXPECT_THAT(transfer_stats.num_received, 0);
+    EXPECT_THAT(transfer_stats.num_errored, 0);
+
+    const auto media0_stats = transport->getMediaStatistics(0);
+    ASSERT_THAT(media0_stats, Optional(_));
+    EXPECT_THAT(media0_stats->num_emitted, 1);
+    EXPECT_THAT(media0_stats->num_errored, 1);
+    EXPECT_THAT(media0_stats->num_overruns, 1);
+
+    const auto media1_stats = transport->getMediaStatistics(1);
+    ASSERT_THAT(media1_stats, Optional(_));
+    EXPECT_THAT(media1_stats->num_emitted, 1);
+    EXPECT_THAT(media1_stats->num_errored, 1);
+    EXPECT_THAT(media1_stats->num_overruns, 0);
+
+    EXPECT_THAT(transport->getMediaStatistics(2), Eq(cetl::nullopt));
 }
 
 TEST_F(TestCanTransport, send_payload_to_out_of_capacity_canard_tx)
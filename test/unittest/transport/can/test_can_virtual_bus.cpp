@@ -0,0 +1,422 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "tracking_memory_resource.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <canard.h>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/can/can_transport.hpp>
+#include <libcyphal/transport/can/can_transport_impl.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/can/virtual_bus.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::Duration;
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+using libcyphal::verification_utilities::makeIotaArray;
+using libcyphal::verification_utilities::makeSpansFrom;
+
+using testing::_;
+using testing::Eq;
+using testing::Lt;
+using testing::Gt;
+using testing::Ge;
+using testing::Le;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::Optional;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+using std::literals::chrono_literals::operator""ns;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestCanVirtualBus : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+        EXPECT_THAT(tx_mr_.total_allocated_bytes, tx_mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    MediaPayload makePayload(const std::size_t size)
+    {
+        auto* const data = static_cast<cetl::byte*>(tx_mr_.allocate(size));
+        std::fill_n(data, size, b(0x42));
+        return {size, data, size, &tx_mr_};
+    }
+
+    bool push(VirtualBus::Media& media, const CanId can_id, const std::size_t size, const TimePoint deadline)
+    {
+        auto       payload = makePayload(size);
+        const auto result  = media.push(deadline, can_id, payload);
+        EXPECT_THAT(result, VariantWith<IMedia::PushResult::Success>(_));
+
+        const auto* const success = cetl::get_if<IMedia::PushResult::Success>(&result);
+        return (success != nullptr) && success->is_accepted;
+    }
+
+    static cetl::optional<IMedia::PopResult::Metadata> pop(VirtualBus::Media& media)
+    {
+        std::array<cetl::byte, VirtualBus::MaxPayloadSize> buffer{};
+
+        const auto  result  = media.pop(buffer);
+        const auto* success = cetl::get_if<IMedia::PopResult::Success>(&result);
+        return (success != nullptr) ? *success : cetl::nullopt;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    TrackingMemoryResource          tx_mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestCanVirtualBus, getFrameDuration)
+{
+    const VirtualBus::Config worst{1000000, 5000000, true};
+    const VirtualBus::Config best{1000000, 5000000, false};
+
+    // Classic CAN
+    //
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 8, false, false), 160us);
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 0, false, false), 80us);
+    EXPECT_THAT(VirtualBus::getFrameDuration(best, 8, false, false), 131us);
+    EXPECT_THAT(VirtualBus::getFrameDuration({500000, 500000, true}, 8, false, false), 320us);
+
+    // CAN FD
+    //
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 64, true, true), 56000ns + 135800ns);
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 64, true, false), 56000ns + 679000ns);
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 63, true, true),
+                VirtualBus::getFrameDuration(worst, 64, true, true));
+    EXPECT_THAT(VirtualBus::getFrameDuration(worst, 8, true, true),
+                Lt(VirtualBus::getFrameDuration(worst, 8, true, false)));
+
+    EXPECT_THAT(VirtualBus::roundUpToFdLength(0), 0);
+    EXPECT_THAT(VirtualBus::roundUpToFdLength(8), 8);
+    EXPECT_THAT(VirtualBus::roundUpToFdLength(9), 12);
+    EXPECT_THAT(VirtualBus::roundUpToFdLength(33), 48);
+    EXPECT_THAT(VirtualBus::roundUpToFdLength(64), 64);
+}
+
+TEST_F(TestCanVirtualBus, arbitration)
+{
+    VirtualBus        bus{scheduler_, {1000000, 1000000, true}};
+    VirtualBus::Media media_a{bus, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media media_b{bus, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media media_c{bus, tx_mr_, {8, false, 3, 8}};
+
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(push(media_a, 0x200, 8, now() + 1s));
+        EXPECT_TRUE(push(media_a, 0x100, 8, now() + 1s));
+        EXPECT_TRUE(push(media_b, 0x150, 8, now() + 1s));
+        EXPECT_THAT(tx_mr_.allocations, IsEmpty());
+    });
+    scheduler_.scheduleAt(1ms + 500us, [&](const auto&) {
+        //
+        EXPECT_THAT(pop(media_c), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x100)));
+        EXPECT_THAT(pop(media_c), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x150)));
+        EXPECT_THAT(pop(media_c), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x200)));
+        EXPECT_THAT(pop(media_c), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(bus.getStatistics().frames, 3);
+    EXPECT_THAT(bus.getStatistics().busy_time, 480us);
+    EXPECT_THAT(media_a.getStatistics().tx_frames, 2);
+    EXPECT_THAT(media_a.getStatistics().rx_frames, 1);
+    EXPECT_THAT(media_b.getStatistics().tx_frames, 1);
+    EXPECT_THAT(media_b.getStatistics().rx_frames, 2);
+    EXPECT_THAT(media_c.getStatistics().rx_frames, 3);
+}
+
+TEST_F(TestCanVirtualBus, rx_timestamps_follow_bitrate)
+{
+    VirtualBus        bus{scheduler_, {1000000, 5000000, true}};
+    VirtualBus::Media media_tx{bus, tx_mr_, {64, true, 4, 8}};
+    VirtualBus::Media media_rx{bus, tx_mr_, {64, true, 4, 8}};
+
+    std::vector<TimePoint> rx_timestamps;
+    auto pop_callback = media_rx.registerPopCallback([&](const auto&) {
+        //
+        while (const auto metadata = pop(media_rx))
+        {
+            rx_timestamps.push_back(metadata->timestamp);
+        }
+    });
+
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(push(media_tx, 0x10, 64, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x11, 64, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x12, 64, now() + 1s));
+    });
+    scheduler_.spinFor(10ms);
+
+    // Back-to-back 191.8us frames end at 191.8us, 383.6us and 575.4us - rounded up to the executor resolution.
+    EXPECT_THAT(rx_timestamps, ElementsAre(TimePoint{1ms + 192us}, TimePoint{1ms + 384us}, TimePoint{1ms + 576us}));
+    EXPECT_THAT(bus.getStatistics().busy_time, 3 * (56000ns + 135800ns));
+}
+
+TEST_F(TestCanVirtualBus, mailboxes_limit_and_push_callback)
+{
+    VirtualBus        bus{scheduler_, {1000000, 1000000, true}};
+    VirtualBus::Media media_tx{bus, tx_mr_, {8, false, 2, 8}};
+    VirtualBus::Media media_rx{bus, tx_mr_, {8, false, 2, 16}};
+
+    std::size_t pending_frames = 5;
+    std::size_t max_busy       = 0;
+
+    IExecutor::Callback::Any push_callback;
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(push(media_tx, 0x100, 8, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x100, 8, now() + 1s));
+        EXPECT_FALSE(push(media_tx, 0x100, 8, now() + 1s));
+        EXPECT_THAT(media_tx.getBusyMailboxes(), 2);
+
+        // Media should notify as soon as a mailbox becomes free again.
+        push_callback = media_tx.registerPushCallback([&](const auto&) {
+            //
+            while ((pending_frames > 0) && push(media_tx, 0x100, 8, now() + 1s))
+            {
+                --pending_frames;
+            }
+            max_busy = std::max(max_busy, media_tx.getBusyMailboxes());
+            if (pending_frames == 0)
+            {
+                push_callback.reset();
+            }
+        });
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(pending_frames, 0);
+    EXPECT_THAT(max_busy, 2);
+    EXPECT_THAT(media_tx.getBusyMailboxes(), 0);
+    EXPECT_THAT(media_tx.getStatistics().tx_frames, 7);
+    EXPECT_THAT(media_rx.getStatistics().rx_frames, 7);
+    EXPECT_THAT(media_rx.getStatistics().rx_overruns, 0);
+
+    // Too big payload
+    auto payload = makePayload(9);
+    EXPECT_THAT(media_tx.push(now() + 1s, 0x100, payload), VariantWith<IMedia::PushResult::Failure>(_));
+}
+
+TEST_F(TestCanVirtualBus, expired_frames_are_dropped)
+{
+    VirtualBus        bus{scheduler_, {1000000, 1000000, true}};
+    VirtualBus::Media media_a{bus, tx_mr_, {8, false, 3, 8}};
+    VirtualBus::Media media_b{bus, tx_mr_, {8, false, 3, 8}};
+
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        // The first frame takes the bus for 160us, so the next low priority one misses its deadline.
+        EXPECT_TRUE(push(media_a, 0x100, 8, now() + 1s));
+        EXPECT_TRUE(push(media_a, 0x200, 8, now() + 100us));
+        EXPECT_TRUE(push(media_a, 0x300, 8, now() + 1s));
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(media_a.getStatistics().tx_frames, 2);
+    EXPECT_THAT(media_a.getStatistics().tx_expired, 1);
+    EXPECT_THAT(media_b.getStatistics().rx_frames, 2);
+    EXPECT_THAT(pop(media_b), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x100)));
+    EXPECT_THAT(pop(media_b), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x300)));
+}
+
+TEST_F(TestCanVirtualBus, filters_and_rx_overruns)
+{
+    VirtualBus        bus{scheduler_, {1000000, 1000000, true}};
+    VirtualBus::Media media_tx{bus, tx_mr_, {8, false, 8, 8}};
+    VirtualBus::Media media_rx{bus, tx_mr_, {8, false, 3, 2}};
+
+    const std::array<Filter, 1> filters{{{0x100, 0x700}}};
+    EXPECT_THAT(media_rx.setFilters(filters), Eq(cetl::nullopt));
+
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        EXPECT_TRUE(push(media_tx, 0x101, 8, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x201, 8, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x102, 8, now() + 1s));
+        EXPECT_TRUE(push(media_tx, 0x103, 8, now() + 1s));
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(media_tx.getStatistics().tx_frames, 4);
+    EXPECT_THAT(media_rx.getStatistics().rx_frames, 2);
+    EXPECT_THAT(media_rx.getStatistics().rx_overruns, 1);
+    EXPECT_THAT(pop(media_rx), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x101)));
+    EXPECT_THAT(pop(media_rx), Optional(testing::Field(&IMedia::PopResult::Metadata::can_id, 0x102)));
+    EXPECT_THAT(pop(media_rx), Eq(cetl::nullopt));
+}
+
+/// Saturates the bus with low priority transfers (of one node), and checks that high priority ones (of another node)
+/// still have bounded latency.
+///
+/// All bounds are derived from the frame duration model (see `VirtualBus::getFrameDuration`).
+///
+TEST_F(TestCanVirtualBus, transport_worst_case_latency_per_priority)
+{
+    constexpr std::size_t TxCapacity = 16;
+
+    VirtualBus        bus{scheduler_, {1000000, 1000000, true}};
+    VirtualBus::Media media_a{bus, tx_mr_, {CANARD_MTU_CAN_CLASSIC, false, 3, 16}};
+    VirtualBus::Media media_b{bus, tx_mr_, {CANARD_MTU_CAN_CLASSIC, false, 3, 16}};
+    VirtualBus::Media media_c{bus, tx_mr_, {CANARD_MTU_CAN_CLASSIC, false, 3, 16}};
+
+    // All transfers are single frame ones (7 bytes of payload + tail byte) - 160us each.
+    const auto frame_duration = VirtualBus::getFrameDuration(bus.getConfig(), CANARD_MTU_CAN_CLASSIC, false, false);
+
+    std::array<IMedia*, 3> media{&media_a, &media_b, &media_c};
+
+    std::array<UniquePtr<ICanTransport>, 3> transports;
+    for (std::size_t index = 0; index < transports.size(); ++index)
+    {
+        std::array<IMedia*, 1> media_array{media[index]};
+
+        auto maybe_transport = can::makeTransport(mr_, scheduler_, media_array, TxCapacity);
+        ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<ICanTransport>>(NotNull()));
+        transports[index] = cetl::get<UniquePtr<ICanTransport>>(std::move(maybe_transport));
+        EXPECT_THAT(transports[index]->setLocalNodeId(static_cast<NodeId>(10 + index)), Eq(cetl::nullopt));
+    }
+    auto& receiver = *transports[2];
+
+    struct Flow
+    {
+        PortId                    subject_id;
+        Priority                  priority;
+        Duration                  offset;
+        std::size_t               burst;
+        IMessageTxSession*        tx_session;
+        TransferId                transfer_id;
+        std::array<TimePoint, 32> sent_at;  // Indexed by transfer ID modulo 32 (as in CAN).
+        Duration                  worst_latency;
+        std::size_t               received;
+    };
+    std::array<Flow, 2> flows{{
+        {100, Priority::Exceptional, 500us, 1, nullptr, 0, {}, {}, 0},
+        {200, Priority::Optional, 0us, 8, nullptr, 0, {}, {}, 0},
+    }};
+
+    std::array<UniquePtr<IMessageTxSession>, 2> tx_sessions;
+    std::array<UniquePtr<IMessageRxSession>, 2> rx_sessions;
+    for (std::size_t index = 0; index < flows.size(); ++index)
+    {
+        Flow& flow = flows[index];
+
+        auto maybe_tx_session = transports[index]->makeMessageTxSession({flow.subject_id});
+        auto maybe_rx_session = receiver.makeMessageRxSession({7, flow.subject_id});
+        ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+        ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+        tx_sessions[index] = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+        rx_sessions[index] = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+        flow.tx_session    = tx_sessions[index].get();
+
+        rx_sessions[index]->setOnReceiveCallback([&flow](const auto& arg) {
+            //
+            const auto& rx_meta = arg.transfer.metadata.rx_meta;
+            const auto  latency = rx_meta.timestamp - flow.sent_at[rx_meta.base.transfer_id % flow.sent_at.size()];
+            flow.worst_latency  = std::max(flow.worst_latency, latency);
+            ++flow.received;
+        });
+    }
+
+    // Low priority flow offers 8 frames per 1ms (~1.3 of the bus capacity), and high priority one - 1 frame per 1ms.
+    // Whatever doesn't fit into the low priority TX queue is dropped by its transport (b/c of the queue capacity).
+    const auto payload = makeIotaArray<CANARD_MTU_CAN_CLASSIC - 1>(b('0'));
+    for (Duration time = 1ms; time < 100ms; time += 1ms)
+    {
+        for (auto& flow : flows)
+        {
+            scheduler_.scheduleAt(time + flow.offset, [this, &flow, &payload](const auto&) {
+                //
+                for (std::size_t i = 0; i < flow.burst; ++i)
+                {
+                    const TransferTxMetadata metadata{{flow.transfer_id, flow.priority}, now() + 1s};
+                    if (!flow.tx_session->send(metadata, makeSpansFrom(payload)).has_value())
+                    {
+                        flow.sent_at[flow.transfer_id % flow.sent_at.size()] = now();
+                        ++flow.transfer_id;
+                    }
+                }
+            });
+        }
+    }
+    scheduler_.spinFor(100ms);
+
+    const auto& high = flows[0];
+    const auto& low  = flows[1];
+
+    // The bus is saturated from the very first transfer (at 1ms) - back-to-back frames till the end of the run.
+    const auto bus_frames = static_cast<std::size_t>((100ms - 1ms) / frame_duration);
+    EXPECT_THAT(bus.getStatistics().frames, bus_frames);
+    EXPECT_THAT(media_c.getStatistics().rx_frames, bus_frames);
+    EXPECT_THAT(media_c.getStatistics().rx_overruns, 0);
+
+    // High priority transfers are never dropped, and wait at most for the frame already on the bus. Plus 2us:
+    // the media polls the transport for new frames at the next executor tick, and RX timestamps are rounded up.
+    EXPECT_THAT(high.received, 99);
+    EXPECT_THAT(high.worst_latency, Ge(frame_duration));
+    EXPECT_THAT(high.worst_latency, Le(2 * frame_duration + 2us));
+
+    // Low priority transfers take the rest of the bus, and whatever doesn't fit is dropped by their transport.
+    // Those accepted wait (at least) for the whole TX queue ahead of them.
+    EXPECT_THAT(low.received, bus_frames - high.received);
+    EXPECT_THAT(low.received, Lt(99 * low.burst));
+    EXPECT_THAT(low.worst_latency, Gt(TxCapacity * frame_duration));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
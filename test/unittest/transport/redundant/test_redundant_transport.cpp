@@ -0,0 +1,576 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/svc_sessions_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/redundant/redundant_transport.hpp>
+#include <libcyphal/transport/redundant/redundant_transport_impl.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::MemoryError;
+using libcyphal::ArgumentError;
+using namespace libcyphal::transport;             // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::redundant;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestRedundantTransport : public testing::Test
+{
+protected:
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using UniquePtrReqRxSpec = RequestRxSessionMock::RefWrapper::Spec;
+    using UniquePtrResTxSpec = ResponseTxSessionMock::RefWrapper::Spec;
+    using MsgRxCallback      = IMessageRxSession::OnReceiveCallback;
+    using SvcRxCallback      = ISvcRxSession::OnReceiveCallback;
+
+    static constexpr TransferId CanTransferIdModulo = 32;
+    static constexpr TransferId UdpTransferIdModulo = std::numeric_limits<TransferId>::max();
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    static void expectInferior(StrictMock<TransportMock>& inferior_mock,
+                               const ProtocolParams&      params,
+                               const cetl::optional<NodeId> node_id = cetl::nullopt)
+    {
+        EXPECT_CALL(inferior_mock, getProtocolParams()).WillRepeatedly(Return(params));
+        EXPECT_CALL(inferior_mock, getLocalNodeId()).WillRepeatedly(Return(node_id));
+    }
+
+    UniquePtr<IRedundantTransport> makeTransport(const cetl::span<ITransport*> inferiors)
+    {
+        auto maybe_transport = redundant::makeTransport(mr_, inferiors);
+        EXPECT_THAT(maybe_transport, VariantWith<UniquePtr<IRedundantTransport>>(NotNull()));
+        return cetl::get<UniquePtr<IRedundantTransport>>(std::move(maybe_transport));
+    }
+
+    void expectMsgRxSession(StrictMock<TransportMock>&          inferior_mock,
+                            StrictMock<MessageRxSessionMock>&   session_mock,
+                            MsgRxCallback::Function&            callback)
+    {
+        EXPECT_CALL(inferior_mock, makeMessageRxSession(_))  //
+            .WillOnce(Invoke([&](const auto&) {              //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, session_mock);
+            }));
+        EXPECT_CALL(session_mock, setOnReceiveCallback(_))  //
+            .WillOnce(Invoke([&](auto&& cb_fn) {            //
+                callback = std::forward<MsgRxCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(session_mock, deinit()).Times(1);
+    }
+
+    void expectMsgTxSession(StrictMock<TransportMock>& inferior_mock, StrictMock<MessageTxSessionMock>& session_mock)
+    {
+        EXPECT_CALL(inferior_mock, makeMessageTxSession(_))  //
+            .WillOnce(Invoke([&](const auto&) {              //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, session_mock);
+            }));
+        EXPECT_CALL(session_mock, deinit()).Times(1);
+    }
+
+    static void deliver(MsgRxCallback::Function&      callback,
+                        const TransferId              transfer_id,
+                        const TimePoint               timestamp,
+                        const cetl::optional<NodeId>  publisher_node_id = NodeId{42})
+    {
+        MessageRxTransfer transfer{{{{transfer_id, Priority::Nominal}, timestamp}, publisher_node_id}, {}};
+        callback(MsgRxCallback::Arg{transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource    mr_;
+    StrictMock<TransportMock> can_mock_;
+    StrictMock<TransportMock> udp_mock_;
+    StrictMock<TransportMock> other_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestRedundantTransport, makeTransport)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    // Zero inferiors is fine.
+    {
+        auto transport = makeTransport({});
+        EXPECT_THAT(transport->getLocalNodeId(), Eq(cetl::nullopt));
+        const auto params = transport->getProtocolParams();
+        EXPECT_THAT(params.mtu_bytes, 0);
+        EXPECT_THAT(params.max_nodes, 0);
+    }
+
+    // The most restrictive protocol parameters are reported.
+    {
+        std::array<ITransport*, 3> inferiors{&can_mock_, nullptr, &udp_mock_};
+        auto                       transport = makeTransport(inferiors);
+        const auto                 params    = transport->getProtocolParams();
+        EXPECT_THAT(params.transfer_id_modulo, CanTransferIdModulo);
+        EXPECT_THAT(params.mtu_bytes, 64);
+        EXPECT_THAT(params.max_nodes, 128);
+
+        // Already attached.
+        EXPECT_THAT(transport->attachInferior(udp_mock_), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+        EXPECT_THAT(transport->attachInferior(*transport), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+        EXPECT_THAT(transport->detachInferior(can_mock_), Eq(cetl::nullopt));
+        EXPECT_THAT(transport->detachInferior(can_mock_), Optional(testing::A<ArgumentError>()));
+        EXPECT_THAT(transport->getProtocolParams().transfer_id_modulo, UdpTransferIdModulo);
+    }
+
+    // Too many or duplicate inferiors.
+    {
+        std::array<ITransport*, 4> inferiors{&can_mock_, &udp_mock_, &other_mock_, &can_mock_};
+        EXPECT_THAT(redundant::makeTransport(mr_, inferiors),
+                    VariantWith<FactoryFailure>(VariantWith<ArgumentError>(_)));
+
+        std::array<ITransport*, 2> duplicates{&can_mock_, &can_mock_};
+        EXPECT_THAT(redundant::makeTransport(mr_, duplicates),
+                    VariantWith<FactoryFailure>(VariantWith<ArgumentError>(_)));
+    }
+
+    // Inferior with a local node ID can't join an anonymous redundant transport.
+    {
+        expectInferior(other_mock_, {UdpTransferIdModulo, 1408, 65535}, NodeId{7});
+        std::array<ITransport*, 1> inferiors{&other_mock_};
+        EXPECT_THAT(redundant::makeTransport(mr_, inferiors),
+                    VariantWith<FactoryFailure>(VariantWith<ArgumentError>(_)));
+    }
+}
+
+TEST_F(TestRedundantTransport, setLocalNodeId)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    std::array<ITransport*, 2> inferiors{&can_mock_, &udp_mock_};
+    auto                       transport = makeTransport(inferiors);
+
+    // Out of CAN range - nothing is assigned.
+    EXPECT_THAT(transport->setLocalNodeId(300), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(transport->getLocalNodeId(), Eq(cetl::nullopt));
+
+    EXPECT_CALL(can_mock_, setLocalNodeId(42)).WillOnce(Return(cetl::nullopt));
+    EXPECT_CALL(udp_mock_, setLocalNodeId(42)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->getLocalNodeId(), Optional(42));
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(43), Optional(testing::A<ArgumentError>()));
+
+    // A newly attached inferior gets the same node ID.
+    expectInferior(other_mock_, {UdpTransferIdModulo, 1408, 65535});
+    EXPECT_CALL(other_mock_, setLocalNodeId(42)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(transport->attachInferior(other_mock_), VariantWith<std::uint8_t>(2));
+}
+
+TEST_F(TestRedundantTransport, msg_tx_fan_out)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    std::array<ITransport*, 2> inferiors{&can_mock_, &udp_mock_};
+    auto                       transport = makeTransport(inferiors);
+
+    StrictMock<MessageTxSessionMock> can_tx_mock;
+    StrictMock<MessageTxSessionMock> udp_tx_mock;
+    expectMsgTxSession(can_mock_, can_tx_mock);
+    expectMsgTxSession(udp_mock_, udp_tx_mock);
+
+    auto maybe_session = transport->makeMessageTxSession({123});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_session));
+    EXPECT_THAT(session->getParams().subject_id, 123);
+
+    const std::array<cetl::byte, 3>                    payload{cetl::byte{1}, cetl::byte{2}, cetl::byte{3}};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{payload};
+    const TransferTxMetadata                           metadata{{7, Priority::High}, TimePoint{1s}};
+
+    // Both inferiors get the very same payload fragments (no copying).
+    const auto same_payload = [&](const PayloadFragments frags) { return frags.data() == fragments.data(); };
+    EXPECT_CALL(can_tx_mock, send(TransferTxMetadataEq(metadata), testing::Truly(same_payload)))
+        .WillOnce(Return(cetl::nullopt));
+    EXPECT_CALL(udp_tx_mock, send(TransferTxMetadataEq(metadata), testing::Truly(same_payload)))
+        .WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(session->send(metadata, fragments), Eq(cetl::nullopt));
+
+    // One inferior fails - still a success.
+    EXPECT_CALL(can_tx_mock, send(_, _)).WillOnce(Return(CapacityError{}));
+    EXPECT_CALL(udp_tx_mock, send(_, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(session->send(metadata, fragments), Eq(cetl::nullopt));
+
+    // All inferiors fail - the first failure is reported.
+    EXPECT_CALL(can_tx_mock, send(_, _)).WillOnce(Return(CapacityError{}));
+    EXPECT_CALL(udp_tx_mock, send(_, _)).WillOnce(Return(MemoryError{}));
+    EXPECT_THAT(session->send(metadata, fragments), Optional(VariantWith<CapacityError>(_)));
+
+    const auto transfer_stats = transport->getTransferStatistics();
+    EXPECT_THAT(transfer_stats.num_emitted, 2);
+    EXPECT_THAT(transfer_stats.num_errored, 1);
+    EXPECT_THAT(transfer_stats.num_overruns, 1);
+
+    const auto can_stats = transport->getMediaStatistics(0);
+    ASSERT_THAT(can_stats, Optional(_));
+    EXPECT_THAT(can_stats->num_emitted, 1);
+    EXPECT_THAT(can_stats->num_errored, 2);
+    const auto udp_stats = transport->getMediaStatistics(1);
+    ASSERT_THAT(udp_stats, Optional(_));
+    EXPECT_THAT(udp_stats->num_emitted, 2);
+    EXPECT_THAT(udp_stats->num_errored, 1);
+    EXPECT_THAT(transport->getMediaStatistics(IRedundantTransport::MaxInferiors), Eq(cetl::nullopt));
+}
+
+TEST_F(TestRedundantTransport, msg_rx_first_wins)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    std::array<ITransport*, 2> inferiors{&can_mock_, &udp_mock_};
+    auto                       transport = makeTransport(inferiors);
+
+    StrictMock<MessageRxSessionMock> can_rx_mock;
+    StrictMock<MessageRxSessionMock> udp_rx_mock;
+    MsgRxCallback::Function          can_rx_cb;
+    MsgRxCallback::Function          udp_rx_cb;
+    expectMsgRxSession(can_mock_, can_rx_mock, can_rx_cb);
+    expectMsgRxSession(udp_mock_, udp_rx_mock, udp_rx_cb);
+
+    auto maybe_session = transport->makeMessageRxSession({64, 123});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    std::vector<TransferId> received;
+    session->setOnReceiveCallback([&](const MsgRxCallback::Arg& arg) {
+        //
+        received.push_back(arg.transfer.metadata.rx_meta.base.transfer_id);
+    });
+
+    // UDP transfer IDs are monotonic, but CAN ones are modulo 32 - they are still matched.
+    deliver(can_rx_cb, 5, TimePoint{1s});
+    deliver(udp_rx_cb, 37, TimePoint{1s + 3ms});  // late copy of #5
+    deliver(udp_rx_cb, 38, TimePoint{2s});
+    deliver(can_rx_cb, 6, TimePoint{2s + 1ms});  // late copy of #6
+    deliver(can_rx_cb, 8, TimePoint{3s});
+    deliver(udp_rx_cb, 39, TimePoint{3s + 1ms});  // #7 arrives out of order - delivered
+    deliver(udp_rx_cb, 40, TimePoint{3s + 2ms});  // late copy of #8
+    deliver(can_rx_cb, 7, TimePoint{3s + 3ms});   // late copy of #7
+    deliver(can_rx_cb, 8, TimePoint{3s + 4ms});   // repeated copy of #8 (the same inferior)
+    EXPECT_THAT(received, ElementsAre(5, 38, 8, 39));
+
+    // Anonymous transfers can't be deduplicated.
+    deliver(can_rx_cb, 1, TimePoint{4s}, cetl::nullopt);
+    deliver(udp_rx_cb, 1, TimePoint{4s}, cetl::nullopt);
+    EXPECT_THAT(received, ElementsAre(5, 38, 8, 39, 1, 1));
+
+    // Expired transfer ID timeout - the same transfer ID is accepted again (f.e. the publisher has restarted).
+    deliver(udp_rx_cb, 40, TimePoint{7s});
+    EXPECT_THAT(received, ElementsAre(5, 38, 8, 39, 1, 1, 40));
+
+    const auto can_stats = transport->getInferiorStatistics(0);
+    ASSERT_THAT(can_stats, Optional(_));
+    EXPECT_THAT(can_stats->num_first, 2);
+    EXPECT_THAT(can_stats->num_late, 2);
+    EXPECT_THAT(can_stats->num_lag_samples, 1);  // lag of the late copy of #7 is unknown
+    EXPECT_THAT(can_stats->total_lag_us, 1000);
+    EXPECT_THAT(can_stats->max_lag_us, 1000);
+    const auto udp_stats = transport->getInferiorStatistics(1);
+    ASSERT_THAT(udp_stats, Optional(_));
+    EXPECT_THAT(udp_stats->num_first, 3);
+    EXPECT_THAT(udp_stats->num_late, 2);
+    EXPECT_THAT(udp_stats->num_lag_samples, 2);
+    EXPECT_THAT(udp_stats->total_lag_us, 3000 + 2000);
+    EXPECT_THAT(udp_stats->max_lag_us, 3000);
+    EXPECT_THAT(transport->getInferiorStatistics(IRedundantTransport::MaxInferiors), Eq(cetl::nullopt));
+
+    EXPECT_THAT(transport->getTransferStatistics().num_received, 7);
+    EXPECT_THAT(transport->getMediaStatistics(0), Optional(testing::Field(&IoStatistics::num_received, 6)));
+}
+
+TEST_F(TestRedundantTransport, msg_rx_loss)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    std::array<ITransport*, 2> inferiors{&can_mock_, &udp_mock_};
+    auto                       transport = makeTransport(inferiors);
+
+    StrictMock<MessageRxSessionMock> can_rx_mock;
+    StrictMock<MessageRxSessionMock> udp_rx_mock;
+    MsgRxCallback::Function          can_rx_cb;
+    MsgRxCallback::Function          udp_rx_cb;
+    expectMsgRxSession(can_mock_, can_rx_mock, can_rx_cb);
+    expectMsgRxSession(udp_mock_, udp_rx_mock, udp_rx_cb);
+
+    auto maybe_session = transport->makeMessageRxSession({64, 123});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    // Without callback the latest transfer is kept for polling.
+    std::size_t received = 0;
+    for (TransferId transfer_id = 0; transfer_id < 200; ++transfer_id)
+    {
+        const TimePoint timestamp{std::chrono::milliseconds{10 * transfer_id}};
+        deliver(udp_rx_cb, transfer_id, timestamp);
+        if ((transfer_id % 10) != 0)  // every 10th CAN frame is lost
+        {
+            deliver(can_rx_cb, transfer_id, timestamp + 1ms);
+        }
+        if (session->receive())
+        {
+            ++received;
+        }
+        EXPECT_THAT(session->receive(), Eq(cetl::nullopt));
+    }
+    EXPECT_THAT(received, 200);
+
+    // Only transfers which have slid out of the window are counted as lost (200 - 64 => 14 lost of 136).
+    const auto can_stats = transport->getInferiorStatistics(0);
+    ASSERT_THAT(can_stats, Optional(_));
+    EXPECT_THAT(can_stats->num_first, 0);
+    EXPECT_THAT(can_stats->num_late, 180);
+    EXPECT_THAT(can_stats->num_lost, 14);
+    const auto udp_stats = transport->getInferiorStatistics(1);
+    ASSERT_THAT(udp_stats, Optional(_));
+    EXPECT_THAT(udp_stats->num_first, 200);
+    EXPECT_THAT(udp_stats->num_lost, 0);
+}
+
+TEST_F(TestRedundantTransport, msg_rx_transfer_id_modulo_change)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    std::array<ITransport*, 2> inferiors{&can_mock_, &udp_mock_};
+    auto                       transport = makeTransport(inferiors);
+
+    StrictMock<MessageRxSessionMock> can_rx_mock;
+    StrictMock<MessageRxSessionMock> udp_rx_mock;
+    MsgRxCallback::Function          can_rx_cb;
+    MsgRxCallback::Function          udp_rx_cb;
+    expectMsgRxSession(can_mock_, can_rx_mock, can_rx_cb);
+    expectMsgRxSession(udp_mock_, udp_rx_mock, udp_rx_cb);
+
+    auto maybe_session = transport->makeMessageRxSession({64, 123});
+    ASSERT_THAT(maybe_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_session));
+
+    std::vector<TransferId> received;
+    session->setOnReceiveCallback([&](const MsgRxCallback::Arg& arg) {
+        //
+        received.push_back(arg.transfer.metadata.rx_meta.base.transfer_id);
+    });
+
+    // #40 is tracked as #8 (modulo 32).
+    deliver(udp_rx_cb, 40, TimePoint{1s});
+    deliver(can_rx_cb, 8, TimePoint{1s + 1ms});  // late copy of #40
+    EXPECT_THAT(received, ElementsAre(40));
+
+    // Detach of CAN changes the modulo - #8 is a different transfer now, and must not be taken as a copy of #40.
+    EXPECT_THAT(transport->detachInferior(can_mock_), Eq(cetl::nullopt));
+    deliver(udp_rx_cb, 8, TimePoint{1s + 2ms});
+    deliver(udp_rx_cb, 8, TimePoint{1s + 3ms});  // repeated copy of #8
+    EXPECT_THAT(received, ElementsAre(40, 8));
+
+    const auto udp_stats = transport->getInferiorStatistics(1);
+    ASSERT_THAT(udp_stats, Optional(_));
+    EXPECT_THAT(udp_stats->num_first, 2);
+    EXPECT_THAT(udp_stats->num_lost, 0);
+}
+
+TEST_F(TestRedundantTransport, attach_detach_with_sessions)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535});
+    expectInferior(other_mock_, {UdpTransferIdModulo, 1408, 65535});
+
+    // Sessions are made before any inferior is attached.
+    auto transport = makeTransport({});
+
+    auto maybe_tx_session = transport->makeMessageTxSession({123});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    auto maybe_rx_session = transport->makeMessageRxSession({64, 123});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+    // Nothing to send to.
+    const TransferTxMetadata metadata{{7, Priority::High}, TimePoint{1s}};
+    EXPECT_THAT(tx_session->send(metadata, {}), Eq(cetl::nullopt));
+
+    // Attach - inferior sessions are made for the existing sessions.
+    StrictMock<MessageTxSessionMock> can_tx_mock;
+    StrictMock<MessageRxSessionMock> can_rx_mock;
+    MsgRxCallback::Function          can_rx_cb;
+    expectMsgTxSession(can_mock_, can_tx_mock);
+    expectMsgRxSession(can_mock_, can_rx_mock, can_rx_cb);
+    EXPECT_CALL(can_rx_mock, setTransferIdTimeout(libcyphal::Duration{3s})).Times(1);
+    rx_session->setTransferIdTimeout(3s);
+    EXPECT_THAT(transport->attachInferior(can_mock_), VariantWith<std::uint8_t>(0));
+
+    EXPECT_CALL(can_tx_mock, send(_, _)).WillOnce(Return(cetl::nullopt));
+    EXPECT_THAT(tx_session->send(metadata, {}), Eq(cetl::nullopt));
+
+    // Failed attachment is rolled back - already made inferior sessions are destroyed.
+    StrictMock<MessageRxSessionMock> udp_rx_mock;
+    MsgRxCallback::Function          udp_rx_cb;
+    expectMsgRxSession(udp_mock_, udp_rx_mock, udp_rx_cb);
+    EXPECT_CALL(udp_rx_mock, setTransferIdTimeout(libcyphal::Duration{3s})).Times(1);
+    EXPECT_CALL(udp_mock_, makeMessageTxSession(_)).WillOnce(Return(MemoryError{}));
+    EXPECT_THAT(transport->attachInferior(udp_mock_), VariantWith<AnyFailure>(VariantWith<MemoryError>(_)));
+    testing::Mock::VerifyAndClearExpectations(&udp_rx_mock);
+
+    // Failure to make an inferior session fails the whole redundant session.
+    EXPECT_CALL(can_mock_, makeResponseTxSession(_)).WillOnce(Return(ArgumentError{}));
+    EXPECT_THAT(transport->makeResponseTxSession({147}),
+                VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+    // Detach - inferior sessions are destroyed, but the redundant ones are still valid.
+    EXPECT_THAT(transport->detachInferior(can_mock_), Eq(cetl::nullopt));
+    testing::Mock::VerifyAndClearExpectations(&can_tx_mock);
+    testing::Mock::VerifyAndClearExpectations(&can_rx_mock);
+    EXPECT_THAT(tx_session->send(metadata, {}), Eq(cetl::nullopt));
+
+    // The freed slot is reused.
+    StrictMock<MessageTxSessionMock> other_tx_mock;
+    StrictMock<MessageRxSessionMock> other_rx_mock;
+    MsgRxCallback::Function          other_rx_cb;
+    expectMsgTxSession(other_mock_, other_tx_mock);
+    expectMsgRxSession(other_mock_, other_rx_mock, other_rx_cb);
+    EXPECT_CALL(other_rx_mock, setTransferIdTimeout(libcyphal::Duration{3s})).Times(1);
+    EXPECT_THAT(transport->attachInferior(other_mock_), VariantWith<std::uint8_t>(0));
+
+    deliver(other_rx_cb, 1, TimePoint{1s});
+    EXPECT_THAT(rx_session->receive(), Optional(_));
+
+    // Redundant sessions destroy their inferior sessions.
+    tx_session.reset();
+    rx_session.reset();
+}
+
+TEST_F(TestRedundantTransport, svc_sessions)
+{
+    expectInferior(can_mock_, {CanTransferIdModulo, 64, 128}, NodeId{42});
+    expectInferior(udp_mock_, {UdpTransferIdModulo, 1408, 65535}, NodeId{42});
+
+    auto transport = makeTransport({});
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->attachInferior(can_mock_), VariantWith<std::uint8_t>(0));
+    EXPECT_THAT(transport->attachInferior(udp_mock_), VariantWith<std::uint8_t>(1));
+
+    // Requests are deduplicated per client node.
+    //
+    std::array<StrictMock<RequestRxSessionMock>, 2> req_rx_mocks;
+    std::array<SvcRxCallback::Function, 2>          req_rx_cbs;
+    for (std::size_t index = 0; index < 2; ++index)
+    {
+        auto& inferior_mock = (index == 0) ? can_mock_ : udp_mock_;
+        EXPECT_CALL(inferior_mock, makeRequestRxSession(_))  //
+            .WillOnce(Invoke([&, index](const auto&) {       //
+                return libcyphal::detail::makeUniquePtr<UniquePtrReqRxSpec>(mr_, req_rx_mocks[index]);
+            }));
+        EXPECT_CALL(req_rx_mocks[index], setOnReceiveCallback(_))  //
+            .WillOnce(Invoke([&, index](auto&& cb_fn) {            //
+                req_rx_cbs[index] = std::forward<SvcRxCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(req_rx_mocks[index], getParams()).WillRepeatedly(Return(RequestRxParams{64, 147}));
+        EXPECT_CALL(req_rx_mocks[index], deinit()).Times(1);
+    }
+    auto maybe_req_rx_session = transport->makeRequestRxSession({64, 147});
+    ASSERT_THAT(maybe_req_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto req_rx_session = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_req_rx_session));
+    EXPECT_THAT(req_rx_session->getParams().service_id, 147);
+
+    std::vector<NodeId> clients;
+    req_rx_session->setOnReceiveCallback([&](const SvcRxCallback::Arg& arg) {
+        //
+        clients.push_back(arg.transfer.metadata.remote_node_id);
+    });
+    const auto deliver_request = [&](const std::size_t index, const TransferId transfer_id, const NodeId client) {
+        ServiceRxTransfer transfer{{{{transfer_id, Priority::Nominal}, TimePoint{1s}}, client}, {}};
+        req_rx_cbs[index](SvcRxCallback::Arg{transfer});
+    };
+    deliver_request(0, 3, 10);
+    deliver_request(1, 3, 11);  // the same transfer ID, but different client
+    deliver_request(1, 3, 10);
+    deliver_request(0, 3, 11);
+    EXPECT_THAT(clients, ElementsAre(10, 11));
+
+    // Responses are fanned out.
+    //
+    StrictMock<ResponseTxSessionMock> can_res_tx_mock;
+    StrictMock<ResponseTxSessionMock> udp_res_tx_mock;
+    for (auto* const res_tx_mock : {&can_res_tx_mock, &udp_res_tx_mock})
+    {
+        auto& inferior_mock = (res_tx_mock == &can_res_tx_mock) ? can_mock_ : udp_mock_;
+        EXPECT_CALL(inferior_mock, makeResponseTxSession(_))  //
+            .WillOnce(Invoke([&, res_tx_mock](const auto&) {  //
+                return libcyphal::detail::makeUniquePtr<UniquePtrResTxSpec>(mr_, *res_tx_mock);
+            }));
+        EXPECT_CALL(*res_tx_mock, send(ServiceTxMetadataEq({{{3, Priority::Nominal}, TimePoint{2s}}, 10}), _))
+            .WillOnce(Return(cetl::nullopt));
+        EXPECT_CALL(*res_tx_mock, deinit()).Times(1);
+    }
+    auto maybe_res_tx_session = transport->makeResponseTxSession({147});
+    ASSERT_THAT(maybe_res_tx_session, VariantWith<UniquePtr<IResponseTxSession>>(NotNull()));
+    auto res_tx_session = cetl::get<UniquePtr<IResponseTxSession>>(std::move(maybe_res_tx_session));
+
+    EXPECT_THAT(res_tx_session->send({{{3, Priority::Nominal}, TimePoint{2s}}, 10}, {}), Eq(cetl::nullopt));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
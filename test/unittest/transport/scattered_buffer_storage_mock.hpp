@@ -70,6 +70,10 @@ public:
         {
             return (mock_ != nullptr) ? mock_->copy(offset_bytes, destination, length_bytes) : 0;
         }
+        bool observeFragments(ScatteredBuffer::IFragmentsObserver& observer) const override
+        {
+            return (mock_ != nullptr) && mock_->observeFragments(observer);
+        }
 
     private:
         ScatteredBufferStorageMock* mock_{nullptr};
@@ -100,6 +104,7 @@ public:
 
     MOCK_METHOD(std::size_t, size, (), (const, noexcept, override));  // NOLINT(bugprone-exception-escape)
     MOCK_METHOD(std::size_t, copy, (const std::size_t, cetl::byte* const, const std::size_t), (const, override));
+    MOCK_METHOD(bool, observeFragments, (ScatteredBuffer::IFragmentsObserver&), (const, override));
 
 };  // ScatteredBufferStorageMock
 
@@ -0,0 +1,55 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_MOCK_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_MOCK_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/serial/media.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace serial
+{
+
+class MediaMock : public IMedia
+{
+public:
+    MediaMock()          = default;
+    virtual ~MediaMock() = default;
+
+    MediaMock(const MediaMock&)                = delete;
+    MediaMock(MediaMock&&) noexcept            = delete;
+    MediaMock& operator=(const MediaMock&)     = delete;
+    MediaMock& operator=(MediaMock&&) noexcept = delete;
+
+    MOCK_METHOD(ReadResult::Type, read, (const cetl::span<cetl::byte> buffer), (noexcept, override));
+
+    MOCK_METHOD(WriteResult::Type, write, (const PayloadFragments fragments), (noexcept, override));
+
+    MOCK_METHOD(IExecutor::Callback::Any,
+                registerWriteCallback,
+                (IExecutor::Callback::Function && function),
+                (override));
+
+    MOCK_METHOD(IExecutor::Callback::Any,
+                registerReadCallback,
+                (IExecutor::Callback::Function && function),
+                (override));
+
+};  // MediaMock
+
+}  // namespace serial
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SERIAL_MEDIA_MOCK_HPP_INCLUDED
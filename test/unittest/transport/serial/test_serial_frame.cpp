@@ -0,0 +1,266 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/common/crc.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/transport/serial/frame.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::transport;                  // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::serial::detail;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::ArgumentError;
+
+using testing::_;
+using testing::IsEmpty;
+using testing::SizeIs;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::VariantWith;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+using Bytes = std::vector<cetl::byte>;
+
+Bytes makeBytes(const std::initializer_list<std::uint8_t> values)
+{
+    Bytes bytes;
+    for (const auto value : values)
+    {
+        bytes.push_back(static_cast<cetl::byte>(value));
+    }
+    return bytes;
+}
+
+Bytes cobsEncode(const Bytes& input)
+{
+    Bytes output(CobsEncoder::getMaxEncodedSize(input.size()));
+
+    CobsEncoder encoder{output};
+    encoder.encode(input);
+    output.resize(encoder.finish());
+    return output;
+}
+
+class TestSerialFrame : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestSerialFrame, crc32c)
+{
+    const Bytes check = makeBytes({'1', '2', '3', '4', '5', '6', '7', '8', '9'});
+
+    libcyphal::common::CRC32C crc{check.data(), check.data() + check.size()};
+    EXPECT_THAT(crc.get(), 0xE3069283UL);
+
+    // CRC over the data followed by its own (little-endian) CRC yields the residue.
+    const auto crc_bytes = makeTransferCrcBytes(crc.get());
+    crc.add(crc_bytes.data(), crc_bytes.data() + crc_bytes.size());
+    EXPECT_THAT(crc.get(), libcyphal::common::CRC32C::Residue);
+}
+
+TEST_F(TestSerialFrame, cobs_encode)
+{
+    EXPECT_THAT(cobsEncode({}), ElementsAreArray(makeBytes({1})));
+    EXPECT_THAT(cobsEncode(makeBytes({0})), ElementsAreArray(makeBytes({1, 1})));
+    EXPECT_THAT(cobsEncode(makeBytes({0, 0})), ElementsAreArray(makeBytes({1, 1, 1})));
+    EXPECT_THAT(cobsEncode(makeBytes({0x11, 0x22, 0, 0x33})), ElementsAreArray(makeBytes({3, 0x11, 0x22, 2, 0x33})));
+    EXPECT_THAT(cobsEncode(makeBytes({0x11, 0, 0, 0})), ElementsAreArray(makeBytes({2, 0x11, 1, 1, 1})));
+
+    // Long run of non-zero bytes is split into 254-byte blocks.
+    const Bytes long_run(300, cetl::byte{0x42});
+    const auto  encoded = cobsEncode(long_run);
+    ASSERT_THAT(encoded, SizeIs(302));
+    EXPECT_THAT(encoded[0], cetl::byte{0xFF});
+    EXPECT_THAT(encoded[255], cetl::byte{47});
+    EXPECT_THAT(std::count(encoded.begin(), encoded.end(), cetl::byte{0}), 0);
+}
+
+TEST_F(TestSerialFrame, transfer_splitter)
+{
+    const Bytes fragment1 = makeBytes({1, 2, 3});
+    const Bytes fragment2 = makeBytes({4, 5});
+    const Bytes crc       = makeBytes({0xA, 0xB, 0xC, 0xD});
+
+    const std::array<cetl::span<const cetl::byte>, 3> fragments{{fragment1, {}, fragment2}};
+    TransferSplitter                                  splitter{fragments, crc};
+
+    // Frame payloads could cross boundaries of fragments and the CRC.
+    std::vector<Bytes> frames;
+    const auto         next_frame = [&splitter, &frames](const std::size_t size) {
+        Bytes frame;
+        splitter.next(size, [&frame](const cetl::span<const cetl::byte> bytes) {
+            //
+            frame.insert(frame.end(), bytes.begin(), bytes.end());
+        });
+        frames.push_back(frame);
+    };
+    next_frame(4);
+    next_frame(3);
+    next_frame(2);
+    EXPECT_THAT(frames, ElementsAre(makeBytes({1, 2, 3, 4}), makeBytes({5, 0xA, 0xB}), makeBytes({0xC, 0xD})));
+}
+
+TEST_F(TestSerialFrame, header_serialize_deserialize)
+{
+    FrameHeader header{};
+    header.priority            = Priority::High;
+    header.source_node_id      = 0x1234;
+    header.destination_node_id = 0x0042;
+    header.data_specifier      = FrameHeader::ServiceBit | FrameHeader::RequestBit | 123;
+    header.transfer_id         = 0x0102030405060708ULL;
+
+    const auto bytes = header.serialize();
+    EXPECT_THAT(bytes[0], cetl::byte{1});
+    EXPECT_THAT(bytes[2], cetl::byte{0x34});
+    EXPECT_THAT(bytes[3], cetl::byte{0x12});
+    EXPECT_THAT(bytes[8], cetl::byte{0x08});
+    EXPECT_THAT(bytes[19], cetl::byte{0x80});
+
+    const auto decoded = FrameHeader::deserialize(bytes);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_THAT(decoded->priority, Priority::High);
+    EXPECT_THAT(decoded->source_node_id, 0x1234);
+    EXPECT_THAT(decoded->destination_node_id, 0x0042);
+    EXPECT_TRUE(decoded->isService());
+    EXPECT_TRUE(decoded->isRequest());
+    EXPECT_THAT(decoded->portId(), 123);
+    EXPECT_THAT(decoded->transfer_id, 0x0102030405060708ULL);
+    EXPECT_TRUE(decoded->isSingleFrame());
+    EXPECT_TRUE(decoded->isEndOfTransfer());
+    EXPECT_THAT(decoded->getFrameIndex(), 0);
+
+    // Frame of a multi-frame transfer.
+    header.frame_index_eot = 2;
+    const auto middle      = FrameHeader::deserialize(header.serialize());
+    ASSERT_TRUE(middle.has_value());
+    EXPECT_FALSE(middle->isSingleFrame());
+    EXPECT_FALSE(middle->isEndOfTransfer());
+    EXPECT_THAT(middle->getFrameIndex(), 2);
+
+    // Corrupted header.
+    auto corrupted = bytes;
+    corrupted[5] ^= cetl::byte{0x01};
+    EXPECT_FALSE(FrameHeader::deserialize(corrupted).has_value());
+
+    // Too short.
+    EXPECT_FALSE(FrameHeader::deserialize({bytes.data(), bytes.size() - 1}).has_value());
+}
+
+TEST_F(TestSerialFrame, reader_multiple_frames_in_one_chunk)
+{
+    const Bytes frame1 = makeBytes({0x11, 0, 0x22});
+    const Bytes frame2 = makeBytes({0, 0, 0});
+    const Bytes frame3(600, cetl::byte{0x33});
+
+    Bytes stream{cetl::byte{0}};
+    for (const auto* frame : {&frame1, &frame2, &frame3})
+    {
+        const auto encoded = cobsEncode(*frame);
+        stream.insert(stream.end(), encoded.begin(), encoded.end());
+        stream.push_back(cetl::byte{0});
+    }
+
+    FrameReader        reader{mr_, 1024};
+    std::vector<Bytes> frames;
+    std::size_t        drops = 0;
+    reader.read(
+        stream,
+        [&frames](MediaPayload& payload) {
+            const auto span = payload.getSpan();
+            frames.emplace_back(span.begin(), span.end());
+        },
+        [&drops](const AnyFailure&) { ++drops; });
+
+    EXPECT_THAT(drops, 0);
+    EXPECT_THAT(frames, ElementsAre(frame1, frame2, frame3));
+}
+
+TEST_F(TestSerialFrame, reader_frame_split_across_chunks)
+{
+    const Bytes frame(300, cetl::byte{0x55});
+
+    Bytes stream = cobsEncode(frame);
+    stream.push_back(cetl::byte{0});
+
+    FrameReader                  reader{mr_, 1024};
+    cetl::optional<MediaPayload> taken;
+    for (std::size_t offset = 0; offset < stream.size(); offset += 7)
+    {
+        const std::size_t size = std::min<std::size_t>(7, stream.size() - offset);
+        reader.read(
+            {stream.data() + offset, size},
+            [&taken](MediaPayload& payload) { taken.emplace(std::move(payload)); },
+            [](const AnyFailure&) { FAIL(); });
+    }
+
+    // The frame buffer has been taken over by the handler (without copying).
+    ASSERT_TRUE(taken.has_value());
+    const auto span = taken->getSpan();
+    EXPECT_THAT(Bytes(span.begin(), span.end()), ElementsAreArray(frame));
+    taken.reset();
+}
+
+TEST_F(TestSerialFrame, reader_drops_bad_frames)
+{
+    FrameReader reader{mr_, 8};
+
+    std::vector<Bytes>      frames;
+    std::vector<AnyFailure> drops;
+    const auto              on_frame = [&frames](MediaPayload& payload) {
+        const auto span = payload.getSpan();
+        frames.emplace_back(span.begin(), span.end());
+    };
+    const auto on_drop = [&drops](const AnyFailure& failure) { drops.push_back(failure); };
+
+    // Oversized frame.
+    Bytes stream = cobsEncode(Bytes(9, cetl::byte{1}));
+    stream.push_back(cetl::byte{0});
+    reader.read(stream, on_frame, on_drop);
+    EXPECT_THAT(frames, IsEmpty());
+    ASSERT_THAT(drops, SizeIs(1));
+    EXPECT_THAT(drops[0], VariantWith<ArgumentError>(_));
+
+    // Premature delimiter, followed by a good frame (the reader recovers on the next delimiter).
+    reader.read(makeBytes({5, 1, 2, 0, 2, 7, 0}), on_frame, on_drop);
+    EXPECT_THAT(drops, SizeIs(2));
+    EXPECT_THAT(frames, ElementsAre(makeBytes({7})));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,589 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/serial/media.hpp>
+#include <libcyphal/transport/serial/serial_transport.hpp>
+#include <libcyphal/transport/serial/serial_transport_impl.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::ArgumentError;
+using namespace libcyphal::transport;          // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::serial;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+using Bytes = std::vector<cetl::byte>;
+
+class TestSerialTransport : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    UniquePtr<ISerialTransport> makeTransport(const std::size_t tx_capacity = 16)
+    {
+        auto maybe_transport = serial::makeTransport(mr_, scheduler_, media_mock_, tx_capacity);
+        EXPECT_THAT(maybe_transport, VariantWith<UniquePtr<ISerialTransport>>(NotNull()));
+        return cetl::get<UniquePtr<ISerialTransport>>(std::move(maybe_transport));
+    }
+
+    /// Makes the media mock to accept (up to `max_bytes` per call) all written bytes into the `wire_` buffer.
+    void expectWritesToWire(const std::size_t max_bytes = SIZE_MAX)
+    {
+        EXPECT_CALL(media_mock_, write(_)).WillRepeatedly(Invoke([this, max_bytes](const PayloadFragments fragments) {
+            std::size_t written = 0;
+            for (const auto fragment : fragments)
+            {
+                const std::size_t size = std::min(fragment.size(), max_bytes - written);
+                wire_.insert(wire_.end(), fragment.begin(), fragment.begin() + static_cast<std::ptrdiff_t>(size));
+                written += size;
+            }
+            return IMedia::WriteResult::Success{written};
+        }));
+    }
+
+    /// Makes the media mock to return (once) all bytes of the `wire_` buffer.
+    void expectReadFromWire()
+    {
+        EXPECT_CALL(media_mock_, read(_)).WillOnce(Invoke([this](const cetl::span<cetl::byte> buffer) {
+            EXPECT_THAT(wire_.size(), testing::Le(buffer.size()));
+            std::copy(wire_.begin(), wire_.end(), buffer.begin());
+            const auto size = wire_.size();
+            wire_.clear();
+            return IMedia::ReadResult::Metadata{now(), size};
+        }));
+    }
+
+    void expectRegisterReadCallback()
+    {
+        EXPECT_CALL(media_mock_, registerReadCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {          //
+                return scheduler_.registerNamedCallback("rx", std::move(function));
+            }));
+    }
+
+    static Bytes payloadOf(const ScatteredBuffer& buffer)
+    {
+        Bytes bytes(buffer.size());
+        EXPECT_THAT(buffer.copy(0, bytes.data(), bytes.size()), bytes.size());
+        return bytes;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    StrictMock<MediaMock>           media_mock_{};
+    Bytes                           wire_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestSerialTransport, makeTransport)
+{
+    auto maybe_transport = serial::makeTransport(mr_, scheduler_, media_mock_, 0);
+    EXPECT_THAT(maybe_transport, VariantWith<FactoryFailure>(VariantWith<ArgumentError>(_)));
+
+    auto transport = makeTransport();
+    EXPECT_THAT(transport->getLocalNodeId(), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->getProtocolParams().mtu_bytes, ISerialTransport::Mtu);
+    EXPECT_THAT(transport->getProtocolParams().max_nodes, 0xFFFF);
+    EXPECT_THAT(transport->getMediaStatistics(1), Eq(cetl::nullopt));
+}
+
+TEST_F(TestSerialTransport, setLocalNodeId)
+{
+    auto transport = makeTransport();
+
+    EXPECT_THAT(transport->setLocalNodeId(0xFFFF), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(transport->setLocalNodeId(1234), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(1234), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(42), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(transport->getLocalNodeId(), Optional(1234));
+}
+
+TEST_F(TestSerialTransport, make_sessions)
+{
+    auto transport = makeTransport();
+
+    EXPECT_THAT(transport->makeMessageRxSession({0, 8192}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport->makeMessageTxSession({8192}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport->makeRequestRxSession({0, 512}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport->makeRequestTxSession({123, 0xFFFF}),
+                VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+    expectRegisterReadCallback();
+    auto maybe_rx_session1 = transport->makeMessageRxSession({0, 123});
+    ASSERT_THAT(maybe_rx_session1, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    EXPECT_TRUE(scheduler_.hasNamedCallback("rx"));
+
+    // Same subject - already exists, but the same port ID of a different kind is fine.
+    EXPECT_THAT(transport->makeMessageRxSession({0, 123}),
+                VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+    auto maybe_rx_session2 = transport->makeRequestRxSession({0, 123});
+    ASSERT_THAT(maybe_rx_session2, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+
+    // The read callback is cancelled together with the last RX session.
+    maybe_rx_session1 = AnyFailure{ArgumentError{}};
+    EXPECT_TRUE(scheduler_.hasNamedCallback("rx"));
+    maybe_rx_session2 = AnyFailure{ArgumentError{}};
+    EXPECT_FALSE(scheduler_.hasNamedCallback("rx"));
+}
+
+TEST_F(TestSerialTransport, send_receive_message)
+{
+    auto transport = makeTransport();
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+
+    expectRegisterReadCallback();
+    auto maybe_rx_session = transport->makeMessageRxSession({4, 7});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+    auto maybe_tx_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    expectWritesToWire();
+
+    const Bytes payload{cetl::byte{1}, cetl::byte{0}, cetl::byte{2}, cetl::byte{3}, cetl::byte{4}, cetl::byte{5}};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        const TransferTxMetadata metadata{{13, Priority::Fast}, now() + 1s};
+        EXPECT_THAT(tx_session->send(metadata, fragments), Eq(cetl::nullopt));
+        EXPECT_THAT(wire_.front(), cetl::byte{0});
+        EXPECT_THAT(wire_.back(), cetl::byte{0});
+        EXPECT_THAT(std::count(wire_.begin(), wire_.end(), cetl::byte{0}), 2);
+
+        // Duplicate the frame on the wire - the second copy should be filtered out as a duplicate.
+        const Bytes frame = wire_;
+        wire_.insert(wire_.end(), frame.begin(), frame.end());
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        const auto rx_transfer = rx_session->receive();
+        ASSERT_THAT(rx_transfer, Optional(testing::_));
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.transfer_id, 13);
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.priority, Priority::Fast);
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.timestamp, TimePoint{2s});
+        EXPECT_THAT(rx_transfer->metadata.publisher_node_id, Optional(42));
+
+        // Payload is truncated to the extent.
+        EXPECT_THAT(payloadOf(rx_transfer->payload),
+                    ElementsAre(cetl::byte{1}, cetl::byte{0}, cetl::byte{2}, cetl::byte{3}));
+
+        EXPECT_THAT(rx_session->receive(), Eq(cetl::nullopt));
+
+        const auto media_stats = transport->getMediaStatistics(0);
+        ASSERT_THAT(media_stats, Optional(testing::_));
+        EXPECT_THAT(media_stats->num_emitted, 1);
+        EXPECT_THAT(media_stats->num_received, 2);
+        EXPECT_THAT(media_stats->num_errored, 0);
+
+        const auto transfer_stats = transport->getTransferStatistics();
+        EXPECT_THAT(transfer_stats.num_emitted, 1);
+        EXPECT_THAT(transfer_stats.num_received, 1);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, send_receive_multi_frame_message)
+{
+    auto transport = makeTransport();
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+
+    // Payload (with zeros inside) needs 3 frames - the last one carries 100 bytes of payload and the CRC.
+    Bytes payload(ISerialTransport::Mtu * 2 + 100);
+    for (std::size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<cetl::byte>(i % 251);
+    }
+    const std::array<cetl::span<const cetl::byte>, 2> fragments{
+        {{payload.data(), 7}, {&payload[7], payload.size() - 7}}};
+
+    expectRegisterReadCallback();
+    auto maybe_rx_session = transport->makeMessageRxSession({payload.size(), 7});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+    auto maybe_tx_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    expectWritesToWire();
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(tx_session->send({{13, Priority::Fast}, now() + 1s}, fragments), Eq(cetl::nullopt));
+        EXPECT_THAT(std::count(wire_.begin(), wire_.end(), cetl::byte{0}), 3 * 2);
+        EXPECT_THAT(transport->getMediaStatistics(0)->num_emitted, 3);
+
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        const auto rx_transfer = rx_session->receive();
+        ASSERT_THAT(rx_transfer, Optional(testing::_));
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.transfer_id, 13);
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.priority, Priority::Fast);
+        EXPECT_THAT(rx_transfer->metadata.publisher_node_id, Optional(42));
+        EXPECT_THAT(payloadOf(rx_transfer->payload), testing::ElementsAreArray(payload));
+
+        EXPECT_THAT(transport->getMediaStatistics(0)->num_received, 3);
+        EXPECT_THAT(transport->getTransferStatistics().num_received, 1);
+
+        // Lost middle frame - the whole transfer is dropped, but the next one is received fine.
+        EXPECT_THAT(tx_session->send({{14, Priority::Fast}, now() + 1s}, fragments), Eq(cetl::nullopt));
+        const auto first_frame_end = std::find(wire_.begin() + 1, wire_.end(), cetl::byte{0}) + 1;
+        const auto second_frame_end = std::find(first_frame_end + 1, wire_.end(), cetl::byte{0}) + 1;
+        wire_.erase(first_frame_end, second_frame_end);
+        EXPECT_THAT(tx_session->send({{15, Priority::Fast}, now() + 1s}, fragments), Eq(cetl::nullopt));
+
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        const auto rx_transfer = rx_session->receive();
+        ASSERT_THAT(rx_transfer, Optional(testing::_));
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.transfer_id, 15);
+        EXPECT_THAT(payloadOf(rx_transfer->payload), testing::ElementsAreArray(payload));
+        EXPECT_THAT(transport->getTransferStatistics().num_received, 2);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, send_partial_writes_and_capacity)
+{
+    auto transport = makeTransport(2);
+
+    auto maybe_tx_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    const std::array<cetl::byte, ISerialTransport::Mtu * 2> payload{};
+    const std::array<cetl::span<const cetl::byte>, 1>       fragments{{{payload.data(), 10}}};
+    const std::array<cetl::span<const cetl::byte>, 1>       big_fragments{{payload}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        const TransferTxMetadata metadata{{13, Priority::Nominal}, now() + 5s};
+
+        // Payload (together with its CRC) needs 3 frames, but there is room for 2 only.
+        EXPECT_THAT(tx_session->send(metadata, big_fragments), Optional(VariantWith<CapacityError>(_)));
+
+        // Media accepts only first 5 bytes.
+        expectWritesToWire(5);
+        EXPECT_CALL(media_mock_, registerWriteCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {           //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+        EXPECT_THAT(tx_session->send(metadata, fragments), Eq(cetl::nullopt));
+        EXPECT_THAT(wire_.size(), 5);
+        EXPECT_TRUE(scheduler_.hasNamedCallback("tx"));
+
+        // The second frame is just queued (b/c the media is not ready yet), and there is no room for a third.
+        EXPECT_THAT(tx_session->send(metadata, fragments), Eq(cetl::nullopt));
+        EXPECT_THAT(tx_session->send(metadata, fragments), Optional(VariantWith<CapacityError>(_)));
+        EXPECT_THAT(wire_.size(), 5);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Now the media is ready to accept everything.
+        expectWritesToWire();
+        scheduler_.scheduleNamedCallback("tx");
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        EXPECT_FALSE(scheduler_.hasNamedCallback("tx"));
+        EXPECT_THAT(std::count(wire_.begin(), wire_.end(), cetl::byte{0}), 4);
+        EXPECT_THAT(transport->getMediaStatistics(0)->num_emitted, 2);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, send_expired_frames_dropped)
+{
+    auto transport = makeTransport();
+
+    auto maybe_tx_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_CALL(media_mock_, write(_)).WillOnce(Return(IMedia::WriteResult::Success{0}));
+        EXPECT_CALL(media_mock_, registerWriteCallback(_))  //
+            .WillOnce(Invoke([&](auto function) {           //
+                return scheduler_.registerNamedCallback("tx", std::move(function));
+            }));
+        EXPECT_THAT(tx_session->send({{13, Priority::Nominal}, now() + 100ms}, {}), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // The frame has expired - no media writes are expected.
+        scheduler_.scheduleNamedCallback("tx");
+    });
+    scheduler_.scheduleAt(2s + 1ms, [&](const auto&) {
+        //
+        EXPECT_FALSE(scheduler_.hasNamedCallback("tx"));
+        EXPECT_THAT(transport->getMediaStatistics(0)->num_emitted, 0);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, send_receive_service)
+{
+    auto transport = makeTransport();
+
+    auto maybe_req_tx_session = transport->makeRequestTxSession({17, 42});
+    ASSERT_THAT(maybe_req_tx_session, VariantWith<UniquePtr<IRequestTxSession>>(NotNull()));
+    auto req_tx_session = cetl::get<UniquePtr<IRequestTxSession>>(std::move(maybe_req_tx_session));
+
+    expectRegisterReadCallback();
+    auto maybe_req_rx_session = transport->makeRequestRxSession({8, 17});
+    ASSERT_THAT(maybe_req_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto req_rx_session = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_req_rx_session));
+
+    auto maybe_res_rx_session = transport->makeResponseRxSession({8, 17, 42});
+    ASSERT_THAT(maybe_res_rx_session, VariantWith<UniquePtr<IResponseRxSession>>(NotNull()));
+    auto res_rx_session = cetl::get<UniquePtr<IResponseRxSession>>(std::move(maybe_res_rx_session));
+
+    auto maybe_res_tx_session = transport->makeResponseTxSession({17});
+    ASSERT_THAT(maybe_res_tx_session, VariantWith<UniquePtr<IResponseTxSession>>(NotNull()));
+    auto res_tx_session = cetl::get<UniquePtr<IResponseTxSession>>(std::move(maybe_res_tx_session));
+
+    const std::array<cetl::byte, 3>                   payload{cetl::byte{1}, cetl::byte{2}, cetl::byte{3}};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{payload}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Anonymous nodes can't send service transfers.
+        EXPECT_THAT(req_tx_session->send({{1, Priority::Nominal}, now() + 1s}, fragments),
+                    Optional(VariantWith<AnonymousError>(_)));
+
+        EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+
+        // Request to ourselves (node 42) - should be received by the server session.
+        expectWritesToWire();
+        EXPECT_THAT(req_tx_session->send({{1, Priority::Nominal}, now() + 1s}, fragments), Eq(cetl::nullopt));
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        const auto request = req_rx_session->receive();
+        ASSERT_THAT(request, Optional(testing::_));
+        EXPECT_THAT(request->metadata.remote_node_id, 42);
+        EXPECT_THAT(payloadOf(request->payload), ElementsAre(cetl::byte{1}, cetl::byte{2}, cetl::byte{3}));
+        EXPECT_THAT(res_rx_session->receive(), Eq(cetl::nullopt));
+
+        // Response to another node (not us) - should be ignored.
+        EXPECT_THAT(res_tx_session->send({{{1, Priority::Nominal}, now() + 1s}, 43}, fragments), Eq(cetl::nullopt));
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        EXPECT_THAT(res_rx_session->receive(), Eq(cetl::nullopt));
+
+        // Response to us.
+        EXPECT_THAT(res_tx_session->send({{{1, Priority::Nominal}, now() + 1s}, 42}, fragments), Eq(cetl::nullopt));
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 3ms, [&](const auto&) {
+        //
+        const auto response = res_rx_session->receive();
+        ASSERT_THAT(response, Optional(testing::_));
+        EXPECT_THAT(response->metadata.remote_node_id, 42);
+        EXPECT_THAT(req_rx_session->receive(), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, send_receive_multi_frame_service)
+{
+    auto transport = makeTransport();
+    EXPECT_THAT(transport->setLocalNodeId(42), Eq(cetl::nullopt));
+
+    auto maybe_req_tx_session = transport->makeRequestTxSession({17, 42});
+    ASSERT_THAT(maybe_req_tx_session, VariantWith<UniquePtr<IRequestTxSession>>(NotNull()));
+    auto req_tx_session = cetl::get<UniquePtr<IRequestTxSession>>(std::move(maybe_req_tx_session));
+
+    expectRegisterReadCallback();
+    auto maybe_req_rx_session = transport->makeRequestRxSession({4, 17});
+    ASSERT_THAT(maybe_req_rx_session, VariantWith<UniquePtr<IRequestRxSession>>(NotNull()));
+    auto req_rx_session = cetl::get<UniquePtr<IRequestRxSession>>(std::move(maybe_req_rx_session));
+
+    // Payload is split so that the last frame carries only a part of the transfer CRC.
+    Bytes payload(ISerialTransport::Mtu * 2 - 2, cetl::byte{0x55});
+    payload[0] = cetl::byte{1};
+    payload[3] = cetl::byte{4};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    expectWritesToWire();
+
+    Bytes frames;
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(req_tx_session->send({{1, Priority::Nominal}, now() + 1s}, fragments), Eq(cetl::nullopt));
+        EXPECT_THAT(std::count(wire_.begin(), wire_.end(), cetl::byte{0}), 3 * 2);
+        frames = wire_;
+
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        const auto request = req_rx_session->receive();
+        ASSERT_THAT(request, Optional(testing::_));
+        EXPECT_THAT(request->metadata.remote_node_id, 42);
+
+        // Payload is truncated to the extent.
+        EXPECT_THAT(payloadOf(request->payload),
+                    ElementsAre(cetl::byte{1}, cetl::byte{0x55}, cetl::byte{0x55}, cetl::byte{4}));
+        EXPECT_THAT(req_rx_session->receive(), Eq(cetl::nullopt));
+
+        // The whole transfer is repeated on the wire - it's filtered out as a duplicate.
+        wire_ = frames;
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        EXPECT_THAT(req_rx_session->receive(), Eq(cetl::nullopt));
+        EXPECT_THAT(transport->getMediaStatistics(0)->num_received, 3 * 2);
+        EXPECT_THAT(transport->getTransferStatistics().num_received, 1);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestSerialTransport, media_failures)
+{
+    auto transport = makeTransport();
+
+    expectRegisterReadCallback();
+    auto maybe_rx_session = transport->makeMessageRxSession({4, 7});
+    ASSERT_THAT(maybe_rx_session, VariantWith<UniquePtr<IMessageRxSession>>(NotNull()));
+    auto rx_session = cetl::get<UniquePtr<IMessageRxSession>>(std::move(maybe_rx_session));
+
+    auto maybe_tx_session = transport->makeMessageTxSession({7});
+    ASSERT_THAT(maybe_tx_session, VariantWith<UniquePtr<IMessageTxSession>>(NotNull()));
+    auto tx_session = cetl::get<UniquePtr<IMessageTxSession>>(std::move(maybe_tx_session));
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Without a handler, write failures are propagated.
+        EXPECT_CALL(media_mock_, write(_)).WillOnce(Return(ArgumentError{}));
+        const TransferTxMetadata metadata{{1, Priority::Nominal}, now() + 1s};
+        EXPECT_THAT(tx_session->send(metadata, {}), Optional(VariantWith<ArgumentError>(_)));
+
+        // With a handler, they could be ignored.
+        std::size_t handler_calls = 0;
+        transport->setTransientErrorHandler([&handler_calls](auto& report_var) {
+            ++handler_calls;
+            EXPECT_THAT(report_var, VariantWith<ISerialTransport::TransientErrorReport::MediaWrite>(_));
+            return cetl::nullopt;
+        });
+        EXPECT_CALL(media_mock_, write(_)).WillOnce(Return(ArgumentError{}));
+        EXPECT_THAT(tx_session->send({{2, Priority::Nominal}, now() + 1s}, {}), Eq(cetl::nullopt));
+        EXPECT_THAT(handler_calls, 1);
+        transport->setTransientErrorHandler(nullptr);
+
+        // Read failures and garbage are only counted.
+        EXPECT_CALL(media_mock_, read(_)).WillOnce(Return(ArgumentError{}));
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        wire_ = Bytes{cetl::byte{0}, cetl::byte{3}, cetl::byte{1}, cetl::byte{2}, cetl::byte{0}};
+        expectReadFromWire();
+        scheduler_.scheduleNamedCallback("rx");
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(rx_session->receive(), Eq(cetl::nullopt));
+
+        const auto media_stats = transport->getMediaStatistics(0);
+        ASSERT_THAT(media_stats, Optional(testing::_));
+        EXPECT_THAT(media_stats->num_errored, 4);
+        EXPECT_THAT(media_stats->num_received, 1);
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#ifndef LIBCYPHAL_TRANSPORT_SHM_MEDIA_MOCK_HPP_INCLUDED
+#define LIBCYPHAL_TRANSPORT_SHM_MEDIA_MOCK_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/shm/media.hpp>
+
+#include <gmock/gmock.h>
+
+namespace libcyphal
+{
+namespace transport
+{
+namespace shm
+{
+
+class MediaMock : public IMedia
+{
+public:
+    MediaMock()          = default;
+    virtual ~MediaMock() = default;
+
+    MediaMock(const MediaMock&)                = delete;
+    MediaMock(MediaMock&&) noexcept            = delete;
+    MediaMock& operator=(const MediaMock&)     = delete;
+    MediaMock& operator=(MediaMock&&) noexcept = delete;
+
+    MOCK_METHOD(cetl::span<cetl::byte>, getSegment, (), (noexcept, override));
+
+    MOCK_METHOD(cetl::optional<MediaFailure>, notify, (), (noexcept, override));
+
+    MOCK_METHOD(void, clearNotifications, (), (noexcept, override));
+
+    MOCK_METHOD(IExecutor::Callback::Any,
+                registerNotificationCallback,
+                (IExecutor::Callback::Function && function),
+                (override));
+
+};  // MediaMock
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace libcyphal
+
+#endif  // LIBCYPHAL_TRANSPORT_SHM_MEDIA_MOCK_HPP_INCLUDED
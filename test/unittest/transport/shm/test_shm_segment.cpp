@@ -0,0 +1,312 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/shm/segment.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace libcyphal::transport;             // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::shm;        // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::shm::detail;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::ArgumentError;
+
+using testing::Eq;
+using testing::Optional;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestShmSegment : public testing::Test
+{
+protected:
+    /// Allocates (properly aligned) memory for a segment, and formats it.
+    Segment makeSegment(const SegmentLayout& layout)
+    {
+        memory_.resize((getSegmentSize(layout) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        EXPECT_THAT(formatSegment(memorySpan(), layout), Eq(cetl::nullopt));
+
+        auto segment = Segment::attach(memorySpan());
+        EXPECT_TRUE(segment.has_value());
+        return *segment;
+    }
+
+    cetl::span<cetl::byte> memorySpan()
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return {reinterpret_cast<cetl::byte*>(memory_.data()), memory_.size() * sizeof(std::uint64_t)};
+    }
+
+    static void fillSlot(const Segment& segment, const std::uint32_t slot_index, const std::uint64_t value)
+    {
+        (void) std::memcpy(segment.getSlotBuffer(slot_index).data(), &value, sizeof(value));
+        segment.setSlotPayloadSize(slot_index, sizeof(value));
+    }
+
+    static std::uint64_t slotValue(const Segment& segment, const std::uint32_t slot_index)
+    {
+        std::uint64_t value = 0;
+        (void) std::memcpy(&value, segment.getSlotBuffer(slot_index).data(), sizeof(value));
+        return value;
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    std::vector<std::uint64_t> memory_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestShmSegment, format_and_attach)
+{
+    const SegmentLayout layout{4, 64, 2, 8};
+    memory_.resize(getSegmentSize(layout) / sizeof(std::uint64_t) + 1);
+
+    // Not formatted yet.
+    EXPECT_FALSE(Segment::attach(memorySpan()).has_value());
+
+    // Invalid layouts.
+    EXPECT_THAT(formatSegment(memorySpan(), {0, 64, 2, 8}), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(formatSegment(memorySpan(), {4, 0, 2, 8}), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(formatSegment(memorySpan(), {4, 64, 0, 8}), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(formatSegment(memorySpan(), {4, 64, 2, 6}), Optional(testing::A<ArgumentError>()));
+
+    // Too small memory.
+    EXPECT_THAT(formatSegment(memorySpan().first(getSegmentSize(layout) - 1), layout),
+                Optional(testing::A<ArgumentError>()));
+
+    EXPECT_THAT(formatSegment(memorySpan(), layout), Eq(cetl::nullopt));
+    const auto segment = Segment::attach(memorySpan());
+    ASSERT_TRUE(segment.has_value());
+    EXPECT_THAT(segment->getLayout().slot_count, 4);
+    EXPECT_THAT(segment->getLayout().slot_size, 64);
+    EXPECT_THAT(segment->getLayout().ring_count, 2);
+    EXPECT_THAT(segment->getLayout().ring_capacity, 8);
+
+    // Attach to a truncated segment.
+    EXPECT_FALSE(Segment::attach(memorySpan().first(getSegmentSize(layout) - 1)).has_value());
+}
+
+TEST_F(TestShmSegment, slots)
+{
+    const auto segment = makeSegment({3, 16, 1, 4});
+
+    const auto slot0 = segment.allocateSlot();
+    const auto slot1 = segment.allocateSlot();
+    const auto slot2 = segment.allocateSlot();
+    EXPECT_THAT(slot0, 0);
+    EXPECT_THAT(slot1, 1);
+    EXPECT_THAT(slot2, 2);
+    EXPECT_THAT(segment.allocateSlot(), Segment::NoSlot);
+
+    // The last reference returns slot to the free stack.
+    EXPECT_TRUE(segment.tryRetainSlot(slot1));
+    segment.releaseSlot(slot1);
+    EXPECT_THAT(segment.allocateSlot(), Segment::NoSlot);
+    segment.releaseSlot(slot1);
+    EXPECT_FALSE(segment.tryRetainSlot(slot1));
+    EXPECT_THAT(segment.allocateSlot(), slot1);
+
+    segment.releaseSlot(slot2);
+    segment.releaseSlot(slot0);
+    EXPECT_THAT(segment.allocateSlot(), slot0);
+    EXPECT_THAT(segment.allocateSlot(), slot2);
+    EXPECT_THAT(segment.allocateSlot(), Segment::NoSlot);
+
+    fillSlot(segment, slot0, 0x1122334455667788ULL);
+    EXPECT_THAT(segment.getSlotPayloadSize(slot0), sizeof(std::uint64_t));
+    EXPECT_THAT(slotValue(segment, slot0), 0x1122334455667788ULL);
+    EXPECT_THAT(segment.getSlotBuffer(slot0).size(), 16);
+}
+
+TEST_F(TestShmSegment, rings)
+{
+    const auto segment = makeSegment({1, 16, 2, 4});
+
+    EXPECT_THAT(segment.getRingKey(0), 0);
+    EXPECT_THAT(segment.claimRing(0x123), Optional(0U));
+    EXPECT_THAT(segment.claimRing(0x123), Optional(0U));
+    EXPECT_THAT(segment.claimRing(0x456), Optional(1U));
+    EXPECT_THAT(segment.claimRing(0x789), Eq(cetl::nullopt));
+    EXPECT_THAT(segment.getRingKey(0), 0x123);
+    EXPECT_THAT(segment.getRingKey(1), 0x456);
+
+    // Claim by another view of the same segment.
+    const auto other = Segment::attach(memorySpan());
+    ASSERT_TRUE(other.has_value());
+    EXPECT_THAT(other->claimRing(0x456), Optional(1U));
+}
+
+TEST_F(TestShmSegment, publish_and_read)
+{
+    const auto segment = makeSegment({8, 16, 1, 4});
+
+    std::uint64_t  cursor = 0;
+    std::size_t    lost   = 0;
+    Segment::Entry entry{};
+    EXPECT_FALSE(segment.read(0, cursor, entry, lost));
+
+    for (std::uint64_t tid = 0; tid < 3; ++tid)
+    {
+        const auto slot = segment.allocateSlot();
+        fillSlot(segment, slot, tid * 100);
+        segment.publish(0, {tid, slot, Priority::High, static_cast<NodeId>(tid + 10)});
+    }
+    EXPECT_THAT(segment.getRingHead(0), 3);
+
+    for (std::uint64_t tid = 0; tid < 3; ++tid)
+    {
+        ASSERT_TRUE(segment.read(0, cursor, entry, lost));
+        EXPECT_THAT(entry.transfer_id, tid);
+        EXPECT_THAT(entry.priority, Priority::High);
+        EXPECT_THAT(entry.destination_node_id, tid + 10);
+        EXPECT_THAT(slotValue(segment, entry.slot_index), tid * 100);
+        segment.releaseSlot(entry.slot_index);
+    }
+    EXPECT_FALSE(segment.read(0, cursor, entry, lost));
+    EXPECT_THAT(cursor, 3);
+    EXPECT_THAT(lost, 0);
+}
+
+TEST_F(TestShmSegment, slow_reader_loses_overwritten_entries)
+{
+    const auto segment = makeSegment({5, 16, 1, 4});
+
+    // Only 4 slots are referenced by the ring at any time - overwritten entries release their slots.
+    for (std::uint64_t tid = 0; tid < 10; ++tid)
+    {
+        const auto slot = segment.allocateSlot();
+        ASSERT_THAT(slot, testing::Ne(Segment::NoSlot));
+        fillSlot(segment, slot, tid);
+        segment.publish(0, {tid, slot, Priority::Nominal, 0xFFFF});
+    }
+
+    std::uint64_t  cursor = 0;
+    std::size_t    lost   = 0;
+    Segment::Entry entry{};
+    for (std::uint64_t tid = 6; tid < 10; ++tid)
+    {
+        ASSERT_TRUE(segment.read(0, cursor, entry, lost));
+        EXPECT_THAT(entry.transfer_id, tid);
+        EXPECT_THAT(slotValue(segment, entry.slot_index), tid);
+        segment.releaseSlot(entry.slot_index);
+    }
+    EXPECT_FALSE(segment.read(0, cursor, entry, lost));
+    EXPECT_THAT(lost, 6);
+}
+
+TEST_F(TestShmSegment, reader_keeps_slot_alive)
+{
+    const auto segment = makeSegment({2, 16, 1, 1});
+
+    const auto slot_a = segment.allocateSlot();
+    fillSlot(segment, slot_a, 42);
+    segment.publish(0, {0, slot_a, Priority::Nominal, 0xFFFF});
+
+    std::uint64_t  cursor = 0;
+    std::size_t    lost   = 0;
+    Segment::Entry entry{};
+    ASSERT_TRUE(segment.read(0, cursor, entry, lost));
+
+    // Overwrite the entry - its slot is still referenced by the reader.
+    const auto slot_b = segment.allocateSlot();
+    segment.publish(0, {1, slot_b, Priority::Nominal, 0xFFFF});
+    EXPECT_THAT(segment.allocateSlot(), Segment::NoSlot);
+
+    {
+        SlotStorage storage{segment, entry.slot_index, segment.getSlotPayloadSize(entry.slot_index)};
+        EXPECT_THAT(storage.size(), sizeof(std::uint64_t));
+
+        std::uint64_t value = 0;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        EXPECT_THAT(storage.copy(0, reinterpret_cast<cetl::byte*>(&value), sizeof(value)), sizeof(value));
+        EXPECT_THAT(value, 42);
+
+        storage.truncate(3);
+        EXPECT_THAT(storage.size(), 3);
+        EXPECT_THAT(storage.copy(2, reinterpret_cast<cetl::byte*>(&value), sizeof(value)), 1);  // NOLINT
+        EXPECT_THAT(storage.copy(3, reinterpret_cast<cetl::byte*>(&value), sizeof(value)), 0);  // NOLINT
+
+        // The storage (moved into a buffer) is the last owner of the slot.
+        const ScatteredBuffer buffer{std::move(storage)};
+        EXPECT_THAT(buffer.size(), 3);
+        EXPECT_THAT(storage.size(), 0);  // NOLINT(bugprone-use-after-move)
+    }
+    EXPECT_THAT(segment.allocateSlot(), slot_a);
+}
+
+TEST_F(TestShmSegment, concurrent_producer_and_consumer)
+{
+    const auto segment = makeSegment({16, 16, 1, 8});
+
+    constexpr std::uint64_t TotalCount = 20000;
+    std::thread             producer{[&segment] {
+        for (std::uint64_t tid = 0; tid < TotalCount; ++tid)
+        {
+            std::uint32_t slot = Segment::NoSlot;
+            while ((slot = segment.allocateSlot()) == Segment::NoSlot)
+            {
+                std::this_thread::yield();
+            }
+            fillSlot(segment, slot, ~tid);
+            segment.publish(0, {tid, slot, Priority::Nominal, 0xFFFF});
+        }
+    }};
+
+    // Every read entry must be consistent with its slot content, and come in order.
+    std::uint64_t  cursor   = 0;
+    std::size_t    lost     = 0;
+    std::uint64_t  received = 0;
+    std::uint64_t  next_tid = 0;
+    Segment::Entry entry{};
+    while ((received + lost) < TotalCount)
+    {
+        if (!segment.read(0, cursor, entry, lost))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        EXPECT_THAT(entry.transfer_id, testing::Ge(next_tid));
+        EXPECT_THAT(slotValue(segment, entry.slot_index), ~entry.transfer_id);
+        next_tid = entry.transfer_id + 1;
+        segment.releaseSlot(entry.slot_index);
+        ++received;
+    }
+    producer.join();
+
+    EXPECT_THAT(received + lost, TotalCount);
+
+    // Nothing is leaked - all but ring referenced slots are free.
+    std::vector<std::uint32_t> slots;
+    std::uint32_t              slot = Segment::NoSlot;
+    while ((slot = segment.allocateSlot()) != Segment::NoSlot)
+    {
+        slots.push_back(slot);
+    }
+    EXPECT_THAT(slots.size(), 16 - 8);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,430 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/shm/media.hpp>
+#include <libcyphal/transport/shm/segment.hpp>
+#include <libcyphal/transport/shm/shm_transport.hpp>
+#include <libcyphal/transport/shm/shm_transport_impl.hpp>
+#include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::ArgumentError;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::shm;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::Optional;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+using Bytes = std::vector<cetl::byte>;
+
+class TestShmTransport : public testing::Test
+{
+protected:
+    /// Defines a node - its media (mock) and transport - attached to the common segment.
+    struct Node
+    {
+        StrictMock<MediaMock>    media_mock;
+        UniquePtr<IShmTransport> transport;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        const SegmentLayout layout{8, 64, 8, 4};
+        segment_memory_.resize((getSegmentSize(layout) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        EXPECT_THAT(formatSegment(segmentSpan(), layout), Eq(cetl::nullopt));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    cetl::span<cetl::byte> segmentSpan()
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return {reinterpret_cast<cetl::byte*>(segment_memory_.data()), segment_memory_.size() * sizeof(std::uint64_t)};
+    }
+
+    /// Makes transport of the node, and its media mock to notify all the other nodes.
+    void makeTransport(Node& node, const NodeId node_id)
+    {
+        EXPECT_CALL(node.media_mock, getSegment()).WillOnce(Return(segmentSpan()));
+
+        auto maybe_transport = shm::makeTransport(mr_, scheduler_, node.media_mock);
+        ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<IShmTransport>>(NotNull()));
+        node.transport = cetl::get<UniquePtr<IShmTransport>>(std::move(maybe_transport));
+        EXPECT_THAT(node.transport->setLocalNodeId(node_id), Eq(cetl::nullopt));
+
+        EXPECT_CALL(node.media_mock, notify()).WillRepeatedly(Invoke([this, node_id] {
+            for (const auto& name : notification_names_)
+            {
+                if (name != nameOf(node_id))
+                {
+                    scheduler_.scheduleNamedCallback(name);
+                }
+            }
+            return cetl::nullopt;
+        }));
+        EXPECT_CALL(node.media_mock, clearNotifications()).WillRepeatedly(Return());
+        EXPECT_CALL(node.media_mock, registerNotificationCallback(_))  //
+            .WillRepeatedly(Invoke([this, node_id](auto function) {
+                notification_names_.push_back(nameOf(node_id));
+                return scheduler_.registerNamedCallback(nameOf(node_id), std::move(function));
+            }));
+    }
+
+    static std::string nameOf(const NodeId node_id)
+    {
+        return "notify_" + std::to_string(node_id);
+    }
+
+    static Bytes payloadOf(const ScatteredBuffer& buffer)
+    {
+        Bytes bytes(buffer.size());
+        EXPECT_THAT(buffer.copy(0, bytes.data(), bytes.size()), bytes.size());
+        return bytes;
+    }
+
+    template <typename Session>
+    static UniquePtr<Session> getSession(libcyphal::Expected<UniquePtr<Session>, AnyFailure>&& maybe_session)
+    {
+        EXPECT_THAT(maybe_session, VariantWith<UniquePtr<Session>>(NotNull()));
+        return cetl::get<UniquePtr<Session>>(std::move(maybe_session));
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler scheduler_{};
+    TrackingMemoryResource          mr_;
+    std::vector<std::uint64_t>      segment_memory_;
+    std::vector<std::string>        notification_names_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestShmTransport, makeTransport)
+{
+    StrictMock<MediaMock> media_mock;
+
+    // Not formatted segment.
+    std::vector<std::uint64_t> raw_memory(64);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const cetl::span<cetl::byte> raw_span{reinterpret_cast<cetl::byte*>(raw_memory.data()), 64 * 8};
+    EXPECT_CALL(media_mock, getSegment()).WillOnce(Return(raw_span));
+    EXPECT_THAT(shm::makeTransport(mr_, scheduler_, media_mock),
+                VariantWith<FactoryFailure>(VariantWith<ArgumentError>(_)));
+
+    EXPECT_CALL(media_mock, getSegment()).WillOnce(Return(segmentSpan()));
+    auto maybe_transport = shm::makeTransport(mr_, scheduler_, media_mock);
+    ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<IShmTransport>>(NotNull()));
+    auto transport = cetl::get<UniquePtr<IShmTransport>>(std::move(maybe_transport));
+
+    EXPECT_THAT(transport->getLocalNodeId(), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->getProtocolParams().mtu_bytes, 64);
+    EXPECT_THAT(transport->getProtocolParams().max_nodes, 0xFFFF);
+    EXPECT_THAT(transport->getMediaStatistics(1), Eq(cetl::nullopt));
+
+    EXPECT_THAT(transport->setLocalNodeId(0xFFFF), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(transport->setLocalNodeId(1234), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(1234), Eq(cetl::nullopt));
+    EXPECT_THAT(transport->setLocalNodeId(42), Optional(testing::A<ArgumentError>()));
+    EXPECT_THAT(transport->getLocalNodeId(), Optional(1234));
+}
+
+TEST_F(TestShmTransport, make_sessions)
+{
+    Node node;
+    makeTransport(node, 1);
+    auto& transport = *node.transport;
+
+    EXPECT_THAT(transport.makeMessageRxSession({0, 8192}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport.makeMessageTxSession({8192}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport.makeRequestRxSession({0, 512}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport.makeRequestTxSession({123, 0xFFFF}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(transport.makeResponseTxSession({512}), VariantWith<AnyFailure>(VariantWith<ArgumentError>(_)));
+
+    auto rx_session1 = getSession(transport.makeMessageRxSession({0, 123}));
+    EXPECT_TRUE(scheduler_.hasNamedCallback(nameOf(1)));
+
+    // Same subject - already exists, but the same port ID of a different kind is fine.
+    EXPECT_THAT(transport.makeMessageRxSession({0, 123}), VariantWith<AnyFailure>(VariantWith<AlreadyExistsError>(_)));
+    auto rx_session2 = getSession(transport.makeResponseRxSession({0, 123, 7}));
+
+    // The notification callback is cancelled together with the last RX session.
+    rx_session1.reset();
+    EXPECT_TRUE(scheduler_.hasNamedCallback(nameOf(1)));
+    rx_session2.reset();
+    EXPECT_FALSE(scheduler_.hasNamedCallback(nameOf(1)));
+}
+
+TEST_F(TestShmTransport, publish_subscribe_without_copying)
+{
+    Node publisher;
+    Node subscriber;
+    makeTransport(publisher, 13);
+    makeTransport(subscriber, 42);
+
+    auto tx_session = getSession(publisher.transport->makeMessageTxSession({7}));
+    auto rx_session = getSession(subscriber.transport->makeMessageRxSession({4, 7}));
+
+    // Publisher doesn't receive its own messages.
+    auto own_rx_session = getSession(publisher.transport->makeMessageRxSession({16, 7}));
+
+    const Bytes payload{cetl::byte{1}, cetl::byte{0}, cetl::byte{2}, cetl::byte{3}, cetl::byte{4}, cetl::byte{5}};
+    const std::array<cetl::span<const cetl::byte>, 2> fragments{
+        {{payload.data(), 2}, {payload.data() + 2, payload.size() - 2}}};
+
+    std::size_t allocated_bytes = 0;
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(tx_session->send({{13, Priority::Fast}, now() + 1s}, fragments), Eq(cetl::nullopt));
+        allocated_bytes = mr_.total_allocated_bytes;
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        const auto rx_transfer = rx_session->receive();
+        ASSERT_THAT(rx_transfer, Optional(_));
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.transfer_id, 13);
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.base.priority, Priority::Fast);
+        EXPECT_THAT(rx_transfer->metadata.rx_meta.timestamp, TimePoint{1s});
+        EXPECT_THAT(rx_transfer->metadata.publisher_node_id, Optional(13));
+
+        // Payload is truncated to the extent.
+        EXPECT_THAT(payloadOf(rx_transfer->payload),
+                    ElementsAre(cetl::byte{1}, cetl::byte{0}, cetl::byte{2}, cetl::byte{3}));
+
+        // Receiving doesn't allocate memory - the payload stays in the shared slot.
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+
+        EXPECT_THAT(rx_session->receive(), Eq(cetl::nullopt));
+        EXPECT_THAT(own_rx_session->receive(), Eq(cetl::nullopt));
+
+        const auto tx_stats = publisher.transport->getTransferStatistics();
+        EXPECT_THAT(tx_stats.num_emitted, 1);
+        const auto rx_stats = subscriber.transport->getTransferStatistics();
+        EXPECT_THAT(rx_stats.num_received, 1);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestShmTransport, send_failures)
+{
+    Node node;
+    makeTransport(node, 1);
+    auto tx_session = getSession(node.transport->makeMessageTxSession({7}));
+
+    const Bytes                                       payload(65);
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    // Payload is too big for a slot.
+    EXPECT_THAT(tx_session->send({{0, Priority::Nominal}, now()}, fragments),
+                Optional(VariantWith<ArgumentError>(_)));
+
+    // Anonymous node can't publish.
+    Node anonymous;
+    EXPECT_CALL(anonymous.media_mock, getSegment()).WillOnce(Return(segmentSpan()));
+    auto maybe_transport = shm::makeTransport(mr_, scheduler_, anonymous.media_mock);
+    ASSERT_THAT(maybe_transport, VariantWith<UniquePtr<IShmTransport>>(NotNull()));
+    anonymous.transport    = cetl::get<UniquePtr<IShmTransport>>(std::move(maybe_transport));
+    auto anonymous_session = getSession(anonymous.transport->makeMessageTxSession({7}));
+    EXPECT_THAT(anonymous_session->send({{0, Priority::Nominal}, now()}, {}), Optional(VariantWith<AnonymousError>(_)));
+
+    // All slots are held by a subscriber which doesn't release its transfers.
+    Node subscriber;
+    makeTransport(subscriber, 2);
+    std::vector<ScatteredBuffer> held_payloads;
+    auto                         rx_session = getSession(subscriber.transport->makeMessageRxSession({64, 7}));
+    rx_session->setOnReceiveCallback([&](const auto& arg) {
+        //
+        held_payloads.push_back(std::move(arg.transfer.payload));
+    });
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        for (TransferId transfer_id = 0; transfer_id < 8; ++transfer_id)
+        {
+            EXPECT_THAT(tx_session->send({{transfer_id, Priority::Nominal}, now()}, {}), Eq(cetl::nullopt));
+            scheduler_.spinFor(1ms);
+        }
+        EXPECT_THAT(held_payloads.size(), 8);
+        EXPECT_THAT(tx_session->send({{8, Priority::Nominal}, now()}, {}), Optional(VariantWith<CapacityError>(_)));
+
+        // Released payloads free their slots.
+        held_payloads.clear();
+        EXPECT_THAT(tx_session->send({{8, Priority::Nominal}, now()}, {}), Eq(cetl::nullopt));
+    });
+    scheduler_.spinFor(10s);
+
+    const auto tx_stats = node.transport->getTransferStatistics();
+    EXPECT_THAT(tx_stats.num_emitted, 9);
+    EXPECT_THAT(tx_stats.num_errored, 2);
+    EXPECT_THAT(tx_stats.num_overruns, 1);
+}
+
+TEST_F(TestShmTransport, slow_subscriber_loses_transfers)
+{
+    Node publisher;
+    Node subscriber;
+    makeTransport(publisher, 1);
+    makeTransport(subscriber, 2);
+
+    auto tx_session = getSession(publisher.transport->makeMessageTxSession({7}));
+    auto rx_session = getSession(subscriber.transport->makeMessageRxSession({8, 7}));
+
+    std::vector<TransferId> transfer_ids;
+    rx_session->setOnReceiveCallback([&](const auto& arg) {
+        //
+        transfer_ids.push_back(arg.transfer.metadata.rx_meta.base.transfer_id);
+    });
+
+    // Publish 6 transfers at once - only the last 4 (ring capacity) are still in the ring on notification.
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        for (TransferId transfer_id = 0; transfer_id < 6; ++transfer_id)
+        {
+            EXPECT_THAT(tx_session->send({{transfer_id, Priority::Nominal}, now()}, {}), Eq(cetl::nullopt));
+        }
+    });
+    scheduler_.spinFor(10s);
+
+    EXPECT_THAT(transfer_ids, ElementsAre(2, 3, 4, 5));
+
+    const auto media_stats = subscriber.transport->getMediaStatistics(0);
+    ASSERT_THAT(media_stats, Optional(_));
+    EXPECT_THAT(media_stats->num_received, 4);
+    EXPECT_THAT(media_stats->num_errored, 2);
+    EXPECT_THAT(media_stats->num_overruns, 2);
+}
+
+TEST_F(TestShmTransport, request_response)
+{
+    Node client;
+    Node server;
+    Node other_server;
+    makeTransport(client, 1);
+    makeTransport(server, 2);
+    makeTransport(other_server, 3);
+
+    auto req_tx_session   = getSession(client.transport->makeRequestTxSession({123, 2}));
+    auto res_rx_session   = getSession(client.transport->makeResponseRxSession({8, 123, 2}));
+    auto req_rx_session   = getSession(server.transport->makeRequestRxSession({8, 123}));
+    auto res_tx_session   = getSession(server.transport->makeResponseTxSession({123}));
+    auto other_rx_session = getSession(other_server.transport->makeRequestRxSession({8, 123}));
+
+    const Bytes                                       payload{cetl::byte{42}};
+    const std::array<cetl::span<const cetl::byte>, 1> fragments{{{payload.data(), payload.size()}}};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        EXPECT_THAT(req_tx_session->send({{7, Priority::High}, now()}, fragments), Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 1ms, [&](const auto&) {
+        //
+        EXPECT_THAT(other_rx_session->receive(), Eq(cetl::nullopt));
+
+        const auto request = req_rx_session->receive();
+        ASSERT_THAT(request, Optional(_));
+        EXPECT_THAT(request->metadata.rx_meta.base.transfer_id, 7);
+        EXPECT_THAT(request->metadata.remote_node_id, 1);
+        EXPECT_THAT(payloadOf(request->payload), ElementsAre(cetl::byte{42}));
+
+        EXPECT_THAT(res_tx_session->send({{{7, Priority::High}, now()}, 0xFFFF}, fragments),
+                    Optional(VariantWith<ArgumentError>(_)));
+        EXPECT_THAT(res_tx_session->send({{{7, Priority::High}, now()}, request->metadata.remote_node_id}, fragments),
+                    Eq(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(1s + 2ms, [&](const auto&) {
+        //
+        const auto response = res_rx_session->receive();
+        ASSERT_THAT(response, Optional(_));
+        EXPECT_THAT(response->metadata.rx_meta.base.transfer_id, 7);
+        EXPECT_THAT(response->metadata.remote_node_id, 2);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestShmTransport, notify_failure)
+{
+    Node node;
+    makeTransport(node, 1);
+    auto tx_session = getSession(node.transport->makeMessageTxSession({7}));
+
+    EXPECT_CALL(node.media_mock, notify()).WillRepeatedly(Return(ArgumentError{}));
+
+    // Without handler the failure is propagated as is (although the transfer is published).
+    EXPECT_THAT(tx_session->send({{0, Priority::Nominal}, now()}, {}), Optional(VariantWith<ArgumentError>(_)));
+
+    std::size_t reports = 0;
+    node.transport->setTransientErrorHandler([&](IShmTransport::TransientErrorReport::Variant& report_var) {
+        using Report = IShmTransport::TransientErrorReport;
+        EXPECT_THAT(report_var, VariantWith<Report::MediaNotify>(_));
+        ++reports;
+        return cetl::nullopt;
+    });
+    EXPECT_THAT(tx_session->send({{1, Priority::Nominal}, now()}, {}), Eq(cetl::nullopt));
+    EXPECT_THAT(reports, 1);
+
+    const auto media_stats = node.transport->getMediaStatistics(0);
+    ASSERT_THAT(media_stats, Optional(_));
+    EXPECT_THAT(media_stats->num_emitted, 2);
+    EXPECT_THAT(media_stats->num_errored, 2);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,339 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "cetl_gtest_helpers.hpp"  // NOLINT(misc-include-cleaner)
+#include "gtest_helpers.hpp"       // NOLINT(misc-include-cleaner)
+#include "memory_resource_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "transport/msg_sessions_mock.hpp"
+#include "transport/scattered_buffer_storage_mock.hpp"
+#include "transport/transport_gtest_helpers.hpp"
+#include "transport/transport_mock.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/config.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/transport/bridge.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using libcyphal::MemoryError;
+using libcyphal::ArgumentError;
+using namespace libcyphal::transport;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Eq;
+using testing::Each;
+using testing::Invoke;
+using testing::ElementsAre;
+using testing::Return;
+using testing::IsEmpty;
+using testing::Optional;
+using testing::AnyNumber;
+using testing::StrictMock;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestBridge : public testing::Test
+{
+protected:
+    using UniquePtrMsgRxSpec = MessageRxSessionMock::RefWrapper::Spec;
+    using UniquePtrMsgTxSpec = MessageTxSessionMock::RefWrapper::Spec;
+    using MsgRxCallback      = IMessageRxSession::OnReceiveCallback;
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    void expectRoute(const PortId                      subject_id,
+                     StrictMock<MessageRxSessionMock>& rx_session_mock,
+                     StrictMock<MessageTxSessionMock>& tx_session_mock,
+                     MsgRxCallback::Function&          callback)
+    {
+        EXPECT_CALL(target_mock_, makeMessageTxSession(MessageTxParamsEq({subject_id})))  //
+            .WillOnce(Invoke([&](const auto&) {                                            //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, tx_session_mock);
+            }));
+        EXPECT_CALL(source_mock_, makeMessageRxSession(MessageRxParamsEq({16, subject_id})))  //
+            .WillOnce(Invoke([&](const auto&) {                                                //
+                return libcyphal::detail::makeUniquePtr<UniquePtrMsgRxSpec>(mr_, rx_session_mock);
+            }));
+        EXPECT_CALL(rx_session_mock, setOnReceiveCallback(_))  //
+            .WillOnce(Invoke([&](auto&& cb_fn) {               //
+                callback = std::forward<MsgRxCallback::Function>(cb_fn);
+            }));
+        EXPECT_CALL(rx_session_mock, deinit()).Times(1);
+        EXPECT_CALL(tx_session_mock, deinit()).Times(1);
+    }
+
+    /// Delivers a transfer with the given payload fragments to the bridge.
+    ///
+    /// @param is_observable Whether the payload storage exposes its fragments (see `IStorage::observeFragments`).
+    ///
+    static void deliver(MsgRxCallback::Function&                    callback,
+                        const TransferId                            transfer_id,
+                        const Priority                              priority,
+                        const TimePoint                             timestamp,
+                        const std::vector<std::vector<cetl::byte>>& fragments,
+                        const bool                                  is_observable = true)
+    {
+        std::size_t payload_size = 0;
+        for (const auto& fragment : fragments)
+        {
+            payload_size += fragment.size();
+        }
+
+        StrictMock<ScatteredBufferStorageMock> storage_mock;
+        EXPECT_CALL(storage_mock, deinit()).Times(1);
+        EXPECT_CALL(storage_mock, moved()).Times(AnyNumber());
+        EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(payload_size));
+        EXPECT_CALL(storage_mock, observeFragments(_))
+            .WillRepeatedly(Invoke([&](ScatteredBuffer::IFragmentsObserver& observer) {
+                if (is_observable)
+                {
+                    for (const auto& fragment : fragments)
+                    {
+                        observer.onNext({fragment.data(), fragment.size()});
+                    }
+                }
+                return is_observable;
+            }));
+        EXPECT_CALL(storage_mock, copy(_, _, _))
+            .WillRepeatedly(Invoke([&](const std::size_t offset, cetl::byte* const dst, const std::size_t length) {
+                std::vector<cetl::byte> flat;
+                for (const auto& fragment : fragments)
+                {
+                    flat.insert(flat.end(), fragment.begin(), fragment.end());
+                }
+                const std::size_t copied = std::min(length, flat.size() - offset);
+                std::memmove(dst, flat.data() + offset, copied);
+                return copied;
+            }));
+
+        MessageRxTransfer transfer{{{{transfer_id, priority}, timestamp}, NodeId{42}},
+                                   ScatteredBuffer{ScatteredBufferStorageMock::Wrapper{&storage_mock}}};
+        callback(MsgRxCallback::Arg{transfer});
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    TrackingMemoryResource    mr_;
+    StrictMock<TransportMock> source_mock_;
+    StrictMock<TransportMock> target_mock_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestBridge, addSubject)
+{
+    StrictMock<MessageRxSessionMock> rx_session_mock;
+    StrictMock<MessageTxSessionMock> tx_session_mock;
+    MsgRxCallback::Function          callback;
+    expectRoute(123, rx_session_mock, tx_session_mock, callback);
+
+    Bridge bridge{mr_, source_mock_, target_mock_};
+    EXPECT_THAT(bridge.getSubjectsCount(), 0);
+
+    EXPECT_THAT(bridge.addSubject(123, 16), Eq(cetl::nullopt));
+    EXPECT_THAT(bridge.getSubjectsCount(), 1);
+    EXPECT_TRUE(callback);
+
+    // Already forwarded.
+    EXPECT_THAT(bridge.addSubject(123, 16), Optional(VariantWith<ArgumentError>(_)));
+    EXPECT_THAT(bridge.getSubjectsCount(), 1);
+}
+
+TEST_F(TestBridge, addSubject_failures)
+{
+    Bridge bridge{mr_, source_mock_, target_mock_};
+
+    // Target TX session failure.
+    EXPECT_CALL(target_mock_, makeMessageTxSession(_)).WillOnce(Return(MemoryError{}));
+    EXPECT_THAT(bridge.addSubject(123, 16), Optional(VariantWith<MemoryError>(_)));
+
+    // Source RX session failure - already made TX session is released.
+    StrictMock<MessageTxSessionMock> tx_session_mock;
+    EXPECT_CALL(target_mock_, makeMessageTxSession(_))  //
+        .WillOnce(Invoke([&](const auto&) {             //
+            return libcyphal::detail::makeUniquePtr<UniquePtrMsgTxSpec>(mr_, tx_session_mock);
+        }));
+    EXPECT_CALL(tx_session_mock, deinit()).Times(1);
+    EXPECT_CALL(source_mock_, makeMessageRxSession(_)).WillOnce(Return(AlreadyExistsError{}));
+    EXPECT_THAT(bridge.addSubject(123, 16), Optional(VariantWith<AlreadyExistsError>(_)));
+
+    EXPECT_THAT(bridge.getSubjectsCount(), 0);
+}
+
+TEST_F(TestBridge, forward)
+{
+    StrictMock<MessageRxSessionMock> rx_session_mock;
+    StrictMock<MessageTxSessionMock> tx_session_mock;
+    MsgRxCallback::Function          callback;
+    expectRoute(123, rx_session_mock, tx_session_mock, callback);
+
+    Bridge bridge{mr_, source_mock_, target_mock_};
+    bridge.setTxTimeout(100ms);
+    ASSERT_THAT(bridge.addSubject(123, 16), Eq(cetl::nullopt));
+    ASSERT_TRUE(callback);
+
+    // Fragments are passed as is (without copying), priority is kept,
+    // and the deadline is counted from the reception timestamp.
+    {
+        const std::vector<std::vector<cetl::byte>> fragments{{cetl::byte{1}, cetl::byte{2}}, {cetl::byte{3}}};
+        EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{1, Priority::Fast}, TimePoint{1s + 100ms}}), _))
+            .WillOnce(Invoke([&](const auto&, const PayloadFragments payload_fragments) {
+                EXPECT_THAT(payload_fragments.size(), 2);
+                EXPECT_THAT(payload_fragments[0].data(), fragments[0].data());
+                EXPECT_THAT(payload_fragments[0].size(), 2);
+                EXPECT_THAT(payload_fragments[1].data(), fragments[1].data());
+                EXPECT_THAT(payload_fragments[1].size(), 1);
+                return cetl::nullopt;
+            }));
+        deliver(callback, 29, Priority::Fast, TimePoint{1s}, fragments);
+    }
+
+    // Transfer IDs are sequential on the target side, regardless of the received ones.
+    {
+        EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{2, Priority::Slow}, TimePoint{2s + 100ms}}), _))
+            .WillOnce(Invoke([](const auto&, const PayloadFragments payload_fragments) {
+                EXPECT_THAT(payload_fragments, IsEmpty());
+                return cetl::nullopt;
+            }));
+        deliver(callback, 3, Priority::Slow, TimePoint{2s}, {});
+    }
+
+    // Failure to send is counted, and the transfer is dropped.
+    {
+        EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{3, Priority::Nominal}, TimePoint{3s + 100ms}}), _))
+            .WillOnce(Return(CapacityError{}));
+        deliver(callback, 4, Priority::Nominal, TimePoint{3s}, {{cetl::byte{7}}});
+    }
+
+    const auto stats = bridge.getStatistics();
+    EXPECT_THAT(stats.num_received, 3);
+    EXPECT_THAT(stats.num_emitted, 2);
+    EXPECT_THAT(stats.num_errored, 1);
+    EXPECT_THAT(stats.num_overruns, 1);
+}
+
+TEST_F(TestBridge, forward_too_many_fragments)
+{
+    StrictMock<MessageRxSessionMock> rx_session_mock;
+    StrictMock<MessageTxSessionMock> tx_session_mock;
+    MsgRxCallback::Function          callback;
+    expectRoute(123, rx_session_mock, tx_session_mock, callback);
+
+    StrictMock<MemoryResourceMock> mr_mock;
+    mr_mock.redirectExpectedCallsTo(mr_);
+
+    Bridge bridge{mr_mock, source_mock_, target_mock_};
+    ASSERT_THAT(bridge.addSubject(123, 16), Eq(cetl::nullopt));
+    ASSERT_TRUE(callback);
+
+    constexpr std::size_t                MaxFragments = libcyphal::config::Transport::Bridge_MaxFragments();
+    std::vector<std::vector<cetl::byte>> fragments;
+    for (std::size_t index = 0; index <= MaxFragments; ++index)
+    {
+        fragments.push_back({cetl::byte{0x5A}, cetl::byte{0x5A}});
+    }
+
+    // Fragments are gathered into a single temporary buffer.
+    EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{1, Priority::High}, TimePoint{1s + 1s}}), _))
+        .WillOnce(Invoke([&](const auto&, const PayloadFragments payload_fragments) {
+            EXPECT_THAT(payload_fragments.size(), 1);
+            EXPECT_THAT(payload_fragments[0].size(), 2 * (MaxFragments + 1));
+            EXPECT_THAT(payload_fragments[0], Each(cetl::byte{0x5A}));
+            EXPECT_THAT(mr_.allocations.back().size, 2 * (MaxFragments + 1));
+            return cetl::nullopt;
+        }));
+    deliver(callback, 0, Priority::High, TimePoint{1s}, fragments);
+
+    // No memory for the temporary buffer.
+    EXPECT_CALL(mr_mock, do_allocate(2 * (MaxFragments + 1), _)).WillOnce(Return(nullptr));
+    deliver(callback, 1, Priority::High, TimePoint{1s}, fragments);
+
+    const auto stats = bridge.getStatistics();
+    EXPECT_THAT(stats.num_received, 2);
+    EXPECT_THAT(stats.num_emitted, 1);
+    EXPECT_THAT(stats.num_errored, 1);
+    EXPECT_THAT(stats.num_overruns, 1);
+}
+
+TEST_F(TestBridge, forward_not_observable_fragments)
+{
+    StrictMock<MessageRxSessionMock> rx_session_mock;
+    StrictMock<MessageTxSessionMock> tx_session_mock;
+    MsgRxCallback::Function          callback;
+    expectRoute(123, rx_session_mock, tx_session_mock, callback);
+
+    Bridge bridge{mr_, source_mock_, target_mock_};
+    ASSERT_THAT(bridge.addSubject(123, 16), Eq(cetl::nullopt));
+    ASSERT_TRUE(callback);
+
+    // Storage which can't expose its fragments is gathered (copied) into a single temporary buffer.
+    {
+        const std::vector<std::vector<cetl::byte>> fragments{{cetl::byte{1}, cetl::byte{2}}, {cetl::byte{3}}};
+        EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{1, Priority::Fast}, TimePoint{1s + 1s}}), _))
+            .WillOnce(Invoke([&](const auto&, const PayloadFragments payload_fragments) {
+                EXPECT_THAT(payload_fragments.size(), 1);
+                EXPECT_THAT(payload_fragments[0], ElementsAre(cetl::byte{1}, cetl::byte{2}, cetl::byte{3}));
+                EXPECT_THAT(mr_.allocations.back().size, 3);
+                return cetl::nullopt;
+            }));
+        deliver(callback, 0, Priority::Fast, TimePoint{1s}, fragments, false);
+    }
+
+    // Empty payload doesn't need any temporary buffer.
+    {
+        const auto allocated_bytes = mr_.total_allocated_bytes;
+        EXPECT_CALL(tx_session_mock, send(TransferTxMetadataEq({{2, Priority::Fast}, TimePoint{2s + 1s}}), _))
+            .WillOnce(Invoke([](const auto&, const PayloadFragments payload_fragments) {
+                EXPECT_THAT(payload_fragments, IsEmpty());
+                return cetl::nullopt;
+            }));
+        deliver(callback, 1, Priority::Fast, TimePoint{2s}, {}, false);
+        EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    }
+
+    const auto stats = bridge.getStatistics();
+    EXPECT_THAT(stats.num_received, 2);
+    EXPECT_THAT(stats.num_emitted, 2);
+    EXPECT_THAT(stats.num_errored, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
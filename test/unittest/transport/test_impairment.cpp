@@ -0,0 +1,265 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/impairment.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::transport;  // NOLINT This our main concern here in the unit tests.
+
+using testing::Eq;
+using testing::Le;
+using testing::Gt;
+using testing::Lt;
+using testing::Optional;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestImpairment : public testing::Test
+{
+protected:
+    struct Frame
+    {
+        TimePoint   timestamp;
+        std::size_t value;
+    };
+
+    template <std::size_t Capacity = 16>
+    using Queue = detail::ImpairmentQueue<Frame, Capacity>;
+
+    static cetl::optional<Frame> copyFrame(const Frame& frame)
+    {
+        return frame;
+    }
+
+    /// Admits frames one by one (with the given interval), and collects all delivered ones (until the queue is empty).
+    ///
+    template <typename QueueT>
+    static std::vector<Frame> run(QueueT& queue, const std::size_t frames, const libcyphal::Duration interval)
+    {
+        std::vector<Frame> delivered;
+        TimePoint          now{};
+        for (std::size_t value = 0; (value < frames) || queue.getNextDueTime().has_value(); ++value)
+        {
+            if (value < frames)
+            {
+                queue.admit(Frame{now, value}, now, copyFrame);
+            }
+            while (auto frame = queue.popDue(now))
+            {
+                delivered.push_back(*frame);
+            }
+            now += interval;
+        }
+        return delivered;
+    }
+
+    static std::vector<std::size_t> valuesOf(const std::vector<Frame>& frames)
+    {
+        std::vector<std::size_t> values;
+        for (const auto& frame : frames)
+        {
+            values.push_back(frame.value);
+        }
+        return values;
+    }
+};
+
+// MARK: - Tests:
+
+TEST_F(TestImpairment, disabled_by_default)
+{
+    const Impairments impairments{};
+    EXPECT_FALSE(impairments.isEnabled());
+
+    Impairments with_reorder_but_no_window{};
+    with_reorder_but_no_window.reorder_probability = 1.0F;
+    EXPECT_FALSE(with_reorder_but_no_window.isEnabled());
+
+    ImpairmentCounters counters;
+    Queue<>            queue{impairments, counters};
+    EXPECT_FALSE(queue.isEnabled());
+
+    // Even disabled queue works - it just passes frames as is.
+    const auto delivered = run(queue, 3, 1ms);
+    EXPECT_THAT(valuesOf(delivered), ElementsAre(0, 1, 2));
+    EXPECT_THAT(counters.passed, 3);
+    EXPECT_THAT(counters.dropped + counters.duplicated + counters.delayed + counters.reordered, 0);
+}
+
+TEST_F(TestImpairment, drop)
+{
+    Impairments impairments{};
+    impairments.seed             = 42;
+    impairments.drop_probability = 0.25F;
+
+    ImpairmentCounters counters;
+    Queue<>            queue{impairments, counters};
+    EXPECT_TRUE(queue.isEnabled());
+
+    const auto delivered = run(queue, 10000, 1ms);
+    EXPECT_THAT(counters.dropped + counters.passed, 10000);
+    EXPECT_THAT(counters.dropped, Gt(2300));
+    EXPECT_THAT(counters.dropped, Lt(2700));
+    EXPECT_THAT(delivered.size(), counters.passed);
+
+    // The same seed gives the same outcome.
+    ImpairmentCounters same_counters;
+    Queue<>            same_queue{impairments, same_counters};
+    EXPECT_THAT(valuesOf(run(same_queue, 10000, 1ms)), ElementsAreArray(valuesOf(delivered)));
+
+    // Everything is dropped with probability 1.
+    impairments.drop_probability = 1.0F;
+    ImpairmentCounters all_counters;
+    Queue<>            all_queue{impairments, all_counters};
+    EXPECT_THAT(run(all_queue, 100, 1ms).size(), 0);
+    EXPECT_THAT(all_counters.dropped, 100);
+}
+
+TEST_F(TestImpairment, delay_and_jitter)
+{
+    Impairments impairments{};
+    impairments.delay  = 5ms;
+    impairments.jitter = 300us;
+
+    ImpairmentCounters counters;
+    Queue<>            queue{impairments, counters};
+
+    const TimePoint now{1ms};
+    queue.admit(Frame{now, 7}, now, copyFrame);
+    EXPECT_THAT(queue.popDue(now), Eq(cetl::nullopt));
+
+    const auto due_time = queue.getNextDueTime();
+    ASSERT_THAT(due_time, Optional(Le(now + 5300us)));
+    EXPECT_THAT(*due_time, testing::Ge(now + 5ms));  // NOLINT(bugprone-unchecked-optional-access)
+
+    // Timestamp is shifted by the time the frame has spent in the queue.
+    const auto frame = queue.popDue(now + 10ms);
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_THAT(frame->value, 7);                   // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(frame->timestamp, now + 10ms);      // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(queue.getNextDueTime(), Eq(cetl::nullopt));
+    EXPECT_THAT(counters.delayed, 1);
+    EXPECT_THAT(counters.passed, 1);
+
+    // Jitter bigger than interval between frames reorders them, but delay stays within the bounds.
+    ImpairmentCounters jitter_counters;
+    Queue<64>          jitter_queue{impairments, jitter_counters};
+    const auto         delivered = run(jitter_queue, 1000, 100us);
+    ASSERT_THAT(delivered.size(), 1000);
+    EXPECT_THAT(jitter_counters.overflows, 0);
+    bool is_reordered = false;
+    for (std::size_t index = 0; index < delivered.size(); ++index)
+    {
+        const auto sent_at = TimePoint{} + (delivered[index].value * 100us);
+        EXPECT_THAT(delivered[index].timestamp - sent_at, testing::Ge(5ms));
+        EXPECT_THAT(delivered[index].timestamp - sent_at, Le(5400us));
+        is_reordered |= (index > 0) && (delivered[index].value < delivered[index - 1].value);
+    }
+    EXPECT_TRUE(is_reordered);
+}
+
+TEST_F(TestImpairment, reorder_window)
+{
+    Impairments impairments{};
+    impairments.seed                = 13;
+    impairments.reorder_probability = 0.1F;
+    impairments.reorder_window      = 3;
+    impairments.reorder_timeout     = 100ms;
+
+    ImpairmentCounters counters;
+    Queue<>            queue{impairments, counters};
+
+    const auto delivered = run(queue, 1000, 1ms);
+    ASSERT_THAT(delivered.size(), 1000);
+    EXPECT_THAT(counters.reordered, Gt(50));
+    EXPECT_THAT(counters.reordered, Lt(150));
+
+    // A held back frame is overtaken by `reorder_window` subsequent frames (more if several are held at once).
+    std::size_t max_displacement = 0;
+    for (std::size_t index = 0; index < delivered.size(); ++index)
+    {
+        if (delivered[index].value < index)
+        {
+            max_displacement = std::max(max_displacement, index - delivered[index].value);
+        }
+    }
+    EXPECT_THAT(max_displacement, Gt(0));
+    EXPECT_THAT(max_displacement, Le(3 * impairments.reorder_window));
+
+    // The last frame has no subsequent frames, so it's released by the timeout.
+    Impairments always{impairments};
+    always.reorder_probability = 1.0F;
+    ImpairmentCounters always_counters;
+    Queue<>            always_queue{always, always_counters};
+    always_queue.admit(Frame{TimePoint{}, 0}, TimePoint{}, copyFrame);
+    EXPECT_THAT(always_queue.getNextDueTime(), Optional(TimePoint{100ms}));
+    EXPECT_THAT(always_queue.popDue(TimePoint{99ms}), Eq(cetl::nullopt));
+    EXPECT_TRUE(always_queue.popDue(TimePoint{100ms}).has_value());
+}
+
+TEST_F(TestImpairment, duplicate)
+{
+    Impairments impairments{};
+    impairments.duplicate_probability = 1.0F;
+
+    ImpairmentCounters counters;
+    Queue<>            queue{impairments, counters};
+
+    EXPECT_THAT(valuesOf(run(queue, 3, 1ms)), ElementsAre(0, 0, 1, 1, 2, 2));
+    EXPECT_THAT(counters.duplicated, 3);
+    EXPECT_THAT(counters.passed, 6);
+
+    // Failed copy means no duplicate.
+    queue.admit(Frame{TimePoint{}, 3}, TimePoint{}, [](const Frame&) { return cetl::optional<Frame>{}; });
+    EXPECT_TRUE(queue.popDue(TimePoint{}).has_value());
+    EXPECT_THAT(queue.popDue(TimePoint{}), Eq(cetl::nullopt));
+    EXPECT_THAT(counters.duplicated, 3);
+}
+
+TEST_F(TestImpairment, overflow)
+{
+    Impairments impairments{};
+    impairments.delay = 1ms;
+
+    ImpairmentCounters counters;
+    Queue<4>           queue{impairments, counters};
+    for (std::size_t value = 0; value < 6; ++value)
+    {
+        queue.admit(Frame{TimePoint{}, value}, TimePoint{}, copyFrame);
+    }
+    EXPECT_THAT(counters.overflows, 2);
+    EXPECT_THAT(counters.delayed, 4);
+
+    std::vector<std::size_t> values;
+    while (auto frame = queue.popDue(TimePoint{1ms}))
+    {
+        values.push_back(frame->value);
+    }
+    EXPECT_THAT(values, ElementsAre(0, 1, 2, 3));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
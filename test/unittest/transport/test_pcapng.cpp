@@ -0,0 +1,341 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "verification_utilities.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/transport/pcapng.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::TimePoint;
+using namespace libcyphal::transport;          // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::pcapng;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::Eq;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+using std::literals::chrono_literals::operator""ns;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPcapng : public testing::Test
+{
+protected:
+    class MemorySink final : public ISink
+    {
+    public:
+        MemorySink()                                 = default;
+        ~MemorySink()                                = default;
+        MemorySink(const MemorySink&)                = delete;
+        MemorySink(MemorySink&&) noexcept            = delete;
+        MemorySink& operator=(const MemorySink&)     = delete;
+        MemorySink& operator=(MemorySink&&) noexcept = delete;
+
+        bool write(const cetl::span<const cetl::byte> data) override
+        {
+            if (is_failing)
+            {
+                return false;
+            }
+            bytes.insert(bytes.end(), data.begin(), data.end());
+            return true;
+        }
+
+        // NOLINTBEGIN
+        std::vector<cetl::byte> bytes;
+        bool                    is_failing{false};
+        // NOLINTEND
+
+    };  // MemorySink
+
+    static std::vector<cetl::byte> toVector(const cetl::span<const cetl::byte> data)
+    {
+        return {data.begin(), data.end()};
+    }
+
+    /// Appends a big-endian 32-bit value - for hand-crafted captures.
+    ///
+    static void appendBe32(std::vector<cetl::byte>& bytes, const std::uint32_t value)
+    {
+        bytes.push_back(b(static_cast<std::uint8_t>(value >> 24U)));
+        bytes.push_back(b(static_cast<std::uint8_t>(value >> 16U)));
+        bytes.push_back(b(static_cast<std::uint8_t>(value >> 8U)));
+        bytes.push_back(b(static_cast<std::uint8_t>(value)));
+    }
+};
+
+// MARK: - Tests:
+
+TEST_F(TestPcapng, write_and_read)
+{
+    MemorySink sink;
+    Writer     writer{sink};
+
+    const auto can_interface = writer.addInterface(LinkType::CanSocketCan, 72);
+    const auto ip_interface  = writer.addInterface(LinkType::Ipv4, 1500);
+    EXPECT_THAT(can_interface, testing::Optional(0U));
+    EXPECT_THAT(ip_interface, testing::Optional(1U));
+
+    // Section header is little-endian.
+    ASSERT_THAT(sink.bytes.size(), 28 + 32 + 32);
+    EXPECT_THAT(toVector({sink.bytes.data(), 12}),
+                ElementsAre(b(0x0A), b(0x0D), b(0x0D), b(0x0A),  // block type
+                            b(28), b(0), b(0), b(0),              // block length
+                            b(0x4D), b(0x3C), b(0x2B), b(0x1A)));  // byte-order magic
+
+    const std::array<cetl::byte, 3> part1{b(0x01), b(0x02), b(0x03)};
+    const std::array<cetl::byte, 2> part2{b(0x04), b(0x05)};
+    const std::array<cetl::span<const cetl::byte>, 2> fragments{part1, part2};
+
+    EXPECT_TRUE(writer.writePacket(0, 5'000'000'123ns, Direction::Inbound, fragments));
+    EXPECT_TRUE(writer.writePacket(1, 7ms, Direction::Outbound, {fragments.data(), 1}));
+    EXPECT_TRUE(writer.writePacket(0, -1ns, Direction::Unknown, {}));
+    EXPECT_THAT(writer.getPacketsCount(), 3);
+    EXPECT_THAT(writer.getFailuresCount(), 0);
+    EXPECT_THAT(sink.bytes.size() % 4, 0);
+
+    Reader reader{sink.bytes};
+
+    auto packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->link_type, LinkType::CanSocketCan);   // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->interface_id, 0);                     // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->timestamp, 5'000'000'123ns);          // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->direction, Direction::Inbound);       // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(toVector(packet->data),                       // NOLINT(bugprone-unchecked-optional-access)
+                ElementsAre(b(0x01), b(0x02), b(0x03), b(0x04), b(0x05)));
+
+    packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->link_type, LinkType::Ipv4);      // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->timestamp, 7ms);                 // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->direction, Direction::Outbound);  // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->data.size(), 3);                 // NOLINT(bugprone-unchecked-optional-access)
+
+    packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->timestamp, 0ns);               // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_THAT(packet->direction, Direction::Unknown);  // NOLINT(bugprone-unchecked-optional-access)
+    EXPECT_TRUE(packet->data.empty());                 // NOLINT(bugprone-unchecked-optional-access)
+
+    EXPECT_THAT(reader.next(), Eq(cetl::nullopt));
+    EXPECT_FALSE(reader.isMalformed());
+
+    // Rewind starts from the very beginning.
+    reader.rewind();
+    packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->timestamp, 5'000'000'123ns);  // NOLINT(bugprone-unchecked-optional-access)
+
+    // Truncated capture is malformed.
+    Reader truncated{{sink.bytes.data(), sink.bytes.size() - 4}};
+    while (truncated.next().has_value())
+    {
+    }
+    EXPECT_TRUE(truncated.isMalformed());
+}
+
+TEST_F(TestPcapng, sink_failures)
+{
+    MemorySink sink;
+    Writer     writer{sink};
+
+    sink.is_failing = true;
+    EXPECT_THAT(writer.addInterface(LinkType::Ipv4, 1500), Eq(cetl::nullopt));
+    EXPECT_FALSE(writer.writePacket(0, 1ms, Direction::Inbound, {}));
+    EXPECT_THAT(writer.getFailuresCount(), 3);  // the section header (twice), and the packet
+    EXPECT_THAT(writer.getPacketsCount(), 0);
+
+    // Section header is written once sink recovers.
+    sink.is_failing = false;
+    EXPECT_THAT(writer.addInterface(LinkType::Ipv4, 1500), testing::Optional(0U));
+    EXPECT_THAT(sink.bytes.size(), 28 + 32);
+}
+
+TEST_F(TestPcapng, read_big_endian_with_default_resolution)
+{
+    // Hand-crafted big-endian section: SHB, IDB (without options, so microseconds),
+    // IDB with 2^-10 resolution, unknown block, and two EPBs.
+    std::vector<cetl::byte> bytes;
+    appendBe32(bytes, 0x0A0D0D0A);
+    appendBe32(bytes, 28);
+    appendBe32(bytes, 0x1A2B3C4D);
+    appendBe32(bytes, 0x00010000);
+    appendBe32(bytes, 0xFFFFFFFF);
+    appendBe32(bytes, 0xFFFFFFFF);
+    appendBe32(bytes, 28);
+
+    appendBe32(bytes, 1);
+    appendBe32(bytes, 20);
+    appendBe32(bytes, 0x00E30000);  // CAN SocketCAN
+    appendBe32(bytes, 72);
+    appendBe32(bytes, 20);
+
+    appendBe32(bytes, 1);
+    appendBe32(bytes, 28);
+    appendBe32(bytes, 0x00E40000);  // IPv4
+    appendBe32(bytes, 1500);
+    appendBe32(bytes, 0x00090001);  // if_tsresol
+    appendBe32(bytes, 0x8A000000);  // 2^-10
+    appendBe32(bytes, 28);
+
+    appendBe32(bytes, 0x00000BAD);
+    appendBe32(bytes, 12);
+    appendBe32(bytes, 12);
+
+    appendBe32(bytes, 6);
+    appendBe32(bytes, 36);
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 1500);  // 1.5ms
+    appendBe32(bytes, 3);
+    appendBe32(bytes, 3);
+    appendBe32(bytes, 0xAABBCC00);
+    appendBe32(bytes, 36);
+
+    appendBe32(bytes, 6);
+    appendBe32(bytes, 44);
+    appendBe32(bytes, 1);
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 3 * 1024 + 512);  // 3.5s
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 0x00020004);  // epb_flags
+    appendBe32(bytes, 2);           // outbound
+    appendBe32(bytes, 0);
+    appendBe32(bytes, 44);
+
+    Reader reader{bytes};
+
+    auto packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->link_type, LinkType::CanSocketCan);                         // NOLINT
+    EXPECT_THAT(packet->timestamp, 1500us);                                         // NOLINT
+    EXPECT_THAT(packet->direction, Direction::Unknown);                             // NOLINT
+    EXPECT_THAT(toVector(packet->data), ElementsAre(b(0xAA), b(0xBB), b(0xCC)));  // NOLINT
+
+    packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->link_type, LinkType::Ipv4);        // NOLINT
+    EXPECT_THAT(packet->timestamp, 3500ms);                // NOLINT
+    EXPECT_THAT(packet->direction, Direction::Outbound);  // NOLINT
+
+    EXPECT_THAT(reader.next(), Eq(cetl::nullopt));
+    EXPECT_FALSE(reader.isMalformed());
+
+    // Without the section header the capture is malformed.
+    Reader no_section{{bytes.data() + 28, bytes.size() - 28}};
+    EXPECT_THAT(no_section.next(), Eq(cetl::nullopt));
+    EXPECT_TRUE(no_section.isMalformed());
+}
+
+TEST_F(TestPcapng, socketcan_frames)
+{
+    const auto header = SocketCan::makeHeader(0x107D552A, 5, false);
+    EXPECT_THAT(header, ElementsAre(b(0x90), b(0x7D), b(0x55), b(0x2A), b(5), b(0), b(0), b(0)));
+    EXPECT_THAT(SocketCan::getPaddingSize(5, false), 3);
+    EXPECT_THAT(SocketCan::getPaddingSize(5, true), 59);
+    EXPECT_THAT(SocketCan::makeHeader(0x123, 12, true)[5], b(0x04));
+
+    std::vector<cetl::byte> data{header.begin(), header.end()};
+    data.insert(data.end(), {b(1), b(2), b(3), b(4), b(5), b(0), b(0), b(0)});
+
+    const auto frame = SocketCan::parse(data);
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_THAT(frame->can_id, 0x107D552A);                                             // NOLINT
+    EXPECT_THAT(toVector(frame->payload), ElementsAre(b(1), b(2), b(3), b(4), b(5)));  // NOLINT
+
+    // Standard, remote and error frames are ignored - as well as truncated ones.
+    data[0] = b(0x00);
+    EXPECT_THAT(SocketCan::parse(data), Eq(cetl::nullopt));
+    data[0] = b(0xD0);
+    EXPECT_THAT(SocketCan::parse(data), Eq(cetl::nullopt));
+    data[0] = b(0x90);
+    EXPECT_THAT(SocketCan::parse({data.data(), 12}), Eq(cetl::nullopt));
+}
+
+TEST_F(TestPcapng, ipv4_udp_datagrams)
+{
+    const auto headers = Ipv4Udp::makeHeaders(0xEF001234, 9382, 7, 4);
+    EXPECT_THAT(toVector({headers.data(), 12}),
+                ElementsAre(b(0x45), b(7 << 2), b(0), b(32),  // version, DSCP, total length
+                            b(0), b(0), b(0x40), b(0),        // id, don't fragment
+                            b(16), b(17), b(0x69), b(0x7D)));  // TTL, UDP, checksum
+    EXPECT_THAT(toVector({headers.data() + 16, 12}),
+                ElementsAre(b(0xEF), b(0x00), b(0x12), b(0x34),  // destination address
+                            b(0), b(0), b(0x24), b(0xA6),        // source and destination ports
+                            b(0), b(12), b(0), b(0)));           // UDP length and checksum
+
+    std::vector<cetl::byte> ip_packet{headers.begin(), headers.end()};
+    ip_packet.insert(ip_packet.end(), {b(1), b(2), b(3), b(4)});
+
+    auto datagram = Ipv4Udp::parse(LinkType::Ipv4, ip_packet);
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_THAT(datagram->ip_address, 0xEF001234);                                   // NOLINT
+    EXPECT_THAT(datagram->udp_port, 9382);                                           // NOLINT
+    EXPECT_THAT(toVector(datagram->payload), ElementsAre(b(1), b(2), b(3), b(4)));  // NOLINT
+
+    // The same datagram within an Ethernet frame with a VLAN tag, and a trailing padding.
+    std::vector<cetl::byte> ethernet(12, b(0xEE));
+    ethernet.insert(ethernet.end(), {b(0x81), b(0x00), b(0x00), b(0x05), b(0x08), b(0x00)});
+    ethernet.insert(ethernet.end(), ip_packet.begin(), ip_packet.end());
+    ethernet.insert(ethernet.end(), 8, b(0));
+    datagram = Ipv4Udp::parse(LinkType::Ethernet, ethernet);
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_THAT(toVector(datagram->payload), ElementsAre(b(1), b(2), b(3), b(4)));  // NOLINT
+
+    // Unsupported link types, non-UDP protocols and fragments are ignored.
+    EXPECT_THAT(Ipv4Udp::parse(LinkType::CanSocketCan, ip_packet), Eq(cetl::nullopt));
+    ip_packet[9] = b(6);
+    EXPECT_THAT(Ipv4Udp::parse(LinkType::Raw, ip_packet), Eq(cetl::nullopt));
+    ip_packet[9] = b(17);
+    ip_packet[6] = b(0x20);
+    EXPECT_THAT(Ipv4Udp::parse(LinkType::Raw, ip_packet), Eq(cetl::nullopt));
+}
+
+TEST_F(TestPcapng, replay_timeline)
+{
+    detail::ReplayTimeline recorded{ReplayMode::Recorded};
+    EXPECT_THAT(recorded.getDueTime(5ms, TimePoint{1ms}), TimePoint{1ms});
+
+    recorded.start(TimePoint{10ms}, 2ms);
+    recorded.start(TimePoint{20ms}, 3ms);  // no-op - already started
+    EXPECT_THAT(recorded.getDueTime(2ms, TimePoint{11ms}), TimePoint{10ms});
+    EXPECT_THAT(recorded.getDueTime(2'500'999ns, TimePoint{11ms}), TimePoint{10ms + 500us});
+    EXPECT_THAT(recorded.getDueTime(1ms, TimePoint{11ms}), TimePoint{10ms});
+
+    recorded.stop();
+    recorded.start(TimePoint{20ms}, 3ms);
+    EXPECT_THAT(recorded.getDueTime(5ms, TimePoint{20ms}), TimePoint{22ms});
+
+    detail::ReplayTimeline fast{ReplayMode::AsFastAsPossible};
+    fast.start(TimePoint{10ms}, 2ms);
+    EXPECT_THAT(fast.getDueTime(5ms, TimePoint{11ms}), TimePoint{11ms});
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
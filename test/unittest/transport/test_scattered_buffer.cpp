@@ -9,6 +9,7 @@
 #include <libcyphal/transport/scattered_buffer.hpp>
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
 #include <cetl/rtti.hpp>
 
 #include <gmock/gmock.h>
@@ -16,14 +17,19 @@
 
 #include <array>
 #include <utility>
+#include <vector>
 
 namespace
 {
 
 using namespace libcyphal::transport;  // NOLINT This our main concern here in the unit tests.
 
+using testing::_;
 using testing::IsNull;
+using testing::Invoke;
 using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
 using testing::NotNull;
 using testing::StrictMock;
 
@@ -98,6 +104,49 @@ TEST(TestScatteredBuffer, copy_reset)
     }
 }
 
+TEST(TestScatteredBuffer, observeFragments)
+{
+    struct FragmentsObserver final : ScatteredBuffer::IFragmentsObserver
+    {
+        void onNext(const cetl::span<const cetl::byte> fragment) override
+        {
+            fragments.push_back(fragment);
+        }
+        std::vector<cetl::span<const cetl::byte>> fragments;
+    };
+
+    const std::array<cetl::byte, 4> fragment0{};
+    const std::array<cetl::byte, 2> fragment1{};
+
+    StrictMock<ScatteredBufferStorageMock> storage_mock;
+    EXPECT_CALL(storage_mock, deinit()).Times(1);
+    EXPECT_CALL(storage_mock, moved()).Times(1 + 1);
+    EXPECT_CALL(storage_mock, observeFragments(_))  //
+        .WillOnce(Invoke([&](ScatteredBuffer::IFragmentsObserver& observer) {
+            observer.onNext(fragment0);
+            observer.onNext(fragment1);
+            return true;
+        }));
+    {
+        ScatteredBuffer src{ScatteredBufferStorageMock::Wrapper{&storage_mock}};  //< +1 move
+
+        FragmentsObserver observer;
+        EXPECT_TRUE(src.observeFragments(observer));
+        ASSERT_THAT(observer.fragments, SizeIs(2));
+        EXPECT_THAT(observer.fragments[0].data(), fragment0.data());
+        EXPECT_THAT(observer.fragments[0].size(), fragment0.size());
+        EXPECT_THAT(observer.fragments[1].data(), fragment1.data());
+        EXPECT_THAT(observer.fragments[1].size(), fragment1.size());
+
+        // Nothing to observe in the moved away buffer.
+        const ScatteredBuffer dst{std::move(src)};  //< +1 move
+        observer.fragments.clear();
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.Move,bugprone-use-after-move,hicpp-invalid-access-moved)
+        EXPECT_FALSE(src.observeFragments(observer));
+        EXPECT_THAT(observer.fragments, IsEmpty());
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
 }  // namespace
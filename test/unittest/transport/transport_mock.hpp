@@ -11,6 +11,7 @@
 #include <libcyphal/transport/errors.hpp>
 #include <libcyphal/transport/msg_sessions.hpp>
 #include <libcyphal/transport/svc_sessions.hpp>
+#include <libcyphal/transport/statistics.hpp>
 #include <libcyphal/transport/transport.hpp>
 #include <libcyphal/transport/types.hpp>
 #include <libcyphal/types.hpp>
@@ -34,6 +35,8 @@ public:
     TransportMock& operator=(TransportMock&&) noexcept = delete;
 
     MOCK_METHOD(ProtocolParams, getProtocolParams, (), (const, noexcept, override));
+    MOCK_METHOD(IoStatistics, getTransferStatistics, (), (const, noexcept, override));
+    MOCK_METHOD(cetl::optional<IoStatistics>, getMediaStatistics, (const std::uint8_t), (const, noexcept, override));
     MOCK_METHOD(cetl::optional<NodeId>, getLocalNodeId, (), (const, noexcept, override));
     MOCK_METHOD(cetl::optional<ArgumentError>, setLocalNodeId, (const NodeId), (noexcept, override));
     MOCK_METHOD((Expected<UniquePtr<IMessageRxSession>, AnyFailure>),
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -314,6 +315,47 @@ TEST_F(TestUdpDelegate, UdpardMemory_copy_multi_fragmented)
     }
 }
 
+TEST_F(TestUdpDelegate, UdpardMemory_observeFragments)
+{
+    using UdpardMemory = udp::detail::TransportDelegate::UdpardMemory;
+
+    struct FragmentsObserver final : ScatteredBuffer::IFragmentsObserver
+    {
+        void onNext(const cetl::span<const byte> fragment) override
+        {
+            fragments.emplace_back(fragment.begin(), fragment.end());
+        }
+        std::vector<std::vector<byte>> fragments;
+    };
+
+    TransportDelegateImpl delegate{general_mr_, &fragment_mr_, &payload_mr_};
+
+    auto* const payload0 = allocateNewUdpardPayload(7);
+
+    UdpardRxTransfer rx_transfer{};
+    rx_transfer.payload            = UdpardFragment{nullptr, {7, payload0}, {7, payload0}};
+    rx_transfer.payload.next       = allocateNewUdpardFragment(8);
+    rx_transfer.payload.next->next = allocateNewUdpardFragment(9);
+
+    auto* const payload2 = static_cast<byte*>(rx_transfer.payload.next->next->origin.data);
+    fillIotaBytes({payload0, 7}, b('0'));
+    fillIotaBytes({payload2, 9}, b('a'));
+
+    // The middle fragment is empty, and the last one is truncated by the total payload size (f.e. by extent).
+    rx_transfer.payload_size             = 3 + 2;
+    rx_transfer.payload.view             = {3, payload0 + 2};
+    rx_transfer.payload.next->view       = {0, nullptr};
+    rx_transfer.payload.next->next->view = {4, payload2 + 3};
+
+    const UdpardMemory udpard_memory{delegate, rx_transfer};
+
+    FragmentsObserver observer;
+    EXPECT_TRUE(udpard_memory.observeFragments(observer));
+    EXPECT_THAT(observer.fragments,
+                ElementsAre(ElementsAre(b('2'), b('3'), b('4')),  //
+                            ElementsAre(b('d'), b('e'))));
+}
+
 TEST_F(TestUdpDelegate, UdpardMemory_copy_empty)
 {
     using UdpardMemory = udp::detail::TransportDelegate::UdpardMemory;
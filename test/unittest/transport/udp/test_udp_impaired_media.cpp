@@ -0,0 +1,191 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "tx_rx_sockets_mock.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/impairment.hpp>
+#include <libcyphal/transport/udp/impaired_media.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using testing::_;
+using testing::Invoke;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpImpairedMedia : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        EXPECT_CALL(media_mock_, makeRxSocket(_))  //
+            .WillRepeatedly(Invoke([this](auto&) {
+                return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock_);
+            }));
+        EXPECT_CALL(rx_socket_mock_, registerCallback(_))  //
+            .WillRepeatedly(Invoke([this](auto function) {
+                inner_callback_ = scheduler_.registerCallback(std::move(function));
+                return IExecutor::Callback::Any{};
+            }));
+        EXPECT_CALL(rx_socket_mock_, receive())  //
+            .WillRepeatedly(Invoke([this]() -> IRxSocket::ReceiveResult::Type {
+                if (inner_datagrams_.empty())
+                {
+                    return cetl::nullopt;
+                }
+                auto datagram = std::move(inner_datagrams_.front());
+                inner_datagrams_.pop_front();
+                return datagram;
+            }));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Emulates arrival of a datagram (with a single byte payload) at the inner RX socket.
+    ///
+    void arrive(const std::uint8_t value)
+    {
+        auto* const buffer = static_cast<cetl::byte*>(mr_.allocate(1));
+        buffer[0]          = static_cast<cetl::byte>(value);
+        inner_datagrams_.push_back({now(), {buffer, libcyphal::PmrRawBytesDeleter{1, &mr_}}});
+        (void) inner_callback_.schedule(IExecutor::Callback::Schedule::Once{now()});
+    }
+
+    /// Registers callback which receives one datagram at a time (like the UDP transport does).
+    ///
+    IExecutor::Callback::Any registerReceiver(IRxSocket& rx_socket)
+    {
+        return rx_socket.registerCallback([this, &rx_socket](const auto&) {
+            //
+            auto        result  = rx_socket.receive();
+            auto* const success = cetl::get_if<IRxSocket::ReceiveResult::Success>(&result);
+            if ((success != nullptr) && success->has_value())
+            {
+                received_.emplace_back((*success)->timestamp,
+                                       static_cast<std::uint8_t>((*success)->payload_ptr.get()[0]));
+            }
+        });
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                 scheduler_{};
+    TrackingMemoryResource                          mr_;
+    StrictMock<MediaMock>                           media_mock_{};
+    StrictMock<RxSocketMock>                        rx_socket_mock_{"RxS1"};
+    IExecutor::Callback::Any                        inner_callback_;
+    std::deque<IRxSocket::ReceiveResult::Metadata>  inner_datagrams_;
+    std::vector<std::pair<TimePoint, std::uint8_t>> received_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpImpairedMedia, disabled_returns_inner_socket)
+{
+    ImpairedMedia impaired{mr_, scheduler_, media_mock_, Impairments{}};
+
+    auto maybe_rx_socket = impaired.makeRxSocket({0x11223344, 9382});
+    ASSERT_THAT(maybe_rx_socket, VariantWith<UniquePtr<IRxSocket>>(NotNull()));
+    auto rx_socket = cetl::get<UniquePtr<IRxSocket>>(std::move(maybe_rx_socket));
+
+    // No wrapper was allocated - just the inner socket.
+    EXPECT_THAT(mr_.allocations.size(), 1);
+
+    EXPECT_CALL(rx_socket_mock_, deinit());
+}
+
+TEST_F(TestUdpImpairedMedia, delay_and_duplicate)
+{
+    Impairments impairments{};
+    impairments.seed                  = 7;
+    impairments.delay                 = 3ms;
+    impairments.duplicate_probability = 1.0F;
+    ImpairedMedia impaired{mr_, scheduler_, media_mock_, impairments};
+
+    auto maybe_rx_socket = impaired.makeRxSocket({0x11223344, 9382});
+    ASSERT_THAT(maybe_rx_socket, VariantWith<UniquePtr<IRxSocket>>(NotNull()));
+    auto rx_socket = cetl::get<UniquePtr<IRxSocket>>(std::move(maybe_rx_socket));
+    auto callback  = registerReceiver(*rx_socket);
+
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        arrive(0x01);
+        arrive(0x02);
+    });
+    scheduler_.scheduleAt(3ms, [&](const auto&) {
+        //
+        EXPECT_THAT(received_, IsEmpty());
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_THAT(received_,
+                ElementsAre(std::make_pair(TimePoint{4ms}, 0x01),
+                            std::make_pair(TimePoint{4ms}, 0x01),
+                            std::make_pair(TimePoint{4ms}, 0x02),
+                            std::make_pair(TimePoint{4ms}, 0x02)));
+    EXPECT_THAT(impaired.getCounters().duplicated, 2);
+    EXPECT_THAT(impaired.getCounters().delayed, 4);
+    EXPECT_THAT(impaired.getCounters().passed, 4);
+
+    // Datagrams which are still delayed are released together with the socket.
+    scheduler_.scheduleAt(11ms, [&](const auto&) {
+        //
+        arrive(0x03);
+    });
+    scheduler_.spinFor(2ms);
+    EXPECT_THAT(received_.size(), 4);
+
+    EXPECT_CALL(rx_socket_mock_, deinit());
+    callback.reset();
+    rx_socket.reset();
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
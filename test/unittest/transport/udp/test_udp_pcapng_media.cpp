@@ -0,0 +1,292 @@
+/// @copyright
+/// Copyright (C) OpenCyphal Development Team  <opencyphal.org>
+/// Copyright Amazon.com Inc. or its affiliates.
+/// SPDX-License-Identifier: MIT
+
+#include "media_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "tx_rx_sockets_mock.hpp"
+#include "verification_utilities.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/pf20/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/pcapng.hpp>
+#include <libcyphal/transport/udp/capture_media.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/replay_media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using libcyphal::IExecutor;
+using libcyphal::TimePoint;
+using libcyphal::UniquePtr;
+using namespace libcyphal::transport;       // NOLINT This our main concern here in the unit tests.
+using namespace libcyphal::transport::udp;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::verification_utilities::b;
+
+using testing::_;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+using testing::ElementsAre;
+using testing::VariantWith;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+using std::literals::chrono_literals::operator""us;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpPcapngMedia : public testing::Test
+{
+protected:
+    class MemorySink final : public pcapng::ISink
+    {
+    public:
+        MemorySink()                                 = default;
+        ~MemorySink()                                = default;
+        MemorySink(const MemorySink&)                = delete;
+        MemorySink(MemorySink&&) noexcept            = delete;
+        MemorySink& operator=(const MemorySink&)     = delete;
+        MemorySink& operator=(MemorySink&&) noexcept = delete;
+
+        bool write(const cetl::span<const cetl::byte> data) override
+        {
+            bytes.insert(bytes.end(), data.begin(), data.end());
+            return true;
+        }
+
+        // NOLINTBEGIN
+        std::vector<cetl::byte> bytes;
+        // NOLINTEND
+
+    };  // MemorySink
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Writes a datagram (with a single byte payload) directly into the capture.
+    ///
+    void writeDatagram(const std::chrono::microseconds timestamp,
+                       const pcapng::Direction         direction,
+                       const IpEndpoint&               endpoint,
+                       const std::uint8_t              value)
+    {
+        if (!interface_id_.has_value())
+        {
+            interface_id_ = writer_.addInterface(pcapng::LinkType::Ipv4, 0xFFFF);
+        }
+        const std::array<cetl::byte, 1>                   payload{b(value)};
+        const std::array<cetl::span<const cetl::byte>, 1> fragments{payload};
+        const auto headers = pcapng::Ipv4Udp::makeHeaders(endpoint.ip_address, endpoint.udp_port, 0, payload.size());
+        EXPECT_TRUE(writer_.writePacket(*interface_id_, timestamp, direction, headers, fragments));
+    }
+
+    /// Registers callback which receives one datagram at a time (like the UDP transport does).
+    ///
+    IExecutor::Callback::Any registerReceiver(IRxSocket& rx_socket)
+    {
+        return rx_socket.registerCallback([this, &rx_socket](const auto&) {
+            //
+            auto        result  = rx_socket.receive();
+            auto* const success = cetl::get_if<IRxSocket::ReceiveResult::Success>(&result);
+            if ((success != nullptr) && success->has_value())
+            {
+                received_.emplace_back((*success)->timestamp,
+                                       static_cast<std::uint8_t>((*success)->payload_ptr.get()[0]));
+            }
+        });
+    }
+
+    static UniquePtr<IRxSocket> makeRxSocket(IMedia& media, const IpEndpoint& endpoint)
+    {
+        auto maybe_rx_socket = media.makeRxSocket(endpoint);
+        EXPECT_THAT(maybe_rx_socket, VariantWith<UniquePtr<IRxSocket>>(NotNull()));
+        return cetl::get<UniquePtr<IRxSocket>>(std::move(maybe_rx_socket));
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    libcyphal::VirtualTimeScheduler                 scheduler_{};
+    TrackingMemoryResource                          mr_;
+    MemorySink                                      sink_;
+    pcapng::Writer                                  writer_{sink_};
+    cetl::optional<std::uint32_t>                   interface_id_;
+    std::vector<std::pair<TimePoint, std::uint8_t>> received_;
+    const IpEndpoint                                endpoint_a_{0xEF000001, 9382};
+    const IpEndpoint                                endpoint_b_{0xEF000002, 9382};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestUdpPcapngMedia, capture)
+{
+    StrictMock<MediaMock>    media_mock{};
+    StrictMock<TxSocketMock> tx_socket_mock{"TxS1"};
+    StrictMock<RxSocketMock> rx_socket_mock{"RxS1"};
+    EXPECT_CALL(media_mock, makeTxSocket()).WillOnce([&] {
+        return libcyphal::detail::makeUniquePtr<TxSocketMock::RefWrapper::Spec>(mr_, tx_socket_mock);
+    });
+    EXPECT_CALL(media_mock, makeRxSocket(_)).WillOnce([&](auto&) {
+        return libcyphal::detail::makeUniquePtr<RxSocketMock::RefWrapper::Spec>(mr_, rx_socket_mock);
+    });
+
+    CaptureMedia capture{mr_, scheduler_, media_mock, writer_};
+
+    auto maybe_tx_socket = capture.makeTxSocket();
+    ASSERT_THAT(maybe_tx_socket, VariantWith<UniquePtr<ITxSocket>>(NotNull()));
+    auto tx_socket = cetl::get<UniquePtr<ITxSocket>>(std::move(maybe_tx_socket));
+    auto rx_socket = makeRxSocket(capture, endpoint_b_);
+
+    // Only accepted datagrams are captured.
+    scheduler_.scheduleAt(1ms, [&](const auto&) {
+        //
+        EXPECT_CALL(tx_socket_mock, send(_, _, _, _))
+            .WillOnce(Return(ITxSocket::SendResult::Success{true}))
+            .WillOnce(Return(ITxSocket::SendResult::Success{false}));
+
+        const std::array<cetl::byte, 2>                   part1{b(0x11), b(0x22)};
+        const std::array<cetl::byte, 1>                   part2{b(0x33)};
+        const std::array<cetl::span<const cetl::byte>, 2> fragments{part1, part2};
+        EXPECT_THAT(tx_socket->send(now() + 1s, endpoint_a_, 5, fragments),
+                    VariantWith<ITxSocket::SendResult::Success>(_));
+        EXPECT_THAT(tx_socket->send(now() + 1s, endpoint_a_, 5, fragments),
+                    VariantWith<ITxSocket::SendResult::Success>(_));
+    });
+    scheduler_.scheduleAt(2ms, [&](const auto&) {
+        //
+        EXPECT_CALL(rx_socket_mock, receive()).WillOnce([&]() -> IRxSocket::ReceiveResult::Type {
+            auto* const buffer = static_cast<cetl::byte*>(mr_.allocate(1));
+            buffer[0]          = b(0x44);
+            return IRxSocket::ReceiveResult::Metadata{now() - 100us, {buffer, libcyphal::PmrRawBytesDeleter{1, &mr_}}};
+        });
+        EXPECT_THAT(rx_socket->receive(), VariantWith<IRxSocket::ReceiveResult::Success>(_));
+    });
+    scheduler_.spinFor(10ms);
+
+    EXPECT_CALL(tx_socket_mock, deinit());
+    EXPECT_CALL(rx_socket_mock, deinit());
+    tx_socket.reset();
+    rx_socket.reset();
+
+    pcapng::Reader reader{sink_.bytes};
+
+    // NOLINTBEGIN(bugprone-unchecked-optional-access)
+    auto packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->link_type, pcapng::LinkType::Ipv4);
+    EXPECT_THAT(packet->timestamp, 1ms);
+    EXPECT_THAT(packet->direction, pcapng::Direction::Outbound);
+    EXPECT_THAT(static_cast<std::uint8_t>(packet->data[1]), 5 << 2);  // DSCP
+    auto datagram = pcapng::Ipv4Udp::parse(packet->link_type, packet->data);
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_THAT(datagram->ip_address, endpoint_a_.ip_address);
+    EXPECT_THAT(datagram->payload.size(), 3);
+
+    packet = reader.next();
+    ASSERT_TRUE(packet.has_value());
+    EXPECT_THAT(packet->timestamp, 1900us);
+    EXPECT_THAT(packet->direction, pcapng::Direction::Inbound);
+    datagram = pcapng::Ipv4Udp::parse(packet->link_type, packet->data);
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_THAT(datagram->ip_address, endpoint_b_.ip_address);
+    EXPECT_THAT(datagram->payload[0], b(0x44));
+    // NOLINTEND(bugprone-unchecked-optional-access)
+
+    EXPECT_THAT(reader.next(), testing::Eq(cetl::nullopt));
+}
+
+TEST_F(TestUdpPcapngMedia, replay_recorded)
+{
+    writeDatagram(1000us, pcapng::Direction::Inbound, endpoint_a_, 0x01);
+    writeDatagram(2000us, pcapng::Direction::Unknown, endpoint_b_, 0x02);
+    writeDatagram(2500us, pcapng::Direction::Outbound, endpoint_a_, 0x03);
+    writeDatagram(4000us, pcapng::Direction::Inbound, endpoint_a_, 0x04);
+
+    ReplayMedia replay{mr_, scheduler_, sink_.bytes, pcapng::ReplayMode::Recorded};
+
+    UniquePtr<IRxSocket>     rx_socket_a;
+    UniquePtr<IRxSocket>     rx_socket_b;
+    IExecutor::Callback::Any callback_a;
+    IExecutor::Callback::Any callback_b;
+    scheduler_.scheduleAt(10ms, [&](const auto&) {
+        //
+        rx_socket_a = makeRxSocket(replay, endpoint_a_);
+        callback_a  = registerReceiver(*rx_socket_a);
+    });
+    scheduler_.scheduleAt(12ms, [&](const auto&) {
+        //
+        // The timeline is shared by all sockets, so a late socket catches up immediately.
+        rx_socket_b = makeRxSocket(replay, endpoint_b_);
+        callback_b  = registerReceiver(*rx_socket_b);
+    });
+    scheduler_.spinFor(100ms);
+
+    EXPECT_THAT(received_,
+                ElementsAre(std::make_pair(TimePoint{10ms}, 0x01),
+                            std::make_pair(TimePoint{11ms}, 0x02),
+                            std::make_pair(TimePoint{13ms}, 0x04)));
+    EXPECT_THAT(replay.getDatagramsCount(), 3);
+
+    // TX sockets accept (and discard) everything.
+    auto maybe_tx_socket = replay.makeTxSocket();
+    ASSERT_THAT(maybe_tx_socket, VariantWith<UniquePtr<ITxSocket>>(NotNull()));
+    auto tx_socket = cetl::get<UniquePtr<ITxSocket>>(std::move(maybe_tx_socket));
+    EXPECT_THAT(tx_socket->getMtu(), ITxSocket::DefaultMtu);
+    EXPECT_THAT(tx_socket->send(now(), endpoint_a_, 0, {}), VariantWith<ITxSocket::SendResult::Success>(_));
+}
+
+TEST_F(TestUdpPcapngMedia, replay_as_fast_as_possible)
+{
+    writeDatagram(1000us, pcapng::Direction::Inbound, endpoint_a_, 0x01);
+    writeDatagram(2000us, pcapng::Direction::Inbound, endpoint_b_, 0x02);
+    writeDatagram(4000us, pcapng::Direction::Inbound, endpoint_a_, 0x03);
+
+    ReplayMedia replay{mr_, scheduler_, sink_.bytes, pcapng::ReplayMode::AsFastAsPossible};
+
+    UniquePtr<IRxSocket>     rx_socket;
+    IExecutor::Callback::Any callback;
+    scheduler_.scheduleAt(10ms, [&](const auto&) {
+        //
+        rx_socket = makeRxSocket(replay, endpoint_a_);
+        callback  = registerReceiver(*rx_socket);
+    });
+    scheduler_.spinFor(100ms);
+
+    EXPECT_THAT(received_,
+                ElementsAre(std::make_pair(TimePoint{10ms}, 0x01), std::make_pair(TimePoint{10ms}, 0x03)));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace